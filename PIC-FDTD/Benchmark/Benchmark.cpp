@@ -0,0 +1,293 @@
+//! \file
+//! \brief Micro-benchmark of the individual PIC kernels on a synthetic mesh
+//! \author Rahul Kalampattel
+//! \date Last updated June 2018
+//!
+//! Usage: Benchmark [key=value ...], where the available keys are
+//!   input            Input file used for all other parameters (inputs.txt)
+//!   cellsX, cellsY   Number of cells in each direction of the generated mesh (64, 64)
+//!   particlesPerCell Number of particles seeded in every cell (16)
+//!   repetitions      Number of timed calls to each kernel (10)
+//!   solver           Field solver type, GS or FFT (taken from input file)
+//!   fdtdIterations   Number of FDTD iterations per FDTD call (10)
+//!   shapeOrder       Particle shape order, 0 to 3 (taken from input file)
+//!   tileSize         Width of cell tiles for gather and deposition, 0 for none (taken from input file)
+//!   format           Output format, csv or json (csv)
+//!   output           Output file name, without extension (benchmark)
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../ChargeProjector.h"
+#include "../CurrentProjector.h"
+#include "../FDTD.h"
+#include "../FieldInterpolator.h"
+#include "../FieldSolver.h"
+#include "../FusedKernel.h"
+#include "../Mesh.h"
+#include "../Parameters.h"
+#include "../ParticlePusher.h"
+#include "../VectorParticle.h"
+
+//! \struct KernelResult
+//! \brief Timings of a single kernel over all repetitions
+struct KernelResult
+{
+	std::string name;				//!< Kernel name
+	long long workItems;			//!< Particles or nodes processed per call
+	std::vector<double> times;		//!< Duration of each call
+};
+
+
+// Time repeated calls to a kernel. If given, reset is called before each call,
+// outside the timed region, so that every call does the same work.
+KernelResult timeKernel(std::string name, long long workItems, int repetitions,
+	std::function<void()> kernel, std::function<void()> reset = nullptr)
+{
+	KernelResult result;
+	result.name = name;
+	result.workItems = workItems;
+
+	for (int i = 0; i < repetitions; i++)
+	{
+		if (reset)
+		{
+			reset();
+		}
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		kernel();
+		std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+		result.times.push_back(duration.count());
+	}
+
+	return result;
+}
+
+
+// Write results in CSV or JSON format
+void writeResults(std::string filename, std::string format, int cellsX, int cellsY,
+	int numParticles, int numThreads, std::vector<KernelResult>& results)
+{
+	std::ofstream outputFile(filename);
+	outputFile << std::scientific << std::setprecision(8);
+
+	if (format == "json")
+	{
+		outputFile << "{" << std::endl;
+		outputFile << "  \"cellsX\": " << cellsX << ", \"cellsY\": " << cellsY <<
+			", \"particles\": " << numParticles << ", \"threads\": " << numThreads <<
+			"," << std::endl;
+		outputFile << "  \"kernels\": [" << std::endl;
+	}
+	else
+	{
+		outputFile << "kernel,cellsX,cellsY,particles,threads,repetitions,workItems,"
+			"minTime,meanTime,maxTime,itemsPerSecond" << std::endl;
+	}
+
+	for (unsigned int i = 0; i < results.size(); i++)
+	{
+		std::vector<double>& times = results[i].times;
+		double minTime = *std::min_element(times.begin(), times.end());
+		double maxTime = *std::max_element(times.begin(), times.end());
+		double meanTime = 0.0;
+		for (unsigned int j = 0; j < times.size(); j++)
+		{
+			meanTime += times[j] / static_cast<double>(times.size());
+		}
+		double throughput = minTime > 0.0 ? results[i].workItems / minTime : 0.0;
+
+		if (format == "json")
+		{
+			outputFile << "    {\"kernel\": \"" << results[i].name << "\", \"repetitions\": " <<
+				times.size() << ", \"workItems\": " << results[i].workItems <<
+				", \"minTime\": " << minTime << ", \"meanTime\": " << meanTime <<
+				", \"maxTime\": " << maxTime << ", \"itemsPerSecond\": " << throughput <<
+				"}" << (i + 1 < results.size() ? "," : "") << std::endl;
+		}
+		else
+		{
+			outputFile << results[i].name << "," << cellsX << "," << cellsY << "," <<
+				numParticles << "," << numThreads << "," << times.size() << "," <<
+				results[i].workItems << "," << minTime << "," << meanTime << "," <<
+				maxTime << "," << throughput << std::endl;
+		}
+	}
+
+	if (format == "json")
+	{
+		outputFile << "  ]" << std::endl;
+		outputFile << "}" << std::endl;
+	}
+
+	outputFile.close();
+}
+
+
+int main(int argc, char *argv[])
+{
+	// Default benchmark settings, which may be overridden by key=value arguments
+	std::string input = "inputs.txt", solver = "", format = "csv", output = "benchmark";
+	int cellsX = 64, cellsY = 64, particlesPerCell = 16, repetitions = 10, fdtdIterations = 10;
+	int shapeOrder = -1, tileSize = -1;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string argument = argv[i];
+		size_t split = argument.find('=');
+		if (split == std::string::npos)
+		{
+			std::cout << "Ignoring argument " << argument << ", expected key=value" << std::endl;
+			continue;
+		}
+
+		std::string key = argument.substr(0, split), value = argument.substr(split + 1);
+		if (key == "input")					input = value;
+		else if (key == "cellsX")			cellsX = std::stoi(value);
+		else if (key == "cellsY")			cellsY = std::stoi(value);
+		else if (key == "particlesPerCell")	particlesPerCell = std::stoi(value);
+		else if (key == "repetitions")		repetitions = std::max(1, std::stoi(value));
+		else if (key == "solver")			solver = value;
+		else if (key == "fdtdIterations")	fdtdIterations = std::stoi(value);
+		else if (key == "shapeOrder")		shapeOrder = std::stoi(value);
+		else if (key == "tileSize")			tileSize = std::stoi(value);
+		else if (key == "format")			format = value;
+		else if (key == "output")			output = value;
+		else std::cout << "Ignoring unknown argument " << key << std::endl;
+	}
+
+	// Read remaining parameters from input file. Benchmark settings replace the
+	// raw inputs first, so that they are checked like any other input.
+	Parameters parametersList(input);
+	std::vector<std::pair<std::string, std::string>> overrides = { { "userMesh", "1" },
+		{ "particlesPerCell", std::to_string(particlesPerCell) }, { "particleDistribution", "random" },
+		{ "FDTDiterations", std::to_string(fdtdIterations) } };
+	if (solver != "")
+	{
+		overrides.push_back({ "solverType", solver });
+	}
+	if (shapeOrder >= 0)
+	{
+		overrides.push_back({ "shapeOrder", std::to_string(shapeOrder) });
+	}
+	if (tileSize >= 0)
+	{
+		overrides.push_back({ "tileSize", std::to_string(tileSize) });
+	}
+	for (unsigned int i = 0; i < overrides.size(); i++)
+	{
+		if (!parametersList.overrideInput(overrides[i].first, overrides[i].second))
+		{
+			parametersList.logBrief("Input file has no " + overrides[i].first + " input to override", 3);
+		}
+	}
+	parametersList.assignInputs();
+
+	// Generate a uniform synthetic mesh with particles in every cell
+	parametersList.domainLength = cellsX * parametersList.PICspacing;
+	parametersList.domainHeight = cellsY * parametersList.PICspacing;
+	parametersList.numCellsWithParticles = cellsX * cellsY;
+
+	if (parametersList.numErrors != 0)
+	{
+		parametersList.logMessages("Benchmark exited UNSUCCESSFULLY", __FILENAME__, __LINE__, 1);
+		return -1;
+	}
+
+	std::vector<KernelResult> results;
+
+	// Mesh generation, loading and processing
+	results.push_back(timeKernel("meshLoad", cellsX * cellsY, repetitions, [&]()
+	{
+		Parameters trialParameters = parametersList;
+		trialParameters.processMesh("PIC");
+		Mesh trialMesh(&trialParameters, "PIC");
+	}));
+
+	parametersList.processMesh("PIC");
+	Mesh mesh(&parametersList, "PIC");
+	VectorParticle particlesVector(&parametersList, &mesh, 1);
+	int numParticles = particlesVector.numParticles;
+	FieldSolver fieldSolver;
+
+	results.push_back(timeKernel("deposition", numParticles, repetitions, [&]()
+	{
+		ChargeProjector projector(&parametersList, &mesh, &particlesVector);
+	}));
+
+	results.push_back(timeKernel("solve" + parametersList.solverType, mesh.numNodes, repetitions, [&]()
+	{
+		mesh.nodesVector.clearPhi();
+		fieldSolver.solvePotential(&parametersList, &mesh);
+	}));
+
+	results.push_back(timeKernel("fieldFromPhi", mesh.numNodes, repetitions, [&]()
+	{
+		fieldSolver.calculateFields(&parametersList, &mesh);
+	}));
+
+	results.push_back(timeKernel("gather", numParticles, repetitions, [&]()
+	{
+		FieldInterpolator interpolator(&parametersList, &mesh, &particlesVector);
+	}));
+
+	// Kernels which move particles start each call from the same particles
+	const VectorParticle initialParticles = particlesVector;
+	const VectorCell initialCells = mesh.cellsVector;
+	std::function<void()> resetParticles = [&]()
+	{
+		particlesVector = initialParticles;
+		mesh.cellsVector = initialCells;
+		mesh.tilesVector.binsValid = false;
+	};
+
+	// A non-zero time is passed to skip the initial half step of the leapfrog
+	results.push_back(timeKernel("borisPush", numParticles, repetitions, [&]()
+	{
+		ParticlePusher pusher(&parametersList, &mesh, &particlesVector, parametersList.timeStep);
+	}, resetParticles));
+
+	// The FDTD mesh is generated once and kept between calls, as in a patch
+	FDTD fdtd(&parametersList, &mesh);
+
+	// Uses the old and new positions from a single push
+	if (parametersList.currentDeposition == "esirkepov" && !parametersList.axisymmetric)
+	{
+		resetParticles();
+		ParticlePusher pusher(&parametersList, &mesh, &particlesVector, parametersList.timeStep);
+		results.push_back(timeKernel("esirkepovCurrent", numParticles, repetitions, [&]()
+		{
+			CurrentProjector currentProjector(&parametersList, &fdtd.FDTDmesh, &particlesVector);
+		}));
+	}
+	else
+	{
+		parametersList.logBrief("Skipping esirkepovCurrent, which requires Esirkepov current deposition "
+			"on a Cartesian user-defined mesh", 2);
+	}
+
+	// Gather, push and charge deposition in a single pass, to compare against
+	// the sum of the separate kernels above
+	results.push_back(timeKernel("fusedKernel", numParticles, repetitions, [&]()
+	{
+		FusedKernel fused(&parametersList, &mesh, &fdtd.FDTDmesh, &particlesVector);
+	}, resetParticles));
+	resetParticles();
+
+	results.push_back(timeKernel("fdtdStep", mesh.numNodes, repetitions, [&]()
+	{
+		fdtd.solveFields(&parametersList, &mesh);
+	}));
+
+	std::string filename = output + (format == "json" ? ".json" : ".csv");
+	writeResults(filename, format, cellsX, cellsY, numParticles, parametersList.numThreads, results);
+	parametersList.logMessages("Benchmark results written to " + filename, __FILENAME__, __LINE__, 1);
+
+	return parametersList.numErrors == 0 ? 0 : -1;
+}
@@ -9,6 +9,7 @@
 //
 
 #include "LeRc.hpp"
+#include "../COMM/common.hpp"
 #include <cmath>
 
 
@@ -28,10 +29,6 @@ LeRc::~LeRc()
 
 void LeRc::read(const int num, const std::vector<std::string>& line)
 {
-    int s = 0;
-    double temp0, temp1, temp2, temp3, temp4, temp5, temp6, temp7, temp8, temp9;
-    double tempT1, tempTu, temphf;
-    
     lvl = num;
     hf.resize(lvl+2);
     T1.resize(lvl+2);
@@ -96,10 +93,6 @@ void LeRc::read(const int num, const std::vector<std::string>& line)
 
 void LeRc::read(const std::vector<std::string>& line)
 {
-    int s = 0;
-    double temp0, temp1, temp2, temp3, temp4, temp5, temp6, temp7, temp8, temp9;
-    double tempT1, tempTu, temphf;
-    
     hf.resize(lvl+2);
     T1.resize(lvl+2);
     Tu.resize(lvl+2);
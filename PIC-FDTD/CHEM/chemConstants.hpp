@@ -3,7 +3,7 @@
 //  OP2A
 //
 //  Created by Kim M.K. on 28/11/2016.
-//  Last edited by Rahul Kalampattel, March 2018
+//  Last edited by Rahul Kalampattel, June 2018
 // 
 //  Copyright © 2016 Kim M.K. All rights reserved.
 //
@@ -29,4 +29,6 @@
 
 #define K_B 1.38064852e-23
 
+#define PI	3.14159265358979323846
+
 #endif /* chemConstants_h */
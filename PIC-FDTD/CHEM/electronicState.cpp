@@ -9,6 +9,7 @@
 //
 
 #include "electronicState.hpp"
+#include "../COMM/common.hpp"
 
 
 electronicState::electronicState()
@@ -9,6 +9,7 @@
 //
 
 #include "kev.hpp"
+#include "../COMM/common.hpp"
 
 
 relaxation_rate_e_v::relaxation_rate_e_v()
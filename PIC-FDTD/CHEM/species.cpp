@@ -15,7 +15,7 @@
 
 // 1. Basic DATA
 speciesBasic::speciesBasic()
-: M(0), m(0), h0(0), D(0), I(0), q(0), type(0), R(0), m_completed(false)
+: M(0), m(0), h0(0), D(0), I(0), q(0), R(0), type(0), m_completed(false)
 {
     
 }
@@ -206,7 +206,7 @@ double species::Cv_ele(double T)
 
 double species::Cv(double T, int mode)
 {
-    double aux;
+    double aux = 0.0;
     switch (mode)
     {
         case 0:
@@ -288,7 +288,7 @@ double species::e_ele(double T)
 
 double species::e(double T, int mode)
 {
-    double aux;
+    double aux = 0.0;
     switch (mode)
     {
         case 0:
@@ -35,6 +35,14 @@
 #include "commonAPI.hpp"
 
 
+// sscanf_s is only provided by the Microsoft C runtime. Elsewhere sscanf is
+// used instead, so sscanf_s must only be used with numeric conversions (string
+// conversions would need buffer size arguments, which sscanf does not take)
+#ifndef _MSC_VER
+    #define sscanf_s sscanf
+#endif
+
+
 
 /*
  * Common holds classes that abstract the Operating System
@@ -18,7 +18,7 @@
 namespace Common {
 
 processor_info_MIC::processor_info_MIC()
-    :num_CPU(-1), taskID(-1), num_threads(-1), num_MIC(-1),
+    :num_CPU(-1), num_MIC(-1), taskID(-1), num_threads(-1),
 	 m_set_CPU(false), m_set_MIC(false)
 {
 	for (int i = 0; i <= MAX_MIC_PER_NODE-1; i++) MIC_ID[i] = -1;
@@ -27,7 +27,7 @@ processor_info_MIC::processor_info_MIC()
 
 
 processor_info_MIC::processor_info_MIC(int nthreads_CPU, int nMIC)
-    :num_CPU(-1), taskID(-1), num_threads(nthreads_CPU), num_MIC(nMIC)
+    :num_CPU(-1), num_MIC(nMIC), taskID(-1), num_threads(nthreads_CPU)
 {
 	for (int i = 0; i <= MAX_MIC_PER_NODE-1; i++) MIC_ID[i] = i;
 	for (int i = 0; i <= MAX_MIC_PER_NODE-1; i++) num_threads_MIC[i] = -1;
@@ -38,9 +38,9 @@ processor_info_MIC::processor_info_MIC(int nthreads_CPU, int nMIC)
 
 
 processor_info_MIC::processor_info_MIC(int nthreads_CPU, int nMIC, std::vector<int> i_MIC_ID)
-    :num_CPU(-1), taskID(-1), num_threads(nthreads_CPU), num_MIC(nMIC)
+    :num_CPU(-1), num_MIC(nMIC), taskID(-1), num_threads(nthreads_CPU)
 {
-	if (i_MIC_ID.size() < nMIC)	Common::ExceptionError(FromHere(), "Problem in number of MIC per node", Common::ErrorCodes::ExceedLimit());
+	if (static_cast<int>(i_MIC_ID.size()) < nMIC)	Common::ExceptionError(FromHere(), "Problem in number of MIC per node", Common::ErrorCodes::ExceedLimit());
 
 	for (int i = 0; i <= nMIC; i++) MIC_ID[i] = i_MIC_ID[i];
 	for (int i = 0; i <= 3; i++) num_threads_MIC[i] = -1;
@@ -1,3 +1,5 @@
+#ifdef _WIN32
+
 #include "times.h"
 
 int gettimeofday(struct timeval* t,void* timezone)
@@ -15,4 +17,6 @@ clock_t times (struct tms *__buffer) {
 	__buffer->tms_cstime = 0;
 	__buffer->tms_cutime = 0;
 	return __buffer->tms_utime;
-}
\ No newline at end of file
+}
+
+#endif
@@ -81,6 +81,7 @@ namespace Common {
 
 	double TimeInfoUsage::seconds() const
 	{
+#ifdef _WIN32
 		HANDLE hProcess = GetCurrentProcess();
 		FILETIME ftCreation, ftExit, ftKernel, ftUser;
 		SYSTEMTIME stUser;
@@ -89,6 +90,12 @@ namespace Common {
 		FileTimeToSystemTime(&ftUser, &stUser);
 
 		return (stUser.wSecond + (stUser.wMilliseconds / 1000));
+#else
+		struct rusage usage;
+		getrusage(RUSAGE_SELF, &usage);
+
+		return (usage.ru_utime.tv_sec + usage.ru_utime.tv_usec * 1.0e-6);
+#endif
 	}
 
 	void TimeInfoUsage::initStartTime()
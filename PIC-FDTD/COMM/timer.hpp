@@ -16,8 +16,12 @@
 
 
 #include <time.h>
+#ifdef _WIN32
 #include "sys/time.h"
-//#include <sys/resource.h>
+#else
+#include <sys/time.h>
+#include <sys/resource.h>
+#endif
 
 #include "common.hpp"
 
@@ -1,5 +1,5 @@
 //! \file
-//! \brief Implementation of Cells class 
+//! \brief Implementation of Cells and CellGeometry classes 
 //! \author Rahul Kalampattel
 //! \date Last updated February 2018
 
@@ -11,8 +11,20 @@ Cells::Cells()
 }
 
 
+// Destructor
+Cells::~Cells()
+{
+}
+
+
+// Default constructor
+CellGeometry::CellGeometry()
+{
+}
+
+
 // Constructor
-Cells::Cells(CellBase baseCell)
+CellGeometry::CellGeometry(CellBase baseCell)
 {
 	this->connectivity = baseCell.connectivity;
 	this->geometry = baseCell.geometry;
@@ -20,6 +32,6 @@ Cells::Cells(CellBase baseCell)
 
 
 // Destructor
-Cells::~Cells()
+CellGeometry::~CellGeometry()
 {
 }
\ No newline at end of file
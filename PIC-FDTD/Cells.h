@@ -1,15 +1,20 @@
 //! \file
-//! \brief Definition of Cells class 
+//! \brief Definition of Cells and CellGeometry classes 
 //! \author Rahul Kalampattel
 //! \date Last updated March 2018
 
 #pragma once
 
-#include "GRID\cell.hpp"
+#include <string>
+#include <vector>
 
-//! \class Cells
-//! \brief Contains cell properties, derived from CellBase
-class Cells : public CellBase
+#include "GRID/cell.hpp"
+#include "Nodes.h"
+
+//! \class CellGeometry
+//! \brief Bounds and connectivity of a cell, derived from CellBase. These do
+//! not change once the mesh is generated, so are shared by copies of the mesh.
+class CellGeometry : public CellBase
 {
 public:
 	// Data members
@@ -23,14 +28,29 @@ public:
 	int bottomCellID = -1;				//!< ID of adjacent bottom (down) cell
 	int periodicX1CellID = -1;			//!< ID of periodic cell, x/z direction (not valid for internal cells)
 	int	periodicX2CellID = -1;			//!< ID of periodic cell, y/r direction (not valid for internal cells and axisymmetric cases)
-	std::string boundaryType;			//!< Position on boundary (internal if FALSE)
-	std::string firstNodePosition;		//!< Position of first node
+	BoundaryType boundaryType =
+		boundaryInternal;				//!< Position on boundary
+	BoundaryType firstNodePosition =
+		boundaryInternal;				//!< Position of first node
+
+
+	// Constructor/destructor
+	CellGeometry();						//!< Default constructor
+	CellGeometry(CellBase baseCell);	//!< Constructor
+	~CellGeometry();					//!< Destructor
+};
+
+//! \class Cells
+//! \brief Contains the particles in a cell, which are updated by each patch
+class Cells
+{
+public:
+	// Data members
 	std::vector<int> listOfParticles;	//!< List of particles in the cell
 
 
 	// Constructor/destructor
 	Cells();							//!< Default constructor
-	Cells(CellBase baseCell);			//!< Constructor
 	~Cells();							//!< Destructor
 
 
@@ -12,64 +12,74 @@ ChargeProjector::ChargeProjector()
 
 // Constructor
 ChargeProjector::ChargeProjector(Parameters *parametersList,
-	Mesh *mesh, VectorParticle *particlesVector)
+	Mesh *mesh, VectorParticle *particlesVector, bool depositCharge)
 {
-	// Set charge at all nodes to zero at the start of each step
-	mesh->nodesVector.clearChargeAndCurrent();
+	// Set charge at all nodes to zero at the start of each step, current is
+	// kept if it was projected during the last push. Charge is also kept if
+	// it was already deposited by the fused kernel.
+	bool directCurrent = parametersList->currentDeposition == "direct";
+	if (directCurrent && depositCharge)
+	{
+		mesh->nodesVector.clearChargeAndCurrent();
+	}
+	else if (directCurrent)
+	{
+		mesh->nodesVector.clearCurrent();
+	}
+	else if (depositCharge)
+	{
+		mesh->nodesVector.clearCharge();
+	}
 
 	double hSquared = mesh->h * mesh->h;
 
-	// Project charge to nodes
-	for (int i = 0; i < particlesVector->numParticles; i++)
+	// Project charge to nodes, with the stencil of the particle's cell for CIC
+	// or of a structured mesh (which may be split into tiles) for other orders
+	if (depositCharge && mesh->tilesVector.tileSize > 0)
 	{
-		// TODO: Can change all of the below to references to avoid copying large 
-		// amounts of data for each calculation
-
-		int cellID = particlesVector->particleVector[i].cellID - 1;
-		int nodeID_0 = mesh->cellsVector.cells[cellID].connectivity.nodeIDs[0] - 1;
-		int nodeID_1 = mesh->cellsVector.cells[cellID].connectivity.nodeIDs[1] - 1;
-		int nodeID_2 = mesh->cellsVector.cells[cellID].connectivity.nodeIDs[2] - 1;
-		int nodeID_3 = mesh->cellsVector.cells[cellID].connectivity.nodeIDs[3] - 1;
-
-		double left = mesh->cellsVector.cells[cellID].left;
-		double right = mesh->cellsVector.cells[cellID].right;
-		double top = mesh->cellsVector.cells[cellID].top;
-		double bottom = mesh->cellsVector.cells[cellID].bottom;
-		
-		double x1 = particlesVector->particleVector[i].position[0];
-		double x2 = particlesVector->particleVector[i].position[1];
-
-		std::string firstNodePosition = mesh->cellsVector.cells[cellID].firstNodePosition;
-		double charge = particlesVector->particleVector[i].basic.q;
-
-		if (firstNodePosition == "TL")
+		switch (parametersList->shapeOrder)
 		{
-			mesh->nodesVector.nodes[nodeID_0].charge += charge * (right - x1) * (x2 - bottom) / hSquared;
-			mesh->nodesVector.nodes[nodeID_1].charge += charge * (right - x1) * (top - x2) / hSquared;
-			mesh->nodesVector.nodes[nodeID_2].charge += charge * (x1 - left) * (top - x2) / hSquared;
-			mesh->nodesVector.nodes[nodeID_3].charge += charge * (x1 - left) * (x2 - bottom) / hSquared;
+		case shapeNGP:
+			projectChargeTiled<shapeNGP>(parametersList, mesh, particlesVector);
+			break;
+		case shapeTSC:
+			projectChargeTiled<shapeTSC>(parametersList, mesh, particlesVector);
+			break;
+		case shapeCubic:
+			projectChargeTiled<shapeCubic>(parametersList, mesh, particlesVector);
+			break;
+		default:
+			projectChargeTiled<shapeCIC>(parametersList, mesh, particlesVector);
+			break;
 		}
-		else if (firstNodePosition == "BL")
-		{
-			mesh->nodesVector.nodes[nodeID_0].charge += charge * (right - x1) * (top - x2) / hSquared;
-			mesh->nodesVector.nodes[nodeID_1].charge += charge * (x1 - left) * (top - x2) / hSquared;
-			mesh->nodesVector.nodes[nodeID_2].charge += charge * (x1 - left) * (x2 - bottom) / hSquared;
-			mesh->nodesVector.nodes[nodeID_3].charge += charge * (right - x1) * (x2 - bottom) / hSquared;
-
-		}
-		else if (firstNodePosition == "BR")
+	}
+	else if (depositCharge)
+	{
+		switch (parametersList->shapeOrder)
 		{
-			mesh->nodesVector.nodes[nodeID_0].charge += charge * (x1 - left) * (top - x2) / hSquared;
-			mesh->nodesVector.nodes[nodeID_1].charge += charge * (x1 - left) * (x2 - bottom) / hSquared;
-			mesh->nodesVector.nodes[nodeID_2].charge += charge * (right - x1) * (x2 - bottom) / hSquared;
-			mesh->nodesVector.nodes[nodeID_3].charge += charge * (right - x1) * (top - x2) / hSquared;
+		case shapeNGP:
+			projectCharge<shapeNGP>(parametersList, mesh, particlesVector);
+			break;
+		case shapeTSC:
+			projectCharge<shapeTSC>(parametersList, mesh, particlesVector);
+			break;
+		case shapeCubic:
+			projectCharge<shapeCubic>(parametersList, mesh, particlesVector);
+			break;
+		default:
+			projectCharge<shapeCIC>(parametersList, mesh, particlesVector);
+			break;
 		}
-		else if (firstNodePosition == "TR")
+	}
+
+	// Total statistical weight of the simulated electrons, which sets the
+	// neutralising background once particles have been merged or split
+	double totalWeight = 0.0;
+	if (parametersList->simulationType == "electron")
+	{
+		for (int i = 0; i < particlesVector->numParticles; i++)
 		{
-			mesh->nodesVector.nodes[nodeID_0].charge += charge * (x1 - left) * (x2 - bottom) / hSquared;
-			mesh->nodesVector.nodes[nodeID_1].charge += charge * (right - x1) * (x2 - bottom) / hSquared;
-			mesh->nodesVector.nodes[nodeID_2].charge += charge * (right - x1) * (top - x2) / hSquared;
-			mesh->nodesVector.nodes[nodeID_3].charge += charge * (x1 - left) * (top - x2) / hSquared;
+			totalWeight += particlesVector->particleVector[i].weight;
 		}
 	}
 
@@ -82,21 +92,21 @@ ChargeProjector::ChargeProjector(Parameters *parametersList,
 			// electrons are modelled. In order to maintain a quasi-neutral plasma,
 			// we assume fixed ions at the nodes, providing a neutralising background 
 			// charge density.
-			mesh->nodesVector.nodes[i].charge -= (particlesVector->numParticles * 
+			mesh->nodesVector.nodes[i].charge -= (totalWeight * 
 				ELECTRON_CHARGE / mesh->numNodes);
 		}
 
 		// For cylindrical case, need to account for changing cell volume
 		if (parametersList->axisymmetric == true)
 		{
-			int bottomNodeID = mesh->nodesVector.nodes[i].bottomNodeID - 1;
+			int bottomNodeID = mesh->node(i).bottomNodeID - 1;
 			if (bottomNodeID >= 0)
 			{
 				mesh->nodesVector.nodes[i].rho = mesh->nodesVector.nodes[i].charge /
-					std::_Pi * mesh->h * (mesh->nodesVector.nodes[i].geometry.X.element(1, 0) *
-						mesh->nodesVector.nodes[i].geometry.X.element(1, 0) -
-						mesh->nodesVector.nodes[bottomNodeID].geometry.X.element(1, 0) *
-						mesh->nodesVector.nodes[bottomNodeID].geometry.X.element(1, 0));
+					PI * mesh->h * (mesh->node(i).geometry.X(1) *
+						mesh->node(i).geometry.X(1) -
+						mesh->node(bottomNodeID).geometry.X(1) *
+						mesh->node(bottomNodeID).geometry.X(1));
 			}
 			else
 			{
@@ -104,17 +114,17 @@ ChargeProjector::ChargeProjector(Parameters *parametersList,
 				mesh->nodesVector.nodes[i].rho = 0.0;
 			}
 		}
-		else
+		else if (!mesh->structured)
 		{
 			// Cartesian case, assume unit cell depth
-			if (mesh->nodesVector.nodes[i].boundaryType == "internal")
+			if (mesh->node(i).boundaryType == boundaryInternal)
 			{
 				mesh->nodesVector.nodes[i].rho = mesh->nodesVector.nodes[i].charge / hSquared;
 			}
-			else if (mesh->nodesVector.nodes[i].boundaryType == "L" ||
-				mesh->nodesVector.nodes[i].boundaryType == "R" || 
-				mesh->nodesVector.nodes[i].boundaryType == "T" || 
-				mesh->nodesVector.nodes[i].boundaryType == "B")
+			else if (mesh->node(i).boundaryType == boundaryL ||
+				mesh->node(i).boundaryType == boundaryR || 
+				mesh->node(i).boundaryType == boundaryT || 
+				mesh->node(i).boundaryType == boundaryB)
 			{
 				mesh->nodesVector.nodes[i].rho = mesh->nodesVector.nodes[i].charge / (0.5 * hSquared);
 			}
@@ -125,6 +135,22 @@ ChargeProjector::ChargeProjector(Parameters *parametersList,
 		}
 	}
 
+	// Cartesian case on a structured mesh, where nodes on each edge of the
+	// domain have half a cell and those in the corners a quarter
+	if (!parametersList->axisymmetric && mesh->structured)
+	{
+		for (int column = 0; column < mesh->numColumns + 1; column++)
+		{
+			double columnArea = (column == 0 || column == mesh->numColumns) ? 0.5 * hSquared : hSquared;
+			int first = mesh->nodeIndex(column, 0), last = mesh->nodeIndex(column, mesh->numRows);
+			for (int i = first; i < last + 1; i++)
+			{
+				double area = (i == first || i == last) ? 0.5 * columnArea : columnArea;
+				mesh->nodesVector.nodes[i].rho = mesh->nodesVector.nodes[i].charge / area;
+			}
+		}
+	}
+
 	double sumT = 0.0;
 	for (int i = 0; i < mesh->numNodes; i++)
 	{
@@ -132,161 +158,130 @@ ChargeProjector::ChargeProjector(Parameters *parametersList,
 	}
 	sumT += 0.0;
 
-	// Account for periodic BCs 
-	for (int i = 0; i < mesh->numNodes; i++)
-	{
-		if (parametersList->leftBCType == "periodic")	// Periodic left implies periodic right
-		{
-			if (mesh->nodesVector.nodes[i].boundaryType == "TL" ||
-				mesh->nodesVector.nodes[i].boundaryType == "L" ||
-				mesh->nodesVector.nodes[i].boundaryType == "BL")
-			{
-				mesh->nodesVector.nodes[i].rho = 0.5 * (mesh->nodesVector.nodes[i].rho +
-					mesh->nodesVector.nodes[mesh->nodesVector.nodes[i].periodicX1NodeID - 1].rho);
-				mesh->nodesVector.nodes[mesh->nodesVector.nodes[i].periodicX1NodeID - 1].rho =
-					mesh->nodesVector.nodes[i].rho;
-			}
-		}
-		if (parametersList->topBCType == "periodic")	// Periodic top implies periodic bottom
-		{
-			if (mesh->nodesVector.nodes[i].boundaryType == "TL" ||
-				mesh->nodesVector.nodes[i].boundaryType == "T" ||
-				mesh->nodesVector.nodes[i].boundaryType == "TR")
-			{
-				mesh->nodesVector.nodes[i].rho = 0.5 * (mesh->nodesVector.nodes[i].rho +
-					mesh->nodesVector.nodes[mesh->nodesVector.nodes[i].periodicX2NodeID - 1].rho);
-				mesh->nodesVector.nodes[mesh->nodesVector.nodes[i].periodicX2NodeID - 1].rho =
-					mesh->nodesVector.nodes[i].rho;
-			}
-		}
-	}
+	// Account for periodic BCs, where periodic left implies periodic right and
+	// periodic top implies periodic bottom
+	mesh->averagePeriodic(&Nodes::rho, parametersList->leftBCType == bcPeriodic,
+		parametersList->topBCType == bcPeriodic);
 
 	// TODO: Current calculation involves velocity, which at present in calculated 
 	// at half time-steps, i.e. current is also calculated at half time-steps. 
 	// Need to make sure this is ok for use with FDTD. If not, can average between
 	// velocity and oldVelocity, like in EK calculation (VectorParticle).
 
-	// Project current to nodes
-	for (int i = 0; i < particlesVector->numParticles; i++)
+	// Project current to nodes, unless it is projected during the push
+	if (!directCurrent)
 	{
-		// TODO: Can change all of the below to references to avoid copying large 
-		// amounts of data for each calculation, or make a template to use same
-		// variables as in charge projection?
+		parametersList->logBrief("Charge projector exited", 1);
+		return;
+	}
 
-		int cellID = particlesVector->particleVector[i].cellID - 1;
-		int nodeID_0 = mesh->cellsVector.cells[cellID].connectivity.nodeIDs[0] - 1;
-		int nodeID_1 = mesh->cellsVector.cells[cellID].connectivity.nodeIDs[1] - 1;
-		int nodeID_2 = mesh->cellsVector.cells[cellID].connectivity.nodeIDs[2] - 1;
-		int nodeID_3 = mesh->cellsVector.cells[cellID].connectivity.nodeIDs[3] - 1;
+	switch (parametersList->shapeOrder)
+	{
+	case shapeNGP:
+		projectCurrent<shapeNGP>(parametersList, mesh, particlesVector);
+		break;
+	case shapeTSC:
+		projectCurrent<shapeTSC>(parametersList, mesh, particlesVector);
+		break;
+	case shapeCubic:
+		projectCurrent<shapeCubic>(parametersList, mesh, particlesVector);
+		break;
+	default:
+		projectCurrent<shapeCIC>(parametersList, mesh, particlesVector);
+		break;
+	}
+	parametersList->logBrief("Charge projector exited", 1);
+}
 
-		double left = mesh->cellsVector.cells[cellID].left;
-		double right = mesh->cellsVector.cells[cellID].right;
-		double top = mesh->cellsVector.cells[cellID].top;
-		double bottom = mesh->cellsVector.cells[cellID].bottom;
 
-		double x1 = particlesVector->particleVector[i].position[0];
-		double x2 = particlesVector->particleVector[i].position[1];
+// Destructor
+ChargeProjector::~ChargeProjector()
+{
+}
 
-		double v1 = particlesVector->particleVector[i].velocity[0];
-		double v2 = particlesVector->particleVector[i].velocity[1];
 
-		std::string firstNodePosition = mesh->cellsVector.cells[cellID].firstNodePosition;
-		double charge = particlesVector->particleVector[i].basic.q;
+// Project charge to nodes with a B-spline shape, taking CIC weights from the
+// particle's cell so that any quadrilateral mesh is supported
+template <int Order>
+void ChargeProjector::projectCharge(Parameters *parametersList, Mesh *mesh,
+	VectorParticle *particlesVector)
+{
+	bool periodicX1 = parametersList->leftBCType == bcPeriodic;
+	bool periodicX2 = parametersList->topBCType == bcPeriodic;
 
-		if (firstNodePosition == "BL")
+	for (int i = 0; i < particlesVector->numParticles; i++)
+	{
+		double charge = particlesVector->particleVector[i].basic.q * particlesVector->particleVector[i].weight;
+		ParticleStencil<Order>::apply(mesh, particlesVector->particleVector[i].cellID,
+			particlesVector->particleVector[i].position[0],
+			particlesVector->particleVector[i].position[1], periodicX1, periodicX2,
+			[&](int nodeID, double weight)
 		{
-			mesh->nodesVector.nodes[nodeID_0].current[0] += mesh->nodesVector.nodes[nodeID_0].rho * 
-				v1 * (right - x1) * (top - x2) / hSquared;
-			mesh->nodesVector.nodes[nodeID_0].current[1] += mesh->nodesVector.nodes[nodeID_0].rho *
-				v2 * (right - x1) * (top - x2) / hSquared;
+			mesh->nodesVector.nodes[nodeID].charge += charge * weight;
+		});
+	}
+}
 
-			mesh->nodesVector.nodes[nodeID_1].current[0] += mesh->nodesVector.nodes[nodeID_1].rho * 
-				v1 * (x1 - left) * (top - x2) / hSquared;
-			mesh->nodesVector.nodes[nodeID_1].current[1] += mesh->nodesVector.nodes[nodeID_1].rho *
-				v2 * (x1 - left) * (top - x2) / hSquared;
 
-			mesh->nodesVector.nodes[nodeID_2].current[0] += mesh->nodesVector.nodes[nodeID_2].rho * 
-				v1 * (x1 - left) * (x2 - bottom) / hSquared;
-			mesh->nodesVector.nodes[nodeID_2].current[1] += mesh->nodesVector.nodes[nodeID_2].rho *
-				v2 * (x1 - left) * (x2 - bottom) / hSquared;
+// Project charge to nodes tile by tile. Each tile deposits into its own
+// accumulator, so tiles (or groups of tiles, once balanced) are processed in
+// parallel as separate tasks. Halo nodes are shared between neighbouring
+// tiles, so accumulators are merged once all tiles are done.
+template <int Order>
+void ChargeProjector::projectChargeTiled(Parameters *parametersList, Mesh *mesh,
+	VectorParticle *particlesVector)
+{
+	VectorTile &tilesVector = mesh->tilesVector;
+	tilesVector.updateBins(mesh, particlesVector);
 
-			mesh->nodesVector.nodes[nodeID_3].current[0] += mesh->nodesVector.nodes[nodeID_3].rho *
-				v1 * (right - x1) * (x2 - bottom) / hSquared;
-			mesh->nodesVector.nodes[nodeID_3].current[1] += mesh->nodesVector.nodes[nodeID_3].rho *
-				v2 * (right - x1) * (x2 - bottom) / hSquared;
-		}
-		else if (firstNodePosition == "BR")
+	TaskGraph graph;
+	std::vector<int> tileTasks = tilesVector.addTasks(graph, [=](Tiles &tile)
+	{
+		tile.clearCharge();
+		for (unsigned int i = 0; i < tile.listOfParticles.size(); i++)
 		{
-			mesh->nodesVector.nodes[nodeID_0].current[0] += mesh->nodesVector.nodes[nodeID_0].rho * 
-				v1 * (x1 - left) * (top - x2) / hSquared;
-			mesh->nodesVector.nodes[nodeID_0].current[1] += mesh->nodesVector.nodes[nodeID_0].rho *
-				v2 * (x1 - left) * (top - x2) / hSquared;
-
-			mesh->nodesVector.nodes[nodeID_1].current[0] += mesh->nodesVector.nodes[nodeID_1].rho * 
-				v1 * (x1 - left) * (x2 - bottom) / hSquared;
-			mesh->nodesVector.nodes[nodeID_1].current[1] += mesh->nodesVector.nodes[nodeID_1].rho *
-				v2 * (x1 - left) * (x2 - bottom) / hSquared;
-
-			mesh->nodesVector.nodes[nodeID_2].current[0] += mesh->nodesVector.nodes[nodeID_2].rho * 
-				v1 * (right - x1) * (x2 - bottom) / hSquared;
-			mesh->nodesVector.nodes[nodeID_2].current[1] += mesh->nodesVector.nodes[nodeID_2].rho *
-				v2 * (right - x1) * (x2 - bottom) / hSquared;
-
-			mesh->nodesVector.nodes[nodeID_3].current[0] += mesh->nodesVector.nodes[nodeID_3].rho * 
-				v1 * (right - x1) * (top - x2) / hSquared;
-			mesh->nodesVector.nodes[nodeID_3].current[1] += mesh->nodesVector.nodes[nodeID_3].rho *
-				v2 * (right - x1) * (top - x2) / hSquared;
+			const Particle &particle = particlesVector->particleVector[tile.listOfParticles[i]];
+			double charge = particle.basic.q * particle.weight;
+			applyTileStencil<Order>(mesh, tile, particle.position[0], particle.position[1],
+				[&](int localID, double weight)
+			{
+				tile.charge[localID] += charge * weight;
+			});
 		}
-		else if (firstNodePosition == "TR")
-		{
-			mesh->nodesVector.nodes[nodeID_0].current[0] += mesh->nodesVector.nodes[nodeID_0].rho * 
-				v1 * (x1 - left) * (x2 - bottom) / hSquared;
-			mesh->nodesVector.nodes[nodeID_0].current[1] += mesh->nodesVector.nodes[nodeID_0].rho *
-				v2 * (x1 - left) * (x2 - bottom) / hSquared;
-
-			mesh->nodesVector.nodes[nodeID_1].current[0] += mesh->nodesVector.nodes[nodeID_1].rho * 
-				v1 * (right - x1) * (x2 - bottom) / hSquared;
-			mesh->nodesVector.nodes[nodeID_1].current[1] += mesh->nodesVector.nodes[nodeID_1].rho *
-				v2 * (right - x1) * (x2 - bottom) / hSquared;
-
-			mesh->nodesVector.nodes[nodeID_2].current[0] += mesh->nodesVector.nodes[nodeID_2].rho * 
-				v1 * (right - x1) * (top - x2) / hSquared;
-			mesh->nodesVector.nodes[nodeID_2].current[1] += mesh->nodesVector.nodes[nodeID_2].rho *
-				v2 * (right - x1) * (top - x2) / hSquared;
+	});
 
-			mesh->nodesVector.nodes[nodeID_3].current[0] += mesh->nodesVector.nodes[nodeID_3].rho * 
-				v1 * (x1 - left) * (top - x2) / hSquared;
-			mesh->nodesVector.nodes[nodeID_3].current[1] += mesh->nodesVector.nodes[nodeID_3].rho *
-				v2 * (x1 - left) * (top - x2) / hSquared;
-		}
-		else if (firstNodePosition == "TL")
+	graph.addTask([=]()
+	{
+		for (unsigned int k = 0; k < mesh->tilesVector.tiles.size(); k++)
 		{
-			mesh->nodesVector.nodes[nodeID_0].current[0] += mesh->nodesVector.nodes[nodeID_0].rho * 
-				v1 * (right - x1) * (x2 - bottom) / hSquared;
-			mesh->nodesVector.nodes[nodeID_0].current[1] += mesh->nodesVector.nodes[nodeID_0].rho *
-				v2 * (right - x1) * (x2 - bottom) / hSquared;
-
-			mesh->nodesVector.nodes[nodeID_1].current[0] += mesh->nodesVector.nodes[nodeID_1].rho * 
-				v1 * (right - x1) * (top - x2) / hSquared;
-			mesh->nodesVector.nodes[nodeID_1].current[1] += mesh->nodesVector.nodes[nodeID_1].rho *
-				v2 * (right - x1) * (top - x2) / hSquared;
-
-			mesh->nodesVector.nodes[nodeID_2].current[0] += mesh->nodesVector.nodes[nodeID_2].rho * 
-				v1 * (x1 - left) * (top - x2) / hSquared;
-			mesh->nodesVector.nodes[nodeID_2].current[1] += mesh->nodesVector.nodes[nodeID_2].rho *
-				v2 * (x1 - left) * (top - x2) / hSquared;
-
-			mesh->nodesVector.nodes[nodeID_3].current[0] += mesh->nodesVector.nodes[nodeID_3].rho * 
-				v1 * (x1 - left) * (x2 - bottom) / hSquared;
-			mesh->nodesVector.nodes[nodeID_3].current[1] += mesh->nodesVector.nodes[nodeID_3].rho *
-				v2 * (x1 - left) * (x2 - bottom) / hSquared;
+			mesh->tilesVector.tiles[k].mergeCharge(mesh->nodesVector);
 		}
-	}
-	parametersList->logBrief("Charge projector exited", 1);
+	}, tileTasks);
+
+	graph.run(parametersList->numThreads);
 }
 
 
-// Destructor
-ChargeProjector::~ChargeProjector()
+// Project current to nodes with a B-spline shape
+template <int Order>
+void ChargeProjector::projectCurrent(Parameters *parametersList, Mesh *mesh,
+	VectorParticle *particlesVector)
 {
-}
\ No newline at end of file
+	bool periodicX1 = parametersList->leftBCType == bcPeriodic;
+	bool periodicX2 = parametersList->topBCType == bcPeriodic;
+
+	for (int i = 0; i < particlesVector->numParticles; i++)
+	{
+		double v1 = particlesVector->particleVector[i].velocity[0] * particlesVector->particleVector[i].weight;
+		double v2 = particlesVector->particleVector[i].velocity[1] * particlesVector->particleVector[i].weight;
+		ParticleStencil<Order>::apply(mesh, particlesVector->particleVector[i].cellID,
+			particlesVector->particleVector[i].position[0],
+			particlesVector->particleVector[i].position[1], periodicX1, periodicX2,
+			[&](int nodeID, double weight)
+		{
+			Nodes &node = mesh->nodesVector.nodes[nodeID];
+			node.current[0] += node.rho * v1 * weight;
+			node.current[1] += node.rho * v2 * weight;
+		});
+	}
+}
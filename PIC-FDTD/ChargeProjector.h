@@ -7,6 +7,8 @@
 
 #include "Mesh.h"
 #include "Parameters.h"
+#include "ShapeFunction.h"
+#include "TaskGraph.h"
 #include "VectorParticle.h"
 
 //! \class ChargeProjector
@@ -20,10 +22,19 @@ public:
 	// Constructor/destructor
 	ChargeProjector();									//!< Default constructor
 	ChargeProjector(Parameters *parametersList,
-		Mesh *mesh, VectorParticle *particlesVector);	//!< Constructor
+		Mesh *mesh, VectorParticle *particlesVector,
+		bool depositCharge = true);						//!< Constructor
 	~ChargeProjector();									//!< Destructor
 
 
 	// Methods
-
+	template <int Order>
+	void projectCharge(Parameters *parametersList, Mesh *mesh,
+		VectorParticle *particlesVector);				//!< Project charge to nodes with a B-spline shape
+	template <int Order>
+	void projectChargeTiled(Parameters *parametersList, Mesh *mesh,
+		VectorParticle *particlesVector);				//!< Project charge to nodes tile by tile
+	template <int Order>
+	void projectCurrent(Parameters *parametersList, Mesh *mesh,
+		VectorParticle *particlesVector);				//!< Project current to nodes with a B-spline shape
 };
\ No newline at end of file
@@ -0,0 +1,333 @@
+//! \file
+//! \brief Implementation of CurrentProjector class
+//! \author Rahul Kalampattel
+//! \date Last updated June 2018
+
+#include "CurrentProjector.h"
+
+// Map an index onto [0, numIntervals) for periodic boundaries, where the last
+// node coincides with the first
+static int wrapIndex(int index, int numIntervals)
+{
+	return ((index % numIntervals) + numIntervals) % numIntervals;
+}
+
+
+// Size and clear the current arrays
+void EdgeGrid::allocate()
+{
+	currentX.assign((numColumns + 1) * (numRows + 1), 0.0);
+	currentY.assign((numColumns + 1) * (numRows + 1), 0.0);
+}
+
+
+// Current along the edge to the right of a node, 0 for edges outside the grid
+double EdgeGrid::edgeX(int column, int row) const
+{
+	if (periodicX1)
+	{
+		column = wrapIndex(column, numColumns);
+	}
+	else if (column < 0 || column >= numColumns)
+	{
+		return 0.0;
+	}
+	if (periodicX2)
+	{
+		row = wrapIndex(row, numRows);
+	}
+	else if (row < 0 || row > numRows)
+	{
+		return 0.0;
+	}
+	return currentX[index(column, row)];
+}
+
+
+// Current along the edge below a node, 0 for edges outside the grid
+double EdgeGrid::edgeY(int column, int row) const
+{
+	if (periodicX1)
+	{
+		column = wrapIndex(column, numColumns);
+	}
+	else if (column < 0 || column > numColumns)
+	{
+		return 0.0;
+	}
+	if (periodicX2)
+	{
+		row = wrapIndex(row, numRows);
+	}
+	else if (row < 0 || row >= numRows)
+	{
+		return 0.0;
+	}
+	return currentY[index(column, row)];
+}
+
+
+// Default constructor
+CurrentProjector::CurrentProjector()
+{
+}
+
+
+// Constructor
+CurrentProjector::CurrentProjector(Parameters *parametersList,
+	Mesh *FDTDmesh, VectorParticle *particlesVector)
+{
+	std::vector<EdgeGrid> lattices = yeeLattices(parametersList, FDTDmesh);
+
+	switch (parametersList->shapeOrder)
+	{
+	case shapeNGP:
+		projectCurrent<shapeNGP>(parametersList, particlesVector, lattices);
+		break;
+	case shapeTSC:
+		projectCurrent<shapeTSC>(parametersList, particlesVector, lattices);
+		break;
+	case shapeCubic:
+		projectCurrent<shapeCubic>(parametersList, particlesVector, lattices);
+		break;
+	default:
+		projectCurrent<shapeCIC>(parametersList, particlesVector, lattices);
+		break;
+	}
+
+	copyToFDTD(lattices, FDTDmesh);
+
+	parametersList->logBrief("Current projector exited", 1);
+}
+
+
+// Destructor
+CurrentProjector::~CurrentProjector()
+{
+}
+
+
+// Empty edge grids of the two Yee lattices of an FDTD mesh. The first has its
+// nodes on the B nodes in even columns and rows of the FDTD mesh, the second
+// on those in odd columns and rows, and both have twice the FDTD mesh spacing.
+std::vector<EdgeGrid> CurrentProjector::yeeLattices(Parameters *parametersList,
+	const Mesh *FDTDmesh)
+{
+	std::vector<EdgeGrid> lattices(2);
+	for (int k = 0; k < 2; k++)
+	{
+		EdgeGrid &grid = lattices[k];
+		grid.periodicX1 = parametersList->leftBCType == bcPeriodic;
+		grid.periodicX2 = parametersList->topBCType == bcPeriodic;
+		grid.originX1 = FDTDmesh->node(0).geometry.X(0) + k * FDTDmesh->h;
+		grid.originX2 = FDTDmesh->node(0).geometry.X(1) - k * FDTDmesh->h;
+		grid.h = 2.0 * FDTDmesh->h;
+
+		// Without wrapping, the odd lattice has one node fewer in each direction
+		grid.numColumns = FDTDmesh->numColumns / 2 - ((k == 1 && !grid.periodicX1) ? 1 : 0);
+		grid.numRows = FDTDmesh->numRows / 2 - ((k == 1 && !grid.periodicX2) ? 1 : 0);
+		grid.allocate();
+	}
+	return lattices;
+}
+
+
+// Set the current at each E node of the FDTD mesh from the edge of the Yee
+// lattice passing through it, in x and y. B nodes carry no current.
+void CurrentProjector::copyToFDTD(const std::vector<EdgeGrid> &lattices, Mesh *FDTDmesh)
+{
+	const EdgeGrid &even = lattices[0], &odd = lattices[1];
+
+	for (int column = 0; column < FDTDmesh->numColumns + 1; column++)
+	{
+		for (int row = 0; row < FDTDmesh->numRows + 1; row++)
+		{
+			int nodeID = FDTDmesh->nodeIndex(column, row);
+			std::vector<double> &current = FDTDmesh->nodesVector.nodes[nodeID].current;
+
+			if (nodeID % 2 == 0)
+			{
+				current = { 0.0, 0.0 };
+			}
+			else if (column % 2 == 1)
+			{
+				current[0] = even.edgeX((column - 1) / 2, row / 2);
+				current[1] = odd.edgeY((column - 1) / 2, row / 2 - 1);
+			}
+			else
+			{
+				current[0] = odd.edgeX(column / 2 - 1, (row - 1) / 2);
+				current[1] = even.edgeY(column / 2, (row - 1) / 2);
+			}
+		}
+	}
+}
+
+
+// Project current of all particles with a B-spline shape, with each thread
+// depositing into its own copy of the lattices
+template <int Order>
+void CurrentProjector::projectCurrent(Parameters *parametersList,
+	VectorParticle *particlesVector, std::vector<EdgeGrid> &lattices)
+{
+	# pragma omp parallel num_threads(parametersList->numThreads)
+	{
+		std::vector<EdgeGrid> local = lattices;
+
+		# pragma omp for
+		for (int i = 0; i < particlesVector->numParticles; i++)
+		{
+			for (unsigned int k = 0; k < local.size(); k++)
+			{
+				depositCurrent<Order>(parametersList, particlesVector->particleVector[i], local[k]);
+			}
+		}
+
+		# pragma omp critical
+		{
+			for (unsigned int k = 0; k < lattices.size(); k++)
+			{
+				for (unsigned int j = 0; j < lattices[k].currentX.size(); j++)
+				{
+					lattices[k].currentX[j] += local[k].currentX[j];
+					lattices[k].currentY[j] += local[k].currentY[j];
+				}
+			}
+		}
+	}
+}
+
+
+// Deposit the current of a single particle to the edges of a grid. Moves of
+// more than one grid cell are split into equal segments of less than a cell.
+template <int Order>
+void CurrentProjector::depositCurrent(Parameters *parametersList,
+	const Particle &particle, EdgeGrid &grid)
+{
+	// Columns are numbered from the left and rows from the top
+	double u0 = (particle.oldPosition[0] - grid.originX1) / grid.h;
+	double v0 = (grid.originX2 - particle.oldPosition[1]) / grid.h;
+	double u1 = (particle.position[0] - grid.originX1) / grid.h;
+	double v1 = (grid.originX2 - particle.position[1]) / grid.h;
+
+	// Undo any shift across a periodic boundary
+	if (grid.periodicX1 && std::abs(u1 - u0) > 0.5 * grid.numColumns)
+	{
+		u0 += (u1 > u0) ? grid.numColumns : -grid.numColumns;
+	}
+	if (grid.periodicX2 && std::abs(v1 - v0) > 0.5 * grid.numRows)
+	{
+		v0 += (v1 > v0) ? grid.numRows : -grid.numRows;
+	}
+
+	// A position which is no longer finite, e.g. after an unstable FDTD
+	// solve, cannot be split into segments
+	if (!std::isfinite(u1) || !std::isfinite(v1))
+	{
+		return;
+	}
+
+	int numSegments = static_cast<int>(std::max(std::abs(u1 - u0), std::abs(v1 - v0))) + 1;
+	double uStart = u0, vStart = v0;
+	for (int s = 1; s < numSegments + 1; s++)
+	{
+		double uEnd = (s == numSegments) ? u1 : u0 + (u1 - u0) * s / numSegments;
+		double vEnd = (s == numSegments) ? v1 : v0 + (v1 - v0) * s / numSegments;
+		depositSegment<Order>(parametersList, particle, grid, uStart, vStart, uEnd, vEnd);
+		uStart = uEnd;
+		vStart = vEnd;
+	}
+}
+
+
+// Deposit the current of a move of less than one cell, following Esirkepov
+// (2001). The change in the particle's shape is split into x and y
+// contributions, which are summed along each direction to give edge currents
+// whose divergence exactly matches the change in deposited charge.
+template <int Order>
+void CurrentProjector::depositSegment(Parameters *parametersList,
+	const Particle &particle, EdgeGrid &grid, double u0, double v0, double u1, double v1)
+{
+	const int support = ShapeFunction<Order>::support;
+	const int width = support + 1;
+
+	int firstColumn0, firstColumn1, firstRow0, firstRow1;
+	double wColumn0[support], wColumn1[support], wRow0[support], wRow1[support];
+	ShapeFunction<Order>::weights(u0, firstColumn0, wColumn0);
+	ShapeFunction<Order>::weights(u1, firstColumn1, wColumn1);
+	ShapeFunction<Order>::weights(v0, firstRow0, wRow0);
+	ShapeFunction<Order>::weights(v1, firstRow1, wRow1);
+
+	// Old and new shapes on a common stencil
+	int baseColumn = std::min(firstColumn0, firstColumn1);
+	int baseRow = std::min(firstRow0, firstRow1);
+	double sx0[width] = {}, sx1[width] = {}, sy0[width] = {}, sy1[width] = {};
+	for (int a = 0; a < support; a++)
+	{
+		sx0[firstColumn0 - baseColumn + a] = wColumn0[a];
+		sx1[firstColumn1 - baseColumn + a] = wColumn1[a];
+		sy0[firstRow0 - baseRow + a] = wRow0[a];
+		sy1[firstRow1 - baseRow + a] = wRow1[a];
+	}
+
+	double factor = -particle.basic.q * particle.weight / (grid.h * parametersList->timeStep);
+
+	// Current in x, accumulated from left to right along each row. Edges
+	// outside a non-periodic grid join folded nodes, so carry no current.
+	for (int b = 0; b < width; b++)
+	{
+		int row = grid.periodicX2 ? wrapIndex(baseRow + b, grid.numRows) :
+			stencilIndex(baseRow + b, grid.numRows, false);
+		double weightY = sy0[b] + 0.5 * (sy1[b] - sy0[b]);
+		double flux = 0.0;
+		for (int a = 0; a < width - 1; a++)
+		{
+			flux += factor * (sx1[a] - sx0[a]) * weightY;
+			int column = baseColumn + a;
+			if (grid.periodicX1)
+			{
+				column = wrapIndex(column, grid.numColumns);
+			}
+			else if (column < 0 || column >= grid.numColumns)
+			{
+				continue;
+			}
+			grid.currentX[grid.index(column, row)] += flux;
+		}
+	}
+
+	// Current in y, accumulated from top to bottom along each column, with
+	// the sign changed since rows are numbered downwards
+	for (int a = 0; a < width; a++)
+	{
+		int column = grid.periodicX1 ? wrapIndex(baseColumn + a, grid.numColumns) :
+			stencilIndex(baseColumn + a, grid.numColumns, false);
+		double weightX = sx0[a] + 0.5 * (sx1[a] - sx0[a]);
+		double flux = 0.0;
+		for (int b = 0; b < width - 1; b++)
+		{
+			flux += factor * (sy1[b] - sy0[b]) * weightX;
+			int row = baseRow + b;
+			if (grid.periodicX2)
+			{
+				row = wrapIndex(row, grid.numRows);
+			}
+			else if (row < 0 || row >= grid.numRows)
+			{
+				continue;
+			}
+			grid.currentY[grid.index(column, row)] -= flux;
+		}
+	}
+}
+
+
+// Instantiations used outside this file (FusedKernel)
+template void CurrentProjector::depositCurrent<shapeNGP>(Parameters *parametersList,
+	const Particle &particle, EdgeGrid &grid);
+template void CurrentProjector::depositCurrent<shapeCIC>(Parameters *parametersList,
+	const Particle &particle, EdgeGrid &grid);
+template void CurrentProjector::depositCurrent<shapeTSC>(Parameters *parametersList,
+	const Particle &particle, EdgeGrid &grid);
+template void CurrentProjector::depositCurrent<shapeCubic>(Parameters *parametersList,
+	const Particle &particle, EdgeGrid &grid);
@@ -0,0 +1,76 @@
+//! \file
+//! \brief Definition of CurrentProjector class
+//! \author Rahul Kalampattel
+//! \date Last updated June 2018
+
+#pragma once
+
+#include <vector>
+
+#include "Mesh.h"
+#include "Parameters.h"
+#include "ShapeFunction.h"
+#include "VectorParticle.h"
+
+//! \struct EdgeGrid
+//! \brief Uniform grid of nodes, with the current along the edge to the right
+//! of (x) and below (y) each node. Columns are numbered from the left and rows
+//! from the top, as on a structured mesh.
+struct EdgeGrid
+{
+	double originX1 = 0.0;				//!< Cartesian x/cylindrical z position of the top left node
+	double originX2 = 0.0;				//!< Cartesian y/cylindrical r position of the top left node
+	double h = 0.0;						//!< Grid spacing
+	int numColumns = 0;					//!< Number of cell columns
+	int numRows = 0;					//!< Number of cell rows
+	bool periodicX1 = false;			//!< Periodic in x, where the last node coincides with the first
+	bool periodicX2 = false;			//!< Periodic in y, where the last node coincides with the first
+	std::vector<double> currentX;		//!< Current along the edge to the right of each node
+	std::vector<double> currentY;		//!< Current along the edge below each node
+
+
+	// Methods
+	int index(int column, int row) const
+	{ return column * (numRows + 1) + row; }	//!< Index of node
+	void allocate();							//!< Size and clear the current arrays
+	double edgeX(int column, int row) const;	//!< Current to the right of a node, 0 outside the grid
+	double edgeY(int column, int row) const;	//!< Current below a node, 0 outside the grid
+};
+
+//! \class CurrentProjector
+//! \brief Charge-conserving (Esirkepov) projection of current, based on the old
+//! and new particle positions of the last push. Current is deposited straight
+//! onto the FDTD mesh, which holds E and B on alternate nodes in a checkerboard.
+//! The B nodes form two interleaved Yee lattices with the FDTD spacing, whose
+//! edge midpoints are the E nodes, so the current of each lattice is deposited
+//! with the Esirkepov stencil at that spacing and read by the FDTD solver as is.
+class CurrentProjector
+{
+public:
+	// Data members
+
+
+	// Constructor/destructor
+	CurrentProjector();									//!< Default constructor
+	CurrentProjector(Parameters *parametersList,
+		Mesh *FDTDmesh, VectorParticle *particlesVector);	//!< Constructor
+	~CurrentProjector();								//!< Destructor
+
+
+	// Methods
+	static std::vector<EdgeGrid> yeeLattices(Parameters *parametersList,
+		const Mesh *FDTDmesh);							//!< Empty edge grids of the two Yee lattices of an FDTD mesh
+	static void copyToFDTD(const std::vector<EdgeGrid> &lattices,
+		Mesh *FDTDmesh);								//!< Set the current at each E node of the FDTD mesh
+	template <int Order>
+	void projectCurrent(Parameters *parametersList,
+		VectorParticle *particlesVector,
+		std::vector<EdgeGrid> &lattices);				//!< Project current of all particles with a B-spline shape
+	template <int Order>
+	static void depositCurrent(Parameters *parametersList,
+		const Particle &particle, EdgeGrid &grid);		//!< Deposit the current of a single particle to the edges of a grid
+	template <int Order>
+	static void depositSegment(Parameters *parametersList,
+		const Particle &particle, EdgeGrid &grid,
+		double u0, double v0, double u1, double v1);	//!< Deposit the current of a move of less than one cell
+};
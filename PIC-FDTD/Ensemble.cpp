@@ -0,0 +1,184 @@
+//! \file
+//! \brief Implementation of Ensemble class
+//! \author Rahul Kalampattel
+//! \date Last updated June 2018
+
+#include "Ensemble.h"
+
+// Remove leading and trailing whitespace
+static std::string trim(const std::string &text)
+{
+	size_t first = text.find_first_not_of(" \t\r");
+	if (first == std::string::npos)
+	{
+		return "";
+	}
+	size_t last = text.find_last_not_of(" \t\r");
+	return text.substr(first, last - first + 1);
+}
+
+
+// Check whether two parameter lists generate the same PIC mesh
+static bool sameMesh(const Parameters &first, const Parameters &second)
+{
+	return first.userMesh == second.userMesh &&
+		first.domainLength == second.domainLength &&
+		first.domainHeight == second.domainHeight &&
+		first.PICspacing == second.PICspacing &&
+		first.meshFilePath == second.meshFilePath &&
+		first.meshScalingParameter == second.meshScalingParameter &&
+		first.leftBCType == second.leftBCType &&
+		first.topBCType == second.topBCType &&
+		first.tileSize == second.tileSize;
+}
+
+
+// Default constructor
+Ensemble::Ensemble()
+{
+}
+
+
+// Constructor, which runs every case as a task, numThreads at a time. Each
+// case runs its own patches on the thread it is given.
+Ensemble::Ensemble(Parameters *parametersList)
+{
+	parametersList->logMessages("Starting ensemble", __FILENAME__, __LINE__, 1);
+
+	readCases(parametersList);
+	caseErrors.assign(cases.size(), 0);
+
+	if (parametersList->numErrors == 0)
+	{
+		Mesh baseMesh(parametersList, "PIC");
+
+		TaskGraph graph;
+		for (unsigned int i = 0; i < cases.size(); i++)
+		{
+			graph.addTask([this, parametersList, &baseMesh, i]()
+			{
+				runCase(parametersList, &baseMesh, i);
+			});
+		}
+		graph.run(parametersList->numThreads);
+
+		for (unsigned int i = 0; i < cases.size(); i++)
+		{
+			numErrors += caseErrors[i];
+			if (caseErrors[i] != 0)
+			{
+				parametersList->logBrief("Case " + cases[i].name + " exited with " +
+					std::to_string(caseErrors[i]) + " errors", 2);
+			}
+		}
+	}
+	numErrors += parametersList->numErrors;
+	parametersList->numErrors = numErrors;
+
+	parametersList->logMessages("Ensemble of " + std::to_string(cases.size()) +
+		" cases complete", __FILENAME__, __LINE__, 1);
+}
+
+
+// Destructor
+Ensemble::~Ensemble()
+{
+}
+
+
+// Read cases from the ensemble file. Each case starts with a line naming it,
+// e.g. "case: beam1", followed by lines in the same format as the input file
+// for each input which differs from it.
+void Ensemble::readCases(Parameters *parametersList)
+{
+	std::ifstream ensembleFile(parametersList->ensembleFile);
+	std::string line;
+	while (std::getline(ensembleFile, line))
+	{
+		line = trim(line);
+		if (line.empty() || line.front() == '%')
+		{
+			continue;
+		}
+
+		size_t colon = line.find(':');
+		if (colon == std::string::npos)
+		{
+			parametersList->logBrief("Ensemble file line \"" + line + "\" is not of the form name: value", 3);
+			continue;
+		}
+		std::string name = trim(line.substr(0, colon));
+		std::string value = trim(line.substr(colon + 1));
+
+		if (name == "case")
+		{
+			cases.push_back(EnsembleCase());
+			cases.back().name = value;
+		}
+		else if (cases.empty())
+		{
+			parametersList->logBrief("Input " + name + " in ensemble file precedes the first case", 3);
+		}
+		else
+		{
+			cases.back().overrides.push_back(std::make_pair(name, value));
+		}
+	}
+
+	if (cases.empty())
+	{
+		parametersList->logBrief("No cases found in ensemble file", 3);
+	}
+	parametersList->logBrief("Number of ensemble cases: " + std::to_string(cases.size()), 1);
+}
+
+
+// Set up and run a single case. The case starts from a copy of the input file
+// parameters, with its overrides applied and its inputs reassigned. Output
+// files are prefixed with the case name, and random numbers are drawn from a
+// stream seeded by the case number.
+void Ensemble::runCase(Parameters *parametersList, const Mesh *baseMesh, int caseID)
+{
+	EnsembleCase &ensembleCase = cases[caseID];
+	Parameters caseParameters = *parametersList;
+	caseParameters.numErrors = 0;
+
+	caseParameters.logMessages("Starting case " + ensembleCase.name, __FILENAME__, __LINE__, 1);
+	for (unsigned int i = 0; i < ensembleCase.overrides.size(); i++)
+	{
+		if (!caseParameters.overrideInput(ensembleCase.overrides[i].first, ensembleCase.overrides[i].second))
+		{
+			caseParameters.logBrief("Unknown input " + ensembleCase.overrides[i].first +
+				" in case " + ensembleCase.name, 3);
+		}
+	}
+	caseParameters.assignInputs();
+
+	if (caseParameters.numErrors == 0)
+	{
+		caseParameters.tecplotMesh = ensembleCase.name + "_" + caseParameters.tecplotMesh;
+		caseParameters.tecplotParticleSolution = ensembleCase.name + "_" + caseParameters.tecplotParticleSolution;
+		caseParameters.tecplotNodeSolution = ensembleCase.name + "_" + caseParameters.tecplotNodeSolution;
+		caseParameters.tecplotGlobalSolution = ensembleCase.name + "_" + caseParameters.tecplotGlobalSolution;
+		caseParameters.timelineFile = ensembleCase.name + "_" + caseParameters.timelineFile;
+		caseParameters.setRandomSeed(caseID + 1, 0);
+
+		if (sameMesh(caseParameters, *parametersList))
+		{
+			VectorPatch patchesVector(&caseParameters, *baseMesh);
+			patchesVector.startPIC();
+			caseParameters.numErrors += patchesVector.numErrors;
+		}
+		else
+		{
+			caseParameters.processMesh("PIC");
+			Mesh caseMesh(&caseParameters, "PIC");
+			VectorPatch patchesVector(&caseParameters, caseMesh);
+			patchesVector.startPIC();
+			caseParameters.numErrors += patchesVector.numErrors;
+		}
+	}
+
+	caseErrors[caseID] = caseParameters.numErrors;
+	caseParameters.logMessages("Case " + ensembleCase.name + " complete", __FILENAME__, __LINE__, 1);
+}
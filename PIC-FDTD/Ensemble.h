@@ -0,0 +1,49 @@
+//! \file
+//! \brief Definition of Ensemble class
+//! \author Rahul Kalampattel
+//! \date Last updated June 2018
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Mesh.h"
+#include "Parameters.h"
+#include "TaskGraph.h"
+#include "VectorPatch.h"
+
+//! \struct EnsembleCase
+//! \brief Name of a case, which prefixes its output files, and the inputs in
+//! which it differs from the input file
+struct EnsembleCase
+{
+	std::string name;											//!< Case name
+	std::vector<std::pair<std::string, std::string>> overrides;	//!< Names and values of overridden inputs
+};
+
+//! \class Ensemble
+//! \brief Runs many independent simulations, each a variation of the input
+//! file, concurrently in one process. Cases which do not change the mesh share
+//! one generated from the input file.
+class Ensemble
+{
+public:
+	// Data members
+	std::vector<EnsembleCase> cases;			//!< Cases listed in the ensemble file
+	std::vector<int> caseErrors;				//!< Number of errors in each case
+	int numErrors = 0;							//!< Sum of errors in all cases
+
+
+	// Constructor/destructor
+	Ensemble();									//!< Default constructor
+	Ensemble(Parameters *parametersList);		//!< Constructor
+	~Ensemble();								//!< Destructor
+
+
+	// Methods
+	void readCases(Parameters *parametersList);	//!< Read cases from the ensemble file
+	void runCase(Parameters *parametersList,
+		const Mesh *baseMesh, int caseID);		//!< Set up and run a single case
+};
@@ -17,156 +17,161 @@ FDTD::FDTD(Parameters *parametersList, Mesh *mesh)
 	// Based on the geometry of the existing mesh, generate a new mesh with a 
 	// finer grid spacing. Nodes in every second row and second column are used 
 	// to calculate E field parameters, while the alternate nodes are used for 
-	// B field parameters (i.e a Yee mesh). 
-	// TODO: Don't need to regenerate FDTD mesh every single class instance, rather 
-	// do it once and use the same mesh for subsequent calls (unless the original
-	// mesh is refined).
+	// B field parameters (i.e a Yee mesh). The mesh is generated once and kept
+	// for all subsequent calls to solveFields.
 	parametersList->processMesh("FDTD");
 	FDTDmesh = Mesh(parametersList, "FDTD");
 
-	int currentCol = 0, cellShift = 0;
 	int step = static_cast<int>(round(mesh->h / FDTDmesh.h));
 
+	PICcellIDs.assign(FDTDmesh.numNodes, -1);
+
 	// Check that the FDTD mesh spacing divides the PIC mesh spacing evenly
-	if (step > 1 && abs(mesh->h - (FDTDmesh.h * round(mesh->h / FDTDmesh.h))) < 1e-10)
+	if (step > 1 && std::abs(mesh->h - (FDTDmesh.h * round(mesh->h / FDTDmesh.h))) < 1e-10)
 	{
-		// Map nodes of the FDTD mesh to cells of the PIC mesh 	
-		for (int i = 0; i < FDTDmesh.numNodes; i += (FDTDmesh.numRows + 1))
+		// Map nodes of the FDTD mesh to cells of the PIC mesh, where nodes on
+		// the left/top edge of each PIC cell belong to the previous cell, 
+		// except along the domain boundary
+		for (int column = 0; column < FDTDmesh.numColumns + 1; column++)
 		{
-			int currentRow = 1;
-			if (currentCol == step + 1)
+			int PICcolumn = std::max(column - 1, 0) / step;
+			for (int row = 0; row < FDTDmesh.numRows + 1; row++)
 			{
-				cellShift += mesh->numRows;
-				currentCol = 1;
+				int PICrow = std::max(row - 1, 0) / step;
+				PICcellIDs[FDTDmesh.nodeIndex(column, row)] =
+					mesh->cellIndex(PICcolumn, PICrow) + 1;
 			}
-			int currentCell = 1 + cellShift;
-
-			FDTDmesh.nodesVector.nodes[i].PICcellID = currentCell;
-
-			int j = 1;
-			while (currentRow < FDTDmesh.numRows + 1)
-			{
-				for (int k = 1; k <= step; k++)
-				{
-					FDTDmesh.nodesVector.nodes[i + j].PICcellID = currentCell;
-					j++;
-					currentRow++;
-				}
-				currentCell++;
-			}
-			currentCol++;
 		}
 	}
 	else
 	{
 		parametersList->logBrief("FDTD spacing should be a factor of PIC spacing", 3);
 	}
+}
+
+
+// Destructor
+FDTD::~FDTD()
+{
+}
 
+
+// Advance the EM field on the FDTD mesh and pass it back to the PIC mesh
+void FDTD::solveFields(Parameters *parametersList, Mesh *mesh)
+{
+	// Esirkepov current is deposited on the FDTD mesh directly, which then
+	// keeps its own fields, so these are only taken from the PIC mesh once
+	bool esirkepov = parametersList->currentDeposition == "esirkepov";
 	double hSquared = mesh->h * mesh->h;
 
-	for (int i = 0; i < FDTDmesh.numNodes; i++)
+	if (!esirkepov || !fieldsInitialised)
 	{
-		// TODO: Can change all of the below to references to avoid copying large 
-		// amounts of data for each calculation
+		for (int i = 0; i < FDTDmesh.numNodes; i++)
+		{
+			// TODO: Can change all of the below to references to avoid copying large 
+			// amounts of data for each calculation
 
-		int cellID = FDTDmesh.nodesVector.nodes[i].PICcellID - 1;
-		int nodeID_0 = mesh->cellsVector.cells[cellID].connectivity.nodeIDs[0] - 1;
-		int nodeID_1 = mesh->cellsVector.cells[cellID].connectivity.nodeIDs[1] - 1;
-		int nodeID_2 = mesh->cellsVector.cells[cellID].connectivity.nodeIDs[2] - 1;
-		int nodeID_3 = mesh->cellsVector.cells[cellID].connectivity.nodeIDs[3] - 1;
+			int cellID = PICcellIDs[i] - 1;
+			int nodeID_0 = mesh->cell(cellID).connectivity.nodeIDs[0] - 1;
+			int nodeID_1 = mesh->cell(cellID).connectivity.nodeIDs[1] - 1;
+			int nodeID_2 = mesh->cell(cellID).connectivity.nodeIDs[2] - 1;
+			int nodeID_3 = mesh->cell(cellID).connectivity.nodeIDs[3] - 1;
 
-		double left = mesh->cellsVector.cells[cellID].left;
-		double right = mesh->cellsVector.cells[cellID].right;
-		double top = mesh->cellsVector.cells[cellID].top;
-		double bottom = mesh->cellsVector.cells[cellID].bottom;
+			double left = mesh->cell(cellID).left;
+			double right = mesh->cell(cellID).right;
+			double top = mesh->cell(cellID).top;
+			double bottom = mesh->cell(cellID).bottom;
 
-		double x1 = FDTDmesh.nodesVector.nodes[i].geometry.X.element(0, 0);
-		double x2 = FDTDmesh.nodesVector.nodes[i].geometry.X.element(1, 0);
+			double x1 = FDTDmesh.node(i).geometry.X(0);
+			double x2 = FDTDmesh.node(i).geometry.X(1);
 
-		std::string firstNodePosition = mesh->cellsVector.cells[cellID].firstNodePosition;
+			BoundaryType firstNodePosition = mesh->cell(cellID).firstNodePosition;
 
-		if (firstNodePosition == "TL")
-		{
-			for (int j = 0; j < 6; j++)
-			{
-				FDTDmesh.nodesVector.nodes[i].EMfield[j] =
-					mesh->nodesVector.nodes[nodeID_0].EMfield[j] * (right - x1) * (x2 - bottom) / hSquared +
-					mesh->nodesVector.nodes[nodeID_1].EMfield[j] * (right - x1) * (top - x2) / hSquared +
-					mesh->nodesVector.nodes[nodeID_2].EMfield[j] * (x1 - left) * (top - x2) / hSquared +
-					mesh->nodesVector.nodes[nodeID_3].EMfield[j] * (x1 - left) * (x2 - bottom) / hSquared;
-			}
-			for (int j = 0; j < 2; j++)
+			if (firstNodePosition == boundaryTL)
 			{
-				FDTDmesh.nodesVector.nodes[i].current[j] =
-					mesh->nodesVector.nodes[nodeID_0].current[j] * (right - x1) * (x2 - bottom) / hSquared +
-					mesh->nodesVector.nodes[nodeID_1].current[j] * (right - x1) * (top - x2) / hSquared +
-					mesh->nodesVector.nodes[nodeID_2].current[j] * (x1 - left) * (top - x2) / hSquared +
-					mesh->nodesVector.nodes[nodeID_3].current[j] * (x1 - left) * (x2 - bottom) / hSquared;
-			}
-		}
-		else if (firstNodePosition == "BL")
-		{
-			for (int j = 0; j < 6; j++)
-			{
-				FDTDmesh.nodesVector.nodes[i].EMfield[j] =
-					mesh->nodesVector.nodes[nodeID_0].EMfield[j] * (right - x1) * (top - x2) / hSquared +
-					mesh->nodesVector.nodes[nodeID_1].EMfield[j] * (x1 - left) * (top - x2) / hSquared +
-					mesh->nodesVector.nodes[nodeID_2].EMfield[j] * (x1 - left) * (x2 - bottom) / hSquared +
-					mesh->nodesVector.nodes[nodeID_3].EMfield[j] * (right - x1) * (x2 - bottom) / hSquared;
-			}
-			for (int j = 0; j < 2; j++)
-			{
-				FDTDmesh.nodesVector.nodes[i].current[j] =
-					mesh->nodesVector.nodes[nodeID_0].current[j] * (right - x1) * (top - x2) / hSquared +
-					mesh->nodesVector.nodes[nodeID_1].current[j] * (x1 - left) * (top - x2) / hSquared +
-					mesh->nodesVector.nodes[nodeID_2].current[j] * (x1 - left) * (x2 - bottom) / hSquared +
-					mesh->nodesVector.nodes[nodeID_3].current[j] * (right - x1) * (x2 - bottom) / hSquared;
-			}
-		}
-		else if (firstNodePosition == "BR")
-		{
-			for (int j = 0; j < 6; j++)
-			{
-				FDTDmesh.nodesVector.nodes[i].EMfield[j] =
-					mesh->nodesVector.nodes[nodeID_0].EMfield[j] * (x1 - left) * (top - x2) / hSquared +
-					mesh->nodesVector.nodes[nodeID_1].EMfield[j] * (x1 - left) * (x2 - bottom) / hSquared +
-					mesh->nodesVector.nodes[nodeID_2].EMfield[j] * (right - x1) * (x2 - bottom) / hSquared +
-					mesh->nodesVector.nodes[nodeID_3].EMfield[j] * (right - x1) * (top - x2) / hSquared;
+				for (int j = 0; j < 6; j++)
+				{
+					FDTDmesh.nodesVector.nodes[i].EMfield[j] =
+						mesh->nodesVector.nodes[nodeID_0].EMfield[j] * (right - x1) * (x2 - bottom) / hSquared +
+						mesh->nodesVector.nodes[nodeID_1].EMfield[j] * (right - x1) * (top - x2) / hSquared +
+						mesh->nodesVector.nodes[nodeID_2].EMfield[j] * (x1 - left) * (top - x2) / hSquared +
+						mesh->nodesVector.nodes[nodeID_3].EMfield[j] * (x1 - left) * (x2 - bottom) / hSquared;
+				}
+				for (int j = 0; j < 2; j++)
+				{
+					FDTDmesh.nodesVector.nodes[i].current[j] =
+						mesh->nodesVector.nodes[nodeID_0].current[j] * (right - x1) * (x2 - bottom) / hSquared +
+						mesh->nodesVector.nodes[nodeID_1].current[j] * (right - x1) * (top - x2) / hSquared +
+						mesh->nodesVector.nodes[nodeID_2].current[j] * (x1 - left) * (top - x2) / hSquared +
+						mesh->nodesVector.nodes[nodeID_3].current[j] * (x1 - left) * (x2 - bottom) / hSquared;
+				}
 			}
-			for (int j = 0; j < 2; j++)
+			else if (firstNodePosition == boundaryBL)
 			{
-				FDTDmesh.nodesVector.nodes[i].current[j] =
-					mesh->nodesVector.nodes[nodeID_0].current[j] * (x1 - left) * (top - x2) / hSquared +
-					mesh->nodesVector.nodes[nodeID_1].current[j] * (x1 - left) * (x2 - bottom) / hSquared +
-					mesh->nodesVector.nodes[nodeID_2].current[j] * (right - x1) * (x2 - bottom) / hSquared +
-					mesh->nodesVector.nodes[nodeID_3].current[j] * (right - x1) * (top - x2) / hSquared;
+				for (int j = 0; j < 6; j++)
+				{
+					FDTDmesh.nodesVector.nodes[i].EMfield[j] =
+						mesh->nodesVector.nodes[nodeID_0].EMfield[j] * (right - x1) * (top - x2) / hSquared +
+						mesh->nodesVector.nodes[nodeID_1].EMfield[j] * (x1 - left) * (top - x2) / hSquared +
+						mesh->nodesVector.nodes[nodeID_2].EMfield[j] * (x1 - left) * (x2 - bottom) / hSquared +
+						mesh->nodesVector.nodes[nodeID_3].EMfield[j] * (right - x1) * (x2 - bottom) / hSquared;
+				}
+				for (int j = 0; j < 2; j++)
+				{
+					FDTDmesh.nodesVector.nodes[i].current[j] =
+						mesh->nodesVector.nodes[nodeID_0].current[j] * (right - x1) * (top - x2) / hSquared +
+						mesh->nodesVector.nodes[nodeID_1].current[j] * (x1 - left) * (top - x2) / hSquared +
+						mesh->nodesVector.nodes[nodeID_2].current[j] * (x1 - left) * (x2 - bottom) / hSquared +
+						mesh->nodesVector.nodes[nodeID_3].current[j] * (right - x1) * (x2 - bottom) / hSquared;
+				}
 			}
-		}
-		else if (firstNodePosition == "TR")
-		{
-			for (int j = 0; j < 6; j++)
+			else if (firstNodePosition == boundaryBR)
 			{
-				FDTDmesh.nodesVector.nodes[i].EMfield[j] =
-					mesh->nodesVector.nodes[nodeID_0].EMfield[j] * (x1 - left) * (x2 - bottom) / hSquared +
-					mesh->nodesVector.nodes[nodeID_1].EMfield[j] * (right - x1) * (x2 - bottom) / hSquared +
-					mesh->nodesVector.nodes[nodeID_2].EMfield[j] * (right - x1) * (top - x2) / hSquared +
-					mesh->nodesVector.nodes[nodeID_3].EMfield[j] * (x1 - left) * (top - x2) / hSquared;
+				for (int j = 0; j < 6; j++)
+				{
+					FDTDmesh.nodesVector.nodes[i].EMfield[j] =
+						mesh->nodesVector.nodes[nodeID_0].EMfield[j] * (x1 - left) * (top - x2) / hSquared +
+						mesh->nodesVector.nodes[nodeID_1].EMfield[j] * (x1 - left) * (x2 - bottom) / hSquared +
+						mesh->nodesVector.nodes[nodeID_2].EMfield[j] * (right - x1) * (x2 - bottom) / hSquared +
+						mesh->nodesVector.nodes[nodeID_3].EMfield[j] * (right - x1) * (top - x2) / hSquared;
+				}
+				for (int j = 0; j < 2; j++)
+				{
+					FDTDmesh.nodesVector.nodes[i].current[j] =
+						mesh->nodesVector.nodes[nodeID_0].current[j] * (x1 - left) * (top - x2) / hSquared +
+						mesh->nodesVector.nodes[nodeID_1].current[j] * (x1 - left) * (x2 - bottom) / hSquared +
+						mesh->nodesVector.nodes[nodeID_2].current[j] * (right - x1) * (x2 - bottom) / hSquared +
+						mesh->nodesVector.nodes[nodeID_3].current[j] * (right - x1) * (top - x2) / hSquared;
+				}
 			}
-			for (int j = 0; j < 2; j++)
+			else if (firstNodePosition == boundaryTR)
 			{
-				FDTDmesh.nodesVector.nodes[i].current[j] =
-					mesh->nodesVector.nodes[nodeID_0].current[j] * (x1 - left) * (x2 - bottom) / hSquared +
-					mesh->nodesVector.nodes[nodeID_1].current[j] * (right - x1) * (x2 - bottom) / hSquared +
-					mesh->nodesVector.nodes[nodeID_2].current[j] * (right - x1) * (top - x2) / hSquared +
-					mesh->nodesVector.nodes[nodeID_3].current[j] * (x1 - left) * (top - x2) / hSquared;
+				for (int j = 0; j < 6; j++)
+				{
+					FDTDmesh.nodesVector.nodes[i].EMfield[j] =
+						mesh->nodesVector.nodes[nodeID_0].EMfield[j] * (x1 - left) * (x2 - bottom) / hSquared +
+						mesh->nodesVector.nodes[nodeID_1].EMfield[j] * (right - x1) * (x2 - bottom) / hSquared +
+						mesh->nodesVector.nodes[nodeID_2].EMfield[j] * (right - x1) * (top - x2) / hSquared +
+						mesh->nodesVector.nodes[nodeID_3].EMfield[j] * (x1 - left) * (top - x2) / hSquared;
+				}
+				for (int j = 0; j < 2; j++)
+				{
+					FDTDmesh.nodesVector.nodes[i].current[j] =
+						mesh->nodesVector.nodes[nodeID_0].current[j] * (x1 - left) * (x2 - bottom) / hSquared +
+						mesh->nodesVector.nodes[nodeID_1].current[j] * (right - x1) * (x2 - bottom) / hSquared +
+						mesh->nodesVector.nodes[nodeID_2].current[j] * (right - x1) * (top - x2) / hSquared +
+						mesh->nodesVector.nodes[nodeID_3].current[j] * (x1 - left) * (top - x2) / hSquared;
+				}
 			}
 		}
 	}
 
+	fieldsInitialised = true;
+
 	// TODO: Define epsilon_0 and mu_0, as well as non-vacuum versions, in an
 	// accessible location (remove from chemConstants file)
 	double epsilon_0 = 8.85418782e-12;
-	double mu_0 = 4 * std::_Pi * 1.0e-7;
+	double mu_0 = 4 * PI * 1.0e-7;
 	double cSquared = 1.0 / (epsilon_0 * mu_0);
 	double FDTDtimeStep = parametersList->timeStep / static_cast<double>(parametersList->FDTDiterations);
 	double timeStepRatio = FDTDtimeStep / (FDTDmesh.h * 2.0);
@@ -185,12 +190,12 @@ FDTD::FDTD(Parameters *parametersList, Mesh *mesh)
 		# pragma omp parallel for num_threads(parametersList->numThreads)
 		for (int j = 0; j < FDTDmesh.numNodes; j += 2)
 		{
-			int leftNodeID = FDTDmesh.nodesVector.nodes[j].leftNodeID - 1;
-			int rightNodeID = FDTDmesh.nodesVector.nodes[j].rightNodeID - 1;
-			int topNodeID = FDTDmesh.nodesVector.nodes[j].topNodeID - 1;
-			int bottomNodeID = FDTDmesh.nodesVector.nodes[j].bottomNodeID - 1;
+			int leftNodeID = FDTDmesh.node(j).leftNodeID - 1;
+			int rightNodeID = FDTDmesh.node(j).rightNodeID - 1;
+			int topNodeID = FDTDmesh.node(j).topNodeID - 1;
+			int bottomNodeID = FDTDmesh.node(j).bottomNodeID - 1;
 
-			if (FDTDmesh.nodesVector.nodes[j].boundaryType == "internal")
+			if (FDTDmesh.node(j).boundaryType == boundaryInternal)
 			{
 				// (1) d/dt(Bx) = -d/dy(Ez)
 				FDTDmesh.nodesVector.nodes[j].EMfield[3] -= timeStepRatio *
@@ -214,23 +219,23 @@ FDTD::FDTD(Parameters *parametersList, Mesh *mesh)
 		# pragma omp parallel for num_threads(parametersList->numThreads)
 		for (int j = 1; j < FDTDmesh.numNodes; j += 2)
 		{
-			int leftNodeID = FDTDmesh.nodesVector.nodes[j].leftNodeID - 1;
-			int rightNodeID = FDTDmesh.nodesVector.nodes[j].rightNodeID - 1;
-			int topNodeID = FDTDmesh.nodesVector.nodes[j].topNodeID - 1;
-			int bottomNodeID = FDTDmesh.nodesVector.nodes[j].bottomNodeID - 1;
+			int leftNodeID = FDTDmesh.node(j).leftNodeID - 1;
+			int rightNodeID = FDTDmesh.node(j).rightNodeID - 1;
+			int topNodeID = FDTDmesh.node(j).topNodeID - 1;
+			int bottomNodeID = FDTDmesh.node(j).bottomNodeID - 1;
 
-			if (FDTDmesh.nodesVector.nodes[j].boundaryType == "internal")
+			if (FDTDmesh.node(j).boundaryType == boundaryInternal)
 			{
 				// (4) e.d/dt(Ex) = (1/u).d/dy(Bz) - Jx
 				FDTDmesh.nodesVector.nodes[j].EMfield[0] += timeStepRatio * cSquared *
 					(FDTDmesh.nodesVector.nodes[topNodeID].EMfield[5] -
 						FDTDmesh.nodesVector.nodes[bottomNodeID].EMfield[5]) - 
-					FDTDmesh.nodesVector.nodes[j].current[0] / epsilon_0;
+					FDTDmesh.nodesVector.nodes[j].current[0] * FDTDtimeStep / epsilon_0;
 				// (5) e.d/dt(Ey) = -(1/u).d/dx(Bz) - Jy
 				FDTDmesh.nodesVector.nodes[j].EMfield[1] -= timeStepRatio * cSquared *
 					(FDTDmesh.nodesVector.nodes[rightNodeID].EMfield[5] -
 						FDTDmesh.nodesVector.nodes[leftNodeID].EMfield[5]) - 
-					FDTDmesh.nodesVector.nodes[j].current[1] / epsilon_0;
+					FDTDmesh.nodesVector.nodes[j].current[1] * FDTDtimeStep / epsilon_0;
 				// (6) e.d/dt(Ez) = (1/u).d/dx(By) - (1/u).d/dy(Bx) 
 				FDTDmesh.nodesVector.nodes[j].EMfield[2] += timeStepRatio * cSquared *
 					(FDTDmesh.nodesVector.nodes[rightNodeID].EMfield[4] -
@@ -242,81 +247,88 @@ FDTD::FDTD(Parameters *parametersList, Mesh *mesh)
 		}
 	}
 
-	for (int i = 0; i < FDTDmesh.numNodes; i++)
+	if (esirkepov)
 	{
-		// TODO: Can change all of the below to references to avoid copying large 
-		// amounts of data for each calculation
+		sampleToPIC(parametersList, mesh);
+	}
+	else
+	{
+		for (int i = 0; i < FDTDmesh.numNodes; i++)
+		{
+			// TODO: Can change all of the below to references to avoid copying large 
+			// amounts of data for each calculation
 
-		int cellID = FDTDmesh.nodesVector.nodes[i].PICcellID - 1;
-		int nodeID_0 = mesh->cellsVector.cells[cellID].connectivity.nodeIDs[0] - 1;
-		int nodeID_1 = mesh->cellsVector.cells[cellID].connectivity.nodeIDs[1] - 1;
-		int nodeID_2 = mesh->cellsVector.cells[cellID].connectivity.nodeIDs[2] - 1;
-		int nodeID_3 = mesh->cellsVector.cells[cellID].connectivity.nodeIDs[3] - 1;
+			int cellID = PICcellIDs[i] - 1;
+			int nodeID_0 = mesh->cell(cellID).connectivity.nodeIDs[0] - 1;
+			int nodeID_1 = mesh->cell(cellID).connectivity.nodeIDs[1] - 1;
+			int nodeID_2 = mesh->cell(cellID).connectivity.nodeIDs[2] - 1;
+			int nodeID_3 = mesh->cell(cellID).connectivity.nodeIDs[3] - 1;
 
-		double left = mesh->cellsVector.cells[cellID].left;
-		double right = mesh->cellsVector.cells[cellID].right;
-		double top = mesh->cellsVector.cells[cellID].top;
-		double bottom = mesh->cellsVector.cells[cellID].bottom;
+			double left = mesh->cell(cellID).left;
+			double right = mesh->cell(cellID).right;
+			double top = mesh->cell(cellID).top;
+			double bottom = mesh->cell(cellID).bottom;
 
-		double x1 = FDTDmesh.nodesVector.nodes[i].geometry.X.element(0, 0);
-		double x2 = FDTDmesh.nodesVector.nodes[i].geometry.X.element(1, 0);
+			double x1 = FDTDmesh.node(i).geometry.X(0);
+			double x2 = FDTDmesh.node(i).geometry.X(1);
 
-		std::string firstNodePosition = mesh->cellsVector.cells[cellID].firstNodePosition;
+			BoundaryType firstNodePosition = mesh->cell(cellID).firstNodePosition;
 
-		if (firstNodePosition == "TL")
-		{
-			for (int j = 0; j < 6; j++)
+			if (firstNodePosition == boundaryTL)
 			{
-				mesh->nodesVector.nodes[nodeID_0].EMfield[j] += 
-					FDTDmesh.nodesVector.nodes[i].EMfield[j] * (right - x1) * (x2 - bottom) / hSquared;
-				mesh->nodesVector.nodes[nodeID_1].EMfield[j] += 
-					FDTDmesh.nodesVector.nodes[i].EMfield[j] * (right - x1) * (top - x2) / hSquared;
-				mesh->nodesVector.nodes[nodeID_2].EMfield[j] += 
-					FDTDmesh.nodesVector.nodes[i].EMfield[j] * (x1 - left) * (top - x2) / hSquared;
-				mesh->nodesVector.nodes[nodeID_3].EMfield[j] += 
-					FDTDmesh.nodesVector.nodes[i].EMfield[j] * (x1 - left) * (x2 - bottom) / hSquared;
+				for (int j = 0; j < 6; j++)
+				{
+					mesh->nodesVector.nodes[nodeID_0].EMfield[j] += 
+						FDTDmesh.nodesVector.nodes[i].EMfield[j] * (right - x1) * (x2 - bottom) / hSquared;
+					mesh->nodesVector.nodes[nodeID_1].EMfield[j] += 
+						FDTDmesh.nodesVector.nodes[i].EMfield[j] * (right - x1) * (top - x2) / hSquared;
+					mesh->nodesVector.nodes[nodeID_2].EMfield[j] += 
+						FDTDmesh.nodesVector.nodes[i].EMfield[j] * (x1 - left) * (top - x2) / hSquared;
+					mesh->nodesVector.nodes[nodeID_3].EMfield[j] += 
+						FDTDmesh.nodesVector.nodes[i].EMfield[j] * (x1 - left) * (x2 - bottom) / hSquared;
+				}
 			}
-		}
-		else if (firstNodePosition == "BL")
-		{
-			for (int j = 0; j < 6; j++)
+			else if (firstNodePosition == boundaryBL)
 			{
-				mesh->nodesVector.nodes[nodeID_0].EMfield[j] += 
-					FDTDmesh.nodesVector.nodes[i].EMfield[j] * (right - x1) * (top - x2) / hSquared;
-				mesh->nodesVector.nodes[nodeID_1].EMfield[j] += 
-					FDTDmesh.nodesVector.nodes[i].EMfield[j] * (x1 - left) * (top - x2) / hSquared;
-				mesh->nodesVector.nodes[nodeID_2].EMfield[j] += 
-					FDTDmesh.nodesVector.nodes[i].EMfield[j] * (x1 - left) * (x2 - bottom) / hSquared;
-				mesh->nodesVector.nodes[nodeID_3].EMfield[j] += 
-					FDTDmesh.nodesVector.nodes[i].EMfield[j] * (right - x1) * (x2 - bottom) / hSquared;
+				for (int j = 0; j < 6; j++)
+				{
+					mesh->nodesVector.nodes[nodeID_0].EMfield[j] += 
+						FDTDmesh.nodesVector.nodes[i].EMfield[j] * (right - x1) * (top - x2) / hSquared;
+					mesh->nodesVector.nodes[nodeID_1].EMfield[j] += 
+						FDTDmesh.nodesVector.nodes[i].EMfield[j] * (x1 - left) * (top - x2) / hSquared;
+					mesh->nodesVector.nodes[nodeID_2].EMfield[j] += 
+						FDTDmesh.nodesVector.nodes[i].EMfield[j] * (x1 - left) * (x2 - bottom) / hSquared;
+					mesh->nodesVector.nodes[nodeID_3].EMfield[j] += 
+						FDTDmesh.nodesVector.nodes[i].EMfield[j] * (right - x1) * (x2 - bottom) / hSquared;
+				}
 			}
-		}
-		else if (firstNodePosition == "BR")
-		{
-			for (int j = 0; j < 6; j++)
+			else if (firstNodePosition == boundaryBR)
 			{
-				mesh->nodesVector.nodes[nodeID_0].EMfield[j] += 
-					FDTDmesh.nodesVector.nodes[i].EMfield[j] * (x1 - left) * (top - x2) / hSquared;
-				mesh->nodesVector.nodes[nodeID_1].EMfield[j] += 
-					FDTDmesh.nodesVector.nodes[i].EMfield[j] * (x1 - left) * (x2 - bottom) / hSquared;
-				mesh->nodesVector.nodes[nodeID_2].EMfield[j] += 
-					FDTDmesh.nodesVector.nodes[i].EMfield[j] * (right - x1) * (x2 - bottom) / hSquared;
-				mesh->nodesVector.nodes[nodeID_3].EMfield[j] += 
-					FDTDmesh.nodesVector.nodes[i].EMfield[j] * (right - x1) * (top - x2) / hSquared;
+				for (int j = 0; j < 6; j++)
+				{
+					mesh->nodesVector.nodes[nodeID_0].EMfield[j] += 
+						FDTDmesh.nodesVector.nodes[i].EMfield[j] * (x1 - left) * (top - x2) / hSquared;
+					mesh->nodesVector.nodes[nodeID_1].EMfield[j] += 
+						FDTDmesh.nodesVector.nodes[i].EMfield[j] * (x1 - left) * (x2 - bottom) / hSquared;
+					mesh->nodesVector.nodes[nodeID_2].EMfield[j] += 
+						FDTDmesh.nodesVector.nodes[i].EMfield[j] * (right - x1) * (x2 - bottom) / hSquared;
+					mesh->nodesVector.nodes[nodeID_3].EMfield[j] += 
+						FDTDmesh.nodesVector.nodes[i].EMfield[j] * (right - x1) * (top - x2) / hSquared;
+				}
 			}
-		}
-		else if (firstNodePosition == "TR")
-		{
-			for (int j = 0; j < 6; j++)
+			else if (firstNodePosition == boundaryTR)
 			{
-				mesh->nodesVector.nodes[nodeID_0].EMfield[j] += 
-					FDTDmesh.nodesVector.nodes[i].EMfield[j] * (x1 - left) * (x2 - bottom) / hSquared;
-				mesh->nodesVector.nodes[nodeID_1].EMfield[j] += 
-					FDTDmesh.nodesVector.nodes[i].EMfield[j] * (right - x1) * (x2 - bottom) / hSquared;
-				mesh->nodesVector.nodes[nodeID_2].EMfield[j] += 
-					FDTDmesh.nodesVector.nodes[i].EMfield[j] * (right - x1) * (top - x2) / hSquared;
-				mesh->nodesVector.nodes[nodeID_3].EMfield[j] += 
-					FDTDmesh.nodesVector.nodes[i].EMfield[j] * (x1 - left) * (top - x2) / hSquared;
+				for (int j = 0; j < 6; j++)
+				{
+					mesh->nodesVector.nodes[nodeID_0].EMfield[j] += 
+						FDTDmesh.nodesVector.nodes[i].EMfield[j] * (x1 - left) * (x2 - bottom) / hSquared;
+					mesh->nodesVector.nodes[nodeID_1].EMfield[j] += 
+						FDTDmesh.nodesVector.nodes[i].EMfield[j] * (right - x1) * (x2 - bottom) / hSquared;
+					mesh->nodesVector.nodes[nodeID_2].EMfield[j] += 
+						FDTDmesh.nodesVector.nodes[i].EMfield[j] * (right - x1) * (top - x2) / hSquared;
+					mesh->nodesVector.nodes[nodeID_3].EMfield[j] += 
+						FDTDmesh.nodesVector.nodes[i].EMfield[j] * (x1 - left) * (top - x2) / hSquared;
+				}
 			}
 		}
 	}
@@ -325,7 +337,48 @@ FDTD::FDTD(Parameters *parametersList, Mesh *mesh)
 }
 
 
-// Destructor
-FDTD::~FDTD()
+// Set the fields at PIC mesh nodes from the FDTD mesh, which holds the whole
+// field when current is deposited on it. Each PIC node coincides with a B
+// node, and takes E from the mean of the E nodes around it.
+void FDTD::sampleToPIC(Parameters *parametersList, Mesh *mesh)
 {
+	int step = static_cast<int>(round(mesh->h / FDTDmesh.h));
+
+	# pragma omp parallel for num_threads(parametersList->numThreads)
+	for (int column = 0; column < mesh->numColumns + 1; column++)
+	{
+		for (int row = 0; row < mesh->numRows + 1; row++)
+		{
+			int FDTDcolumn = column * step, FDTDrow = row * step;
+			std::vector<double> &EMfield = mesh->nodesVector.nodes[mesh->nodeIndex(column, row)].EMfield;
+			const std::vector<double> &Bnode =
+				FDTDmesh.nodesVector.nodes[FDTDmesh.nodeIndex(FDTDcolumn, FDTDrow)].EMfield;
+
+			int neighbourColumns[4] = { FDTDcolumn - 1, FDTDcolumn + 1, FDTDcolumn, FDTDcolumn };
+			int neighbourRows[4] = { FDTDrow, FDTDrow, FDTDrow - 1, FDTDrow + 1 };
+			double E[3] = { 0.0, 0.0, 0.0 };
+			int count = 0;
+			for (int k = 0; k < 4; k++)
+			{
+				if (neighbourColumns[k] < 0 || neighbourColumns[k] > FDTDmesh.numColumns ||
+					neighbourRows[k] < 0 || neighbourRows[k] > FDTDmesh.numRows)
+				{
+					continue;
+				}
+				const std::vector<double> &Enode = FDTDmesh.nodesVector.nodes[
+					FDTDmesh.nodeIndex(neighbourColumns[k], neighbourRows[k])].EMfield;
+				for (int j = 0; j < 3; j++)
+				{
+					E[j] += Enode[j];
+				}
+				count++;
+			}
+
+			for (int j = 0; j < 3; j++)
+			{
+				EMfield[j] = E[j] / count;
+				EMfield[j + 3] = Bnode[j + 3];
+			}
+		}
+	}
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 
 #include "Parameters.h"
 #include "Mesh.h"
+#include "CHEM/chemConstants.hpp"
 
 //! \class FDTD
 //! \brief Resolves an external EM field using the FDTD method
@@ -15,6 +16,8 @@ class FDTD
 public:
 	// Data members
 	Mesh FDTDmesh;									//!< FDTD mesh
+	std::vector<int> PICcellIDs;					//!< ID of PIC mesh cell which each FDTD mesh node occupies
+	bool fieldsInitialised = false;					//!< Set once FDTD mesh fields have been taken from the PIC mesh
 
 
 	// Constructor/destructor
@@ -24,5 +27,7 @@ public:
 
 
 	// Methods
-
+	void solveFields(Parameters *parametersList, Mesh *mesh);	//!< Advance the EM field and pass it back to the PIC mesh
+	void sampleToPIC(Parameters *parametersList,
+		Mesh *mesh);								//!< Set PIC mesh fields from the FDTD mesh
 };
\ No newline at end of file
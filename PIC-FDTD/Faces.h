@@ -5,7 +5,7 @@
 
 #pragma once
 
-#include "GRID\face.hpp"
+#include "GRID/face.hpp"
 
 //! \class Faces
 //! \brief Contains face properties, derived from FaceBase
@@ -10,89 +10,111 @@ FieldInterpolator::FieldInterpolator()
 {
 }
 
-// TODO: Large parts of the code below are similar to what is in ChargeProjector.
-// potentially look at making both functions of Patch, enabling code re-use?
-
 // Constructor
 FieldInterpolator::FieldInterpolator(Parameters *parametersList,
 	Mesh *mesh, VectorParticle *particlesVector)
 {
 	particlesVector->clearFields();
-	
-	double hSquared = mesh->h * mesh->h;
 
-	// # pragma omp parallel for num_threads(parametersList->numThreads)
-	for (int i = 0; i < particlesVector->numParticles; i++)
+	// Gather fields to particles, using the same shape as the charge projection
+	if (mesh->tilesVector.tileSize > 0)
 	{
-		// TODO: Can change all of the below to references to avoid copying large 
-		// amounts of data for each calculation
+		switch (parametersList->shapeOrder)
+		{
+		case shapeNGP:
+			interpolateFieldsTiled<shapeNGP>(parametersList, mesh, particlesVector);
+			break;
+		case shapeTSC:
+			interpolateFieldsTiled<shapeTSC>(parametersList, mesh, particlesVector);
+			break;
+		case shapeCubic:
+			interpolateFieldsTiled<shapeCubic>(parametersList, mesh, particlesVector);
+			break;
+		default:
+			interpolateFieldsTiled<shapeCIC>(parametersList, mesh, particlesVector);
+			break;
+		}
+		parametersList->logBrief("Field interpolator exited", 1);
+		return;
+	}
 
-		int cellID = particlesVector->particleVector[i].cellID - 1;
-		int nodeID_0 = mesh->cellsVector.cells[cellID].connectivity.nodeIDs[0] - 1;
-		int nodeID_1 = mesh->cellsVector.cells[cellID].connectivity.nodeIDs[1] - 1;
-		int nodeID_2 = mesh->cellsVector.cells[cellID].connectivity.nodeIDs[2] - 1;
-		int nodeID_3 = mesh->cellsVector.cells[cellID].connectivity.nodeIDs[3] - 1;
+	switch (parametersList->shapeOrder)
+	{
+	case shapeNGP:
+		interpolateFields<shapeNGP>(parametersList, mesh, particlesVector);
+		break;
+	case shapeTSC:
+		interpolateFields<shapeTSC>(parametersList, mesh, particlesVector);
+		break;
+	case shapeCubic:
+		interpolateFields<shapeCubic>(parametersList, mesh, particlesVector);
+		break;
+	default:
+		interpolateFields<shapeCIC>(parametersList, mesh, particlesVector);
+		break;
+	}
+	parametersList->logBrief("Field interpolator exited", 1);
+}
 
-		double left = mesh->cellsVector.cells[cellID].left;
-		double right = mesh->cellsVector.cells[cellID].right;
-		double top = mesh->cellsVector.cells[cellID].top;
-		double bottom = mesh->cellsVector.cells[cellID].bottom;
 
-		double x1 = particlesVector->particleVector[i].position[0];
-		double x2 = particlesVector->particleVector[i].position[1];
+// Destructor
+FieldInterpolator::~FieldInterpolator()
+{
+}
 
-		std::string firstNodePosition = mesh->cellsVector.cells[cellID].firstNodePosition;
 
-		if (firstNodePosition == "TL")
-		{
-			for (int j = 0; j < 6; j++)
-			{
-				particlesVector->particleVector[i].EMfield[j] =
-					mesh->nodesVector.nodes[nodeID_0].EMfield[j] * (right - x1) * (x2 - bottom) / hSquared +
-					mesh->nodesVector.nodes[nodeID_1].EMfield[j] * (right - x1) * (top - x2) / hSquared +
-					mesh->nodesVector.nodes[nodeID_2].EMfield[j] * (x1 - left) * (top - x2) / hSquared +
-					mesh->nodesVector.nodes[nodeID_3].EMfield[j] * (x1 - left) * (x2 - bottom) / hSquared;
-			}
-		}
-		else if (firstNodePosition == "BL")
-		{
-			for (int j = 0; j < 6; j++)
-			{
-				particlesVector->particleVector[i].EMfield[j] =
-					mesh->nodesVector.nodes[nodeID_0].EMfield[j] * (right - x1) * (top - x2) / hSquared +
-					mesh->nodesVector.nodes[nodeID_1].EMfield[j] * (x1 - left) * (top - x2) / hSquared +
-					mesh->nodesVector.nodes[nodeID_2].EMfield[j] * (x1 - left) * (x2 - bottom) / hSquared +
-					mesh->nodesVector.nodes[nodeID_3].EMfield[j] * (right - x1) * (x2 - bottom) / hSquared;
-			}
-		}
-		else if (firstNodePosition == "BR")
-		{
-			for (int j = 0; j < 6; j++)
-			{
-				particlesVector->particleVector[i].EMfield[j] =
-					mesh->nodesVector.nodes[nodeID_0].EMfield[j] * (x1 - left) * (top - x2) / hSquared +
-					mesh->nodesVector.nodes[nodeID_1].EMfield[j] * (x1 - left) * (x2 - bottom) / hSquared +
-					mesh->nodesVector.nodes[nodeID_2].EMfield[j] * (right - x1) * (x2 - bottom) / hSquared +
-					mesh->nodesVector.nodes[nodeID_3].EMfield[j] * (right - x1) * (top - x2) / hSquared;
-			}
-		}
-		else if (firstNodePosition == "TR")
+// Interpolate fields with a B-spline shape
+template <int Order>
+void FieldInterpolator::interpolateFields(Parameters *parametersList, Mesh *mesh,
+	VectorParticle *particlesVector)
+{
+	bool periodicX1 = parametersList->leftBCType == bcPeriodic;
+	bool periodicX2 = parametersList->topBCType == bcPeriodic;
+
+	for (int i = 0; i < particlesVector->numParticles; i++)
+	{
+		std::vector<double> &EMfield = particlesVector->particleVector[i].EMfield;
+		ParticleStencil<Order>::apply(mesh, particlesVector->particleVector[i].cellID,
+			particlesVector->particleVector[i].position[0],
+			particlesVector->particleVector[i].position[1], periodicX1, periodicX2,
+			[&](int nodeID, double weight)
 		{
 			for (int j = 0; j < 6; j++)
 			{
-				particlesVector->particleVector[i].EMfield[j] =
-					mesh->nodesVector.nodes[nodeID_0].EMfield[j] * (x1 - left) * (x2 - bottom) / hSquared +
-					mesh->nodesVector.nodes[nodeID_1].EMfield[j] * (right - x1) * (x2 - bottom) / hSquared +
-					mesh->nodesVector.nodes[nodeID_2].EMfield[j] * (right - x1) * (top - x2) / hSquared +
-					mesh->nodesVector.nodes[nodeID_3].EMfield[j] * (x1 - left) * (top - x2) / hSquared;
+				EMfield[j] += mesh->nodesVector.nodes[nodeID].EMfield[j] * weight;
 			}
-		}
+		});
 	}
-	parametersList->logBrief("Field interpolator exited", 1);
 }
 
 
-// Destructor
-FieldInterpolator::~FieldInterpolator()
+// Interpolate fields tile by tile, from a local copy of the node fields around
+// each tile. Tiles (or groups of tiles, once balanced) are processed in 
+// parallel as separate tasks.
+template <int Order>
+void FieldInterpolator::interpolateFieldsTiled(Parameters *parametersList, Mesh *mesh,
+	VectorParticle *particlesVector)
 {
-}
\ No newline at end of file
+	VectorTile &tilesVector = mesh->tilesVector;
+	tilesVector.updateBins(mesh, particlesVector);
+
+	TaskGraph graph;
+	tilesVector.addTasks(graph, [=](Tiles &tile)
+	{
+		tile.loadFields(mesh->nodesVector);
+		for (unsigned int i = 0; i < tile.listOfParticles.size(); i++)
+		{
+			Particle &particle = particlesVector->particleVector[tile.listOfParticles[i]];
+			applyTileStencil<Order>(mesh, tile, particle.position[0], particle.position[1],
+				[&](int localID, double weight)
+			{
+				for (int j = 0; j < 6; j++)
+				{
+					particle.EMfield[j] += tile.EMfield[6 * localID + j] * weight;
+				}
+			});
+		}
+	});
+
+	graph.run(parametersList->numThreads);
+}
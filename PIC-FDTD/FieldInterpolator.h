@@ -7,6 +7,8 @@
 
 #include "Mesh.h"
 #include "Parameters.h"
+#include "ShapeFunction.h"
+#include "TaskGraph.h"
 #include "VectorParticle.h"
 
 //! \class FieldInterpolator
@@ -25,5 +27,10 @@ public:
 
 
 	// Methods
-
+	template <int Order>
+	void interpolateFields(Parameters *parametersList, Mesh *mesh,
+		VectorParticle *particlesVector);				//!< Interpolate fields with a B-spline shape
+	template <int Order>
+	void interpolateFieldsTiled(Parameters *parametersList, Mesh *mesh,
+		VectorParticle *particlesVector);				//!< Interpolate fields tile by tile
 };
\ No newline at end of file
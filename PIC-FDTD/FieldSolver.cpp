@@ -5,6 +5,52 @@
 
 #include "FieldSolver.h"
 
+// Relax every node of a mesh in index order, with relaxInternal(j, left,
+// right, top, bottom) at internal nodes and relaxBoundary(j) at the others.
+// On a structured mesh the neighbours of internal nodes follow from the column
+// and row, so stored connectivity is only read at the boundaries.
+template <typename Internal, typename Boundary>
+static void sweepNodes(const Mesh *mesh, Internal relaxInternal, Boundary relaxBoundary)
+{
+	if (!mesh->structured)
+	{
+		for (int j = 0; j < mesh->numNodes; j++)
+		{
+			if (mesh->node(j).boundaryType == boundaryInternal)
+			{
+				relaxInternal(j, mesh->node(j).leftNodeID - 1, mesh->node(j).rightNodeID - 1,
+					mesh->node(j).topNodeID - 1, mesh->node(j).bottomNodeID - 1);
+			}
+			else
+			{
+				relaxBoundary(j);
+			}
+		}
+		return;
+	}
+
+	int stride = mesh->numRows + 1;
+	for (int column = 0; column < mesh->numColumns + 1; column++)
+	{
+		if (column == 0 || column == mesh->numColumns)
+		{
+			for (int row = 0; row < mesh->numRows + 1; row++)
+			{
+				relaxBoundary(mesh->nodeIndex(column, row));
+			}
+			continue;
+		}
+
+		relaxBoundary(mesh->nodeIndex(column, 0));
+		for (int j = mesh->nodeIndex(column, 1); j < mesh->nodeIndex(column, mesh->numRows); j++)
+		{
+			relaxInternal(j, j - stride, j + stride, j - 1, j + 1);
+		}
+		relaxBoundary(mesh->nodeIndex(column, mesh->numRows));
+	}
+}
+
+
 // Default constructor
 FieldSolver::FieldSolver()
 {
@@ -13,10 +59,33 @@ FieldSolver::FieldSolver()
 // Constructor
 FieldSolver::FieldSolver(Parameters *parametersList, Mesh *mesh)
 {
-	// Set potential and fields at all nodes to zero at the start of each step
-	mesh->nodesVector.clearPhi();
+	// Set fields at all nodes to zero at the start of each step, and either
+	// clear the potential or start from previous solutions
+	if (parametersList->solverWarmStart == "none")
+	{
+		mesh->nodesVector.clearPhi();
+	}
+	else
+	{
+		mesh->nodesVector.predictPhi(parametersList->solverWarmStart == "extrapolate");
+	}
 	mesh->nodesVector.clearFields();
 
+	solvePotential(parametersList, mesh);
+	calculateFields(parametersList, mesh);
+
+	parametersList->logBrief("Field solver exited", 1);
+}
+
+// Destructor
+FieldSolver::~FieldSolver()
+{
+}
+
+
+// Solve the Poisson equation for the potential at each node
+void FieldSolver::solvePotential(Parameters *parametersList, Mesh *mesh)
+{
 	double h = mesh->h;
 
 	// TODO: How to solve for phi when open BCs are present?
@@ -28,109 +97,145 @@ FieldSolver::FieldSolver(Parameters *parametersList, Mesh *mesh)
 
 	// TODO: Test edge cases for all BC's 
 
+	// Krylov solvers work on the assembled operator, for any mesh and for
+	// axisymmetric simulations
+	if (parametersList->solverType == "PCG" || parametersList->solverType == "BiCGStab")
+	{
+		if (!mesh->poissonMatrix)
+		{
+			mesh->assembleOperators(parametersList);
+		}
+		iterations = mesh->poissonMatrix->solve(parametersList, mesh);
+		return;
+	}
+
+	// Separable direct solver, for rectangular domains with any BCs
+	if (parametersList->solverType == "FFT")
+	{
+		solveDirect(parametersList, mesh);
+		iterations = 1;
+		return;
+	}
+
 	// TODO: Check that time step is fine enough for solver stability
 	for (int i = 0; i < parametersList->maxSolverIterations; i++)
 	{
+		iterations = i + 1;
+
+		// The residual is summed from the stencil at each internal node before
+		// it is updated, so checking convergence needs no extra pass
+		bool checkResidual = i != 0 && i % parametersList->residualCheckInterval == 0;
+		double residualSum = 0.0;
+
 		// Axisymmetric simulation
 		if (parametersList->axisymmetric)
 		{
 			// TODO: Corner node equations
 
-			for (int j = 0; j < mesh->numNodes; j++)
+			auto relaxInternal = [&](int j, int leftNodeID, int rightNodeID,
+				int topNodeID, int bottomNodeID)
 			{
-				int leftNodeID = mesh->nodesVector.nodes[j].leftNodeID - 1;
-				int rightNodeID = mesh->nodesVector.nodes[j].rightNodeID - 1;
-				int topNodeID = mesh->nodesVector.nodes[j].topNodeID - 1;
-				int bottomNodeID = mesh->nodesVector.nodes[j].bottomNodeID - 1;
-
-				if (mesh->nodesVector.nodes[j].boundaryType == "internal")
+				double stencilSum = (mesh->nodesVector.nodes[j].rho / EPSILON_0) * h * h +
+					mesh->nodesVector.nodes[leftNodeID].phi +
+					mesh->nodesVector.nodes[rightNodeID].phi +
+					(1.0 + h / (2 * mesh->node(j).geometry.X(1))) *
+					mesh->nodesVector.nodes[topNodeID].phi +
+					(1.0 - h / (2 * mesh->node(j).geometry.X(1))) *
+					mesh->nodesVector.nodes[bottomNodeID].phi;
+
+				if (checkResidual)
 				{
-					mesh->nodesVector.nodes[j].phi = parametersList->SORparameter * 0.25 *
-						((mesh->nodesVector.nodes[j].rho / EPSILON_0) * h * h +
-							mesh->nodesVector.nodes[leftNodeID].phi +
-							mesh->nodesVector.nodes[rightNodeID].phi +
-							(1.0 + h / (2 * mesh->nodesVector.nodes[j].geometry.X.element(1, 0))) *
-							mesh->nodesVector.nodes[topNodeID].phi +
-							(1.0 - h / (2 * mesh->nodesVector.nodes[j].geometry.X.element(1, 0))) *
-							mesh->nodesVector.nodes[bottomNodeID].phi) +
-							(1 - parametersList->SORparameter) * mesh->nodesVector.nodes[j].phi;
+					double residual = stencilSum - 4 * mesh->nodesVector.nodes[j].phi;
+					residualSum += residual * residual;
 				}
-				else if (mesh->nodesVector.nodes[j].boundaryType == "L")
+
+				mesh->nodesVector.nodes[j].phi = parametersList->SORparameter * 0.25 * stencilSum +
+					(1 - parametersList->SORparameter) * mesh->nodesVector.nodes[j].phi;
+			};
+
+			auto relaxBoundary = [&](int j)
+			{
+				int leftNodeID = mesh->node(j).leftNodeID - 1;
+				int rightNodeID = mesh->node(j).rightNodeID - 1;
+				int topNodeID = mesh->node(j).topNodeID - 1;
+				int bottomNodeID = mesh->node(j).bottomNodeID - 1;
+
+				if (mesh->node(j).boundaryType == boundaryL)
 				{
-					if (parametersList->leftBCType == "periodic")
+					if (parametersList->leftBCType == bcPeriodic)
 					{
 						mesh->nodesVector.nodes[j].phi = parametersList->SORparameter * 0.25 *
 							((mesh->nodesVector.nodes[j].rho / EPSILON_0) * h * h +
-								mesh->nodesVector.nodes[mesh->nodesVector.nodes[j].periodicX1NodeID - 1].phi +
+								mesh->nodesVector.nodes[mesh->node(j).periodicX1NodeID - 1].phi +
 								mesh->nodesVector.nodes[rightNodeID].phi +
-								(1.0 + h / (2 * mesh->nodesVector.nodes[j].geometry.X.element(1, 0))) *
+								(1.0 + h / (2 * mesh->node(j).geometry.X(1))) *
 								mesh->nodesVector.nodes[topNodeID].phi +
-								(1.0 - h / (2 * mesh->nodesVector.nodes[j].geometry.X.element(1, 0))) *
+								(1.0 - h / (2 * mesh->node(j).geometry.X(1))) *
 								mesh->nodesVector.nodes[bottomNodeID].phi) +
 								(1 - parametersList->SORparameter) * mesh->nodesVector.nodes[j].phi;
 					}
-					else if (parametersList->leftBCType == "dirichlet")
+					else if (parametersList->leftBCType == bcDirichlet)
 					{
 						mesh->nodesVector.nodes[j].phi = parametersList->leftBCValue;
 					}
-					else if (parametersList->leftBCType == "neumann")
+					else if (parametersList->leftBCType == bcNeumann)
 					{
 						mesh->nodesVector.nodes[j].phi = parametersList->SORparameter * (1.0 / 3.0) *
 							((mesh->nodesVector.nodes[j].rho / EPSILON_0) * h * h +
 								mesh->nodesVector.nodes[rightNodeID].phi +
-								(1.0 + h / (2 * mesh->nodesVector.nodes[j].geometry.X.element(1, 0))) *
+								(1.0 + h / (2 * mesh->node(j).geometry.X(1))) *
 								mesh->nodesVector.nodes[topNodeID].phi +
-								(1.0 - h / (2 * mesh->nodesVector.nodes[j].geometry.X.element(1, 0))) *
+								(1.0 - h / (2 * mesh->node(j).geometry.X(1))) *
 								mesh->nodesVector.nodes[bottomNodeID].phi -
 								h * parametersList->leftBCValue) + (1 - parametersList->SORparameter) *
 							mesh->nodesVector.nodes[j].phi;
 					}
 				}
-				else if (mesh->nodesVector.nodes[j].boundaryType == "R")
+				else if (mesh->node(j).boundaryType == boundaryR)
 				{
-					if (parametersList->rightBCType == "periodic")
+					if (parametersList->rightBCType == bcPeriodic)
 					{
 						mesh->nodesVector.nodes[j].phi = parametersList->SORparameter * 0.25 *
 							((mesh->nodesVector.nodes[j].rho / EPSILON_0) * h * h +
 								mesh->nodesVector.nodes[leftNodeID].phi +
-								mesh->nodesVector.nodes[mesh->nodesVector.nodes[j].periodicX1NodeID - 1].phi +
-								(1.0 + h / (2 * mesh->nodesVector.nodes[j].geometry.X.element(1, 0))) *
+								mesh->nodesVector.nodes[mesh->node(j).periodicX1NodeID - 1].phi +
+								(1.0 + h / (2 * mesh->node(j).geometry.X(1))) *
 								mesh->nodesVector.nodes[topNodeID].phi +
-								(1.0 - h / (2 * mesh->nodesVector.nodes[j].geometry.X.element(1, 0))) *
+								(1.0 - h / (2 * mesh->node(j).geometry.X(1))) *
 								mesh->nodesVector.nodes[bottomNodeID].phi) +
 								(1 - parametersList->SORparameter) * mesh->nodesVector.nodes[j].phi;
 					}
-					else if (parametersList->rightBCType == "dirichlet")
+					else if (parametersList->rightBCType == bcDirichlet)
 					{
 						mesh->nodesVector.nodes[j].phi = parametersList->rightBCValue;
 					}
-					else if (parametersList->rightBCType == "neumann")
+					else if (parametersList->rightBCType == bcNeumann)
 					{
 						mesh->nodesVector.nodes[j].phi = parametersList->SORparameter * (1.0 / 3.0) *
 							((mesh->nodesVector.nodes[j].rho / EPSILON_0) * h * h +
 								mesh->nodesVector.nodes[leftNodeID].phi +
-								(1.0 + h / (2 * mesh->nodesVector.nodes[j].geometry.X.element(1, 0))) *
+								(1.0 + h / (2 * mesh->node(j).geometry.X(1))) *
 								mesh->nodesVector.nodes[topNodeID].phi +
-								(1.0 - h / (2 * mesh->nodesVector.nodes[j].geometry.X.element(1, 0))) *
+								(1.0 - h / (2 * mesh->node(j).geometry.X(1))) *
 								mesh->nodesVector.nodes[bottomNodeID].phi +
 								h * parametersList->rightBCValue) + (1 - parametersList->SORparameter) *
 							mesh->nodesVector.nodes[j].phi;
 					}
 				}
-				else if (mesh->nodesVector.nodes[j].boundaryType == "T")
+				else if (mesh->node(j).boundaryType == boundaryT)
 				{
 					// Periodic y BCs not valid for axisymmetric simulation since 
 					// bottom boundary is actually an axis 
 
-					if (parametersList->topBCType == "dirichlet")
+					if (parametersList->topBCType == bcDirichlet)
 					{
 						mesh->nodesVector.nodes[j].phi = parametersList->topBCValue;
 					}
-					else if (parametersList->topBCType == "neumann")
+					else if (parametersList->topBCType == bcNeumann)
 					{
 						mesh->nodesVector.nodes[j].phi = parametersList->SORparameter * (1.0 / 3.0) *
 							(h * h * ((mesh->nodesVector.nodes[j].rho / EPSILON_0) +
-							(parametersList->topBCValue / mesh->nodesVector.nodes[j].geometry.X.element(1, 0))) +
+							(parametersList->topBCValue / mesh->node(j).geometry.X(1))) +
 								mesh->nodesVector.nodes[leftNodeID].phi +
 								mesh->nodesVector.nodes[rightNodeID].phi +
 								mesh->nodesVector.nodes[bottomNodeID].phi +
@@ -138,7 +243,7 @@ FieldSolver::FieldSolver(Parameters *parametersList, Mesh *mesh)
 							mesh->nodesVector.nodes[j].phi;
 					}
 				}
-				else if (mesh->nodesVector.nodes[j].boundaryType == "B")
+				else if (mesh->node(j).boundaryType == boundaryB)
 				{
 					// Bottom nodes must always obey the symmetry BC
 
@@ -149,32 +254,13 @@ FieldSolver::FieldSolver(Parameters *parametersList, Mesh *mesh)
 							2 * mesh->nodesVector.nodes[topNodeID].phi) +
 							(1 - parametersList->SORparameter) * mesh->nodesVector.nodes[j].phi;
 				}
-			}
+			};
+
+			sweepNodes(mesh, relaxInternal, relaxBoundary);
 
 			// Check convergence
-			if (i != 0 && i % 9 == 0)
+			if (checkResidual)
 			{
-				double residualSum = 0;
-
-				for (int j = 0; j < mesh->numNodes; j++)
-				{
-					// TODO: Include other nodes in calculating residual sum (???)
-					if (mesh->nodesVector.nodes[j].boundaryType == "internal")
-					{
-						double residual = 
-							(mesh->nodesVector.nodes[j].rho / EPSILON_0) * h * h +
-							mesh->nodesVector.nodes[mesh->nodesVector.nodes[j].leftNodeID - 1].phi +
-							mesh->nodesVector.nodes[mesh->nodesVector.nodes[j].rightNodeID - 1].phi +
-							(1.0 + h / (2 * mesh->nodesVector.nodes[j].geometry.X.element(1, 0))) *
-							mesh->nodesVector.nodes[mesh->nodesVector.nodes[j].topNodeID - 1].phi +
-							(1.0 - h / (2 * mesh->nodesVector.nodes[j].geometry.X.element(1, 0))) *
-							mesh->nodesVector.nodes[mesh->nodesVector.nodes[j].bottomNodeID - 1].phi -
-							4 * mesh->nodesVector.nodes[j].phi;
-
-						residualSum += residual * residual;
-					}
-				}
-
 				if (sqrt(residualSum / static_cast<double>(mesh->numNodes)) < parametersList->residualTolerance)
 				{
 					parametersList->logBrief("Solver convergence criteria met", 1);
@@ -182,264 +268,60 @@ FieldSolver::FieldSolver(Parameters *parametersList, Mesh *mesh)
 				}
 			}
 
-			// Account for periodic BCs 
-			for (int i = 0; i < mesh->numNodes; i++)
-			{
-				if (parametersList->leftBCType == "periodic")
-				{
-					if (mesh->nodesVector.nodes[i].boundaryType == "TL" ||
-						mesh->nodesVector.nodes[i].boundaryType == "L" ||
-						mesh->nodesVector.nodes[i].boundaryType == "BL")
-					{
-						mesh->nodesVector.nodes[i].phi = 0.5 * (mesh->nodesVector.nodes[i].phi +
-							mesh->nodesVector.nodes[mesh->nodesVector.nodes[i].periodicX1NodeID - 1].phi);
-						mesh->nodesVector.nodes[mesh->nodesVector.nodes[i].periodicX1NodeID - 1].phi =
-							mesh->nodesVector.nodes[i].phi;
-					}
-				}
-			}
+			// Account for periodic BCs
+			mesh->averagePeriodic(&Nodes::phi, parametersList->leftBCType == bcPeriodic, false);
 		}
 		else
 		{
-			if (parametersList->solverType == "FFT")
+			// Gauss-Seidel solver with successive over-relaxation (SOR)
+			if (parametersList->solverType == "GS")
 			{
-				// TODO: Implement FFT based solver for mixed BC cases, and until
-				// then check that the same BC is applied across the domain
-				int nx = mesh->numColumns + 1, ny = mesh->numRows + 1;
-
-				// Periodic BC case
-				if (parametersList->bottomBCType == "periodic" && parametersList->rightBCType == "periodic")
-				{
-					// Allocate memory for signal (real) and transformed signal (complex)
-					double *signal;
-					signal = (double*)fftw_malloc(sizeof(double) * mesh->numNodes);
-					fftw_complex *transform;
-					transform = (fftw_complex*)fftw_malloc(sizeof(fftw_complex) *
-						ny * (1 + nx / 2));
-
-					// Copy charge density from nodesVector into signal array
-					for (int i = 0; i < ny; i++)
-					{
-						for (int j = 0; j < nx; j++)
-						{
-							signal[i*nx + j] =
-								mesh->nodesVector.nodes[i*nx + j].rho;
-						}
-					}
-
-					// Create and execute plan for forwards DFT
-					fftw_plan forwardsPlan = fftw_plan_dft_r2c_2d(ny, nx, signal,
-						transform, FFTW_ESTIMATE);
-					fftw_execute(forwardsPlan);
-
-					// Calculate (transformed) potential phi based on (transformed)
-					// charge density				
-					double W = exp(2.0 * std::_Pi * sqrt(-1.0) / static_cast<double>(nx));
-					double Wm = 1, Wn = 1;
-
-					// TODO: Current formulation assumes uniform length boundaries
-					for (int i = 0; i < nx; i++)
-					{
-						for (int j = 0; j < ny; j++)
-						{
-							double denominator = 4 - Wm - Wn - 1.0 / Wm - 1.0 / Wn;
-							if (denominator != 0.0)
-							{
-								transform[i*ny + j][0] *= mesh->h * mesh->h / denominator;
-								// TODO: Need to multiply complex part as well??
-							}
-							Wn *= W;
-						}
-						Wm *= W;
-					}
-
-					// Create and execute plan for backwards (inverse) DFT
-					fftw_plan backwardsPlan = fftw_plan_dft_c2r_2d(ny,
-						nx, transform, signal, FFTW_ESTIMATE);
-					fftw_execute(backwardsPlan);
-
-					// Write data from signal array back to nodesVector phi
-					for (int i = 0; i < ny; i++)
-					{
-						for (int j = 0; j < nx; j++)
-						{
-							mesh->nodesVector.nodes[i*nx + j].phi = signal[i*nx + j] /
-								static_cast<double>(ny * nx);
-						}
-					}
-
-					// Destroy plans and memory blocks allocated with fftw_malloc
-					fftw_destroy_plan(forwardsPlan);
-					fftw_destroy_plan(backwardsPlan);
-					fftw_free(signal);
-					fftw_free(transform);
-				}
-				// Dirichlet BC case
-				else if (parametersList->bottomBCType == "dirichlet" && parametersList->rightBCType == "dirichlet")
-				{
-					// Allocate memory for signal (real) and transformed signal (real)
-					double *signal, *transform;
-					signal = (double*)fftw_malloc(sizeof(double) * mesh->numNodes);
-					transform = (double*)fftw_malloc(sizeof(double) * mesh->numNodes);
-
-					// Copy charge density from nodesVector into signal array
-					for (int i = 0; i < ny; i++)
-					{
-						for (int j = 0; j < nx; j++)
-						{
-							signal[i*nx + j] =
-								mesh->nodesVector.nodes[i*nx + j].rho;
-						}
-					}
-
-					// Create and execute plan for forwards DST
-					fftw_plan forwardsPlan = fftw_plan_r2r_2d(ny, nx, signal,
-						transform, FFTW_RODFT00, FFTW_RODFT00, FFTW_ESTIMATE);
-					fftw_execute(forwardsPlan);
-
-					// Calculate (transformed) potential phi based on (transformed)
-					// charge density				
-
-					// TODO: Current formulation assumes uniform length boundaries
-					for (int i = 0; i < nx; i++)
-					{
-						for (int j = 0; j < ny; j++)
-						{
-							double denominator = 4.0 - 2.0 * 
-								(cos(std::_Pi * static_cast<double>(i + 1) / static_cast<double>(nx + 1)) +
-								cos(std::_Pi * static_cast<double>(j + 1) / static_cast<double>(ny + 1)));
-							if (denominator != 0.0)
-							{
-								transform[i*ny + j] *= mesh->h * mesh->h / denominator;
-							}
-						}
-					}
-
-					// Create and execute plan for backwards (inverse) DST
-					fftw_plan backwardsPlan = fftw_plan_r2r_2d(ny, nx, transform,
-						signal, FFTW_RODFT00, FFTW_RODFT00, FFTW_ESTIMATE);
-					fftw_execute(backwardsPlan);
-
-					// Write data from signal array back to nodesVector phi
-					for (int i = 0; i < ny; i++)
-					{
-						for (int j = 0; j < nx; j++)
-						{
-							mesh->nodesVector.nodes[i*nx + j].phi = signal[i*nx + j] /
-								static_cast<double>((2.0 * (ny + 1.0)) * (2.0 * (nx + 1.0)));
-						}
-					}
-
-					// Destroy plans and memory blocks allocated with fftw_malloc
-					fftw_destroy_plan(forwardsPlan);
-					fftw_destroy_plan(backwardsPlan);
-					fftw_free(signal);
-					fftw_free(transform);
-				}
-				// Neumann BC case
-				else if (parametersList->bottomBCType == "neumann" && parametersList->rightBCType == "neumann")
+				// Five point stencil is used on internal points and periodic
+				// boundaries, while for other BCs and the four corner nodes, a
+				// three point stencil or fixed value is used
+				auto relaxInternal = [&](int j, int leftNodeID, int rightNodeID,
+					int topNodeID, int bottomNodeID)
 				{
-					// Allocate memory for signal (real) and transformed signal (real)
-					double *signal, *transform;
-					signal = (double*)fftw_malloc(sizeof(double) * mesh->numNodes);
-					transform = (double*)fftw_malloc(sizeof(double) * mesh->numNodes);
-
-					// Copy charge density from nodesVector into signal array
-					for (int i = 0; i < ny; i++)
-					{
-						for (int j = 0; j < nx; j++)
-						{
-							signal[i*nx + j] =
-								mesh->nodesVector.nodes[i*nx + j].rho;
-						}
-					}
-
-					// Create and execute plan for forwards DCT
-					fftw_plan forwardsPlan = fftw_plan_r2r_2d(ny, nx, signal,
-						transform, FFTW_REDFT11, FFTW_REDFT11, FFTW_ESTIMATE);
-					fftw_execute(forwardsPlan);
-
-					// Calculate (transformed) potential phi based on (transformed)
-					// charge density				
+					double stencilSum = (mesh->nodesVector.nodes[j].rho / EPSILON_0) * h * h +
+						mesh->nodesVector.nodes[leftNodeID].phi +
+						mesh->nodesVector.nodes[rightNodeID].phi +
+						mesh->nodesVector.nodes[topNodeID].phi +
+						mesh->nodesVector.nodes[bottomNodeID].phi;
 
-					// TODO: Current formulation assumes uniform length boundaries
-					for (int i = 0; i < nx; i++)
+					if (checkResidual)
 					{
-						for (int j = 0; j < ny; j++)
-						{
-							double denominator = 4.0 - 2.0 *
-								(cos(std::_Pi * static_cast<double>(i + 0.5) / static_cast<double>(nx)) +
-									cos(std::_Pi * static_cast<double>(j + 0.5) / static_cast<double>(ny)));
-							if (denominator != 0.0)
-							{
-								transform[i*ny + j] *= mesh->h * mesh->h / denominator;
-							}
-						}
+						double residual = stencilSum - 4 * mesh->nodesVector.nodes[j].phi;
+						residualSum += residual * residual;
 					}
 
-					// Create and execute plan for backwards (inverse) DCT
-					fftw_plan backwardsPlan = fftw_plan_r2r_2d(ny, nx, transform,
-						signal, FFTW_REDFT11, FFTW_REDFT11, FFTW_ESTIMATE);
-					fftw_execute(backwardsPlan);
-
-					// Write data from signal array back to nodesVector phi
-					for (int i = 0; i < ny; i++)
-					{
-						for (int j = 0; j < nx; j++)
-						{
-							mesh->nodesVector.nodes[i*nx + j].phi = signal[i*nx + j] /
-								static_cast<double>((2.0 * ny) * (2.0 * nx));
-						}
-					}
+					mesh->nodesVector.nodes[j].phi = parametersList->SORparameter * 0.25 * stencilSum +
+						(1 - parametersList->SORparameter) * mesh->nodesVector.nodes[j].phi;
+				};
 
-					// Destroy plans and memory blocks allocated with fftw_malloc
-					fftw_destroy_plan(forwardsPlan);
-					fftw_destroy_plan(backwardsPlan);
-					fftw_free(signal);
-					fftw_free(transform);
-				}
-			}
-			// Gauss-Seidel solver with successive over-relaxation (SOR)
-			else if (parametersList->solverType == "GS")
-			{
-				for (int j = 0; j < mesh->numNodes; j++)
+				auto relaxBoundary = [&](int j)
 				{
-					// Five point stencil is used on internal points and periodic
-					// boundaries, while for other BCs and the four corner nodes, a
-					// three point stencil or fixed value is used
-
-					int leftNodeID = mesh->nodesVector.nodes[j].leftNodeID - 1;
-					int rightNodeID = mesh->nodesVector.nodes[j].rightNodeID - 1;
-					int topNodeID = mesh->nodesVector.nodes[j].topNodeID - 1;
-					int bottomNodeID = mesh->nodesVector.nodes[j].bottomNodeID - 1;
+					int leftNodeID = mesh->node(j).leftNodeID - 1;
+					int rightNodeID = mesh->node(j).rightNodeID - 1;
+					int topNodeID = mesh->node(j).topNodeID - 1;
+					int bottomNodeID = mesh->node(j).bottomNodeID - 1;
 
-					if (mesh->nodesVector.nodes[j].boundaryType == "internal")
+					if (mesh->node(j).boundaryType == boundaryL)
 					{
-						mesh->nodesVector.nodes[j].phi = parametersList->SORparameter * 0.25 *
-							((mesh->nodesVector.nodes[j].rho / EPSILON_0) * h * h +
-								mesh->nodesVector.nodes[leftNodeID].phi +
-								mesh->nodesVector.nodes[rightNodeID].phi +
-								mesh->nodesVector.nodes[topNodeID].phi +
-								mesh->nodesVector.nodes[bottomNodeID].phi) +
-								(1 - parametersList->SORparameter) * mesh->nodesVector.nodes[j].phi;
-					}
-					else if (mesh->nodesVector.nodes[j].boundaryType == "L")
-					{
-						if (parametersList->leftBCType == "periodic")
+						if (parametersList->leftBCType == bcPeriodic)
 						{
 							mesh->nodesVector.nodes[j].phi = parametersList->SORparameter * 0.25 *
 								((mesh->nodesVector.nodes[j].rho / EPSILON_0) * h * h +
-									mesh->nodesVector.nodes[mesh->nodesVector.nodes[j].periodicX1NodeID - 1].phi +
+									mesh->nodesVector.nodes[mesh->node(j).periodicX1NodeID - 1].phi +
 									mesh->nodesVector.nodes[rightNodeID].phi +
 									mesh->nodesVector.nodes[topNodeID].phi +
 									mesh->nodesVector.nodes[bottomNodeID].phi) +
 									(1 - parametersList->SORparameter) * mesh->nodesVector.nodes[j].phi;
 						}
-						else if (parametersList->leftBCType == "dirichlet")
+						else if (parametersList->leftBCType == bcDirichlet)
 						{
 							mesh->nodesVector.nodes[j].phi = parametersList->leftBCValue;
 						}
-						else if (parametersList->leftBCType == "neumann")
+						else if (parametersList->leftBCType == bcNeumann)
 						{
 							mesh->nodesVector.nodes[j].phi = parametersList->SORparameter * (1.0 / 3.0) *
 								((mesh->nodesVector.nodes[j].rho / EPSILON_0) * h * h +
@@ -450,23 +332,23 @@ FieldSolver::FieldSolver(Parameters *parametersList, Mesh *mesh)
 								mesh->nodesVector.nodes[j].phi;
 						}
 					}
-					else if (mesh->nodesVector.nodes[j].boundaryType == "R")
+					else if (mesh->node(j).boundaryType == boundaryR)
 					{
-						if (parametersList->rightBCType == "periodic")
+						if (parametersList->rightBCType == bcPeriodic)
 						{
 							mesh->nodesVector.nodes[j].phi = parametersList->SORparameter * 0.25 *
 								((mesh->nodesVector.nodes[j].rho / EPSILON_0) * h * h +
 									mesh->nodesVector.nodes[leftNodeID].phi +
-									mesh->nodesVector.nodes[mesh->nodesVector.nodes[j].periodicX1NodeID - 1].phi +
+									mesh->nodesVector.nodes[mesh->node(j).periodicX1NodeID - 1].phi +
 									mesh->nodesVector.nodes[topNodeID].phi +
 									mesh->nodesVector.nodes[bottomNodeID].phi) +
 									(1 - parametersList->SORparameter) * mesh->nodesVector.nodes[j].phi;
 						}
-						else if (parametersList->rightBCType == "dirichlet")
+						else if (parametersList->rightBCType == bcDirichlet)
 						{
 							mesh->nodesVector.nodes[j].phi = parametersList->rightBCValue;
 						}
-						else if (parametersList->rightBCType == "neumann")
+						else if (parametersList->rightBCType == bcNeumann)
 						{
 							mesh->nodesVector.nodes[j].phi = parametersList->SORparameter * (1.0 / 3.0) *
 								((mesh->nodesVector.nodes[j].rho / EPSILON_0) * h * h +
@@ -477,23 +359,23 @@ FieldSolver::FieldSolver(Parameters *parametersList, Mesh *mesh)
 								mesh->nodesVector.nodes[j].phi;
 						}
 					}
-					else if (mesh->nodesVector.nodes[j].boundaryType == "T")
+					else if (mesh->node(j).boundaryType == boundaryT)
 					{
-						if (parametersList->topBCType == "periodic")
+						if (parametersList->topBCType == bcPeriodic)
 						{
 							mesh->nodesVector.nodes[j].phi = parametersList->SORparameter * 0.25 *
 								((mesh->nodesVector.nodes[j].rho / EPSILON_0) * h * h +
 									mesh->nodesVector.nodes[leftNodeID].phi +
 									mesh->nodesVector.nodes[rightNodeID].phi +
-									mesh->nodesVector.nodes[mesh->nodesVector.nodes[j].periodicX2NodeID - 1].phi +
+									mesh->nodesVector.nodes[mesh->node(j).periodicX2NodeID - 1].phi +
 									mesh->nodesVector.nodes[bottomNodeID].phi) +
 									(1 - parametersList->SORparameter) * mesh->nodesVector.nodes[j].phi;
 						}
-						else if (parametersList->topBCType == "dirichlet")
+						else if (parametersList->topBCType == bcDirichlet)
 						{
 							mesh->nodesVector.nodes[j].phi = parametersList->topBCValue;
 						}
-						else if (parametersList->topBCType == "neumann")
+						else if (parametersList->topBCType == bcNeumann)
 						{
 							mesh->nodesVector.nodes[j].phi = parametersList->SORparameter * (1.0 / 3.0) *
 								((mesh->nodesVector.nodes[j].rho / EPSILON_0) * h * h +
@@ -504,23 +386,23 @@ FieldSolver::FieldSolver(Parameters *parametersList, Mesh *mesh)
 								mesh->nodesVector.nodes[j].phi;
 						}
 					}
-					else if (mesh->nodesVector.nodes[j].boundaryType == "B")
+					else if (mesh->node(j).boundaryType == boundaryB)
 					{
-						if (parametersList->bottomBCType == "periodic")
+						if (parametersList->bottomBCType == bcPeriodic)
 						{
 							mesh->nodesVector.nodes[j].phi = parametersList->SORparameter * 0.25 *
 								((mesh->nodesVector.nodes[j].rho / EPSILON_0) * h * h +
 									mesh->nodesVector.nodes[leftNodeID].phi +
 									mesh->nodesVector.nodes[rightNodeID].phi +
 									mesh->nodesVector.nodes[topNodeID].phi +
-									mesh->nodesVector.nodes[mesh->nodesVector.nodes[j].periodicX2NodeID - 1].phi) +
+									mesh->nodesVector.nodes[mesh->node(j).periodicX2NodeID - 1].phi) +
 									(1 - parametersList->SORparameter) * mesh->nodesVector.nodes[j].phi;
 						}
-						else if (parametersList->bottomBCType == "dirichlet")
+						else if (parametersList->bottomBCType == bcDirichlet)
 						{
 							mesh->nodesVector.nodes[j].phi = parametersList->bottomBCValue;
 						}
-						else if (parametersList->bottomBCType == "neumann")
+						else if (parametersList->bottomBCType == bcNeumann)
 						{
 							mesh->nodesVector.nodes[j].phi = parametersList->SORparameter * (1.0 / 3.0) *
 								((mesh->nodesVector.nodes[j].rho / EPSILON_0) * h * h +
@@ -533,12 +415,12 @@ FieldSolver::FieldSolver(Parameters *parametersList, Mesh *mesh)
 					}
 					else
 					{
-						if (parametersList->leftBCType == "neumann" &&
-							parametersList->rightBCType == "neumann" &&
-							parametersList->topBCType == "neumann" &&
-							parametersList->bottomBCType == "neumann")
+						if (parametersList->leftBCType == bcNeumann &&
+							parametersList->rightBCType == bcNeumann &&
+							parametersList->topBCType == bcNeumann &&
+							parametersList->bottomBCType == bcNeumann)
 						{
-							if (mesh->nodesVector.nodes[j].boundaryType == "TL")
+							if (mesh->node(j).boundaryType == boundaryTL)
 							{
 								mesh->nodesVector.nodes[j].phi = parametersList->SORparameter * 0.5 *
 									((mesh->nodesVector.nodes[j].rho / EPSILON_0) * h * h +
@@ -547,7 +429,7 @@ FieldSolver::FieldSolver(Parameters *parametersList, Mesh *mesh)
 										h * (parametersList->topBCValue - parametersList->leftBCValue)) +
 										(1 - parametersList->SORparameter) * mesh->nodesVector.nodes[j].phi;
 							}
-							else if (mesh->nodesVector.nodes[j].boundaryType == "BL")
+							else if (mesh->node(j).boundaryType == boundaryBL)
 							{
 								mesh->nodesVector.nodes[j].phi = parametersList->SORparameter * 0.5 *
 									((mesh->nodesVector.nodes[j].rho / EPSILON_0) * h * h +
@@ -556,7 +438,7 @@ FieldSolver::FieldSolver(Parameters *parametersList, Mesh *mesh)
 										h * (parametersList->bottomBCValue + parametersList->leftBCValue)) +
 										(1 - parametersList->SORparameter) * mesh->nodesVector.nodes[j].phi;
 							}
-							else if (mesh->nodesVector.nodes[j].boundaryType == "TR")
+							else if (mesh->node(j).boundaryType == boundaryTR)
 							{
 								mesh->nodesVector.nodes[j].phi = parametersList->SORparameter * 0.5 *
 									((mesh->nodesVector.nodes[j].rho / EPSILON_0) * h * h +
@@ -565,7 +447,7 @@ FieldSolver::FieldSolver(Parameters *parametersList, Mesh *mesh)
 										h * (parametersList->topBCValue + parametersList->rightBCValue)) +
 										(1 - parametersList->SORparameter) * mesh->nodesVector.nodes[j].phi;
 							}
-							else if (mesh->nodesVector.nodes[j].boundaryType == "BR")
+							else if (mesh->node(j).boundaryType == boundaryBR)
 							{
 								mesh->nodesVector.nodes[j].phi = parametersList->SORparameter * 0.5 *
 									((mesh->nodesVector.nodes[j].rho / EPSILON_0) * h * h +
@@ -575,43 +457,43 @@ FieldSolver::FieldSolver(Parameters *parametersList, Mesh *mesh)
 										(1 - parametersList->SORparameter) * mesh->nodesVector.nodes[j].phi;
 							}
 						}
-						else if (parametersList->leftBCType == "dirichlet" &&
-							parametersList->topBCType == "dirichlet")
+						else if (parametersList->leftBCType == bcDirichlet &&
+							parametersList->topBCType == bcDirichlet)
 						{
 							mesh->nodesVector.nodes[j].phi = 0.5 * (parametersList->leftBCValue +
 								parametersList->topBCValue);
 						}
-						else if (parametersList->leftBCType == "dirichlet" &&
-							parametersList->bottomBCType == "dirichlet")
+						else if (parametersList->leftBCType == bcDirichlet &&
+							parametersList->bottomBCType == bcDirichlet)
 						{
 							mesh->nodesVector.nodes[j].phi = 0.5 * (parametersList->leftBCValue +
 								parametersList->bottomBCValue);
 						}
-						else if (parametersList->rightBCType == "dirichlet" &&
-							parametersList->topBCType == "dirichlet")
+						else if (parametersList->rightBCType == bcDirichlet &&
+							parametersList->topBCType == bcDirichlet)
 						{
 							mesh->nodesVector.nodes[j].phi = 0.5 * (parametersList->rightBCValue +
 								parametersList->topBCValue);
 						}
-						else if (parametersList->rightBCType == "dirichlet" &&
-							parametersList->bottomBCType == "dirichlet")
+						else if (parametersList->rightBCType == bcDirichlet &&
+							parametersList->bottomBCType == bcDirichlet)
 						{
 							mesh->nodesVector.nodes[j].phi = 0.5 * (parametersList->rightBCValue +
 								parametersList->bottomBCValue);
 						}
-						else if (parametersList->leftBCType == "dirichlet")
+						else if (parametersList->leftBCType == bcDirichlet)
 						{
 							mesh->nodesVector.nodes[j].phi = parametersList->leftBCValue;
 						}
-						else if (parametersList->rightBCType == "dirichlet")
+						else if (parametersList->rightBCType == bcDirichlet)
 						{
 							mesh->nodesVector.nodes[j].phi = parametersList->rightBCValue;
 						}
-						else if (parametersList->topBCType == "dirichlet")
+						else if (parametersList->topBCType == bcDirichlet)
 						{
 							mesh->nodesVector.nodes[j].phi = parametersList->topBCValue;
 						}
-						else if (parametersList->bottomBCType == "dirichlet")
+						else if (parametersList->bottomBCType == bcDirichlet)
 						{
 							mesh->nodesVector.nodes[j].phi = parametersList->bottomBCValue;
 						}
@@ -622,30 +504,13 @@ FieldSolver::FieldSolver(Parameters *parametersList, Mesh *mesh)
 							mesh->nodesVector.nodes[j].phi = 0.0;
 						}
 					}
-				}
+				};
+
+				sweepNodes(mesh, relaxInternal, relaxBoundary);
 
 				// Check convergence
-				if (i != 0 && i % 9 == 0)
+				if (checkResidual)
 				{
-					double residualSum = 0;
-
-					for (int j = 0; j < mesh->numNodes; j++)
-					{
-						// TODO: Include other nodes in calculating residual sum (???)
-						if (mesh->nodesVector.nodes[j].boundaryType == "internal")
-						{
-							double residual =
-								(mesh->nodesVector.nodes[j].rho / EPSILON_0) * h * h +
-								mesh->nodesVector.nodes[mesh->nodesVector.nodes[j].leftNodeID - 1].phi +
-								mesh->nodesVector.nodes[mesh->nodesVector.nodes[j].rightNodeID - 1].phi +
-								mesh->nodesVector.nodes[mesh->nodesVector.nodes[j].topNodeID - 1].phi +
-								mesh->nodesVector.nodes[mesh->nodesVector.nodes[j].bottomNodeID - 1].phi -
-								4 * mesh->nodesVector.nodes[j].phi;
-
-							residualSum += residual * residual;
-						}
-					}
-
 					if (sqrt(residualSum / static_cast<double>(mesh->numNodes)) < parametersList->residualTolerance)
 					{
 						parametersList->logBrief("Solver convergence criteria met", 1);
@@ -653,231 +518,316 @@ FieldSolver::FieldSolver(Parameters *parametersList, Mesh *mesh)
 					}
 				}
 
-				// Account for periodic BCs 
-				for (int i = 0; i < mesh->numNodes; i++)
-				{
-					if (parametersList->leftBCType == "periodic")
-					{
-						if (mesh->nodesVector.nodes[i].boundaryType == "TL" ||
-							mesh->nodesVector.nodes[i].boundaryType == "L" ||
-							mesh->nodesVector.nodes[i].boundaryType == "BL")
-						{
-							mesh->nodesVector.nodes[i].phi = 0.5 * (mesh->nodesVector.nodes[i].phi +
-								mesh->nodesVector.nodes[mesh->nodesVector.nodes[i].periodicX1NodeID - 1].phi);
-							mesh->nodesVector.nodes[mesh->nodesVector.nodes[i].periodicX1NodeID - 1].phi =
-								mesh->nodesVector.nodes[i].phi;
-						}
-					}
-					if (parametersList->topBCType == "periodic")
-					{
-						if (mesh->nodesVector.nodes[i].boundaryType == "TL" ||
-							mesh->nodesVector.nodes[i].boundaryType == "T" ||
-							mesh->nodesVector.nodes[i].boundaryType == "TR")
-						{
-							mesh->nodesVector.nodes[i].phi = 0.5 * (mesh->nodesVector.nodes[i].phi +
-								mesh->nodesVector.nodes[mesh->nodesVector.nodes[i].periodicX2NodeID - 1].phi);
-							mesh->nodesVector.nodes[mesh->nodesVector.nodes[i].periodicX2NodeID - 1].phi =
-								mesh->nodesVector.nodes[i].phi;
-						}
-					}
-				}
+				// Account for periodic BCs
+				mesh->averagePeriodic(&Nodes::phi, parametersList->leftBCType == bcPeriodic,
+					parametersList->topBCType == bcPeriodic);
 			}
 		}
 	}
+}
+
 
-	// Electric field
-	for (int i = 0; i < mesh->numNodes; i++)
+// Solve the Poisson equation directly on a structured mesh. The five point
+// stencil separates, so a transform along one axis decouples the modes, each
+// of which is then a tridiagonal system along the other axis, solved with the
+// Thomas algorithm. The transform follows the BCs at the ends of its axis:
+// Fourier for periodic, sine for fixed (dirichlet or open) at both ends, cosine
+// for neumann at both ends, and sine on a mirrored line for one of each.
+// Boundary values are lifted onto the right hand side. Axisymmetric equations
+// are transformed in z, since their coefficients vary in r, and Cartesian ones
+// in x unless y is periodic. Corners follow the equations of both edges, or
+// take the average where both are dirichlet, as in the SOR solver.
+void FieldSolver::solveDirect(Parameters *parametersList, Mesh *mesh)
+{
+	double h = mesh->h;
+	bool axisymmetric = parametersList->axisymmetric;
+	bool transformX = axisymmetric || parametersList->topBCType != bcPeriodic;
+	std::vector<Nodes> &nodes = mesh->nodesVector.nodes;
+
+	// Sides are left, right, top and bottom, with the sign of the flux term
+	// of a neumann BC. The axis of an axisymmetric simulation is not a side.
+	BCType types[4] = { parametersList->leftBCType, parametersList->rightBCType,
+		parametersList->topBCType, parametersList->bottomBCType };
+	double values[4] = { parametersList->leftBCValue, parametersList->rightBCValue,
+		parametersList->topBCValue, parametersList->bottomBCValue };
+	double signs[4] = { -1.0, 1.0, 1.0, -1.0 };
+	auto dirichlet = [&](int side)
 	{
-		int leftNodeID = mesh->nodesVector.nodes[i].leftNodeID - 1;
-		int rightNodeID = mesh->nodesVector.nodes[i].rightNodeID - 1;
-		int topNodeID = mesh->nodesVector.nodes[i].topNodeID - 1;
-		int bottomNodeID = mesh->nodesVector.nodes[i].bottomNodeID - 1;
-		int periodicX1NodeID = mesh->nodesVector.nodes[i].periodicX1NodeID - 1;
-		int periodicX2NodeID = mesh->nodesVector.nodes[i].periodicX2NodeID - 1;
-
-		if (mesh->nodesVector.nodes[i].boundaryType == "internal")
-		{
-			mesh->nodesVector.nodes[i].EMfield[0] = (mesh->nodesVector.nodes[leftNodeID].phi -
-				mesh->nodesVector.nodes[rightNodeID].phi) / (2 * h);
+		return types[side] == bcDirichlet && !(axisymmetric && side == 3);
+	};
+	auto fixed = [&](int side)
+	{
+		return (types[side] == bcDirichlet || types[side] == bcOpen) && !(axisymmetric && side == 3);
+	};
 
-			mesh->nodesVector.nodes[i].EMfield[1] = (mesh->nodesVector.nodes[bottomNodeID].phi -
-				mesh->nodesVector.nodes[topNodeID].phi) / (2 * h);
-		}
-		else if (mesh->nodesVector.nodes[i].boundaryType == "T")
+	// Set dirichlet potentials, while open boundaries keep their potential
+	for (int column = 0; column < mesh->numColumns + 1; column++)
+	{
+		for (int row = 0; row < mesh->numRows + 1; row++)
 		{
-			mesh->nodesVector.nodes[i].EMfield[0] = (mesh->nodesVector.nodes[leftNodeID].phi -
-				mesh->nodesVector.nodes[rightNodeID].phi) / (2 * h);
-
-			if (parametersList->topBCType == "periodic")
+			bool onSide[4] = { column == 0, column == mesh->numColumns, row == 0, row == mesh->numRows };
+			double sum = 0.0;
+			int count = 0;
+			for (int side = 0; side < 4; side++)
 			{
-				mesh->nodesVector.nodes[i].EMfield[1] = (mesh->nodesVector.nodes[bottomNodeID].phi -
-					mesh->nodesVector.nodes[periodicX2NodeID].phi) / (2 * h);
+				if (onSide[side] && dirichlet(side))
+				{
+					sum += values[side];
+					count++;
+				}
 			}
-			else
+			if (count > 0)
 			{
-				mesh->nodesVector.nodes[i].EMfield[1] = (mesh->nodesVector.nodes[i].phi -
-					mesh->nodesVector.nodes[bottomNodeID].phi) / h;
+				nodes[mesh->nodeIndex(column, row)].phi = sum / count;
 			}
 		}
-		else if (mesh->nodesVector.nodes[i].boundaryType == "B")
-		{
-			mesh->nodesVector.nodes[i].EMfield[0] = (mesh->nodesVector.nodes[leftNodeID].phi -
-				mesh->nodesVector.nodes[rightNodeID].phi) / (2 * h);
+	}
 
-			if (parametersList->bottomBCType == "periodic")
-			{
-				mesh->nodesVector.nodes[i].EMfield[1] = (mesh->nodesVector.nodes[periodicX2NodeID].phi -
-					mesh->nodesVector.nodes[topNodeID].phi) / (2 * h);
-			}
-			else
-			{
-				mesh->nodesVector.nodes[i].EMfield[1] = (mesh->nodesVector.nodes[i].phi -
-					mesh->nodesVector.nodes[topNodeID].phi) / h;
-			}
+	// Transform axis t and line axis s, each numbered from its first side
+	// (left or top) to its last (right or bottom)
+	int numT = transformX ? mesh->numColumns : mesh->numRows;
+	int numS = transformX ? mesh->numRows : mesh->numColumns;
+	int firstT = transformX ? 0 : 2, lastT = firstT + 1;
+	int firstS = transformX ? 2 : 0, lastS = firstS + 1;
+	auto index = [&](int t, int s)
+	{
+		return transformX ? mesh->nodeIndex(t, s) : mesh->nodeIndex(s, t);
+	};
+
+	// Unknowns along t in transform order, and the transform of each line
+	std::vector<int> unknownT;
+	int length;
+	fftw_r2r_kind forwardsKind = FFTW_RODFT00, backwardsKind = FFTW_RODFT00;
+	if (types[firstT] == bcPeriodic)
+	{
+		for (int t = 0; t < numT; t++)
+		{
+			unknownT.push_back(t);
 		}
-		else if (mesh->nodesVector.nodes[i].boundaryType == "L")
+		length = numT;
+		forwardsKind = FFTW_R2HC;
+		backwardsKind = FFTW_HC2R;
+	}
+	else if (fixed(firstT) && fixed(lastT))
+	{
+		for (int t = 1; t < numT; t++)
 		{
-			if (parametersList->leftBCType == "periodic")
-			{
-				mesh->nodesVector.nodes[i].EMfield[0] = (mesh->nodesVector.nodes[periodicX1NodeID].phi -
-					mesh->nodesVector.nodes[rightNodeID].phi) / (2 * h);
-			}
-			else
-			{
-				mesh->nodesVector.nodes[i].EMfield[0] = (mesh->nodesVector.nodes[i].phi -
-					mesh->nodesVector.nodes[rightNodeID].phi) / h;
-			}
-
-			mesh->nodesVector.nodes[i].EMfield[1] = (mesh->nodesVector.nodes[bottomNodeID].phi -
-				mesh->nodesVector.nodes[topNodeID].phi) / (2 * h);
+			unknownT.push_back(t);
 		}
-		else if (mesh->nodesVector.nodes[i].boundaryType == "R")
+		length = numT - 1;
+	}
+	else if (!fixed(firstT) && !fixed(lastT))
+	{
+		for (int t = 0; t < numT + 1; t++)
 		{
-			if (parametersList->rightBCType == "periodic")
-			{
-				mesh->nodesVector.nodes[i].EMfield[0] = (mesh->nodesVector.nodes[leftNodeID].phi -
-					mesh->nodesVector.nodes[periodicX1NodeID].phi) / (2 * h);
-			}
-			else
-			{
-				mesh->nodesVector.nodes[i].EMfield[0] = (mesh->nodesVector.nodes[i].phi -
-					mesh->nodesVector.nodes[leftNodeID].phi) / h;
-			}
-
-			mesh->nodesVector.nodes[i].EMfield[1] = (mesh->nodesVector.nodes[bottomNodeID].phi -
-				mesh->nodesVector.nodes[topNodeID].phi) / (2 * h);
+			unknownT.push_back(t);
 		}
-		else if (mesh->nodesVector.nodes[i].boundaryType == "TL")
+		length = numT + 1;
+		forwardsKind = FFTW_REDFT10;
+		backwardsKind = FFTW_REDFT01;
+	}
+	else
+	{
+		// Starting from the fixed end, and mirrored about the neumann end
+		for (int a = 0; a < numT; a++)
 		{
-			if (parametersList->leftBCType == "periodic")
-			{
-				mesh->nodesVector.nodes[i].EMfield[0] = (mesh->nodesVector.nodes[periodicX1NodeID].phi -
-					mesh->nodesVector.nodes[rightNodeID].phi) / (2 * h);
-			}
-			else
-			{
-				mesh->nodesVector.nodes[i].EMfield[0] = (mesh->nodesVector.nodes[i].phi -
-					mesh->nodesVector.nodes[rightNodeID].phi) / h;
-			}
-			
-			if (parametersList->topBCType == "periodic")
-			{
-				mesh->nodesVector.nodes[i].EMfield[1] = (mesh->nodesVector.nodes[bottomNodeID].phi -
-					mesh->nodesVector.nodes[periodicX2NodeID].phi) / (2 * h);
-			}
-			else
+			unknownT.push_back(fixed(firstT) ? a + 1 : numT - 1 - a);
+		}
+		length = 2 * numT;
+	}
+	int n = unknownT.size();
+	double normalisation = (forwardsKind == FFTW_R2HC) ? length :
+		(forwardsKind == FFTW_REDFT10) ? 2.0 * length : 2.0 * (length + 1);
+
+	// Equation along s of each line, with the potential before (prev) and
+	// after (next) it, and any constant from a neumann BC
+	std::vector<double> diagonal(numS + 1, 2.0), previous(numS + 1, 1.0),
+		next(numS + 1, 1.0), constant(numS + 1, 0.0);
+	for (int s = 0; s < numS + 1; s++)
+	{
+		double r = mesh->node(index(0, s)).geometry.X(1);
+		if (axisymmetric && s > 0 && s < numS)
+		{
+			previous[s] = 1.0 + h / (2 * r);
+			next[s] = 1.0 - h / (2 * r);
+		}
+		if (s == 0 && types[firstS] == bcNeumann)
+		{
+			diagonal[s] = 1.0;
+			constant[s] = signs[firstS] * h * values[firstS];
+			if (axisymmetric)
 			{
-				mesh->nodesVector.nodes[i].EMfield[1] = (mesh->nodesVector.nodes[i].phi -
-					mesh->nodesVector.nodes[bottomNodeID].phi) / h;
+				constant[s] += h * h * values[firstS] / r;
 			}
 		}
-		else if (mesh->nodesVector.nodes[i].boundaryType == "BL")
+		if (s == numS && axisymmetric)
+		{
+			// Bottom nodes must always obey the symmetry BC
+			previous[s] = 2.0;
+		}
+		else if (s == numS && types[lastS] == bcNeumann)
 		{
-			if (parametersList->leftBCType == "periodic")
+			diagonal[s] = 1.0;
+			constant[s] = signs[lastS] * h * values[lastS];
+		}
+	}
+	int beginS = fixed(firstS) ? 1 : 0;
+	int endS = fixed(lastS) ? numS - 1 : numS;
+	int m = endS - beginS + 1;
+
+	// Right hand side, with lifted boundary values, stored by line
+	double *signal = (double*)fftw_malloc(sizeof(double) * length * m);
+	for (int s = beginS; s < endS + 1; s++)
+	{
+		for (int a = 0; a < n; a++)
+		{
+			int t = unknownT[a];
+			double value = (nodes[index(t, s)].rho / EPSILON_0) * h * h + constant[s];
+
+			if (t == 0 && types[firstT] == bcNeumann)
 			{
-				mesh->nodesVector.nodes[i].EMfield[0] = (mesh->nodesVector.nodes[periodicX1NodeID].phi -
-					mesh->nodesVector.nodes[rightNodeID].phi) / (2 * h);
+				value += signs[firstT] * h * values[firstT];
 			}
-			else
+			else if (t == 1 && fixed(firstT))
 			{
-				mesh->nodesVector.nodes[i].EMfield[0] = (mesh->nodesVector.nodes[i].phi -
-					mesh->nodesVector.nodes[rightNodeID].phi) / h;
+				value += nodes[index(0, s)].phi;
 			}
-			
-			if (parametersList->topBCType == "periodic")
+			if (t == numT && types[lastT] == bcNeumann)
 			{
-				mesh->nodesVector.nodes[i].EMfield[1] = (mesh->nodesVector.nodes[periodicX2NodeID].phi -
-					mesh->nodesVector.nodes[topNodeID].phi) / (2 * h);
+				value += signs[lastT] * h * values[lastT];
 			}
-			else
+			else if (t == numT - 1 && fixed(lastT))
 			{
-				mesh->nodesVector.nodes[i].EMfield[1] = (mesh->nodesVector.nodes[i].phi -
-					mesh->nodesVector.nodes[topNodeID].phi) / h;
+				value += nodes[index(numT, s)].phi;
 			}
-		}
-		else if (mesh->nodesVector.nodes[i].boundaryType == "TR")
-		{
-			if (parametersList->leftBCType == "periodic")
+
+			if (s == 1 && beginS == 1)
 			{
-				mesh->nodesVector.nodes[i].EMfield[0] = (mesh->nodesVector.nodes[leftNodeID].phi -
-					mesh->nodesVector.nodes[periodicX1NodeID].phi) / (2 * h);
+				value += previous[s] * nodes[index(t, 0)].phi;
 			}
-			else
+			if (s == numS - 1 && endS == numS - 1)
 			{
-				mesh->nodesVector.nodes[i].EMfield[0] = (mesh->nodesVector.nodes[i].phi -
-					mesh->nodesVector.nodes[leftNodeID].phi) / h;
+				value += next[s] * nodes[index(t, numS)].phi;
 			}
 
-			if (parametersList->topBCType == "periodic")
+			signal[(s - beginS) * length + a] = value;
+			if (length == 2 * n)
 			{
-				mesh->nodesVector.nodes[i].EMfield[1] = (mesh->nodesVector.nodes[bottomNodeID].phi -
-					mesh->nodesVector.nodes[periodicX2NodeID].phi) / (2 * h);
-			}
-			else
-			{
-				mesh->nodesVector.nodes[i].EMfield[1] = (mesh->nodesVector.nodes[i].phi -
-					mesh->nodesVector.nodes[bottomNodeID].phi) / h;
+				signal[(s - beginS) * length + length - 1 - a] = value;
 			}
 		}
-		else if (mesh->nodesVector.nodes[i].boundaryType == "BR")
+	}
+
+	fftw_plan forwardsPlan, backwardsPlan;
+	# pragma omp critical(fftwPlanner)
+	{
+#ifdef USE_FFTW_THREADS
+		// Threads are set up once per process, plans are serial if this fails
+		static bool threadsInitialised = fftw_init_threads() != 0;
+		static bool threadsWarned = false;
+		if (threadsInitialised)
+		{
+			fftw_plan_with_nthreads(parametersList->numThreads);
+		}
+		else if (!threadsWarned)
 		{
-			if (parametersList->leftBCType == "periodic")
+			parametersList->logBrief("Unable to initialise FFTW threads, transforms will run on one thread", 2);
+			threadsWarned = true;
+		}
+#endif
+		forwardsPlan = fftw_plan_many_r2r(1, &length, m, signal, NULL, 1, length,
+			signal, NULL, 1, length, &forwardsKind, FFTW_ESTIMATE);
+		backwardsPlan = fftw_plan_many_r2r(1, &length, m, signal, NULL, 1, length,
+			signal, NULL, 1, length, &backwardsKind, FFTW_ESTIMATE);
+	}
+	fftw_execute(forwardsPlan);
+
+	// Tridiagonal solve along s for each mode, with the t part of the stencil
+	// replaced by its eigenvalue
+	# pragma omp parallel num_threads(parametersList->numThreads)
+	{
+		std::vector<double> upper(m);
+
+		# pragma omp for
+		for (int k = 0; k < length; k++)
+		{
+			double eigenvalue;
+			if (forwardsKind == FFTW_R2HC)
+			{
+				int frequency = (k <= length / 2) ? k : length - k;
+				eigenvalue = 2.0 - 2.0 * cos(2.0 * PI * frequency / length);
+			}
+			else if (forwardsKind == FFTW_REDFT10)
 			{
-				mesh->nodesVector.nodes[i].EMfield[0] = (mesh->nodesVector.nodes[leftNodeID].phi -
-					mesh->nodesVector.nodes[periodicX1NodeID].phi) / (2 * h);
+				eigenvalue = 2.0 - 2.0 * cos(PI * k / length);
 			}
 			else
 			{
-				mesh->nodesVector.nodes[i].EMfield[0] = (mesh->nodesVector.nodes[i].phi -
-					mesh->nodesVector.nodes[leftNodeID].phi) / h;
+				eigenvalue = 2.0 - 2.0 * cos(PI * (k + 1) / (length + 1));
 			}
 
-			if (parametersList->topBCType == "periodic")
+			// Forward elimination
+			double previousUpper = 0.0;
+			for (int b = 0; b < m; b++)
 			{
-				mesh->nodesVector.nodes[i].EMfield[1] = (mesh->nodesVector.nodes[periodicX2NodeID].phi -
-					mesh->nodesVector.nodes[topNodeID].phi) / (2 * h);
+				int s = beginS + b;
+				double lower = (b > 0) ? -previous[s] : 0.0;
+				double pivot = diagonal[s] + eigenvalue - lower * previousUpper;
+				double &value = signal[b * length + k];
+				if (b > 0)
+				{
+					value -= lower * signal[(b - 1) * length + k];
+				}
+
+				// Constant mode of a pure neumann problem is undetermined
+				if (std::abs(pivot) < 1e-12 * (diagonal[s] + eigenvalue))
+				{
+					pivot = 1.0;
+					value = 0.0;
+				}
+				upper[b] = (b < m - 1) ? -next[s] / pivot : 0.0;
+				value /= pivot;
+				previousUpper = upper[b];
 			}
-			else
+
+			// Back substitution
+			for (int b = m - 2; b >= 0; b--)
 			{
-				mesh->nodesVector.nodes[i].EMfield[1] = (mesh->nodesVector.nodes[i].phi -
-					mesh->nodesVector.nodes[topNodeID].phi) / h;
+				signal[b * length + k] -= upper[b] * signal[(b + 1) * length + k];
 			}
 		}
 	}
 
-	// Magnetic field
-	for (int i = 0; i < mesh->numNodes; i++)
+	fftw_execute(backwardsPlan);
+
+	for (int s = beginS; s < endS + 1; s++)
 	{
-		for (int j = 0; j < 3; j++)
+		for (int a = 0; a < n; a++)
+		{
+			nodes[index(unknownT[a], s)].phi = signal[(s - beginS) * length + a] / normalisation;
+		}
+		if (types[firstT] == bcPeriodic)
 		{
-			mesh->nodesVector.nodes[i].EMfield[j+3] = parametersList->Bfield[j];
+			nodes[index(numT, s)].phi = nodes[index(0, s)].phi;
 		}
 	}
 
-	parametersList->logBrief("Field solver exited", 1);
+	# pragma omp critical(fftwPlanner)
+	{
+		fftw_destroy_plan(forwardsPlan);
+		fftw_destroy_plan(backwardsPlan);
+	}
+	fftw_free(signal);
 }
 
-// Destructor
-FieldSolver::~FieldSolver()
+
+// Calculate the electric field from the potential, and apply the external
+// magnetic field, in a single pass over precomputed stencils
+void FieldSolver::calculateFields(Parameters *parametersList, Mesh *mesh)
 {
+	if (!mesh->gradientOperator)
+	{
+		mesh->assembleOperators(parametersList);
+	}
+	mesh->gradientOperator->apply(parametersList, mesh);
 }
\ No newline at end of file
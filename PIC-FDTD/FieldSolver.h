@@ -17,7 +17,7 @@ class FieldSolver
 {
 public:
 	// Data members
-
+	int iterations = 0;									//!< Number of solver iterations performed
 
 	// Constructor/destructor
 	FieldSolver();										//!< Default constructor
@@ -26,5 +26,10 @@ public:
 
 	
 	// Methods
-
+	void solvePotential(Parameters *parametersList,
+		Mesh *mesh);									//!< Solve the Poisson equation for phi
+	void solveDirect(Parameters *parametersList,
+		Mesh *mesh);									//!< Solve the Poisson equation directly, by transform along one axis
+	void calculateFields(Parameters *parametersList,
+		Mesh *mesh);									//!< Calculate E from phi, and apply external B
 };
\ No newline at end of file
@@ -0,0 +1,284 @@
+//! \file
+//! \brief Implementation of FusedKernel class 
+//! \author Rahul Kalampattel
+//! \date Last updated June 2018
+
+#include "FusedKernel.h"
+
+// Default constructor
+FusedKernel::FusedKernel()
+{
+}
+
+
+// Constructor
+FusedKernel::FusedKernel(Parameters *parametersList, Mesh *mesh,
+	Mesh *FDTDmesh, VectorParticle *particlesVector)
+{
+	if (mesh->tilesVector.tileSize > 0)
+	{
+		switch (parametersList->shapeOrder)
+		{
+		case shapeNGP:
+			gatherPushDepositTiled<shapeNGP>(parametersList, mesh, FDTDmesh, particlesVector);
+			break;
+		case shapeTSC:
+			gatherPushDepositTiled<shapeTSC>(parametersList, mesh, FDTDmesh, particlesVector);
+			break;
+		case shapeCubic:
+			gatherPushDepositTiled<shapeCubic>(parametersList, mesh, FDTDmesh, particlesVector);
+			break;
+		default:
+			gatherPushDepositTiled<shapeCIC>(parametersList, mesh, FDTDmesh, particlesVector);
+			break;
+		}
+	}
+	else
+	{
+		switch (parametersList->shapeOrder)
+		{
+		case shapeNGP:
+			gatherPushDeposit<shapeNGP>(parametersList, mesh, FDTDmesh, particlesVector);
+			break;
+		case shapeTSC:
+			gatherPushDeposit<shapeTSC>(parametersList, mesh, FDTDmesh, particlesVector);
+			break;
+		case shapeCubic:
+			gatherPushDeposit<shapeCubic>(parametersList, mesh, FDTDmesh, particlesVector);
+			break;
+		default:
+			gatherPushDeposit<shapeCIC>(parametersList, mesh, FDTDmesh, particlesVector);
+			break;
+		}
+	}
+
+	parametersList->logBrief("Fused kernel exited", 1);
+}
+
+
+// Destructor
+FusedKernel::~FusedKernel()
+{
+}
+
+
+// Gather fields to each particle, push it, then deposit its charge (and 
+// Esirkepov current) at the new position while it is still in cache. Charge
+// is accumulated in a node buffer and current on the Yee lattices of the FDTD
+// mesh, which are merged into the meshes once all particles have been pushed.
+// Direct (rho * v) current depends on rho, so is still projected afterwards by
+// ChargeProjector.
+template <int Order>
+void FusedKernel::gatherPushDeposit(Parameters *parametersList, Mesh *mesh,
+	Mesh *FDTDmesh, VectorParticle *particlesVector)
+{
+	bool periodicX1 = parametersList->leftBCType == bcPeriodic;
+	bool periodicX2 = parametersList->topBCType == bcPeriodic;
+	bool esirkepov = parametersList->currentDeposition == "esirkepov";
+
+	std::vector<double> charge(mesh->numNodes, 0.0);
+	std::vector<EdgeGrid> lattices;
+	if (esirkepov)
+	{
+		lattices = CurrentProjector::yeeLattices(parametersList, FDTDmesh);
+	}
+
+	ParticlePusher pusher;
+	for (int i = 0; i < particlesVector->numParticles; i++)
+	{
+		// Gather
+		Particle *particle = &particlesVector->particleVector[i];
+		particle->EMfield = { 0.0,0.0,0.0,0.0,0.0,0.0 };
+		ParticleStencil<Order>::apply(mesh, particle->cellID, particle->position[0],
+			particle->position[1], periodicX1, periodicX2, [&](int nodeID, double weight)
+		{
+			for (int j = 0; j < 6; j++)
+			{
+				particle->EMfield[j] += mesh->nodesVector.nodes[nodeID].EMfield[j] * weight;
+			}
+		});
+
+		// Push, unless the particle is sub-cycled and held this step
+		double timeStep = ParticlePusher::subcycleStep(parametersList, *particle);
+		if (timeStep > 0.0)
+		{
+			PushResult result = pusher.pushParticle(parametersList, mesh, particlesVector, i, timeStep);
+			if (result == pushStopped)
+			{
+				break;
+			}
+			else if (result == pushRemoved)
+			{
+				// Particle was removed from the simulation, the next one now has index i
+				i -= 1;
+				continue;
+			}
+		}
+
+		// Deposit
+		particle = &particlesVector->particleVector[i];
+		double q = particle->basic.q * particle->weight;
+		ParticleStencil<Order>::apply(mesh, particle->cellID, particle->position[0],
+			particle->position[1], periodicX1, periodicX2, [&](int nodeID, double weight)
+		{
+			charge[nodeID] += q * weight;
+		});
+
+		if (esirkepov)
+		{
+			for (unsigned int k = 0; k < lattices.size(); k++)
+			{
+				CurrentProjector::depositCurrent<Order>(parametersList, *particle, lattices[k]);
+			}
+		}
+	}
+
+	// Merge accumulation buffers into the mesh
+	for (int j = 0; j < mesh->numNodes; j++)
+	{
+		mesh->nodesVector.nodes[j].charge = charge[j];
+	}
+	if (esirkepov)
+	{
+		CurrentProjector::copyToFDTD(lattices, FDTDmesh);
+	}
+}
+
+
+
+// Gather, push and deposit the particles of each tile while they and the
+// tile's local nodes are in cache. Tiles (or groups of tiles, once balanced)
+// are processed in parallel as separate tasks, gathering from a local copy of
+// the node fields and depositing into a local charge accumulator, which are
+// merged once all tiles are done. Pushes do not change the cell lists or the
+// particle vector, so particles which change cell or leave the domain are
+// moved or removed afterwards, in the order a serial push would, and sorted
+// into tiles again. Particles which end up beyond the halo of their tile (e.g.
+// across a periodic boundary) deposit their charge after the merge. Esirkepov
+// current needs the whole FDTD mesh, so is projected in a separate pass.
+template <int Order>
+void FusedKernel::gatherPushDepositTiled(Parameters *parametersList, Mesh *mesh,
+	Mesh *FDTDmesh, VectorParticle *particlesVector)
+{
+	bool periodicX1 = parametersList->leftBCType == bcPeriodic;
+	bool periodicX2 = parametersList->topBCType == bcPeriodic;
+	int numParticles = particlesVector->numParticles;
+
+	VectorTile &tilesVector = mesh->tilesVector;
+	tilesVector.updateBins(mesh, particlesVector);
+	mesh->nodesVector.clearCharge();
+
+	std::vector<PushResult> results(numParticles, pushMoved);
+	std::vector<int> oldCellIDs(numParticles);
+	std::vector<char> outsideHalo(numParticles, 0);
+
+	TaskGraph graph;
+	std::vector<int> tileTasks = tilesVector.addTasks(graph, [&](Tiles &tile)
+	{
+		ParticlePusher pusher;
+		tile.loadFields(mesh->nodesVector);
+		tile.clearCharge();
+		for (unsigned int k = 0; k < tile.listOfParticles.size(); k++)
+		{
+			// Gather
+			int i = tile.listOfParticles[k];
+			Particle &particle = particlesVector->particleVector[i];
+			particle.EMfield = { 0.0,0.0,0.0,0.0,0.0,0.0 };
+			applyTileStencil<Order>(mesh, tile, particle.position[0], particle.position[1],
+				[&](int localID, double weight)
+			{
+				for (int j = 0; j < 6; j++)
+				{
+					particle.EMfield[j] += tile.EMfield[6 * localID + j] * weight;
+				}
+			});
+
+			// Push, unless the particle is sub-cycled and held this step
+			oldCellIDs[i] = particle.cellID;
+			double timeStep = ParticlePusher::subcycleStep(parametersList, particle);
+			if (timeStep > 0.0)
+			{
+				results[i] = pusher.pushParticle(parametersList, mesh, particlesVector, i, timeStep, true);
+				if (results[i] == pushStopped)
+				{
+					break;
+				}
+				else if (results[i] == pushRemoved)
+				{
+					continue;
+				}
+			}
+
+			// Deposit
+			if (!withinHalo(mesh, tile, particle.position[0], particle.position[1]))
+			{
+				outsideHalo[i] = 1;
+				continue;
+			}
+			double charge = particle.basic.q * particle.weight;
+			applyTileStencil<Order>(mesh, tile, particle.position[0], particle.position[1],
+				[&](int localID, double weight)
+			{
+				tile.charge[localID] += charge * weight;
+			});
+		}
+	});
+
+	graph.addTask([&]()
+	{
+		for (unsigned int k = 0; k < tilesVector.tiles.size(); k++)
+		{
+			tilesVector.tiles[k].mergeCharge(mesh->nodesVector);
+		}
+	}, tileTasks);
+
+	graph.run(parametersList->numThreads);
+
+	std::vector<bool> removed(numParticles, false);
+	for (int i = 0; i < numParticles; i++)
+	{
+		Particle &particle = particlesVector->particleVector[i];
+		if (outsideHalo[i])
+		{
+			double charge = particle.basic.q * particle.weight;
+			ParticleStencil<Order>::apply(mesh, particle.cellID, particle.position[0],
+				particle.position[1], periodicX1, periodicX2, [&](int nodeID, double weight)
+			{
+				mesh->nodesVector.nodes[nodeID].charge += charge * weight;
+			});
+		}
+
+		if (results[i] == pushCrossed)
+		{
+			mesh->removeParticlesFromCell(oldCellIDs[i], particle.particleID);
+			mesh->addParticlesToCell(particle.cellID, particle.particleID);
+		}
+		else if (results[i] == pushRemoved)
+		{
+			// Still listed in the cell it started the step in
+			particle.cellID = oldCellIDs[i];
+			removed[i] = true;
+		}
+	}
+
+	// Also rebuilds plotVector from the new positions
+	std::vector<Particle> added;
+	particlesVector->replaceParticles(mesh, removed, added);
+
+	if (parametersList->currentDeposition == "esirkepov")
+	{
+		CurrentProjector currentProjector(parametersList, FDTDmesh, particlesVector);
+	}
+}
+
+
+// True if the stencil of a particle at (x1, x2) lies within the local nodes
+// of a tile. The halo holds the cubic stencil of a particle up to one cell
+// outside the tile.
+bool FusedKernel::withinHalo(const Mesh *mesh, const Tiles &tile, double x1, double x2)
+{
+	int column = static_cast<int>(floor((x1 - mesh->node(0).geometry.X(0)) / mesh->h));
+	int row = static_cast<int>(floor((mesh->node(0).geometry.X(1) - x2) / mesh->h));
+	return column >= tile.firstColumn - 1 && column <= tile.firstColumn + tile.numColumns &&
+		row >= tile.firstRow - 1 && row <= tile.firstRow + tile.numRows;
+}
\ No newline at end of file
@@ -0,0 +1,44 @@
+//! \file
+//! \brief Definition of FusedKernel class 
+//! \author Rahul Kalampattel
+//! \date Last updated June 2018
+
+#pragma once
+
+#include <vector>
+
+#include "CurrentProjector.h"
+#include "Mesh.h"
+#include "Parameters.h"
+#include "ParticlePusher.h"
+#include "ShapeFunction.h"
+#include "TaskGraph.h"
+#include "VectorParticle.h"
+
+//! \class FusedKernel
+//! \brief Gather fields, push and deposit each particle in a single pass, so 
+//! that particle data is only loaded once per time step. On a tiled mesh the
+//! pass is made tile by tile, in parallel.
+class FusedKernel
+{
+public:
+	// Data members
+
+
+	// Constructor/destructor
+	FusedKernel();										//!< Default constructor
+	FusedKernel(Parameters *parametersList, Mesh *mesh,
+		Mesh *FDTDmesh, VectorParticle *particlesVector);	//!< Constructor
+	~FusedKernel();										//!< Destructor
+
+
+	// Methods
+	template <int Order>
+	void gatherPushDeposit(Parameters *parametersList, Mesh *mesh,
+		Mesh *FDTDmesh, VectorParticle *particlesVector);	//!< Single pass over particles with a B-spline shape
+	template <int Order>
+	void gatherPushDepositTiled(Parameters *parametersList, Mesh *mesh,
+		Mesh *FDTDmesh, VectorParticle *particlesVector);	//!< Single pass over the particles of each tile with a B-spline shape
+	static bool withinHalo(const Mesh *mesh, const Tiles &tile,
+		double x1, double x2);							//!< True if the stencil of a position lies within the local nodes of a tile
+};
@@ -3,6 +3,7 @@
 //  OP2A
 //
 //  Created by Kim M.K. on 09/11/2016.
+//  Last edited by Rahul Kalampattel, June 2018
 //  Copyright © 2016 Kim M.K. All rights reserved.
 //
 
@@ -14,7 +15,7 @@
 // 1. Class: Common for Geometry classes
 //     1.1 Constructor and Destructor
 GeometryCommon::GeometryCommon()
-:id(0), bcType(0), bcIndex(0), treat(0), S(0.0), X(3)
+:id(0), bcType(0), bcIndex(0), treat(0), S(0.0)
 {
     
 };
@@ -41,7 +42,7 @@ GeometryNode::~GeometryNode()
 
 // 3. Class: for Face
 GeometryFace::GeometryFace()
-:n(3,3), distanceToWall(0.0), nDotWall(0.0)
+:distanceToWall(0.0), nDotWall(0.0)
 {
     
 };
@@ -3,6 +3,7 @@
 //  OP2A
 //
 //  Created by Kim M.K. on 09/11/2016.
+//  Last edited by Rahul Kalampattel, June 2018
 //  Copyright © 2016 Kim M.K. All rights reserved.
 //
 
@@ -11,6 +12,7 @@
 
 #include <stdio.h>
 #include "../MATH_MK/matrix.hpp"
+#include "../MATH_MK/vec.hpp"
 
 
 
@@ -24,7 +26,7 @@ public:
     int  treat;     // Flag for treatment (0: Include, 1: neet to refine, -1: need to remove)
     
     double S;       // Area/Volume (0 for point)
-    matrix X;       // Location vector, X
+    Vec3   X;       // Location vector, X
     
     
 public:
@@ -53,7 +55,7 @@ public:
 class GeometryFace : public GeometryCommon{
     
 public:
-    matrix n;               // Normal/Tangent vectors ( 0: normal vector, 1: tangential vector, 2: tangential vector)
+    Vec3   n[3];            // Normal/Tangent vectors ( 0: normal vector, 1: tangential vector, 2: tangential vector)
     double distanceToWall;  // Distance to Wall;
     double nDotWall;        // n(vector) Dot Wall vector
     
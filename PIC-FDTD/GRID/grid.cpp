@@ -3,7 +3,7 @@
 //  OP2A
 //
 //  Created by Kim M.K. on 10/11/2016.
-//  Last edited by Rahul Kalampattel, April 2018
+//  Last edited by Rahul Kalampattel, June 2018
 //  
 //  Copyright © 2016 Kim M.K. All rights reserved.
 //
@@ -210,7 +210,7 @@ void GridGeo::readGrid(const std::string& mesh_file_name, GridBasicInfo& gridInf
                     nodes[n].geometry.X(1) = y;
                     nodes[n].geometry.X(2) = z;
                     
-                    if (nodeID + 1 > whereisNodes.size()) whereisNodes.resize(nodeID+1);
+                    if (nodeID + 1 > static_cast<int>(whereisNodes.size())) whereisNodes.resize(nodeID+1);
                     whereisNodes[nodeID] = n;
                 }
             }
@@ -297,7 +297,7 @@ void GridGeo::readGrid(const std::string& mesh_file_name, GridBasicInfo& gridInf
                     faces[f].connectivity.cl[0] = cl;
                     faces[f].connectivity.cr[0] = cr;
                     
-                    if (faceID + 1 > whereisFaces.size()) whereisFaces.resize(faceID+1);
+                    if (faceID + 1 > static_cast<int>(whereisFaces.size())) whereisFaces.resize(faceID+1);
                     whereisFaces[faceID] = f;
                 }
             }
@@ -469,7 +469,7 @@ void GridGeo::readGrid(const std::string& mesh_file_name, GridBasicInfo& gridInf
                             break;
                     }
                     
-                    if (cellID + 1 > whereisCells.size()) whereisCells.resize(cellID+1);
+                    if (cellID + 1 > static_cast<int>(whereisCells.size())) whereisCells.resize(cellID+1);
                     whereisCells[cellID] = c;
                 }
             }
@@ -491,6 +491,108 @@ void readGridFromFile(const std::string& mesh_file_name, GridBasicInfo& gridinfo
 }
 
 
+
+// Write grid data in OP2A format
+void writeGridOP2(const std::string& mesh_file_name, GridBasicInfo& gridinfo, GridGeo& gridgeo)
+{
+    std::ofstream mesh_file_OP2;
+    mesh_file_OP2.open(mesh_file_name.c_str());
+    
+    
+    
+    
+    mesh_file_OP2 << "%*****************************************************" << std::endl;
+    mesh_file_OP2 << "%     OP2A Grid File using FORMAT version 1.0         " << std::endl;
+    mesh_file_OP2 << "%                                                     " << std::endl;
+    mesh_file_OP2 << "%                  Originally developed by Minkwan Kim" << std::endl;
+    mesh_file_OP2 << "%=====================================================" << std::endl;
+    mesh_file_OP2 << "% [FACE / CELL TYPE identifiers]                      " << std::endl;
+    mesh_file_OP2 << "%      Line                   :  3                    " << std::endl;
+    mesh_file_OP2 << "%      Triangle (3-nodes)     :  5                    " << std::endl;
+    mesh_file_OP2 << "%      Quadrilateral (4-nodes):  9                    " << std::endl;
+    mesh_file_OP2 << "%      Tetrahedral (4-nodes)  : 10                    " << std::endl;
+    mesh_file_OP2 << "%      Hexahedral (8-nodes)   : 12                    " << std::endl;
+    mesh_file_OP2 << "%      Prism (6-nodes)        : 13                    " << std::endl;
+    mesh_file_OP2 << "%      Pramid (5-nodes)       : 14                    " << std::endl;
+    mesh_file_OP2 << "%                                                     " << std::endl;
+    mesh_file_OP2 << "% [BC TYPE identifiers]                               " << std::endl;
+    mesh_file_OP2 << "%      Interior               :  0                    " << std::endl;
+    mesh_file_OP2 << "%      Wall                   : 10                    " << std::endl;
+    mesh_file_OP2 << "%      Inlet                  : 20                    " << std::endl;
+    mesh_file_OP2 << "%      Outlet                 : 30                    " << std::endl;
+    mesh_file_OP2 << "%      Freestream (Far-field) : 40                    " << std::endl;
+    mesh_file_OP2 << "%      Symmetric              : 50                    " << std::endl;
+    mesh_file_OP2 << "%      Axisymmetric           : 60                    " << std::endl;
+    mesh_file_OP2 << "%      Anode                  : 70                    " << std::endl;
+    mesh_file_OP2 << "%      Cathode                : 80                    " << std::endl;
+    mesh_file_OP2 << "%      Dielectric material    : 90                    " << std::endl;
+    mesh_file_OP2 << "%                                                     " << std::endl;
+    mesh_file_OP2 << "% [DATA Format]                                       " << std::endl;
+    mesh_file_OP2 << "%    -Node Data FORMAT                                " << std::endl;
+    mesh_file_OP2 << "%     (NODE ID#)  (POSITION DATA: X Y Z)           " << std::endl;
+    mesh_file_OP2 << "%    -Face Data FORMAT                                " << std::endl;
+    mesh_file_OP2 << "%     (FACE ID#)  (BOUNDARY CONDITION)  (FACE TYPE)  (LIST OF NODE IDs) (LEFT-CELL ID) (RIGHT-CELL ID)" << std::endl;
+    mesh_file_OP2 << "%    -Cell Data FORMAT" << std::endl;
+    mesh_file_OP2 << "%     (CELL ID#)  (BOUNDARY CONDITION)  (CELL TYPE)  (LIST OF NODE IDs) (LIST OF FACE IDs)" << std::endl;
+    mesh_file_OP2 << "%=====================================================" << std::endl;
+    mesh_file_OP2 << "%                   Last Format Updated on April/2016 " << std::endl;
+    mesh_file_OP2 << "%                                       by M Kim      " << std::endl;
+    mesh_file_OP2 << "%*****************************************************" << std::endl << std::endl;
+    
+    mesh_file_OP2 << "% OVERALL GRID INFORMATION" << std::endl;
+    mesh_file_OP2 << "DIM= " << gridinfo.DIM << std::endl;
+    mesh_file_OP2 << "NNM= " << gridinfo.NNM << std::endl;
+    mesh_file_OP2 << "NFM= " << gridinfo.NFM << std::endl;
+    mesh_file_OP2 << "NCM= " << gridinfo.NCM << std::endl;
+    mesh_file_OP2 << std::endl;
+    
+    mesh_file_OP2 << "%%%%%%%%%%%" << std::endl;
+    mesh_file_OP2 << "NODEDATA= " << gridinfo.NNM << std::endl;
+    for (int n = 0; n <= gridinfo.NNM-1; n++)
+    {
+        mesh_file_OP2 << std::setw(8) << gridgeo.nodes[n].geometry.id <<
+        std::setw(25) << std::scientific << std::setprecision(16) << gridgeo.nodes[n].geometry.X(0) <<
+        std::setw(25) << gridgeo.nodes[n].geometry.X(1) <<
+        std::setw(25) << gridgeo.nodes[n].geometry.X(2) << std::endl;
+    }
+    mesh_file_OP2 << std::endl;
+    
+    mesh_file_OP2 << "%%%%%%%%%%%%" << std::endl;
+    mesh_file_OP2 << "FACEDATA= " << gridinfo.NFM << std::endl;
+    for (int f = 0; f <= gridinfo.NFM-1; f++)
+    {
+        FaceBase& face = gridgeo.faces[f];
+        
+        mesh_file_OP2 << std::setw(8) << face.geometry.id;
+        mesh_file_OP2 << std::setw(8) << face.geometry.bcType;
+        mesh_file_OP2 << std::setw(8) << face.connectivity.type;
+        
+        for (int n = 0; n <= face.connectivity.numNodes-1; n++) mesh_file_OP2 << std::setw(8) << face.connectivity.nodeIDs[n];
+        mesh_file_OP2 << std::setw(8) << face.connectivity.cl[0];
+        mesh_file_OP2 << std::setw(8) << face.connectivity.cr[0];
+        mesh_file_OP2 << std::endl;
+    }
+    mesh_file_OP2 << std::endl;
+    
+    
+    
+    mesh_file_OP2 << "%%%%%%%%%%%" << std::endl;
+    mesh_file_OP2 << "CELLDATA= " << gridinfo.NCM << std::endl;
+    for (int c = 0; c <= gridinfo.NCM-1; c++)
+    {
+        CellBase& cell = gridgeo.cells[c];
+        
+        mesh_file_OP2 << std::setw(8) << cell.geometry.id;
+        mesh_file_OP2 << std::setw(8) << cell.geometry.bcType;
+        mesh_file_OP2 << std::setw(8) << cell.connectivity.type;
+        for (int n = 0; n <= cell.connectivity.numNodes-1; n++) mesh_file_OP2 << std::setw(8) << cell.connectivity.nodeIDs[n];
+        for (int f = 0; f <= cell.connectivity.numFaces-1; f++) mesh_file_OP2 << std::setw(8) << cell.connectivity.faceIDs[f];
+        mesh_file_OP2 << std::endl;
+    }
+    mesh_file_OP2 << std::endl;
+    mesh_file_OP2.close();
+}
+
 void processingGrid(GridBasicInfo& gridinfo, GridGeo& gridgeo)
 {
     // 1 Processing for Nodes
@@ -529,9 +631,9 @@ void processingGrid(GridBasicInfo& gridinfo, GridGeo& gridgeo)
 #pragma ivdep
     for (int f = 0; f < gridinfo.NFM; f++)
     {
-        matrix x1(3);
-        matrix x2(3);
-        matrix x3(3);
+        Vec3 x1;
+        Vec3 x2;
+        Vec3 x3;
         
         NodeBase* n1 = &gridgeo.Node(gridgeo.faces[f].connectivity.nodeIDs[0]);
         NodeBase* n2 = &gridgeo.Node(gridgeo.faces[f].connectivity.nodeIDs[1]);
@@ -546,12 +648,12 @@ void processingGrid(GridBasicInfo& gridinfo, GridGeo& gridgeo)
                 // Tangential vector
                 x1 = vectorStartEnd(n1->geometry.X, n2->geometry.X);
                 x1.normalize();
-                for (int d = 0; d < 3; d++) gridgeo.faces[f].geometry.n(GRID_TAN1, d) = x1(d);
+                gridgeo.faces[f].geometry.n[GRID_TAN1] = x1;
                 
                 // Normal Vector
-                gridgeo.faces[f].geometry.n(GRID_NOR, 0) =  gridgeo.faces[f].geometry.n(GRID_TAN1, 1);
-                gridgeo.faces[f].geometry.n(GRID_NOR, 1) = -gridgeo.faces[f].geometry.n(GRID_TAN1, 0);
-                gridgeo.faces[f].geometry.n(GRID_NOR, 2) =  gridgeo.faces[f].geometry.n(GRID_TAN1, 2);
+                gridgeo.faces[f].geometry.n[GRID_NOR](0) =  gridgeo.faces[f].geometry.n[GRID_TAN1](1);
+                gridgeo.faces[f].geometry.n[GRID_NOR](1) = -gridgeo.faces[f].geometry.n[GRID_TAN1](0);
+                gridgeo.faces[f].geometry.n[GRID_NOR](2) =  gridgeo.faces[f].geometry.n[GRID_TAN1](2);
                 break;
                 
             case TRI3:
@@ -567,13 +669,13 @@ void processingGrid(GridBasicInfo& gridinfo, GridGeo& gridgeo)
                 x2.normalize();
                 
                 x3 = cross(x1, x2);
-                for (int d = 0; d < 3; d++) gridgeo.faces[f].geometry.n(GRID_NOR, d) = x3(d);
+                gridgeo.faces[f].geometry.n[GRID_NOR] = x3;
                 
                 // Tangential Vector
-                for (int d = 0; d < 3; d++) gridgeo.faces[f].geometry.n(GRID_TAN1, d) = x1(d);
+                gridgeo.faces[f].geometry.n[GRID_TAN1] = x1;
                 
                 x2 = cross(x3, x1);
-                for (int d = 0; d < 3; d++) gridgeo.faces[f].geometry.n(GRID_TAN2, d) = x2(d);
+                gridgeo.faces[f].geometry.n[GRID_TAN2] = x2;
                 break;
                 
                 
@@ -593,17 +695,17 @@ void processingGrid(GridBasicInfo& gridinfo, GridGeo& gridgeo)
                 x2.normalize();
                 x3.normalize();
                 
-                matrix x4 = normalFromThreePoints(x1, x2, x3);
+                Vec3 x4 = normalFromThreePoints(x1, x2, x3);
                 x4.normalize();
                 
                 
-                for (int d = 0; d < 3; d++) gridgeo.faces[f].geometry.n(GRID_NOR, d) = x4(d);
+                gridgeo.faces[f].geometry.n[GRID_NOR] = x4;
                 
                 // Tangential Vector
-                for (int d = 0; d < 3; d++) gridgeo.faces[f].geometry.n(GRID_TAN1, d) = x2(d);
+                gridgeo.faces[f].geometry.n[GRID_TAN1] = x2;
                 
                 x1 = cross(x4, x2);
-                for (int d = 0; d < 3; d++) gridgeo.faces[f].geometry.n(GRID_TAN2, d) = x1(d);
+                gridgeo.faces[f].geometry.n[GRID_TAN2] = x1;
                 break;
         }
         
@@ -642,10 +744,10 @@ void processingGrid(GridBasicInfo& gridinfo, GridGeo& gridgeo)
         
         
         // Calculate Volume/Area and Characteristic length
-        matrix xf1(3);
-        matrix xf2(3);
-        matrix xf3(3);
-        matrix xf4(3);
+        Vec3 xf1;
+        Vec3 xf2;
+        Vec3 xf3;
+        Vec3 xf4;
         
         NodeBase* n1 = &gridgeo.Node(cell->connectivity.nodeIDs[0]);
         NodeBase* n2 = &gridgeo.Node(cell->connectivity.nodeIDs[1]);
@@ -813,7 +915,7 @@ void processingGrid(GridBasicInfo& gridinfo, GridGeo& gridgeo)
             
             gPos++;
             gID++;
-            if (gID+1 > gridgeo.whereisGhost.size()) gridgeo.whereisGhost.resize(gID+1);
+            if (gID+1 > static_cast<int>(gridgeo.whereisGhost.size())) gridgeo.whereisGhost.resize(gID+1);
         }
         else if (face->connectivity.cl[0] == 0)
         {
@@ -823,7 +925,7 @@ void processingGrid(GridBasicInfo& gridinfo, GridGeo& gridgeo)
             {
                 for (int k2 = 0; k2 < 3; k2++)
                 {
-                    face->geometry.n(k1,k2)	= -face->geometry.n(k1, k2);
+                    face->geometry.n[k1](k2)	= -face->geometry.n[k1](k2);
                 }
             }
             face->connectivity.cr[0] = -gID;
@@ -854,7 +956,7 @@ void processingGrid(GridBasicInfo& gridinfo, GridGeo& gridgeo)
             
             gPos++;
             gID++;
-            if (gID+1 > gridgeo.whereisGhost.size()) gridgeo.whereisGhost.resize(gID+1);
+            if (gID+1 > static_cast<int>(gridgeo.whereisGhost.size())) gridgeo.whereisGhost.resize(gID+1);
         }
     }
     gridinfo.NGM = counterNGM;
@@ -886,12 +988,11 @@ void processingGrid(GridBasicInfo& gridinfo, GridGeo& gridgeo)
             num_WalkCells++;
             
             gridgeo.Cell(cID).geometry.distanceToWall = area_line(gridgeo.Cell(cID).geometry.X, gridgeo.Face(fID).geometry.X);
-            int temp;
         }
     }
 
     // c. Calculate path
-    int num_Pass = 0;
+    unsigned int num_Pass = 0;
     FaceBase* wall_Face;
     
     while (num_WalkCells > 0 && num_Pass <= GRID_MAX_NUM_PATH)
@@ -974,13 +1075,13 @@ void processingGrid(GridBasicInfo& gridinfo, GridGeo& gridgeo)
         gridgeo.Face(fID).geometry.distanceToWall	= 0.5 * (gridgeo.Cell(cl).geometry.distanceToWall + gridgeo.Cell(cr).geometry.distanceToWall);
         wall_Face = nearWallFace[cl];
         
-        matrix wallNormal(3);
-        matrix faceNormal(3);
+        Vec3 wallNormal;
+        Vec3 faceNormal;
 		
         for (int d = 0; d < 3; d++)
         {
-            wallNormal(d) = wall_Face->geometry.n(GRID_NOR, d);
-            faceNormal(d) = gridgeo.Face(fID).geometry.n(GRID_NOR, d);
+            wallNormal(d) = wall_Face->geometry.n[GRID_NOR](d);
+            faceNormal(d) = gridgeo.Face(fID).geometry.n[GRID_NOR](d);
         }
         
         double n_dot_wall = dot(faceNormal, wallNormal);
@@ -990,8 +1091,8 @@ void processingGrid(GridBasicInfo& gridinfo, GridGeo& gridgeo)
     
     // 7. Find Stencil
     // Find stencil
-    matrix xfc(3);
-    matrix normal_vector(3);
+    Vec3 xfc;
+    Vec3 normal_vector;
     double max_dot;
     double test_dot;
     
@@ -1032,11 +1133,11 @@ void processingGrid(GridBasicInfo& gridinfo, GridGeo& gridgeo)
             max_dot = -1.0;
             
             // GET NORMAL VECTOR TOWARD TO CL
-            for (int k = 0; k < 3; k++) normal_vector(k) = -gridgeo.faces[f].geometry.n(GRID_NOR, k);
+            for (int k = 0; k < 3; k++) normal_vector(k) = -gridgeo.faces[f].geometry.n[GRID_NOR](k);
             
             
             // CALCULATE DISTANCE TO CELL-CENTER OF EACH NEIGHBORING CELL
-            for (int j = 0; j < neighborList[cl].size(); j++)
+            for (unsigned int j = 0; j < neighborList[cl].size(); j++)
             {
                 int trial_ID = neighborList[cl][j];
                 
@@ -1067,10 +1168,10 @@ void processingGrid(GridBasicInfo& gridinfo, GridGeo& gridgeo)
             max_dot = -1.0;
             
             // GET NORMAL VECTOR TOWARD TO CR
-            for (int k = 0; k < 3; k++) normal_vector(k) = gridgeo.faces[f].geometry.n(GRID_NOR, k);
+            for (int k = 0; k < 3; k++) normal_vector(k) = gridgeo.faces[f].geometry.n[GRID_NOR](k);
             
             // CALCULATE DISTANCE TO CELL-CENTER OF EACH NEIGHBORING CELL
-            for (int j = 0; j < neighborList[cl].size(); j++)
+            for (unsigned int j = 0; j < neighborList[cl].size(); j++)
             {
                 int trial_ID = neighborList[cr][j];
                 
@@ -1257,7 +1358,7 @@ void writeMeshTecplot(const std::string& title, Mesh& mesh)
 	{
 		newNodeID[n] = -1;
 
-		if (mesh.nodesVector.nodes[n].geometry.treat != -1)
+		if (mesh.node(n).geometry.treat != -1)
 		{
 			NNM++;
 			newNodeID[n] = NNM;
@@ -1267,7 +1368,7 @@ void writeMeshTecplot(const std::string& title, Mesh& mesh)
 	int NCM = 0;
 	for (int c = 0; c < maxCellID; c++)
 	{
-		if (mesh.cellsVector.cells[c].geometry.treat != -1)
+		if (mesh.cell(c).geometry.treat != -1)
 		{
 			NCM++;
 			newCellID[c] = NCM;
@@ -1305,7 +1406,7 @@ void writeMeshTecplot(const std::string& title, Mesh& mesh)
 		{
 			for (int d = 0; d < mesh.dimension; d++)
 			{
-				grid_tecplot << mesh.nodesVector.nodes[newNodeID[n] - 1].geometry.X(d) << " ";
+				grid_tecplot << mesh.node(newNodeID[n] - 1).geometry.X(d) << " ";
 			}
 			grid_tecplot << std::endl;
 		}
@@ -1320,10 +1421,10 @@ void writeMeshTecplot(const std::string& title, Mesh& mesh)
 		{
 			int cID = newCellID[c] - 1;
 
-			grid_tecplot << newNodeID[mesh.cellsVector.cells[cID].connectivity.nodeIDs[0] - 1] << " ";
-			grid_tecplot << newNodeID[mesh.cellsVector.cells[cID].connectivity.nodeIDs[1] - 1] << " ";
-			grid_tecplot << newNodeID[mesh.cellsVector.cells[cID].connectivity.nodeIDs[2] - 1] << " ";
-			grid_tecplot << newNodeID[mesh.cellsVector.cells[cID].connectivity.nodeIDs[3] - 1] << std::endl;
+			grid_tecplot << newNodeID[mesh.cell(cID).connectivity.nodeIDs[0] - 1] << " ";
+			grid_tecplot << newNodeID[mesh.cell(cID).connectivity.nodeIDs[1] - 1] << " ";
+			grid_tecplot << newNodeID[mesh.cell(cID).connectivity.nodeIDs[2] - 1] << " ";
+			grid_tecplot << newNodeID[mesh.cell(cID).connectivity.nodeIDs[3] - 1] << std::endl;
 		}
 	}
 
@@ -1406,8 +1507,8 @@ void writeSolutionNodeTecplot(const std::string& title, Mesh& mesh, double t)
 		for (int c = 0; c < mesh.numNodes; c++)
 		{
 			grid_tecplot << std::scientific << std::setprecision(16) <<
-				mesh.nodesVector.nodes[c].geometry.X(0) << " " <<
-				mesh.nodesVector.nodes[c].geometry.X(1) << " " <<
+				mesh.node(c).geometry.X(0) << " " <<
+				mesh.node(c).geometry.X(1) << " " <<
 				mesh.nodesVector.nodes[c].rho << " " <<
 				mesh.nodesVector.nodes[c].phi << " " <<
 				sqrt(mesh.nodesVector.nodes[c].EMfield[0] * mesh.nodesVector.nodes[c].EMfield[0] +
@@ -1424,10 +1525,10 @@ void writeSolutionNodeTecplot(const std::string& title, Mesh& mesh, double t)
 		// 4. Write connectivity data
 		for (int c = 0; c < mesh.numCells; c++)
 		{
-				grid_tecplot << mesh.cellsVector.cells[c].connectivity.nodeIDs[0] << " ";
-				grid_tecplot << mesh.cellsVector.cells[c].connectivity.nodeIDs[1] << " ";
-				grid_tecplot << mesh.cellsVector.cells[c].connectivity.nodeIDs[2] << " ";
-				grid_tecplot << mesh.cellsVector.cells[c].connectivity.nodeIDs[3] << std::endl;
+				grid_tecplot << mesh.cell(c).connectivity.nodeIDs[0] << " ";
+				grid_tecplot << mesh.cell(c).connectivity.nodeIDs[1] << " ";
+				grid_tecplot << mesh.cell(c).connectivity.nodeIDs[2] << " ";
+				grid_tecplot << mesh.cell(c).connectivity.nodeIDs[3] << std::endl;
 		}
 		grid_tecplot << std::endl;
 
@@ -1739,7 +1840,7 @@ void writeSolution_T_Tecplot(const std::string& title, double EK, double EP, int
 
 		grid_tecplot << "ZONE DATAPACKING = POINT, I = " << N + 1 << std::endl;
 		grid_tecplot << std::scientific << std::setprecision(16) << EK << " " <<
-			EP << " " << EK + abs(EP) << " " << t << std::scientific <<
+			EP << " " << EK + std::abs(EP) << " " << t << std::scientific <<
 			std::endl;
 
 		grid_tecplot.close();
@@ -1757,7 +1858,7 @@ void writeSolution_T_Tecplot(const std::string& title, double EK, double EP, int
 		// 2. Write solution data
 
 		grid_tecplot << std::scientific << std::setprecision(16) << EK << " " <<
-			EP << " " << EK + abs(EP) << " " << t << std::scientific <<
+			EP << " " << EK + std::abs(EP) << " " << t << std::scientific <<
 			std::endl;
 
 		grid_tecplot.close();
@@ -3,7 +3,7 @@
 //  OP2A
 //
 //  Created by Kim M.K. on 09/11/2016.
-//  Last edited by Rahul Kalampattel, April 2018
+//  Last edited by Rahul Kalampattel, June 2018
 //  
 //  Copyright © 2016 Kim M.K. All rights reserved.
 //
@@ -19,6 +19,7 @@
 #include <iomanip>
 #include <string>
 #include <stdio.h>
+#include <unordered_map>
 
 #include "../COMM/assert_mk.hpp"
 #include "../COMM/readdatafromstring.hpp"
@@ -225,6 +226,22 @@ bool isWallTypeBC(int bc);
 
 void faceNodeNumberingReverse(std::vector<int>& nodeList, int type);
 int faceCompare(std::vector<int>& F1_list, std::vector<int>& F2_list, int type); // [1] Same [-1] Different direction [0] Different
+int faceDirection(const int* F1_list, const int* F2_list, int nnode);             // Same as faceCompare, for faces known to share all nodes
+const int* cellFaceNodeList(int celltype, int f, int& facetype);                  // Local node numbering of the f-th face of a cell
+
+// Hashed face table, used to identify faces from their nodes in O(1)
+struct FaceKey {
+    int n[MAX_FACE_PER_NODE];       // Sorted node IDs, unused entries are -1
+    
+    FaceKey(const int* nodeList, int nnode);
+    bool operator==(const FaceKey& other) const;
+};
+
+struct FaceKeyHash {
+    std::size_t operator()(const FaceKey& key) const;
+};
+
+typedef std::unordered_map<FaceKey, int, FaceKeyHash> FaceMap;
 
 ///////////////////////////////////////////////////////////////////////////////
 // Grid file read and processing
@@ -237,11 +254,15 @@ void precessingGridSU2(const std::string& mesh_file_name_SU2, std::string& out_f
 // 1.2 FLUENT input files
 void precessingGridFLUENT(const std::string& mesh_file_name_Fluent);
 void precessingGridFLUENT(const std::string& mesh_file_name_Fluent, std::string& out_file_name);
+// 1.3 OP2A output
+void writeGridOP2(const std::string& mesh_file_name, GridBasicInfo& gridinfo, GridGeo& gridgeo);
 
 ///////////////////////////////////////////////////////////////////////////////
 
 // 2. Processing
 void readGridFromFile(const std::string& mesh_file_name, GridBasicInfo& gridinfo, GridGeo& gridgeo);
+void readGridFromSU2(const std::string& mesh_file_name_SU2, GridBasicInfo& gridinfo, GridGeo& gridgeo);			// Direct read, no .op2 file
+void readGridFromFluent(const std::string& mesh_file_name_Fluent, GridBasicInfo& gridinfo, GridGeo& gridgeo);	// Direct read, no .op2 file
 void processingGrid(GridBasicInfo& gridinfo, GridGeo& gridgeo);
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3,10 +3,13 @@
 //  OP2A
 //
 //  Created by Kim M.K. on 09/11/2016.
+//  Last edited by Rahul Kalampattel, June 2018
+//
 //  Copyright © 2016 Kim M.K. All rights reserved.
 //
 
 #include <stdio.h>
+#include <algorithm>
 #include "grid.hpp"
 #include "../COMM/error_codes.hpp"
 #include "../COMM/error_exception.hpp"
@@ -14,7 +17,7 @@
 
 int faceTypeNumNode(int facetype)
 {
-    int nnode;
+    int nnode = 0;
     
     switch (facetype)
     {
@@ -40,7 +43,7 @@ int faceTypeNumNode(int facetype)
 
 int cellTypeNumNode(int celltype)
 {
-    int nnode;
+    int nnode = 0;
     
     switch (celltype)
     {
@@ -79,7 +82,7 @@ int cellTypeNumNode(int celltype)
 
 int cellTypeNumFace(int celltype)
 {
-    int nface;
+    int nface = 0;
     
     switch (celltype)
     {
@@ -234,3 +237,92 @@ int faceCompare(std::vector<int>& F1_list, std::vector<int>& F2_list, int type)
 
 
 
+// Local node numbering of cell faces (unused entries are -1). Faces of each
+// cell are oriented consistently, i.e. an edge shared by two faces of the
+// same cell is traversed in opposite directions.
+static const int TRI3_FACES[3][MAX_FACE_PER_NODE]     = {{0, 1, -1, -1}, {1, 2, -1, -1}, {2, 0, -1, -1}};
+static const int QUAD4_FACES[4][MAX_FACE_PER_NODE]    = {{0, 1, -1, -1}, {1, 2, -1, -1}, {2, 3, -1, -1}, {3, 0, -1, -1}};
+static const int TETRA4_FACES[4][MAX_FACE_PER_NODE]   = {{0, 1, 2, -1}, {0, 3, 1, -1}, {1, 3, 2, -1}, {0, 2, 3, -1}};
+static const int HEXA8_FACES[6][MAX_FACE_PER_NODE]    = {{0, 1, 2, 3}, {4, 7, 6, 5}, {0, 4, 5, 1}, {1, 5, 6, 2}, {2, 6, 7, 3}, {3, 7, 4, 0}};
+static const int PRISM6_FACES[5][MAX_FACE_PER_NODE]   = {{0, 1, 2, -1}, {3, 5, 4, -1}, {0, 3, 4, 1}, {1, 4, 5, 2}, {2, 5, 3, 0}};
+static const int PYRAMID5_FACES[5][MAX_FACE_PER_NODE] = {{0, 1, 2, 3}, {0, 4, 1, -1}, {1, 4, 2, -1}, {2, 4, 3, -1}, {3, 4, 0, -1}};
+
+const int* cellFaceNodeList(int celltype, int f, int& facetype)
+{
+    switch (celltype)
+    {
+        case TRI3:
+            facetype = LINE;
+            return (TRI3_FACES[f]);
+            
+        case QUAD4:
+            facetype = LINE;
+            return (QUAD4_FACES[f]);
+            
+        case TETRA4:
+            facetype = TRI3;
+            return (TETRA4_FACES[f]);
+            
+        case HEXA8:
+            facetype = QUAD4;
+            return (HEXA8_FACES[f]);
+            
+        case PRISM6:
+            facetype = (f <= 1) ? TRI3 : QUAD4;
+            return (PRISM6_FACES[f]);
+            
+        case PYRAMID5:
+            facetype = (f == 0) ? QUAD4 : TRI3;
+            return (PYRAMID5_FACES[f]);
+            
+        default:
+            Common::ExceptionError(FromHere(), "It is not supported cell-type", Common::ErrorCodes::NotSupportedType());
+            break;
+    }
+    
+    return (NULL);
+}
+
+
+int faceDirection(const int* F1_list, const int* F2_list, int nnode)
+{
+    if (nnode == 2) return ((F1_list[0] == F2_list[0]) ? 1 : -1);
+    
+    int j = 0;
+    while (j < nnode-1 && F2_list[j] != F1_list[0]) j++;
+    
+    for (int i = 1; i <= nnode-1; i++)
+    {
+        if (F1_list[i] != F2_list[(j+i) % nnode]) return (-1);
+    }
+    
+    return (1);
+}
+
+
+
+// Hashed face table
+FaceKey::FaceKey(const int* nodeList, int nnode)
+{
+    for (int i = 0; i <= MAX_FACE_PER_NODE-1; i++) n[i] = (i < nnode) ? nodeList[i] : -1;
+    std::sort(n, n + nnode);
+}
+
+bool FaceKey::operator==(const FaceKey& other) const
+{
+    for (int i = 0; i <= MAX_FACE_PER_NODE-1; i++)
+    {
+        if (n[i] != other.n[i]) return (false);
+    }
+    return (true);
+}
+
+std::size_t FaceKeyHash::operator()(const FaceKey& key) const
+{
+    unsigned long long h = 14695981039346656037ULL;
+    for (int i = 0; i <= MAX_FACE_PER_NODE-1; i++)
+    {
+        h = (h ^ static_cast<unsigned int>(key.n[i])) * 1099511628211ULL;
+    }
+    return (static_cast<std::size_t>(h ^ (h >> 32)));
+}
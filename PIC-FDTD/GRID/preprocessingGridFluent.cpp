@@ -3,7 +3,7 @@
 //  OP2A
 //
 //  Created by Kim M.K. on 09/11/2016.
-//  Last edited by Rahul Kalampattel, April 2018
+//  Last edited by Rahul Kalampattel, June 2018
 //
 //  Copyright © 2016 Kim M.K. All rights reserved.
 //
@@ -12,6 +12,7 @@
 #include <sstream>
 #include <iostream>
 #include <cstring>
+#include <cstdlib>
 #include <iomanip>
 
 
@@ -50,4613 +51,640 @@ int cellTypeConverterFluent(int typeFluent)
         case 6:
             type = PRISM6;
             break;
+        default:
+            type = -1;
+            break;
     }
     
     return (type);
 }
 
 
-void precessingGridFLUENT(const  std::string& mesh_file_name_Fluent)
+
+// Data section of a Fluent file (nodes, cells or faces of one zone). Each
+// section covers its own range of IDs, so sections can be read in parallel.
+struct FluentSection
+{
+    int index;              // Section index: 10 (nodes), 12 (cells) or 13 (faces)
+    int zone;
+    int index_s;
+    int index_e;
+    int type;               // Element type of the section (0 for mixed)
+    const char* data_s;     // Start of section data
+    const char* data_e;     // End of section data
+};
+
+
+// Grid data read from a Fluent file, indexed by Fluent ID (starting from 1)
+struct FluentData
+{
+    int dim;
+    std::vector<double> node_XY;        // 3 entries per node
+    std::vector<int>    face_type;
+    std::vector<int>    face_zone;
+    std::vector<int>    face_node;      // MAX_FACE_PER_NODE entries per face
+    std::vector<int>    face_cl;
+    std::vector<int>    face_cr;
+    std::vector<int>    cell_type;
+};
+
+
+
+// Boundary condition of a named Fluent zone type, [-1] for unsupported types
+static int bcTypeFluent(const char* zone_type, std::vector<int>& numBC)
+{
+    if (strcmp(zone_type, "interior") == 0 || strcmp(zone_type, "fluid") == 0)    return (BC_INTERIOR);
+    if (strcmp(zone_type, "pressure-outlet") == 0)                                return (BC_OUTLET);
+    if (strcmp(zone_type, "symmetry") == 0)                                       return (BC_SYMMETRY);
+    if (strcmp(zone_type, "axis") == 0)                                           return (BC_AXIS);
+    
+    // Types which can be split into several sub-conditions
+    int bc = -1;
+    if (strcmp(zone_type, "wall") == 0)                 bc = BC_WALL;
+    if (strcmp(zone_type, "pressure-inlet") == 0)       bc = BC_INLET;
+    if (strcmp(zone_type, "pressure-far-field") == 0)   bc = BC_FREESTREAM;
+    if (strcmp(zone_type, "anode") == 0)                bc = BC_ANODE;
+    if (strcmp(zone_type, "cathode") == 0)              bc = BC_CATHODE;
+    if (strcmp(zone_type, "dielectric-wall") == 0)      bc = BC_DIELECTRIC;
+    
+    if (bc == -1 || numBC[bc/10] >= BC_MAX_DETAIL_SUBCOND) return (-1);
+    
+    numBC[bc/10]++;
+    return (bc + numBC[bc/10] - 1);
+}
+
+
+
+// Read one data section, returns false if the data is incomplete
+static bool readSectionFluent(const FluentSection& section, FluentData& data)
+{
+    const char* pos = section.data_s;
+    char* end;
+    
+    for (int i = section.index_s; i <= section.index_e; i++)
+    {
+        switch (section.index)
+        {
+            case 10: // NODE
+                for (int k = 0; k <= data.dim-1; k++)
+                {
+                    data.node_XY[i*3 + k] = std::strtod(pos, &end);
+                    if (end == pos || end > section.data_e) return (false);
+                    pos = end;
+                }
+                break;
+    
+            case 12: // CELL (mixed element types only)
+                data.cell_type[i] = cellTypeConverterFluent(static_cast<int>(std::strtol(pos, &end, 16)));
+                if (end == pos || end > section.data_e) return (false);
+                pos = end;
+                break;
+    
+            case 13: // FACE
+            {
+                int nnode = section.type;
+                if (nnode == 0)
+                {
+                    nnode = static_cast<int>(std::strtol(pos, &end, 16));
+                    if (end == pos) return (false);
+                    pos = end;
+                }
+    
+                switch (nnode)
+                {
+                    case 2:
+                        data.face_type[i] = LINE;
+                        break;
+                    case 3:
+                        data.face_type[i] = TRI3;
+                        break;
+                    case 4:
+                        data.face_type[i] = QUAD4;
+                        break;
+                    default:
+                        return (false);
+                }
+    
+                int values[MAX_FACE_PER_NODE+2];
+                for (int k = 0; k <= nnode+1; k++)
+                {
+                    values[k] = static_cast<int>(std::strtol(pos, &end, 16));
+                    if (end == pos || end > section.data_e) return (false);
+                    pos = end;
+                }
+    
+                for (int k = 0; k <= MAX_FACE_PER_NODE-1; k++) data.face_node[i*MAX_FACE_PER_NODE + k] = (k < nnode) ? values[k] : -1;
+                data.face_cl[i]   = values[nnode];
+                data.face_cr[i]   = values[nnode+1];
+                data.face_zone[i] = section.zone;
+                break;
+            }
+        }
+    }
+    
+    return (true);
+}
+
+
+
+// Read Fluent grid file directly into memory. The file is loaded once, the
+// zone sections are read in parallel, and cell node/face lists are built
+// from the face stencils using a hashed face table.
+void readGridFromFluent(const std::string& mesh_file_name_Fluent, GridBasicInfo& gridinfo, GridGeo& gridgeo)
 {
     int index;
     int index_s, index_e;
     int temp_dummy;
     int zone;
+    int type;
+    int temp_type;
+    
+    std::ostringstream error_message;
     
-    std::string line;
     
-    // 1. Open file to read
+    // 1. Load file into memory
     std::ifstream mesh_file_Fluent;
-    mesh_file_Fluent.open(mesh_file_name_Fluent.c_str());
+    mesh_file_Fluent.open(mesh_file_name_Fluent.c_str(), std::ios::binary);
     
     if (!mesh_file_Fluent.is_open()) Common::ExceptionError(FromHere(), "Cannot find grid file. Please check your grid file!", Common::ErrorCodes::FileSystem());
     
+    std::string buffer;
+    mesh_file_Fluent.seekg(0, std::ios::end);
+    buffer.resize(static_cast<size_t>(mesh_file_Fluent.tellg()));
+    mesh_file_Fluent.seekg(0, std::ios::beg);
+    mesh_file_Fluent.read(&buffer[0], buffer.size());
+    mesh_file_Fluent.close();
+    
     
-    // 2. 1st READ
-    int dim;
-    int nnm;
-    int nfm;
-    int ncm;
-    int nbc;
-    int maxZone = 0;
+    // 2. Read headers, locating data sections and BCs of each zone
+    int dim = -1;
+    int nnm = -1;
+    int nfm = -1;
+    int ncm = -1;
+    
+    std::vector<FluentSection> sections;
+    std::vector<int> bcZone;
+    std::vector<int> numBC(BC_DIELECTRIC/10 + 1, 0);
     
+    const char* pos = buffer.c_str();
+    const char* end = pos + buffer.size();
     
-    while (! mesh_file_Fluent.eof())
+    while (pos < end)
     {
+        const char* eol = static_cast<const char*>(memchr(pos, '\n', end - pos));
+        if (eol == NULL) eol = end;
+    
+        std::string line(pos, eol);
+        pos = eol + 1;
+    
         index = -1;
-        
-        getline(mesh_file_Fluent, line);
         sscanf_s(line.c_str(), "(%d ", &index);
-        
-        switch(index)
+    
+        FluentSection section;
+        section.index  = index;
+        section.data_s = NULL;
+        bool headerOnly = false;    // Cell zone of a single element type, without data
+    
+        switch (index)
         {
             case 2:
-                dim = 0;
                 sscanf_s(line.c_str(), "(%d %d)", &temp_dummy, &dim);
                 break;
-                
+    
             case 10:
-                index_s = 0;
-                index_e = 0;
-                sscanf_s(line.c_str(),"(%d (%x %x %x", &temp_dummy, &zone, &index_s, &index_e); // GETTING INDEX AND ZONE
+                zone = 0; index_s = 0; index_e = -1; type = -1; temp_type = -1;
+                sscanf_s(line.c_str(), "(%d (%x %x %x %d %d)", &temp_dummy, &zone, &index_s, &index_e, &type, &temp_type); // GETTING INDEX AND ZONE
+    
                 if (zone == 0) // READ GENERAL INFORMATION OF NODES
                 {
                     nnm = index_e - index_s + 1;
                 }
+                else
+                {
+                    if (temp_type != dim) Common::ExceptionError(FromHere(), "PROBLEM IN DIMENSION OF NODE DATA. Please the dimension of grid file", Common::ErrorCodes::MismatchData());
+                    section.data_s = pos;
+                }
                 break;
-                
+    
             case 12:
-                index_s = 0;
-                index_e = 0;
-                sscanf_s(line.c_str(),"(%d (%x %x %x", &temp_dummy, &zone, &index_s, &index_e); // GETTING INDEX AND ZONE
+                zone = 0; index_s = 0; index_e = -1; type = -1; temp_type = -1;
+                sscanf_s(line.c_str(), "(%d (%x %x %x %d %d)", &temp_dummy, &zone, &index_s, &index_e, &type, &temp_type); // GETTING INDEX AND ZONE
+    
                 if (zone == 0) // READ GENERAL INFORMATION OF CELLS
                 {
                     ncm = index_e - index_s + 1;
                 }
+                else if (type == 1)
+                {
+                    if (temp_type == 0) section.data_s = pos;
+                    else                headerOnly = true;
+                }
                 break;
-                
+    
             case 13:
-                index_s = 0;
-                index_e = 0;
-                sscanf_s(line.c_str(),"(%d (%x %x %x", &temp_dummy, &zone, &index_s, &index_e); // GETTING INDEX AND ZONE
-                
+                zone = 0; index_s = 0; index_e = -1; type = -1; temp_type = -1;
+                sscanf_s(line.c_str(), "(%d (%x %x %x %x %x)", &temp_dummy, &zone, &index_s, &index_e, &temp_type, &type); // GETTING INDEX AND ZONE
+    
                 if (zone == 0) // READ GENERAL INFORMATION OF FACES
                 {
                     nfm = index_e - index_s + 1;
                 }
                 else
                 {
-                    maxZone = fmax(maxZone, zone);
+                    section.data_s = pos;
+                }
+                break;
+    
+            case 39:
+            case 45:
+            {
+                char zone_type[64];
+                zone = -1;
+                sscanf(line.c_str(), "(%d (%d %63s", &index, &zone, zone_type); // GETTING ZONE TYPE (width limited to buffer)
+    
+                if (zone >= 0)
+                {
+                    if (zone + 1 > static_cast<int>(bcZone.size())) bcZone.resize(zone+1, -1);
+                    bcZone[zone] = bcTypeFluent(zone_type, numBC);
+    
+                    if (bcZone[zone] == -1)
+                    {
+                        Common::ExceptionError(FromHere(), "Given BC type in the grid is not supported BC type. Please check BC type in the grid file", Common::ErrorCodes::NotSupportedType());
+                    }
                 }
                 break;
+            }
         }
-    }
     
-    // 2. Second Read
-    std::vector<int>	nfmZone(maxZone+1, 0);
-    std::vector<int>    bcZone(maxZone+1, -1);
+        section.zone    = zone;
+        section.index_s = index_s;
+        section.index_e = index_e;
+        section.type    = (index == 12) ? temp_type : type;
     
+        if (headerOnly) sections.push_back(section);
     
-    mesh_file_Fluent.clear();
-    mesh_file_Fluent.seekg(0, std::ios::beg);
+        // Data continues until the closing bracket of the section
+        if (section.data_s != NULL)
+        {
+            while (section.data_s < end && (*section.data_s == '(' || isspace(*section.data_s))) section.data_s++;
+    
+            section.data_e = static_cast<const char*>(memchr(section.data_s, ')', end - section.data_s));
+            if (section.data_e == NULL) section.data_e = end;
+    
+            sections.push_back(section);
+            pos = section.data_e;
+        }
+    }
     
-    int temp_zone;
-    int bc_type;
-    int nfm_zone;
-    int num_zone = 0;
+    if (dim != 2 && dim != 3) Common::ExceptionError(FromHere(), "Cannot find dimension information in the gridfile!", Common::ErrorCodes::NoSuchValue());
+    if (nnm <= 0) Common::ExceptionError(FromHere(), "Cannot find NNM information in the grid file!", Common::ErrorCodes::NoSuchValue());
+    if (nfm <= 0) Common::ExceptionError(FromHere(), "Cannot find NFM information in the grid file!", Common::ErrorCodes::NoSuchValue());
+    if (ncm <= 0) Common::ExceptionError(FromHere(), "Cannot find NCM information in the grid file!", Common::ErrorCodes::NoSuchValue());
     
-    int numWall       = 0;
-    int numInlet      = 0;
-    int numAnode      = 0;
-    int numCathode    = 0;
-    int numDielectric = 0;
-    int numFreestream = 0;
     
+    // 3. Read node, face and cell data of all zones in parallel
+    FluentData data;
+    data.dim = dim;
+    data.node_XY.assign((nnm+1)*3, 0.0);
+    data.face_type.assign(nfm+1, -1);
+    data.face_zone.assign(nfm+1, -1);
+    data.face_node.assign((nfm+1)*MAX_FACE_PER_NODE, -1);
+    data.face_cl.assign(nfm+1, 0);
+    data.face_cr.assign(nfm+1, 0);
+    data.cell_type.assign(ncm+1, -1);
     
-    char zone_type[20];
+    int numSections = static_cast<int>(sections.size());
+    int n = 0;
+    int f = 0;
+    int c = 0;
     
-    while (! mesh_file_Fluent.eof())
+    for (int s = 0; s <= numSections-1; s++)
     {
-        index = -1;
-        getline(mesh_file_Fluent, line);
-        sscanf_s(line.c_str(), "(%d ", &index);
-        
-        switch(index)
+        int maxID = (sections[s].index == 10) ? nnm : ((sections[s].index == 13) ? nfm : ncm);
+        if (sections[s].index_s < 1 || sections[s].index_e > maxID)
         {
-            case 13:
-                index_s = 0;
-                index_e = 0;
-                sscanf_s(line.c_str(),"(%d (%x %x %x", &temp_dummy, &zone, &index_s, &index_e); // GETTING INDEX AND ZONE
-                
-                if (zone != 0)
-                {
-                    sscanf_s(line.c_str(),"(%d (%x %x %x %d", &temp_dummy, &temp_zone, &index_s, &index_e, &bc_type); // GETTING INDEX AND ZONE
-                    nfm_zone 		= index_e - index_s + 1;
-                    nfmZone[zone]	= nfm_zone;
-                    num_zone++;
-                }
-                break;
-                
-                
-            case 45:
-                sscanf_s(line.c_str(),"(%d (%d %s", &index, &zone, zone_type); // GETTING INDEX AND ZONE
-                
-                // GENERAL TYPE OF BOUNDARY CONDITIONS
-                bool flagFindBCtype = false;
-                
-                if (strcmp(zone_type,"interior") == 0)
-                {
-                    bcZone[zone] = 0;
-                    flagFindBCtype = true;
-                }
-                
-                if (strcmp(zone_type,"wall") == 0)
-                {
-                    if (numWall < BC_MAX_DETAIL_SUBCOND)
-                    {
-                        bcZone[zone] = BC_WALL + numWall;
-                        flagFindBCtype = true;
-                        numWall++;
-                    }
-                }
-                
-                if (strcmp(zone_type,"pressure-inlet") == 0)
-                {
-                    if (numInlet < BC_MAX_DETAIL_SUBCOND)
-                    {
-                        bcZone[zone] = BC_INLET + numInlet;
-                        flagFindBCtype = true;
-                        numInlet++;
-                    }
-                }
-                
-                if (strcmp(zone_type,"pressure-outlet") == 0)
-                {
-                    bcZone[zone] = BC_OUTLET;
-                    flagFindBCtype = true;
-                }
-                
-                if (strcmp(zone_type,"pressure-far-field") == 0)
-                {
-                    if (numFreestream < BC_MAX_DETAIL_SUBCOND)
-                    {
-                        bcZone[zone] = BC_FREESTREAM + numFreestream;
-                        flagFindBCtype = true;
-                        numFreestream++;
-                    }
-                }
-                
-                if (strcmp(zone_type,"symmetry") == 0)
-                {
-                    bcZone[zone] = BC_SYMMETRY;
-                    flagFindBCtype = true;
-                }
-                
-                if (strcmp(zone_type,"axis") == 0)
-                {
-                    bcZone[zone] = BC_AXIS;
-                    flagFindBCtype = true;
-                }
-                
-                if (strcmp(zone_type,"anode") == 0)
-                {
-                    if (numAnode < BC_MAX_DETAIL_SUBCOND)
-                    {
-                        bcZone[zone] = BC_ANODE + numAnode;
-                        flagFindBCtype = true;
-                        numAnode++;
-                    }
-                }
-                
-                if (strcmp(zone_type,"cathode") == 0)
-                {
-                    if (numCathode < BC_MAX_DETAIL_SUBCOND)
-                    {
-                        bcZone[zone] = BC_CATHODE + numCathode;
-                        flagFindBCtype = true;
-                        numCathode++;
-                    }
-                }
-                
-                if (strcmp(zone_type,"dielectric-wall") == 0)
-                {
-                    if (numDielectric < BC_MAX_DETAIL_SUBCOND)
-                    {
-                        bcZone[zone] = BC_DIELECTRIC + numDielectric;
-                        flagFindBCtype = true;
-                        numDielectric++;
-                    }
-                }
-                
-                if (strcmp(zone_type,"fluid") == 0)
-                {
-                    bcZone[zone] = 0;
-                    flagFindBCtype = true;
-                }
-                
-                if (flagFindBCtype == false)
-                {
-                    Common::ExceptionError(FromHere(), "Given BC type in the grid is not supported BC type. Please check BC type in the grid file", Common::ErrorCodes::NotSupportedType());
-                }
-                break;
+            error_message << "Zone [" << sections[s].zone << "] has IDs out of range of the header";
+            Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::MismatchData());
         }
+    
+        if (sections[s].index == 10) n += sections[s].index_e - sections[s].index_s + 1;
+        if (sections[s].index == 13) f += sections[s].index_e - sections[s].index_s + 1;
+        if (sections[s].index == 12) c += sections[s].index_e - sections[s].index_s + 1;
     }
     
+    if (n != nnm) Common::ExceptionError(FromHere(), "PROBLEM IN NODE DATA. Number of read node does not match with header", Common::ErrorCodes::MismatchData());
+    if (f != nfm) Common::ExceptionError(FromHere(), "PROBLEM IN Face DATA. Number of read face does not match with header", Common::ErrorCodes::MismatchData());
+    if (c != ncm) Common::ExceptionError(FromHere(), "PROBLEM IN Cell DATA. Number of read cell does not match with header", Common::ErrorCodes::MismatchData());
     
-    // 3. Read Node Data (3rd READ)
-    std::vector<int>	                node_ID(nnm,-1);
-    std::vector<int>	                node_whereis(nnm+1, -1);
-    std::vector<std::vector<double> >	node_XY(nnm, std::vector<double>(dim, 0.0));
-    mesh_file_Fluent.clear();
-    mesh_file_Fluent.seekg(0, std::ios::beg);
+    std::vector<char> sectionRead(numSections, 1);
     
+#pragma omp parallel for schedule(dynamic)
+    for (int s = 0; s < numSections; s++)
+    {
+        if (sections[s].index == 12 && sections[s].data_s == NULL)
+        {
+            for (int i = sections[s].index_s; i <= sections[s].index_e; i++) data.cell_type[i] = cellTypeConverterFluent(sections[s].type);
+        }
+        else
+        {
+            sectionRead[s] = readSectionFluent(sections[s], data);
+        }
+    }
     
-    int type;
-    int temp_dim;
-    int n = 0;
-    double x, y, z;
-    while (! mesh_file_Fluent.eof())
+    for (int s = 0; s <= numSections-1; s++)
     {
-        index = -1;
-        getline(mesh_file_Fluent, line);
-        sscanf_s(line.c_str(), "(%d ", &index);
-        
-        if (index == 10)
+        if (sectionRead[s] == 0)
         {
-            temp_dummy = -1;
-            zone       = -1;
-            index_s    = -1;
-            index_e    = -1;
-            type       = -1;
-            temp_dim   = -1;
-            
-            sscanf_s(line.c_str(),"(%d (%x %x %x %d %d)", &temp_dummy, &zone, &index_s, &index_e, &type, &temp_dim); // GETTING INDEX AND ZONE
-            if (zone > 0)
-            {
-                if (temp_dim != dim)
-                    Common::ExceptionError(FromHere(), "PROBLEM IN DIMENSION OF NODE DATA. Please the dimension of grid file", Common::ErrorCodes::MismatchData());
-                
-                if (dim == 2)
-                {
-                    for (int i = index_s; i <= index_e; i++)
-                    {
-                        x = 0.0;
-                        y = 0.0;
-                        
-                        getline(mesh_file_Fluent, line);
-                        sscanf_s(line.c_str(), "%lf %lf", &x, &y);
-                        
-                        node_ID[n]    = n;
-                        node_XY[n][0] = x;
-                        node_XY[n][1] = y;
-                        node_whereis[i] = n;
-                        n++;
-                    }
-                }
-                else
-                {
-                    for (int i = index_s; i <= index_e; i++)
-                    {
-                        x = 0.0;
-                        y = 0.0;
-                        z = 0.0;
-                        
-                        getline(mesh_file_Fluent, line);
-                        sscanf_s(line.c_str(), "%lf %lf %lf", &x, &y, &z);
-                        
-                        node_ID[n]    = i;
-                        node_XY[n][0] = x;
-                        node_XY[n][1] = y;
-                        node_XY[n][2] = z;
-                        node_whereis[i] = n;
-                        n++;
-                    }
-                }
-            }
+            error_message << "Zone [" << sections[s].zone << "] has incomplete or unsupported data. PLEASE CHECK THE MESH FILE!";
+            Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::MismatchData());
         }
     }
     
-    if (n != nnm) Common::ExceptionError(FromHere(), "PROBLEM IN NODE DATA. Number of read node does not match with header", Common::ErrorCodes::MismatchData());
-    // END READ NODE DATA
     
+    // 4. List faces of each cell (in order of appearance in the file) and
+    //    build hashed face table
+    std::vector<int> cell_faceStart(ncm+2, 0);
+    std::vector<int> cell_faces;
     
+    for (int f = 1; f <= nfm; f++)
+    {
+        if (data.face_cl[f] > ncm || data.face_cr[f] > ncm) Common::ExceptionError(FromHere(), "PROBLEM IN Face DATA. Cell ID is out of range", Common::ErrorCodes::MismatchData());
+        if (data.face_cl[f] > 0) cell_faceStart[data.face_cl[f]+1]++;
+        if (data.face_cr[f] > 0) cell_faceStart[data.face_cr[f]+1]++;
+    }
+    for (int c = 1; c <= ncm; c++) cell_faceStart[c+1] += cell_faceStart[c];
     
-    // 4. Read Face Data (4th READ)
-    std::vector<int>               face_type (nfm, -1);
-    std::vector<int>               face_ID(nfm, -1);
-    std::vector<int>               face_whereis(nfm+1, -1);
-    std::vector<int>               face_BC(nfm, 0);
-    std::vector<std::vector<int> > face_stencil(nfm, std::vector<int>(2, -1));
-    std::vector<std::vector<int> > face_node(nfm, std::vector<int>(MAX_FACE_PER_NODE, -1));
+    cell_faces.resize(cell_faceStart[ncm+1]);
+    std::vector<int> filled_faces(cell_faceStart.begin(), cell_faceStart.end()-1);
     
-    int f = 0;
+    FaceMap faceMap;
+    faceMap.reserve(nfm);
     
-    mesh_file_Fluent.clear();
-    mesh_file_Fluent.seekg(0, std::ios::beg);
+    for (int s = 0; s <= numSections-1; s++)
+    {
+        if (sections[s].index != 13) continue;
+    
+        for (int f = sections[s].index_s; f <= sections[s].index_e; f++)
+        {
+            if (data.face_cl[f] > 0) cell_faces[filled_faces[data.face_cl[f]]++] = f;
+            if (data.face_cr[f] > 0) cell_faces[filled_faces[data.face_cr[f]]++] = f;
     
+            faceMap.emplace(FaceKey(&data.face_node[f*MAX_FACE_PER_NODE], faceTypeNumNode(data.face_type[f])), f);
+        }
+    }
+    
+    
+    // 5. Construct cells (Node and Face list)
+    std::vector<int>  cell_NodeList((ncm+1)*MAX_CELL_PER_NODE, -1);
+    std::vector<int>  cell_FaceList((ncm+1)*MAX_CELL_PER_FACE, -1);
+    std::vector<char> cell_error(ncm+1, 0);     // [1] Faces missing [2] Nodes missing [3] Faces not found [4] Repeated nodes
     
-    while (! mesh_file_Fluent.eof())
+#pragma omp parallel for
+    for (int c = 1; c <= ncm; c++)
     {
-        index = -1;
-        getline(mesh_file_Fluent, line);
-        sscanf_s(line.c_str(), "(%d ", &index);
-        
-        if (index == 13)
+        int ctype = data.cell_type[c];
+        if (ctype == -1)
+        {
+            cell_error[c] = 1;
+            continue;
+        }
+    
+        int nnode  = cellTypeNumNode(ctype);
+        int nface  = cellTypeNumFace(ctype);
+        int* nodes = &cell_NodeList[c*MAX_CELL_PER_NODE];
+        int* faces = &cell_faces[cell_faceStart[c]];
+        int num    = cell_faceStart[c+1] - cell_faceStart[c];
+    
+        if (num != nface)
+        {
+            cell_error[c] = 1;
+            continue;
+        }
+    
+        if (ctype == TRI3 || ctype == QUAD4)
         {
-            temp_dummy	= -1;
-            zone 		= -1;
-            index_s     = -1;
-            index_e     = -1;
-            bc_type     = -1;
-            type 	    = -1;
-            
-            sscanf_s(line.c_str(),"(%d (%x %x %x %d %d)", &temp_dummy, &zone, &index_s, &index_e, &bc_type, &type); // GETTING INDEX AND ZONE
-            
-            if (zone > 0)
+            // Edges are oriented so that the cell is on their left, and then
+            // chained starting from the first face of the cell
+            for (int k = 0; k <= nnode-2; k++)
             {
-                // Assign BC type from data
-                bc_type	= bcZone[zone];
-                
-                switch (type)
+                for (int i = 0; i <= num-1; i++)
                 {
-                    case 0:
-                        for (int i = index_s; i <= index_e; i++)
-                        {
-                            int temp_faceType = -1;
-                            getline(mesh_file_Fluent, line);
-                            sscanf_s(line.c_str(), "%d", &temp_faceType);
-                            
-                            std::vector<int> temp_nodeList (MAX_FACE_PER_NODE, -1);
-                            int cl = -1;
-                            int cr = -1;
-                            
-                            switch (temp_faceType)
-                            {
-                                case 2: // LINE
-                                    sscanf_s(line.c_str(), "%d %x %x %x %x", &type, &temp_nodeList[0], &temp_nodeList[1], &cl, &cr);
-                                    
-                                    face_ID[f]         = i;
-                                    face_type[f]       = LINE;
-                                    face_node[f][0]    = temp_nodeList[0];
-                                    face_node[f][1]    = temp_nodeList[1];
-                                    face_stencil[f][0] = cl;
-                                    face_stencil[f][1] = cr;
-                                    break;
-                                    
-                                case 3: // Triangle
-                                    sscanf_s(line.c_str(), "%d %x %x %x %x %x", &type, &temp_nodeList[0], &temp_nodeList[1], &temp_nodeList[2], &cl, &cr);
-                                    
-                                    face_ID[f]         = i;
-                                    face_type[f]       = TRI3;
-                                    face_node[f][0]    = temp_nodeList[0];
-                                    face_node[f][1]    = temp_nodeList[1];
-                                    face_node[f][2]    = temp_nodeList[2];
-                                    face_stencil[f][0] = cl;
-                                    face_stencil[f][1] = cr;
-                                    break;
-                                    
-                                case 4: // Quadrilateral
-                                    sscanf_s(line.c_str(), "%d %x %x %x %x %x %x", &type, &temp_nodeList[0], &temp_nodeList[1], &temp_nodeList[2], &temp_nodeList[3], &cl, &cr);
-                                    
-                                    face_ID[f]         = i;
-                                    face_type[f]       = QUAD4;
-                                    face_node[f][0]    = temp_nodeList[0];
-                                    face_node[f][1]    = temp_nodeList[1];
-                                    face_node[f][2]    = temp_nodeList[2];
-                                    face_node[f][3]    = temp_nodeList[3];
-                                    face_stencil[f][0] = cl;
-                                    face_stencil[f][1] = cr;
-                                    break;
-                                    
-                                default:
-                                    Common::ExceptionError(FromHere(), "It is not supported Face-type. PLEASE CHECK THE FACE TYPE IN A MESH FILE!", Common::ErrorCodes::NotSupportedType());
-                                    break;
-                            }
-                            
-                            face_BC[f]      = bc_type;
-                            face_whereis[i]	= f;
-                            f++;
-                        }
-                        break;
-                        
-                    case 2: // LINE
-                        for (int i = index_s; i <= index_e; i++)
-                        {
-                            std::vector<int> temp_nodeList (MAX_FACE_PER_NODE, -1);
-                            int cl = -1;
-                            int cr = -1;
-                            
-                            getline(mesh_file_Fluent, line);
-                            sscanf_s(line.c_str(), "%x %x %x %x", &temp_nodeList[0], &temp_nodeList[1], &cl, &cr);
-                            
-                            face_ID[f]         = i;
-                            face_type[f]       = LINE;
-                            face_node[f][0]    = temp_nodeList[0];
-                            face_node[f][1]    = temp_nodeList[1];
-                            face_stencil[f][0] = cl;
-                            face_stencil[f][1] = cr;
-                            
-                            face_BC[f]         = bc_type;
-                            face_whereis[i]	   = f;
-                            f++;
-                        }
-                        break;
-                        
-                    case 3: // Triangle
-                        for (int i = index_s; i <= index_e; i++)
-                        {
-                            std::vector<int> temp_nodeList (MAX_FACE_PER_NODE, -1);
-                            int cl = -1;
-                            int cr = -1;
-                            
-                            getline(mesh_file_Fluent, line);
-                            sscanf_s(line.c_str(), "%x %x %x %x %x", &temp_nodeList[0], &temp_nodeList[1], &temp_nodeList[2], &cl, &cr);
-                            
-                            face_ID[f]         = i;
-                            face_type[f]       = TRI3;
-                            face_node[f][0]    = temp_nodeList[0];
-                            face_node[f][1]    = temp_nodeList[1];
-                            face_node[f][2]    = temp_nodeList[2];
-                            face_stencil[f][0] = cl;
-                            face_stencil[f][1] = cr;
-                            
-                            face_BC[f]         = bc_type;
-                            face_whereis[i]	   = f;
-                            f++;
-                        }
-                        break;
-                        
-                    case 4: // Quadrilateral
-                        for (int i = index_s; i <= index_e; i++)
-                        {
-                            std::vector<int> temp_nodeList (MAX_FACE_PER_NODE, -1);
-                            int cl = -1;
-                            int cr = -1;
-                            
-                            getline(mesh_file_Fluent, line);
-                            sscanf_s(line.c_str(), "%x %x %x %x %x %x", &temp_nodeList[0], &temp_nodeList[1], &temp_nodeList[2], &temp_nodeList[3], &cl, &cr);
-                            
-                            face_ID[f]         = i;
-                            face_type[f]       = QUAD4;
-                            face_node[f][0]    = temp_nodeList[0];
-                            face_node[f][1]    = temp_nodeList[1];
-                            face_node[f][2]    = temp_nodeList[2];
-                            face_node[f][3]    = temp_nodeList[3];
-                            face_stencil[f][0] = cl;
-                            face_stencil[f][1] = cr;
-                            
-                            face_BC[f]         = bc_type;
-                            face_whereis[i]	   = f;
-                            f++;
-                        }
+                    int* fn = &data.face_node[faces[i]*MAX_FACE_PER_NODE];
+                    int n0  = (data.face_cl[faces[i]] == c) ? fn[0] : fn[1];
+                    int n1  = (data.face_cl[faces[i]] == c) ? fn[1] : fn[0];
+    
+                    if (k == 0 && i == 0)
+                    {
+                        nodes[0] = n0;
+                        nodes[1] = n1;
                         break;
-                        
-                    default:
-                        Common::ExceptionError(FromHere(), "It is not supported Face-type. PLEASE CHECK THE FACE TYPE IN A MESH FILE!", Common::ErrorCodes::NotSupportedType());
+                    }
+                    else if (k > 0 && n0 == nodes[k])
+                    {
+                        nodes[k+1] = n1;
                         break;
+                    }
                 }
             }
         }
-    }
+        else
+        {
+            // Base face (oriented with the cell on its right), followed by the
+            // apex or the nodes joined to each base node by an edge
+            int base = 0;
+            for (int i = 0; i <= num-1; i++)
+            {
+                int ftype = data.face_type[faces[i]];
+                if ((ctype == PRISM6 && ftype == TRI3) || (ctype == PYRAMID5 && ftype == QUAD4))
+                {
+                    base = i;
+                    break;
+                }
+            }
     
-    if (f != nfm) Common::ExceptionError(FromHere(), "PROBLEM IN Face DATA. Number of read face does not match with header", Common::ErrorCodes::MismatchData());
+            int* fn = &data.face_node[faces[base]*MAX_FACE_PER_NODE];
+            int nb  = faceTypeNumNode(data.face_type[faces[base]]);
+            for (int k = 0; k <= nb-1; k++) nodes[k] = (data.face_cr[faces[base]] == c || k == 0) ? fn[k] : fn[nb-k];
     
+            for (int i = 0; i <= num-1; i++)
+            {
+                if (i == base) continue;
     
-    // 5. Read Cell Data (5th READ)
-    std::vector<int>               cell_type(ncm, -1);
-    std::vector<int>               cell_ID(ncm, -1);
-    std::vector<int>               cell_BC(ncm, -1);
-    std::vector<int>               cell_whereis(ncm+1, -1);
-    std::vector<std::vector<int> > cell_NodeList(ncm, std::vector<int>(MAX_CELL_PER_NODE, -1));
-    std::vector<std::vector<int> > cell_FaceList(ncm, std::vector<int>(MAX_CELL_PER_FACE, -1));
+                int* fi = &data.face_node[faces[i]*MAX_FACE_PER_NODE];
+                int ni  = faceTypeNumNode(data.face_type[faces[i]]);
     
-    int c = 0;
-    int temp_type;
-    mesh_file_Fluent.clear();
-    mesh_file_Fluent.seekg(0, std::ios::beg);
+                for (int k = 0; k <= ni-1; k++)
+                {
+                    int p = fi[k];
+                    int q = fi[(k+1) % ni];
+                    int pb = -1;
+                    int qb = -1;
     
+                    for (int j = 0; j <= nb-1; j++)
+                    {
+                        if (nodes[j] == p) pb = j;
+                        if (nodes[j] == q) qb = j;
+                    }
     
-    while (! mesh_file_Fluent.eof())
-    {
-        index = -1;
-        getline(mesh_file_Fluent, line);
-        sscanf_s(line.c_str(), "(%d ", &index);
-        
-        if (index == 12)
-        {
-            temp_dummy	= -1;
-            zone 		= -1;
-            index_s		= -1;
-            index_e		= -1;
-            type 		= -1;
-            temp_type	= -1;
-            
-            sscanf_s(line.c_str(),"(%d (%x %x %x %d", &temp_dummy, &zone, &index_s, &index_e, &type); // GETTING INDEX AND ZONE
-            if (zone > 0)
-            {
-                sscanf_s(line.c_str(),"(%d (%x %x %x %d %d)", &temp_dummy, &zone, &index_e, &index_e, &type, &temp_type); // GETTING INDEX AND ZONE
-                
-                if (type == 1)
-                {
-                    if (temp_type != 0)
+                    if (nnode == nb+1)
                     {
-                        for (int i = index_s; i <= index_e; i++)
-                        {
-                            cell_ID[c]      = i;
-                            cell_BC[c]      = BC_INTERIOR;
-                            cell_type[c]    = cellTypeConverterFluent(temp_type);
-                            cell_whereis[i]	= c;
-                            c++;
-                        }
+                        if (pb == -1) nodes[nb] = p;
                     }
                     else
                     {
-                        for (int i = index_s; i <= index_e; i++)
-                        {
-                            mesh_file_Fluent >> temp_type;
-                            
-                            cell_ID[c]      = i;
-                            cell_BC[c]      = BC_INTERIOR;
-                            cell_type[c]    = cellTypeConverterFluent(temp_type);
-                            cell_whereis[i]	= c;
-                            c++;
-                        }
+                        if (pb != -1 && qb == -1) nodes[nb+pb] = q;
+                        if (qb != -1 && pb == -1) nodes[nb+qb] = p;
                     }
                 }
             }
         }
+    
+        if (Common::VectorCompare::hasSameComponentINT(std::vector<int>(nodes, nodes+nnode), nnode))
+        {
+            cell_error[c] = 4;
+            continue;
+        }
+    
+        for (int k = 0; k <= nnode-1; k++)
+        {
+            if (nodes[k] < 1 || nodes[k] > nnm) cell_error[c] = 2;
+        }
+        if (cell_error[c] != 0) continue;
+    
+        // Find faces from their nodes
+        for (int lf = 0; lf <= nface-1; lf++)
+        {
+            int ftype;
+            const int* localNodes = cellFaceNodeList(ctype, lf, ftype);
+            int nfnode = faceTypeNumNode(ftype);
+    
+            int nodeList[MAX_FACE_PER_NODE];
+            for (int k = 0; k <= nfnode-1; k++) nodeList[k] = nodes[localNodes[k]];
+    
+            FaceMap::const_iterator it = faceMap.find(FaceKey(nodeList, nfnode));
+            if (it == faceMap.end() || (data.face_cl[it->second] != c && data.face_cr[it->second] != c))
+            {
+                cell_error[c] = 3;
+                break;
+            }
+            cell_FaceList[c*MAX_CELL_PER_FACE + lf] = it->second;
+        }
+    }
+    
+    // Error check
+    for (int c = 1; c <= ncm; c++)
+    {
+        switch (cell_error[c])
+        {
+            case 1:
+                error_message << "Cell ID:[" << c << "] has problem during cell mesh construction. Some of faces are not filled";
+                Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::MismatchData());
+                break;
+    
+            case 2:
+                error_message << "Cell ID:[" << c << "] has problem during cell mesh construction. Some of nodes are not filled";
+                Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::MismatchData());
+                break;
+    
+            case 3:
+                error_message << "Cell ID:[" << c << "] has problem during cell mesh construction. It has impossible face-type";
+                Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::NotSupportedType());
+                break;
+    
+            case 4:
+                error_message << "Cell ID:[" << c << "] has repeated node on its node list.";
+                Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::ExceedLimit());
+                break;
+        }
     }
-    if (c != ncm) Common::ExceptionError(FromHere(), "PROBLEM IN Cell DATA. Number of read cell does not match with header", Common::ErrorCodes::MismatchData());
     
     
+    // 6. Set grid data
+    gridinfo.DIM = dim;
+    gridinfo.NNM = nnm;
+    gridinfo.NFM = nfm;
+    gridinfo.NCM = ncm;
+    gridinfo.NGM = -1;
+    gridinfo.setComplete();
+    
+    gridgeo.nodes.clear();
+    gridgeo.faces.clear();
+    gridgeo.cells.clear();
+    gridgeo.nodes.resize(nnm);
+    gridgeo.faces.resize(nfm);
+    gridgeo.cells.resize(ncm);
+    gridgeo.whereisNodes.assign(nnm+1, 0);
+    gridgeo.whereisFaces.assign(nfm+1, 0);
+    gridgeo.whereisCells.assign(ncm+1, 0);
+    
+    for (int n = 1; n <= nnm; n++)
+    {
+        gridgeo.nodes[n-1].geometry.id   = n;
+        gridgeo.nodes[n-1].geometry.X(0) = data.node_XY[n*3];
+        gridgeo.nodes[n-1].geometry.X(1) = data.node_XY[n*3 + 1];
+        gridgeo.nodes[n-1].geometry.X(2) = data.node_XY[n*3 + 2];
+        gridgeo.whereisNodes[n] = n-1;
+    }
     
+    for (int f = 1; f <= nfm; f++)
+    {
+        FaceBase& face = gridgeo.faces[f-1];
+        int bc = (data.face_zone[f] >= 0 && data.face_zone[f] < static_cast<int>(bcZone.size())) ? bcZone[data.face_zone[f]] : -1;
     
+        face.geometry.id       = f;
+        face.geometry.bcType   = bc;
+        face.connectivity.type = data.face_type[f];
     
+        face.connectivity.numNodes = faceTypeNumNode(data.face_type[f]);
+        face.connectivity.nodeIDs.resize(face.connectivity.numNodes);
+        for (int n = 0; n <= face.connectivity.numNodes-1; n++) face.connectivity.nodeIDs[n] = data.face_node[f*MAX_FACE_PER_NODE + n];
     
-    /*
-     * Construct cells (Node and Face list)
-     */
-    int flag;
-    std::vector<int> filled_nodes(ncm, 0);
-    std::vector<int> filled_faces(ncm, 0);
+        face.connectivity.cl.resize(1);
+        face.connectivity.cr.resize(1);
+        face.connectivity.cl[0] = data.face_cl[f];
+        face.connectivity.cr[0] = data.face_cr[f];
     
-    std::ostringstream error_message;
+        gridgeo.whereisFaces[f] = f-1;
+    }
     
-    for (int f = 0; f <= nfm-1; f++)
+    for (int c = 1; c <= ncm; c++)
     {
-        int cl	= face_stencil[f][0];
-        int cr	= face_stencil[f][1];
-        
-        // For Right Cell
-        if (cr != -1)
-        {
-            c = cell_whereis[cr];
-            
-            switch (cell_type[c])
-            {
-                case TRI3:
-                    if (face_type[f] != LINE)
-                    {
-                        error_message << "Cell ID:[" << cr << "] has problem during cell mesh construction. It has impossible face-type";
-                        Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::NotSupportedType());
-                    }
-                    
-                    
-                    if (filled_nodes[c] == 0)
-                    {
-                        cell_NodeList[c][0]	= face_node[f][1];
-                        cell_NodeList[c][1]	= face_node[f][0];
-                        filled_nodes[c]	= 2;
-                        
-                        cell_FaceList[c][0]	= face_ID[f];
-                        filled_faces[c] = 1;
-                    }
-                    else if (filled_nodes[c] == 2)
-                    {
-                        if (face_node[f][0] == cell_NodeList[c][0])
-                        {
-                            cell_NodeList[c][2]	= face_node[f][1];
-                            filled_nodes[c]	= 3;
-                            
-                            cell_FaceList[c][2]	= face_ID[f];
-                            filled_faces[c]++;
-                        }
-                        else if (face_node[f][1] == cell_NodeList[c][1])
-                        {
-                            cell_NodeList[c][2]	= face_node[f][0];
-                            filled_nodes[c]	= 3;
-                            
-                            cell_FaceList[c][1]	= face_ID[f];
-                            filled_faces[c]++;
-                        }
-                    }
-                    else
-                    {
-                        if (filled_faces[c] == 2)
-                        {
-                            if (face_node[f][0] == cell_NodeList[c][0] && face_node[f][1] == cell_NodeList[c][2])
-                            {
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if (face_node[f][0] == cell_NodeList[c][2] && face_node[f][1] == cell_NodeList[c][1])
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                    }
-                    break;
-                    
-                case QUAD4:
-                    if (face_type[f] != LINE)
-                    {
-                        error_message << "Cell ID:[" << cr << "] has problem during cell mesh construction. It has impossible face-type";
-                        Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::NotSupportedType());
-                    }
-                    
-                    
-                    if (filled_nodes[c] == 0)
-                    {
-                        cell_NodeList[c][0]	= face_node[f][1];
-                        cell_NodeList[c][1]	= face_node[f][0];
-                        filled_nodes[c]	= 2;
-                        
-                        cell_FaceList[c][0]	= face_ID[f];
-                        filled_faces[c] = 1;
-                    }
-                    else if (filled_nodes[c] == 2)
-                    {
-                        if (face_node[f][0] != cell_NodeList[c][0] &&
-                            face_node[f][0] != cell_NodeList[c][1] &&
-                            face_node[f][1] != cell_NodeList[c][0] &&
-                            face_node[f][1] != cell_NodeList[c][1])
-                        {
-                            cell_NodeList[c][2]	= face_node[f][1];
-                            cell_NodeList[c][3]	= face_node[f][0];
-                            filled_nodes[c]	= 4;
-                            
-                            cell_FaceList[c][2]	= face_ID[f];
-                            filled_faces[c]++;
-                        }
-                        
-                        if (cell_NodeList[c][0] == face_node[f][0] && cell_NodeList[c][1] != face_node[f][1])
-                        {
-                            if (cell_FaceList[c][3] == -1)
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                        
-                        if (cell_NodeList[c][0] != face_node[f][0] && cell_NodeList[c][1] == face_node[f][1])
-                        {
-                            if (cell_FaceList[c][1] == -1)
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                    }
-                    else if (filled_nodes[c] == 4)
-                    {
-                        if (face_node[f][0] == cell_NodeList[c][0] && face_node[f][1] == cell_NodeList[c][3])
-                        {
-                            if (cell_FaceList[c][3] == -1)
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                        else if (face_node[f][0] == cell_NodeList[c][2] && face_node[f][1] == cell_NodeList[c][1])
-                        {
-                            if (cell_FaceList[c][1] == -1)
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                    }
-                    
-                    break;
-                    
-                case TETRA4:
-                    if (face_type[f] != TRI3)
-                    {
-                        error_message << "Cell ID:[" << cr << "] has problem during cell mesh construction. It has impossible face-type";
-                        Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::NotSupportedType());
-                    }
-                    
-                    if (filled_nodes[c] == 0)
-                    {
-                        cell_NodeList[c][0]	= face_node[f][0];
-                        cell_NodeList[c][1]	= face_node[f][1];
-                        cell_NodeList[c][2]	= face_node[f][2];
-                        filled_nodes[c]	= 3;
-                        
-                        cell_FaceList[c][0]	= face_ID[f];
-                        filled_faces[c] = 1;
-                    }
-                    if (filled_nodes[c] == 3)
-                    {
-                        if (face_node[f][0] != cell_NodeList[c][0] &&
-                            face_node[f][0] != cell_NodeList[c][1] &&
-                            face_node[f][0] != cell_NodeList[c][2])
-                        {
-                            cell_NodeList[c][3] = face_node[f][0];
-                            filled_nodes[c]++;
-                            
-                            if(face_node[f][1] == cell_NodeList[c][0] &&
-                               face_node[f][2] == cell_NodeList[c][2])
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if(face_node[f][1] == cell_NodeList[c][1] &&
-                                    face_node[f][2] == cell_NodeList[c][0])
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if(face_node[f][1] == cell_NodeList[c][2] &&
-                                    face_node[f][2] == cell_NodeList[c][1])
-                            {
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                        else if (face_node[f][1] != cell_NodeList[c][0] &&
-                                 face_node[f][1] != cell_NodeList[c][1] &&
-                                 face_node[f][1] != cell_NodeList[c][2])
-                        {
-                            cell_NodeList[c][3] = face_node[f][1];
-                            filled_nodes[c]++;
-                            
-                            if(face_node[f][0] == cell_NodeList[c][0] &&
-                               face_node[f][2] == cell_NodeList[c][1])
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if(face_node[f][0] == cell_NodeList[c][1] &&
-                                    face_node[f][2] == cell_NodeList[c][2])
-                            {
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if(face_node[f][0] == cell_NodeList[c][2] &&
-                                    face_node[f][2] == cell_NodeList[c][0])
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                        else if (face_node[f][2] != cell_NodeList[c][0] &&
-                                 face_node[f][2] != cell_NodeList[c][1] &&
-                                 face_node[f][2] != cell_NodeList[c][2])
-                        {
-                            cell_NodeList[c][3] = face_node[f][2];
-                            filled_nodes[c]++;
-                            
-                            if(face_node[f][0] == cell_NodeList[c][1] &&
-                               face_node[f][1] == cell_NodeList[c][0])
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if(face_node[f][0] == cell_NodeList[c][2] &&
-                                    face_node[f][1] == cell_NodeList[c][1])
-                            {
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if(face_node[f][0] == cell_NodeList[c][0] &&
-                                    face_node[f][1] == cell_NodeList[c][2])
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                    }
-                    break;
-                    
-                case HEXA8:
-                    if (face_type[f] != QUAD4)
-                    {
-                        error_message << "Cell ID:[" << cr << "] has problem during cell mesh construction. It has impossible face-type";
-                        Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::NotSupportedType());
-                    }
-                    
-                    if (filled_nodes[c] == 0)
-                    {
-                        cell_NodeList[c][0]	= face_node[f][0];
-                        cell_NodeList[c][1]	= face_node[f][1];
-                        cell_NodeList[c][2]	= face_node[f][2];
-                        cell_NodeList[c][3]	= face_node[f][3];
-                        filled_nodes[c]	= 4;
-                        
-                        cell_FaceList[c][0]	= face_ID[f];
-                        filled_faces[c] = 1;
-                    }
-                    else if (filled_nodes[c] == 4 || filled_nodes[c] == 6)
-                    {
-                        if(cell_NodeList[c][0] == face_node[f][0]&&
-                           cell_NodeList[c][1] == face_node[f][3])
-                        {
-                            cell_NodeList[c][4]	= face_node[f][1];
-                            cell_NodeList[c][5]	= face_node[f][2];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][1]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][0] == face_node[f][1]&&
-                                cell_NodeList[c][1] == face_node[f][0])
-                        {
-                            cell_NodeList[c][4]	= face_node[f][2];
-                            cell_NodeList[c][5]	= face_node[f][3];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][1]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][0] == face_node[f][2]&&
-                                cell_NodeList[c][1] == face_node[f][1])
-                        {
-                            cell_NodeList[c][4]	= face_node[f][3];
-                            cell_NodeList[c][5]	= face_node[f][0];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][1]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][0] == face_node[f][3]&&
-                                cell_NodeList[c][1] == face_node[f][2])
-                        {
-                            cell_NodeList[c][4]	= face_node[f][0];
-                            cell_NodeList[c][5]	= face_node[f][1];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][1]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][2] == face_node[f][0]&&
-                                cell_NodeList[c][3] == face_node[f][3])
-                        {
-                            cell_NodeList[c][6]	= face_node[f][1];
-                            cell_NodeList[c][7]	= face_node[f][2];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][3]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][2] == face_node[f][1]&&
-                                cell_NodeList[c][3] == face_node[f][0])
-                        {
-                            cell_NodeList[c][6]	= face_node[f][2];
-                            cell_NodeList[c][7]	= face_node[f][3];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][3]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][2] == face_node[f][2]&&
-                                cell_NodeList[c][3] == face_node[f][1])
-                        {
-                            cell_NodeList[c][6]	= face_node[f][3];
-                            cell_NodeList[c][7]	= face_node[f][0];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][3]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][2] == face_node[f][3]&&
-                                cell_NodeList[c][3] == face_node[f][2])
-                        {
-                            cell_NodeList[c][6]	= face_node[f][0];
-                            cell_NodeList[c][7]	= face_node[f][1];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][3]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                    }
-                    else
-                    {
-                        std::vector<int> temp_face2(4);
-                        std::vector<int> temp_face4(4);
-                        std::vector<int> temp_face5(4);
-                        
-                        temp_face2[0]	= cell_NodeList[c][1];
-                        temp_face2[1]	= cell_NodeList[c][5];
-                        temp_face2[2]	= cell_NodeList[c][6];
-                        temp_face2[3]	= cell_NodeList[2][2];
-                        
-                        temp_face4[0]	= cell_NodeList[c][0];
-                        temp_face4[1]	= cell_NodeList[c][3];
-                        temp_face4[2]	= cell_NodeList[c][7];
-                        temp_face4[3]	= cell_NodeList[2][4];
-                        
-                        temp_face5[0]	= cell_NodeList[c][4];
-                        temp_face5[1]	= cell_NodeList[c][7];
-                        temp_face5[2]	= cell_NodeList[c][6];
-                        temp_face5[3]	= cell_NodeList[2][5];
-                        
-                        if (faceCompare(temp_face2, face_node[f], QUAD4) == 1)
-                        {
-                            cell_FaceList[c][2]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        
-                        if (faceCompare(temp_face4, face_node[f], QUAD4) == 1)
-                        {
-                            cell_FaceList[c][4]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        
-                        if (faceCompare(temp_face5, face_node[f], QUAD4) == 1)
-                        {
-                            cell_FaceList[c][5]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                    }
-                    break;
-                    
-                case PRISM6:
-                    if (face_type[f] == TRI3)
-                    {
-                        if (filled_nodes[c] == 0)
-                        {
-                            cell_NodeList[c][0]	= face_node[f][0];
-                            cell_NodeList[c][1]	= face_node[f][1];
-                            cell_NodeList[c][2]	= face_node[f][2];
-                            filled_nodes[c] = 3;
-                            
-                            cell_FaceList[c][0]	= face_ID[f];
-                            filled_faces[c] = 1;
-                        }
-                        else if (filled_nodes[c] == 5)
-                        {
-                            if (cell_NodeList[c][3] == face_node[f][0] &&
-                                cell_NodeList[c][4] == face_node[f][2])
-                            {
-                                cell_NodeList[c][5]	= face_node[f][1];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][5]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][3] == face_node[f][1] &&
-                                     cell_NodeList[c][4] == face_node[f][0])
-                            {
-                                cell_NodeList[c][5]	= face_node[f][2];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][5]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][3] == face_node[f][2] &&
-                                     cell_NodeList[c][4] == face_node[f][1])
-                            {
-                                cell_NodeList[c][5]	= face_node[f][0];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][5]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                        }
-                    }
-                    else if (face_type[f] == QUAD4)
-                    {
-                        if (filled_nodes[c] == 3)
-                        {
-                            if (cell_NodeList[c][0] == face_node[f][0] &&
-                                cell_NodeList[c][1] == face_node[f][3])
-                            {
-                                cell_NodeList[c][3]	= face_node[f][1];
-                                cell_NodeList[c][4]	= face_node[f][2];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][1] &&
-                                     cell_NodeList[c][1] == face_node[f][0])
-                            {
-                                cell_NodeList[c][3]	= face_node[f][2];
-                                cell_NodeList[c][4]	= face_node[f][3];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][2] &&
-                                     cell_NodeList[c][1] == face_node[f][1])
-                            {
-                                cell_NodeList[c][3]	= face_node[f][3];
-                                cell_NodeList[c][4]	= face_node[f][0];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][3] &&
-                                     cell_NodeList[c][1] == face_node[f][2])
-                            {
-                                cell_NodeList[c][3]	= face_node[f][0];
-                                cell_NodeList[c][4]	= face_node[f][1];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                        }
-                        else if (filled_nodes[c] == 6)
-                        {
-                            std::vector<int> temp_face2(4);
-                            std::vector<int> temp_face3(4);
-                            
-                            temp_face2[0]	= cell_NodeList[c][1];
-                            temp_face2[1]	= cell_NodeList[c][4];
-                            temp_face2[2]	= cell_NodeList[c][5];
-                            temp_face2[3]	= cell_NodeList[2][2];
-                            
-                            temp_face3[0]	= cell_NodeList[c][0];
-                            temp_face3[1]	= cell_NodeList[c][2];
-                            temp_face3[2]	= cell_NodeList[c][5];
-                            temp_face3[3]	= cell_NodeList[2][3];
-                            
-                            
-                            if (faceCompare(temp_face2, face_node[f], QUAD4) == 1)
-                            {
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            
-                            if (faceCompare(temp_face3, face_node[f], QUAD4) == 1)
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                        }
-                    }
-                    else
-                    {
-                        error_message << "Cell ID:[" << cr << "] has problem during cell mesh construction. It has impossible face-type";
-                        Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::NotSupportedType());
-                    }
-                    break;
-                    
-                case PYRAMID5:
-                    if (face_type[f] == QUAD4)
-                    {
-                        if (filled_nodes[c] == 0)
-                        {
-                            cell_NodeList[c][0]	= face_node[f][0];
-                            cell_NodeList[c][1]	= face_node[f][1];
-                            cell_NodeList[c][2]	= face_node[f][2];
-                            cell_NodeList[c][3]	= face_node[f][3];
-                            
-                            filled_nodes[c] = 4;
-                            
-                            cell_FaceList[c][0]	= face_ID[f];
-                            filled_faces[c] = 1;
-                        }
-                        else if (filled_nodes[c] == 3)
-                        {
-                            if (cell_NodeList[c][0] == face_node[f][0] &&
-                                cell_NodeList[c][1] == face_node[f][1])
-                            {
-                                cell_NodeList[c][2]	= face_node[f][2];
-                                cell_NodeList[c][3]	= face_node[f][3];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][0]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][1] &&
-                                     cell_NodeList[c][1] == face_node[f][2])
-                            {
-                                cell_NodeList[c][2]	= face_node[f][3];
-                                cell_NodeList[c][3]	= face_node[f][0];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][0]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][2] &&
-                                     cell_NodeList[c][1] == face_node[f][3])
-                            {
-                                cell_NodeList[c][2]	= face_node[f][0];
-                                cell_NodeList[c][3]	= face_node[f][1];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][0]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][3] &&
-                                     cell_NodeList[c][1] == face_node[f][0])
-                            {
-                                cell_NodeList[c][2]	= face_node[f][1];
-                                cell_NodeList[c][3]	= face_node[f][2];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][0]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                        }
-                    }
-                    else if (face_type[f] == TRI3)
-                    {
-                        if (filled_nodes[c] == 0)
-                        {
-                            cell_NodeList[c][0]	= face_node[f][0];
-                            cell_NodeList[c][1]	= face_node[f][2];
-                            cell_NodeList[c][4]	= face_node[f][1];
-                            filled_nodes[c] = 3;
-                            
-                            cell_FaceList[c][1]	= face_ID[f];
-                            filled_faces[c] = 1;
-                        }
-                        else if (filled_nodes[c] == 4)
-                        {
-                            if (cell_NodeList[c][0] == face_node[f][0] &&
-                                cell_NodeList[c][1] == face_node[f][2])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][1];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][1] &&
-                                     cell_NodeList[c][1] == face_node[f][0])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][2];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][2] &&
-                                     cell_NodeList[c][1] == face_node[f][1])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][0];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][1] == face_node[f][0] &&
-                                     cell_NodeList[c][2] == face_node[f][2])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][1];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][1] == face_node[f][1] &&
-                                     cell_NodeList[c][2] == face_node[f][0])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][2];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][1] == face_node[f][2] &&
-                                     cell_NodeList[c][2] == face_node[f][1])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][0];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][2] == face_node[f][0] &&
-                                     cell_NodeList[c][3] == face_node[f][2])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][1];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][2] == face_node[f][1] &&
-                                     cell_NodeList[c][3] == face_node[f][0])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][2];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][2] == face_node[f][2] &&
-                                     cell_NodeList[c][3] == face_node[f][1])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][0];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][3] == face_node[f][0] &&
-                                     cell_NodeList[c][0] == face_node[f][2])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][1];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][4]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][3] == face_node[f][1] &&
-                                     cell_NodeList[c][0] == face_node[f][0])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][2];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][4]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][3] == face_node[f][2] &&
-                                     cell_NodeList[c][0] == face_node[f][1])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][0];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][4]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                        }
-                        else if (filled_nodes[c] == 5)
-                        {
-                            std::vector<int> temp_face1(3);
-                            std::vector<int> temp_face2(3);
-                            std::vector<int> temp_face3(3);
-                            std::vector<int> temp_face4(3);
-                            
-                            temp_face1[0]	= cell_NodeList[c][0];
-                            temp_face1[1]	= cell_NodeList[c][4];
-                            temp_face1[2]	= cell_NodeList[c][1];
-                            
-                            temp_face2[0]	= cell_NodeList[c][1];
-                            temp_face2[1]	= cell_NodeList[c][4];
-                            temp_face2[2]	= cell_NodeList[c][2];
-                            
-                            temp_face3[0]	= cell_NodeList[c][3];
-                            temp_face3[1]	= cell_NodeList[c][2];
-                            temp_face3[2]	= cell_NodeList[c][4];
-                            
-                            temp_face4[0]	= cell_NodeList[c][0];
-                            temp_face4[1]	= cell_NodeList[c][3];
-                            temp_face4[2]	= cell_NodeList[c][4];
-                            
-                            
-                            if (faceCompare(temp_face1, face_node[f], TRI3) == 1)
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            
-                            if (faceCompare(temp_face2, face_node[f], TRI3) == 1)
-                            {
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            
-                            if (faceCompare(temp_face3, face_node[f], TRI3) == 1)
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            
-                            if (faceCompare(temp_face4, face_node[f], TRI3) == 1)
-                            {
-                                cell_FaceList[c][4]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                        }
-                    }
-                    break;
-            }
-        } // end right-cell
-        
-        
-        
-        // For Left Cell
-        if (cl != -1)
-        {
-            c = cell_whereis[cl];
-            
-            switch (cell_type[c])
-            {
-                case TRI3:
-                    if (face_type[f] != LINE)
-                    {
-                        error_message << "Cell ID:[" << cr << "] has problem during cell mesh construction. It has impossible face-type";
-                        Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::NotSupportedType());
-                    }
-                    
-                    
-                    if (filled_nodes[c] == 0)
-                    {
-                        cell_NodeList[c][0]	= face_node[f][0];
-                        cell_NodeList[c][1]	= face_node[f][1];
-                        filled_nodes[c]	= 2;
-                        
-                        cell_FaceList[c][0]	= face_ID[f];
-                        filled_faces[c] = 1;
-                    }
-                    else if (filled_nodes[c] == 2)
-                    {
-                        if (face_node[f][0] == cell_NodeList[c][1])
-                        {
-                            cell_NodeList[c][2]	= face_node[f][1];
-                            filled_nodes[c]	= 3;
-                            
-                            cell_FaceList[c][1]	= face_ID[f];
-                            filled_faces[c]++;
-                        }
-                        else if (face_node[f][1] == cell_NodeList[c][0])
-                        {
-                            cell_NodeList[c][2]	= face_node[f][0];
-                            filled_nodes[c]	= 3;
-                            
-                            cell_FaceList[c][2]	= face_ID[f];
-                            filled_faces[c]++;
-                        }
-                    }
-                    else
-                    {
-                        if (filled_faces[c] == 2)
-                        {
-                            if (face_node[f][0] == cell_NodeList[c][1] && face_node[f][1] == cell_NodeList[c][2])
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if (face_node[f][0] == cell_NodeList[c][2] && face_node[f][1] == cell_NodeList[c][0])
-                            {
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                    }
-                    break;
-                    
-                case QUAD4:
-                    if (face_type[f] != LINE)
-                    {
-                        error_message << "Cell ID:[" << cr << "] has problem during cell mesh construction. It has impossible face-type";
-                        Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::NotSupportedType());
-                    }
-                    
-                    
-                    if (filled_nodes[c] == 0)
-                    {
-                        cell_NodeList[c][0]	= face_node[f][0];
-                        cell_NodeList[c][1]	= face_node[f][1];
-                        filled_nodes[c]	= 2;
-                        
-                        cell_FaceList[c][0]	= face_ID[f];
-                        filled_faces[c] = 1;
-                    }
-                    else if (filled_nodes[c] == 2)
-                    {
-                        if (face_node[f][0] != cell_NodeList[c][0] &&
-                            face_node[f][0] != cell_NodeList[c][1] &&
-                            face_node[f][1] != cell_NodeList[c][0] &&
-                            face_node[f][1] != cell_NodeList[c][1])
-                        {
-                            cell_NodeList[c][2]	= face_node[f][0];
-                            cell_NodeList[c][3]	= face_node[f][1];
-                            filled_nodes[c]	= 4;
-                            
-                            cell_FaceList[c][2]	= face_ID[f];
-                            filled_faces[c]++;
-                        }
-                        
-                        if (cell_NodeList[c][0] == face_node[f][1] && cell_NodeList[c][1] != face_node[f][0])
-                        {
-                            if (cell_FaceList[c][3] == -1)
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                        
-                        if (cell_NodeList[c][0] != face_node[f][1] && cell_NodeList[c][1] == face_node[f][0])
-                        {
-                            if (cell_FaceList[c][1] == -1)
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                    }
-                    else if (filled_nodes[c] == 4)
-                    {
-                        if (face_node[f][0] == cell_NodeList[c][3] && face_node[f][1] == cell_NodeList[c][0])
-                        {
-                            if (cell_FaceList[c][3] == -1)
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                        else if (face_node[f][0] == cell_NodeList[c][1] && face_node[f][1] == cell_NodeList[c][2])
-                        {
-                            if (cell_FaceList[c][1] == -1)
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                    }
-                    break;
-                    
-                case TETRA4:
-                    if (face_type[f] != TRI3)
-                    {
-                        error_message << "Cell ID:[" << cr << "] has problem during cell mesh construction. It has impossible face-type";
-                        Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::NotSupportedType());
-                    }
-                    
-                    if (filled_nodes[c] == 0)
-                    {
-                        cell_NodeList[c][0]	= face_node[f][0];
-                        cell_NodeList[c][1]	= face_node[f][2];
-                        cell_NodeList[c][2]	= face_node[f][1];
-                        filled_nodes[c]	= 3;
-                        
-                        cell_FaceList[c][0]	= face_ID[f];
-                        filled_faces[c] = 1;
-                    }
-                    if (filled_nodes[c] == 3)
-                    {
-                        if (face_node[f][0] != cell_NodeList[c][0] &&
-                            face_node[f][0] != cell_NodeList[c][1] &&
-                            face_node[f][0] != cell_NodeList[c][2])
-                        {
-                            cell_NodeList[c][3] = face_node[f][0];
-                            filled_nodes[c]++;
-                            
-                            if(face_node[f][1] == cell_NodeList[c][0] &&
-                               face_node[f][2] == cell_NodeList[c][1])
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if(face_node[f][1] == cell_NodeList[c][1] &&
-                                    face_node[f][2] == cell_NodeList[c][2])
-                            {
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if(face_node[f][1] == cell_NodeList[c][2] &&
-                                    face_node[f][2] == cell_NodeList[c][0])
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                        else if (face_node[f][1] != cell_NodeList[c][0] &&
-                                 face_node[f][1] != cell_NodeList[c][1] &&
-                                 face_node[f][1] != cell_NodeList[c][2])
-                        {
-                            cell_NodeList[c][3] = face_node[f][1];
-                            filled_nodes[c]++;
-                            
-                            if(face_node[f][0] == cell_NodeList[c][1] &&
-                               face_node[f][2] == cell_NodeList[c][0])
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if(face_node[f][0] == cell_NodeList[c][2] &&
-                                    face_node[f][2] == cell_NodeList[c][1])
-                            {
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if(face_node[f][0] == cell_NodeList[c][0] &&
-                                    face_node[f][2] == cell_NodeList[c][2])
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                        else if (face_node[f][2] != cell_NodeList[c][0] &&
-                                 face_node[f][2] != cell_NodeList[c][1] &&
-                                 face_node[f][2] != cell_NodeList[c][2])
-                        {
-                            cell_NodeList[c][3] = face_node[f][2];
-                            filled_nodes[c]++;
-                            
-                            if(face_node[f][0] == cell_NodeList[c][0] &&
-                               face_node[f][1] == cell_NodeList[c][1])
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if(face_node[f][0] == cell_NodeList[c][1] &&
-                                    face_node[f][1] == cell_NodeList[c][2])
-                            {
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if(face_node[f][0] == cell_NodeList[c][2] &&
-                                    face_node[f][1] == cell_NodeList[c][0])
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                    }
-                    break;
-                    
-                case HEXA8:
-                    if (face_type[f] != QUAD4)
-                    {
-                        error_message << "Cell ID:[" << cr << "] has problem during cell mesh construction. It has impossible face-type";
-                        Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::NotSupportedType());
-                    }
-                    
-                    if (filled_nodes[c] == 0)
-                    {
-                        cell_NodeList[c][0]	= face_node[f][0];
-                        cell_NodeList[c][1]	= face_node[f][3];
-                        cell_NodeList[c][2]	= face_node[f][2];
-                        cell_NodeList[c][3]	= face_node[f][1];
-                        filled_nodes[c]	= 4;
-                        
-                        cell_FaceList[c][0]	= face_ID[f];
-                        filled_faces[c] = 1;
-                    }
-                    else if (filled_nodes[c] == 4 || filled_nodes[c] == 6)
-                    {
-                        if(cell_NodeList[c][0] == face_node[f][0]&&
-                           cell_NodeList[c][1] == face_node[f][1])
-                        {
-                            cell_NodeList[c][4]	= face_node[f][3];
-                            cell_NodeList[c][5]	= face_node[f][2];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][1]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][0] == face_node[f][1]&&
-                                cell_NodeList[c][1] == face_node[f][2])
-                        {
-                            cell_NodeList[c][4]	= face_node[f][0];
-                            cell_NodeList[c][5]	= face_node[f][3];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][1]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][0] == face_node[f][2]&&
-                                cell_NodeList[c][1] == face_node[f][3])
-                        {
-                            cell_NodeList[c][4]	= face_node[f][1];
-                            cell_NodeList[c][5]	= face_node[f][0];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][1]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][0] == face_node[f][3]&&
-                                cell_NodeList[c][1] == face_node[f][0])
-                        {
-                            cell_NodeList[c][4]	= face_node[f][2];
-                            cell_NodeList[c][5]	= face_node[f][1];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][1]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][2] == face_node[f][0]&&
-                                cell_NodeList[c][3] == face_node[f][1])
-                        {
-                            cell_NodeList[c][6]	= face_node[f][3];
-                            cell_NodeList[c][7]	= face_node[f][2];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][3]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][2] == face_node[f][1]&&
-                                cell_NodeList[c][3] == face_node[f][2])
-                        {
-                            cell_NodeList[c][6]	= face_node[f][0];
-                            cell_NodeList[c][7]	= face_node[f][3];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][3]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][2] == face_node[f][2]&&
-                                cell_NodeList[c][3] == face_node[f][3])
-                        {
-                            cell_NodeList[c][6]	= face_node[f][1];
-                            cell_NodeList[c][7]	= face_node[f][0];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][3]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][2] == face_node[f][3]&&
-                                cell_NodeList[c][3] == face_node[f][0])
-                        {
-                            cell_NodeList[c][6]	= face_node[f][2];
-                            cell_NodeList[c][7]	= face_node[f][1];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][3]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                    }
-                    else
-                    {
-                        std::vector<int> temp_face2(4);
-                        std::vector<int> temp_face4(4);
-                        std::vector<int> temp_face5(4);
-                        
-                        temp_face2[0]	= cell_NodeList[c][1];
-                        temp_face2[1]	= cell_NodeList[c][2];
-                        temp_face2[2]	= cell_NodeList[c][6];
-                        temp_face2[3]	= cell_NodeList[2][5];
-                        
-                        temp_face4[0]	= cell_NodeList[c][0];
-                        temp_face4[1]	= cell_NodeList[c][4];
-                        temp_face4[2]	= cell_NodeList[c][7];
-                        temp_face4[3]	= cell_NodeList[2][3];
-                        
-                        temp_face5[0]	= cell_NodeList[c][4];
-                        temp_face5[1]	= cell_NodeList[c][5];
-                        temp_face5[2]	= cell_NodeList[c][6];
-                        temp_face5[3]	= cell_NodeList[2][7];
-                        
-                        if (faceCompare(temp_face2, face_node[f], QUAD4) == 1)
-                        {
-                            cell_FaceList[c][2]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        
-                        if (faceCompare(temp_face4, face_node[f], QUAD4) == 1)
-                        {
-                            cell_FaceList[c][4]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        
-                        if (faceCompare(temp_face5, face_node[f], QUAD4) == 1)
-                        {
-                            cell_FaceList[c][5]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                    }
-                    break;
-                    
-                case PRISM6:
-                    if (face_type[f] == TRI3)
-                    {
-                        if (filled_nodes[c] == 0)
-                        {
-                            cell_NodeList[c][0]	= face_node[f][0];
-                            cell_NodeList[c][1]	= face_node[f][2];
-                            cell_NodeList[c][2]	= face_node[f][1];
-                            filled_nodes[c] = 3;
-                            
-                            cell_FaceList[c][0]	= face_ID[f];
-                            filled_faces[c] = 1;
-                        }
-                        else if (filled_nodes[c] == 5)
-                        {
-                            if (cell_NodeList[c][3] == face_node[f][0] &&
-                                cell_NodeList[c][4] == face_node[f][1])
-                            {
-                                cell_NodeList[c][5]	= face_node[f][2];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][5]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][3] == face_node[f][1] &&
-                                     cell_NodeList[c][4] == face_node[f][2])
-                            {
-                                cell_NodeList[c][5]	= face_node[f][0];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][5]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][3] == face_node[f][2] &&
-                                     cell_NodeList[c][4] == face_node[f][0])
-                            {
-                                cell_NodeList[c][5]	= face_node[f][1];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][5]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                        }
-                    }
-                    else if (face_type[f] == QUAD4)
-                    {
-                        if (filled_nodes[c] == 3)
-                        {
-                            if (cell_NodeList[c][0] == face_node[f][0] &&
-                                cell_NodeList[c][1] == face_node[f][1])
-                            {
-                                cell_NodeList[c][3]	= face_node[f][3];
-                                cell_NodeList[c][4]	= face_node[f][2];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][1] &&
-                                     cell_NodeList[c][1] == face_node[f][2])
-                            {
-                                cell_NodeList[c][3]	= face_node[f][0];
-                                cell_NodeList[c][4]	= face_node[f][3];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][2] &&
-                                     cell_NodeList[c][1] == face_node[f][3])
-                            {
-                                cell_NodeList[c][3]	= face_node[f][1];
-                                cell_NodeList[c][4]	= face_node[f][0];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][3] &&
-                                     cell_NodeList[c][1] == face_node[f][0])
-                            {
-                                cell_NodeList[c][3]	= face_node[f][2];
-                                cell_NodeList[c][4]	= face_node[f][1];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                        }
-                        else if (filled_nodes[c] == 6)
-                        {
-                            std::vector<int> temp_face2(4);
-                            std::vector<int> temp_face3(4);
-                            
-                            temp_face2[0]	= cell_NodeList[c][1];
-                            temp_face2[1]	= cell_NodeList[c][2];
-                            temp_face2[2]	= cell_NodeList[c][5];
-                            temp_face2[3]	= cell_NodeList[2][4];
-                            
-                            temp_face3[0]	= cell_NodeList[c][0];
-                            temp_face3[1]	= cell_NodeList[c][3];
-                            temp_face3[2]	= cell_NodeList[c][5];
-                            temp_face3[3]	= cell_NodeList[2][2];
-                            
-                            
-                            if (faceCompare(temp_face2, face_node[f], QUAD4) == 1)
-                            {
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            
-                            if (faceCompare(temp_face3, face_node[f], QUAD4) == 1)
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                        }
-                    }
-                    else
-                    {
-                        error_message << "Cell ID:[" << cr << "] has problem during cell mesh construction. It has impossible face-type";
-                        Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::NotSupportedType());
-                    }
-                    break;
-                    
-                case PYRAMID5:
-                    if (face_type[f] == QUAD4)
-                    {
-                        if (filled_nodes[c] == 0)
-                        {
-                            cell_NodeList[c][0]	= face_node[f][0];
-                            cell_NodeList[c][1]	= face_node[f][3];
-                            cell_NodeList[c][2]	= face_node[f][2];
-                            cell_NodeList[c][3]	= face_node[f][1];
-                            filled_nodes[c] = 4;
-                            
-                            cell_FaceList[c][0]	= face_ID[f];
-                            filled_faces[c] = 1;
-                        }
-                        else if (filled_nodes[c] == 3)
-                        {
-                            if (cell_NodeList[c][0] == face_node[f][0] &&
-                                cell_NodeList[c][1] == face_node[f][3])
-                            {
-                                cell_NodeList[c][2]	= face_node[f][2];
-                                cell_NodeList[c][3]	= face_node[f][1];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][0]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][1] &&
-                                     cell_NodeList[c][1] == face_node[f][0])
-                            {
-                                cell_NodeList[c][2]	= face_node[f][3];
-                                cell_NodeList[c][3]	= face_node[f][2];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][0]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][2] &&
-                                     cell_NodeList[c][1] == face_node[f][1])
-                            {
-                                cell_NodeList[c][2]	= face_node[f][0];
-                                cell_NodeList[c][3]	= face_node[f][3];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][0]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][3] &&
-                                     cell_NodeList[c][1] == face_node[f][2])
-                            {
-                                cell_NodeList[c][2]	= face_node[f][1];
-                                cell_NodeList[c][3]	= face_node[f][0];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][0]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                        }
-                    }
-                    else if (face_type[f] == TRI3)
-                    {
-                        if (filled_nodes[c] == 0)
-                        {
-                            cell_NodeList[c][0]	= face_node[f][0];
-                            cell_NodeList[c][1]	= face_node[f][1];
-                            cell_NodeList[c][4]	= face_node[f][2];
-                            filled_nodes[c] = 3;
-                            
-                            cell_FaceList[c][1]	= face_ID[f];
-                            filled_faces[c] = 1;
-                        }
-                        else if (filled_nodes[c] == 4)
-                        {
-                            if (cell_NodeList[c][0] == face_node[f][0] &&
-                                cell_NodeList[c][1] == face_node[f][1])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][2];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][1] &&
-                                     cell_NodeList[c][1] == face_node[f][2])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][0];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][2] &&
-                                     cell_NodeList[c][1] == face_node[f][0])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][1];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][1] == face_node[f][0] &&
-                                     cell_NodeList[c][2] == face_node[f][1])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][2];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][1] == face_node[f][1] &&
-                                     cell_NodeList[c][2] == face_node[f][2])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][0];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][1] == face_node[f][2] &&
-                                     cell_NodeList[c][2] == face_node[f][0])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][1];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][2] == face_node[f][0] &&
-                                     cell_NodeList[c][3] == face_node[f][1])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][2];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][2] == face_node[f][1] &&
-                                     cell_NodeList[c][3] == face_node[f][2])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][0];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][2] == face_node[f][2] &&
-                                     cell_NodeList[c][3] == face_node[f][0])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][1];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][3] == face_node[f][0] &&
-                                     cell_NodeList[c][0] == face_node[f][1])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][2];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][4]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][3] == face_node[f][1] &&
-                                     cell_NodeList[c][0] == face_node[f][2])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][0];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][4]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][3] == face_node[f][2] &&
-                                     cell_NodeList[c][0] == face_node[f][0])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][1];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][4]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                        }
-                        else if (filled_nodes[c] == 5)
-                        {
-                            std::vector<int> temp_face1(3);
-                            std::vector<int> temp_face2(3);
-                            std::vector<int> temp_face3(3);
-                            std::vector<int> temp_face4(3);
-                            
-                            temp_face1[0]	= cell_NodeList[c][0];
-                            temp_face1[1]	= cell_NodeList[c][1];
-                            temp_face1[2]	= cell_NodeList[c][4];
-                            
-                            temp_face2[0]	= cell_NodeList[c][1];
-                            temp_face2[1]	= cell_NodeList[c][2];
-                            temp_face2[2]	= cell_NodeList[c][4];
-                            
-                            temp_face3[0]	= cell_NodeList[c][2];
-                            temp_face3[1]	= cell_NodeList[c][3];
-                            temp_face3[2]	= cell_NodeList[c][4];
-                            
-                            temp_face4[0]	= cell_NodeList[c][3];
-                            temp_face4[1]	= cell_NodeList[c][0];
-                            temp_face4[2]	= cell_NodeList[c][4];
-                            
-                            
-                            if (faceCompare(temp_face1, face_node[f], TRI3) == 1)
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            
-                            if (faceCompare(temp_face2, face_node[f], TRI3) == 1)
-                            {
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            
-                            if (faceCompare(temp_face3, face_node[f], TRI3) == 1)
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            
-                            if (faceCompare(temp_face4, face_node[f], TRI3) == 1)
-                            {
-                                cell_FaceList[c][4]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                        }
-                    }
-                    break;
-            }
-        } // end left-cell
-    }
-    
-    
-    
-    // Error check
-    for (int c = 0; c <= ncm-1; c++)
-    {
-        int nfaces;
-        int nnodes;
-        switch (cell_type[c])
-        {
-            case TRI3:
-                nfaces = 3;
-                nnodes = 3;
-                break;
-                
-            case QUAD4:
-                nfaces = 4;
-                nnodes = 4;
-                break;
-                
-            case TETRA4:
-                nfaces = 4;
-                nnodes = 4;
-                break;
-                
-            case HEXA8:
-                nfaces = 6;
-                nnodes = 8;
-                break;
-                
-            case PRISM6:
-                nfaces = 5;
-                nnodes = 6;
-                break;
-                
-            case PYRAMID5:
-                nfaces = 5;
-                nnodes = 5;
-                break;
-        }
-        
-        if (filled_nodes[c] != nnodes)
-        {
-            error_message << "Cell ID:[" << c << "] has problem during cell mesh construction. Some of nodes are not filled";
-            Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::MismatchData());
-        }
-        
-        if (filled_faces[c] != nfaces)
-        {
-            error_message << "Cell ID:[" << c << "] has problem during cell mesh construction. Some of faces are not filled";
-            Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::MismatchData());
-        }
-        
-        
-        
-        if (Common::VectorCompare::hasSameComponentINT(cell_NodeList[c], nnodes))
-        {
-            error_message << "Cell ID:[" << c << "] has repeated node on its node list.";
-            Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::ExceedLimit());
-        }
-        
-        if (Common::VectorCompare::hasSameComponentINT(cell_FaceList[c], nfaces))
-        {
-            error_message << "Cell ID:[" << c << "] has repeated face on its face list.";
-            Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::ExceedLimit());
-        }
-        
-        
-        if(Common::VectorCompare::hasSatisfyRangeINT(cell_NodeList[c], nnodes, 1, nnm))
-        {
-            error_message << "Cell ID:[" << c << "] has wrong node index in which is out of possible index range.";
-            Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::ExceedLimit());
-        }
-        
-        if(Common::VectorCompare::hasSatisfyRangeINT(cell_FaceList[c], nfaces, 1, nfm))
-        {
-            error_message << "Cell ID:[" << c << "] has wrong face index in which is out of possible index range.";
-            Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::ExceedLimit());
-        }
-        
-    }
-    
-    mesh_file_Fluent.close();
-    
-    
-    
-    
-    
-    // WRITE OP2A GRID DATA
-    std::string fileName;
-    std::vector<std::string> fileName_temp;
-    
-    Common::StringOps::split(mesh_file_name_Fluent, '.', fileName_temp);
-    fileName = fileName_temp[0] + ".op2";
-    
-    std::ofstream mesh_file_OP2;
-    mesh_file_OP2.open(fileName.c_str());
-    
-    mesh_file_OP2 << "%*****************************************************" << std::endl;
-    mesh_file_OP2 << "%     OP2A Grid File using FORMAT version 1.0         " << std::endl;
-    mesh_file_OP2 << "%                                                     " << std::endl;
-    mesh_file_OP2 << "%                  Originally developed by Minkwan Kim" << std::endl;
-    mesh_file_OP2 << "%=====================================================" << std::endl;
-    mesh_file_OP2 << "% [FACE / CELL TYPE identifiers]                      " << std::endl;
-    mesh_file_OP2 << "%      Line                   :  3                    " << std::endl;
-    mesh_file_OP2 << "%      Triangle (3-nodes)     :  5                    " << std::endl;
-    mesh_file_OP2 << "%      Quadrilateral (4-nodes):  9                    " << std::endl;
-    mesh_file_OP2 << "%      Tetrahedral (4-nodes)  : 10                    " << std::endl;
-    mesh_file_OP2 << "%      Hexahedral (8-nodes)   : 12                    " << std::endl;
-    mesh_file_OP2 << "%      Prism (6-nodes)        : 13                    " << std::endl;
-    mesh_file_OP2 << "%      Pramid (5-nodes)       : 14                    " << std::endl;
-    mesh_file_OP2 << "%                                                     " << std::endl;
-    mesh_file_OP2 << "% [BC TYPE identifiers]                               " << std::endl;
-    mesh_file_OP2 << "%      Interior               :  0                    " << std::endl;
-    mesh_file_OP2 << "%      Wall                   : 10                    " << std::endl;
-    mesh_file_OP2 << "%      Inlet                  : 20                    " << std::endl;
-    mesh_file_OP2 << "%      Outlet                 : 30                    " << std::endl;
-    mesh_file_OP2 << "%      Freestream (Far-field) : 40                    " << std::endl;
-    mesh_file_OP2 << "%      Symmetric              : 50                    " << std::endl;
-    mesh_file_OP2 << "%      Axisymmetric           : 60                    " << std::endl;
-    mesh_file_OP2 << "%      Anode                  : 70                    " << std::endl;
-    mesh_file_OP2 << "%      Cathode                : 80                    " << std::endl;
-    mesh_file_OP2 << "%      Dielectric material    : 90                    " << std::endl;
-    mesh_file_OP2 << "%                                                     " << std::endl;
-    mesh_file_OP2 << "% [DATA Format]                                       " << std::endl;
-    mesh_file_OP2 << "%    -Node Data FORMAT                                " << std::endl;
-    mesh_file_OP2 << "%     (NODE ID#)  (POSITION DATA: X Y Z)           " << std::endl;
-    mesh_file_OP2 << "%    -Face Data FORMAT                                " << std::endl;
-    mesh_file_OP2 << "%     (FACE ID#)  (BOUNDARY CONDITION)  (FACE TYPE)  (LIST OF NODE IDs) (LEFT-CELL ID) (RIGHT-CELL ID)" << std::endl;
-    mesh_file_OP2 << "%    -Cell Data FORMAT" << std::endl;
-    mesh_file_OP2 << "%     (CELL ID#)  (BOUNDARY CONDITION)  (CELL TYPE)  (LIST OF NODE IDs) (LIST OF FACE IDs)" << std::endl;
-    mesh_file_OP2 << "%=====================================================" << std::endl;
-    mesh_file_OP2 << "%                   Last Format Updated on April/2016 " << std::endl;
-    mesh_file_OP2 << "%                                       by M Kim      " << std::endl;
-    mesh_file_OP2 << "%*****************************************************" << std::endl << std::endl;
-    
-    
-    mesh_file_OP2 << "% OVERALL GRID INFORMATION" << std::endl;
-    mesh_file_OP2 << "DIM= " << dim << std::endl;
-    mesh_file_OP2 << "NNM= " << nnm << std::endl;
-    mesh_file_OP2 << "NFM= " << nfm << std::endl;
-    mesh_file_OP2 << "NCM= " << ncm << std::endl;
-    mesh_file_OP2 << std::endl;
+        CellBase& cell = gridgeo.cells[c-1];
     
-    mesh_file_OP2 << "%%%%%%%%%%%%" << std::endl;
-    mesh_file_OP2 << "NODEDATA= " << nnm <<std::endl;
-    if (dim == 2)
-    {
-        double z = 0.0;
-        for (int n_ID = 1; n_ID <= nnm; n_ID++)
-        {
-            n = node_whereis[n_ID];
-            
-            mesh_file_OP2 << std::setw(8) << node_ID[n]+1 <<
-            std::setw(25) << std::scientific << std::setprecision(16) << node_XY[n][0] <<
-            std::setw(25) << node_XY[n][1] <<
-            std::setw(25) << z << std::endl;
-        }
-        
-    }
-    else
-    {
-        for (int n_ID = 0; n_ID <= nnm-1; n_ID++)
-        {
-            n = node_whereis[n_ID];
-            
-            mesh_file_OP2 << std::setw(8) << n_ID <<
-            std::setw(25) << std::scientific << std::setprecision(16) << node_XY[n][0] <<
-            std::setw(25) << node_XY[n][1] <<
-            std::setw(25) << node_XY[n][2] << std::endl;
-        }
-    }
-    mesh_file_OP2 << std::endl;
+        cell.geometry.id       = c;
+        cell.geometry.bcType   = BC_INTERIOR;
+        cell.connectivity.type = data.cell_type[c];
     
+        cell.connectivity.numNodes = cellTypeNumNode(data.cell_type[c]);
+        cell.connectivity.nodeIDs.assign(&cell_NodeList[c*MAX_CELL_PER_NODE], &cell_NodeList[c*MAX_CELL_PER_NODE] + cell.connectivity.numNodes);
     
-    mesh_file_OP2 << "%%%%%%%%%%%%" << std::endl;
-    mesh_file_OP2 << "FACEDATA= " << nfm << std::endl;
-    for (int f_ID = 1; f_ID <= nfm; f_ID++)
-    {
-        f = face_whereis[f_ID];
-        
-        int nnode;
-        switch (face_type[f])
-        {
-            case LINE:
-                nnode = 2;
-                break;
-                
-            case TRI3:
-                nnode = 3;
-                break;
-                
-            case QUAD4:
-                nnode = 4;
-                break;
-        }
-        
-        mesh_file_OP2 << std::setw(8) << f_ID;
-        mesh_file_OP2 << std::setw(8) << face_BC[f];
-        mesh_file_OP2 << std::setw(8) << face_type[f];
-        
-        for (int n = 0; n <= nnode-1; n++) mesh_file_OP2 << std::setw(8) << face_node[f][n];
-        mesh_file_OP2 << std::setw(8) << face_stencil[f][0];
-        mesh_file_OP2 << std::setw(8) << face_stencil[f][1];
-        mesh_file_OP2 << std::endl;
-    }
-    mesh_file_OP2 << std::endl;
-    
+        cell.connectivity.numFaces = cellTypeNumFace(data.cell_type[c]);
+        cell.connectivity.faceIDs.assign(&cell_FaceList[c*MAX_CELL_PER_FACE], &cell_FaceList[c*MAX_CELL_PER_FACE] + cell.connectivity.numFaces);
     
-    mesh_file_OP2 << "%%%%%%%%%%%%" << std::endl;
-    mesh_file_OP2 << "CELLDATA= " << ncm << std::endl;
-    for (int c_ID = 1; c_ID <= ncm; c_ID++)
-    {
-        c = cell_whereis[c_ID];
-        
-        int cellBC = cell_BC[c];
-        
-        int nface;
-        int nnode;
-        
-        switch (cell_type[c])
-        {
-            case TRI3:
-                nface = 3;
-                nnode = 3;
-                break;
-                
-            case QUAD4:
-                nface = 4;
-                nnode = 4;
-                break;
-                
-            case TETRA4:
-                nface = 4;
-                nnode = 4;
-                break;
-                
-            case HEXA8:
-                nface = 6;
-                nnode = 8;
-                break;
-                
-            case PRISM6:
-                nface = 5;
-                nnode = 6;
-                break;
-        }
-        
-        mesh_file_OP2 << std::setw(8) << c_ID;
-        mesh_file_OP2 << std::setw(8) << cellBC;
-        mesh_file_OP2 << std::setw(8) << cell_type[c];
-        for (int n = 0; n <= nnode-1; n++) mesh_file_OP2 << std::setw(8) << cell_NodeList[c][n];
-        for (int f = 0; f <= nface-1; f++) mesh_file_OP2 << std::setw(8) << cell_FaceList[c][f];
-        mesh_file_OP2 << std::endl;
+        gridgeo.whereisCells[c] = c-1;
     }
-    mesh_file_OP2 << std::endl;
-    
-    
-    mesh_file_OP2.close();
 }
 
 
 
+// Convert Fluent grid file into OP2A format, using the name of the Fluent file
+void precessingGridFLUENT(const  std::string& mesh_file_name_Fluent)
+{
+    std::vector<std::string> fileName_temp;
+    Common::StringOps::split(mesh_file_name_Fluent, '.', fileName_temp);
+    
+    std::string out_file_name = fileName_temp[0];
+    precessingGridFLUENT(mesh_file_name_Fluent, out_file_name);
+}
+
 
 
+// Convert Fluent grid file into OP2A format
 void precessingGridFLUENT(const  std::string& mesh_file_name_Fluent, std::string& out_file_name)
 {
-    int index;
-    int index_s, index_e;
-    int temp_dummy;
-    int zone;
-    
-    std::string line;
-    
-    // 1. Open file to read
-    std::ifstream mesh_file_Fluent;
-    mesh_file_Fluent.open(mesh_file_name_Fluent.c_str());
-    
-    if (!mesh_file_Fluent.is_open()) Common::ExceptionError(FromHere(), "Cannot find grid file. Please check your grid file!", Common::ErrorCodes::FileSystem());
-    
-    
-    // 2. 1st READ
-    int dim;
-    int nnm;
-    int nfm;
-    int ncm;
-    int nbc;
-    int maxZone = 0;
-    
-    
-    while (! mesh_file_Fluent.eof())
-    {
-        index = -1;
-        
-        getline(mesh_file_Fluent, line);
-        sscanf_s(line.c_str(), "(%d ", &index);
-        
-        switch(index)
-        {
-            case 2:
-                dim = 0;
-                sscanf_s(line.c_str(), "(%d %d)", &temp_dummy, &dim);
-                break;
-                
-            case 10:
-                index_s = 0;
-                index_e = 0;
-                sscanf_s(line.c_str(),"(%d (%x %x %x", &temp_dummy, &zone, &index_s, &index_e); // GETTING INDEX AND ZONE
-                if (zone == 0) // READ GENERAL INFORMATION OF NODES
-                {
-                    nnm = index_e - index_s + 1;
-                }
-                break;
-                
-            case 12:
-                index_s = 0;
-                index_e = 0;
-                sscanf_s(line.c_str(),"(%d (%x %x %x", &temp_dummy, &zone, &index_s, &index_e); // GETTING INDEX AND ZONE
-                if (zone == 0) // READ GENERAL INFORMATION OF CELLS
-                {
-                    ncm = index_e - index_s + 1;
-                }
-                break;
-                
-            case 13:
-                index_s = 0;
-                index_e = 0;
-                sscanf_s(line.c_str(),"(%d (%x %x %x", &temp_dummy, &zone, &index_s, &index_e); // GETTING INDEX AND ZONE
-                
-                if (zone == 0) // READ GENERAL INFORMATION OF FACES
-                {
-                    nfm = index_e - index_s + 1;
-                }
-                else
-                {
-                    maxZone = fmax(maxZone, zone);
-                }
-                break;
-        }
-    }
-    
-    // 2. Second Read
-    std::vector<int>	nfmZone(maxZone+1, 0);
-    std::vector<int>    bcZone(maxZone+1, -1);
-    
-    
-    mesh_file_Fluent.clear();
-    mesh_file_Fluent.seekg(0, std::ios::beg);
-    
-    int temp_zone;
-    int bc_type;
-    int nfm_zone;
-    int num_zone = 0;
-    
-    int numWall       = 0;
-    int numInlet      = 0;
-    int numAnode      = 0;
-    int numCathode    = 0;
-    int numDielectric = 0;
-    int numFreestream = 0;
-    
-    
-    char zone_type[20];
-    
-    while (! mesh_file_Fluent.eof())
-    {
-        index = -1;
-        getline(mesh_file_Fluent, line);
-        sscanf_s(line.c_str(), "(%d ", &index);
-        
-        switch(index)
-        {
-            case 13:
-                index_s = 0;
-                index_e = 0;
-                sscanf_s(line.c_str(),"(%d (%x %x %x", &temp_dummy, &zone, &index_s, &index_e); // GETTING INDEX AND ZONE
-                
-                if (zone != 0)
-                {
-                    sscanf_s(line.c_str(),"(%d (%x %x %x %d", &temp_dummy, &temp_zone, &index_s, &index_e, &bc_type); // GETTING INDEX AND ZONE
-                    nfm_zone 		= index_e - index_s + 1;
-                    nfmZone[zone]	= nfm_zone;
-                    num_zone++;
-                }
-                break;
-                
-                
-            case 45:
-                sscanf_s(line.c_str(),"(%d (%d %s", &index, &zone, zone_type); // GETTING INDEX AND ZONE
-                
-                // GENERAL TYPE OF BOUNDARY CONDITIONS
-                bool flagFindBCtype = false;
-                
-                if (strcmp(zone_type,"interior") == 0)
-                {
-                    bcZone[zone] = 0;
-                    flagFindBCtype = true;
-                }
-                
-                if (strcmp(zone_type,"wall") == 0)
-                {
-                    if (numWall < BC_MAX_DETAIL_SUBCOND)
-                    {
-                        bcZone[zone] = BC_WALL + numWall;
-                        flagFindBCtype = true;
-                        numWall++;
-                    }
-                }
-                
-                if (strcmp(zone_type,"pressure-inlet") == 0)
-                {
-                    if (numInlet < BC_MAX_DETAIL_SUBCOND)
-                    {
-                        bcZone[zone] = BC_INLET + numInlet;
-                        flagFindBCtype = true;
-                        numInlet++;
-                    }
-                }
-                
-                if (strcmp(zone_type,"pressure-outlet") == 0)
-                {
-                    bcZone[zone] = BC_OUTLET;
-                    flagFindBCtype = true;
-                }
-                
-                if (strcmp(zone_type,"pressure-far-field") == 0)
-                {
-                    if (numFreestream < BC_MAX_DETAIL_SUBCOND)
-                    {
-                        bcZone[zone] = BC_FREESTREAM + numFreestream;
-                        flagFindBCtype = true;
-                        numFreestream++;
-                    }
-                }
-                
-                if (strcmp(zone_type,"symmetry") == 0)
-                {
-                    bcZone[zone] = BC_SYMMETRY;
-                    flagFindBCtype = true;
-                }
-                
-                if (strcmp(zone_type,"axis") == 0)
-                {
-                    bcZone[zone] = BC_AXIS;
-                    flagFindBCtype = true;
-                }
-                
-                if (strcmp(zone_type,"anode") == 0)
-                {
-                    if (numAnode < BC_MAX_DETAIL_SUBCOND)
-                    {
-                        bcZone[zone] = BC_ANODE + numAnode;
-                        flagFindBCtype = true;
-                        numAnode++;
-                    }
-                }
-                
-                if (strcmp(zone_type,"cathode") == 0)
-                {
-                    if (numCathode < BC_MAX_DETAIL_SUBCOND)
-                    {
-                        bcZone[zone] = BC_CATHODE + numCathode;
-                        flagFindBCtype = true;
-                        numCathode++;
-                    }
-                }
-                
-                if (strcmp(zone_type,"dielectric-wall") == 0)
-                {
-                    if (numDielectric < BC_MAX_DETAIL_SUBCOND)
-                    {
-                        bcZone[zone] = BC_DIELECTRIC + numDielectric;
-                        flagFindBCtype = true;
-                        numDielectric++;
-                    }
-                }
-                
-                if (strcmp(zone_type,"fluid") == 0)
-                {
-                    bcZone[zone] = 0;
-                    flagFindBCtype = true;
-                }
-                
-                if (flagFindBCtype == false)
-                {
-                    Common::ExceptionError(FromHere(), "Given BC type in the grid is not supported BC type. Please check BC type in the grid file", Common::ErrorCodes::NotSupportedType());
-                }
-                break;
-        }
-    }
-    
-    
-    // 3. Read Node Data (3rd READ)
-    std::vector<int>	                node_ID(nnm,-1);
-    std::vector<int>	                node_whereis(nnm+1, -1);
-    std::vector<std::vector<double> >	node_XY(nnm, std::vector<double>(dim, 0.0));
-    mesh_file_Fluent.clear();
-    mesh_file_Fluent.seekg(0, std::ios::beg);
-    
-    
-    int type;
-    int temp_dim;
-    int n = 0;
-    double x, y, z;
-    while (! mesh_file_Fluent.eof())
-    {
-        index = -1;
-        getline(mesh_file_Fluent, line);
-        sscanf_s(line.c_str(), "(%d ", &index);
-        
-        if (index == 10)
-        {
-            temp_dummy = -1;
-            zone       = -1;
-            index_s    = -1;
-            index_e    = -1;
-            type       = -1;
-            temp_dim   = -1;
-            
-            sscanf_s(line.c_str(),"(%d (%x %x %x %d %d)", &temp_dummy, &zone, &index_s, &index_e, &type, &temp_dim); // GETTING INDEX AND ZONE
-            if (zone > 0)
-            {
-                if (temp_dim != dim)
-                    Common::ExceptionError(FromHere(), "PROBLEM IN DIMENSION OF NODE DATA. Please the dimension of grid file", Common::ErrorCodes::MismatchData());
-                
-                if (dim == 2)
-                {
-                    for (int i = index_s; i <= index_e; i++)
-                    {
-                        x = 0.0;
-                        y = 0.0;
-                        
-                        getline(mesh_file_Fluent, line);
-                        sscanf_s(line.c_str(), "%lf %lf", &x, &y);
-                        
-                        node_ID[n]    = n;
-                        node_XY[n][0] = x;
-                        node_XY[n][1] = y;
-                        node_whereis[i] = n;
-                        n++;
-                    }
-                }
-                else
-                {
-                    for (int i = index_s; i <= index_e; i++)
-                    {
-                        x = 0.0;
-                        y = 0.0;
-                        z = 0.0;
-                        
-                        getline(mesh_file_Fluent, line);
-                        sscanf_s(line.c_str(), "%lf %lf %lf", &x, &y, &z);
-                        
-                        node_ID[n]    = i;
-                        node_XY[n][0] = x;
-                        node_XY[n][1] = y;
-                        node_XY[n][2] = z;
-                        node_whereis[i] = n;
-                        n++;
-                    }
-                }
-            }
-        }
-    }
-    
-    if (n != nnm) Common::ExceptionError(FromHere(), "PROBLEM IN NODE DATA. Number of read node does not match with header", Common::ErrorCodes::MismatchData());
-    // END READ NODE DATA
-    
-    
-    
-    // 4. Read Face Data (4th READ)
-    std::vector<int>               face_type (nfm, -1);
-    std::vector<int>               face_ID(nfm, -1);
-    std::vector<int>               face_whereis(nfm+1, -1);
-    std::vector<int>               face_BC(nfm, 0);
-    std::vector<std::vector<int> > face_stencil(nfm, std::vector<int>(2, -1));
-    std::vector<std::vector<int> > face_node(nfm, std::vector<int>(MAX_FACE_PER_NODE, -1));
-    
-    int f = 0;
-    
-    mesh_file_Fluent.clear();
-    mesh_file_Fluent.seekg(0, std::ios::beg);
-    
-    
-    while (! mesh_file_Fluent.eof())
-    {
-        index = -1;
-        getline(mesh_file_Fluent, line);
-        sscanf_s(line.c_str(), "(%d ", &index);
-        
-        if (index == 13)
-        {
-            temp_dummy	= -1;
-            zone 		= -1;
-            index_s     = -1;
-            index_e     = -1;
-            bc_type     = -1;
-            type 	    = -1;
-            
-            sscanf_s(line.c_str(),"(%d (%x %x %x %d %d)", &temp_dummy, &zone, &index_s, &index_e, &bc_type, &type); // GETTING INDEX AND ZONE
-            
-            if (zone > 0)
-            {
-                // Assign BC type from data
-                bc_type	= bcZone[zone];
-                
-                switch (type)
-                {
-                    case 0:
-                        for (int i = index_s; i <= index_e; i++)
-                        {
-                            int temp_faceType = -1;
-                            getline(mesh_file_Fluent, line);
-                            sscanf_s(line.c_str(), "%d", &temp_faceType);
-                            
-                            std::vector<int> temp_nodeList (MAX_FACE_PER_NODE, -1);
-                            int cl = -1;
-                            int cr = -1;
-                            
-                            switch (temp_faceType)
-                            {
-                                case 2: // LINE
-                                    sscanf_s(line.c_str(), "%d %x %x %x %x", &type, &temp_nodeList[0], &temp_nodeList[1], &cl, &cr);
-                                    
-                                    face_ID[f]         = i;
-                                    face_type[f]       = LINE;
-                                    face_node[f][0]    = temp_nodeList[0];
-                                    face_node[f][1]    = temp_nodeList[1];
-                                    face_stencil[f][0] = cl;
-                                    face_stencil[f][1] = cr;
-                                    break;
-                                    
-                                case 3: // Triangle
-                                    sscanf_s(line.c_str(), "%d %x %x %x %x %x", &type, &temp_nodeList[0], &temp_nodeList[1], &temp_nodeList[2], &cl, &cr);
-                                    
-                                    face_ID[f]         = i;
-                                    face_type[f]       = TRI3;
-                                    face_node[f][0]    = temp_nodeList[0];
-                                    face_node[f][1]    = temp_nodeList[1];
-                                    face_node[f][2]    = temp_nodeList[2];
-                                    face_stencil[f][0] = cl;
-                                    face_stencil[f][1] = cr;
-                                    break;
-                                    
-                                case 4: // Quadrilateral
-                                    sscanf_s(line.c_str(), "%d %x %x %x %x %x %x", &type, &temp_nodeList[0], &temp_nodeList[1], &temp_nodeList[2], &temp_nodeList[3], &cl, &cr);
-                                    
-                                    face_ID[f]         = i;
-                                    face_type[f]       = QUAD4;
-                                    face_node[f][0]    = temp_nodeList[0];
-                                    face_node[f][1]    = temp_nodeList[1];
-                                    face_node[f][2]    = temp_nodeList[2];
-                                    face_node[f][3]    = temp_nodeList[3];
-                                    face_stencil[f][0] = cl;
-                                    face_stencil[f][1] = cr;
-                                    break;
-                                    
-                                default:
-                                    Common::ExceptionError(FromHere(), "It is not supported Face-type. PLEASE CHECK THE FACE TYPE IN A MESH FILE!", Common::ErrorCodes::NotSupportedType());
-                                    break;
-                            }
-                            
-                            face_BC[f]      = bc_type;
-                            face_whereis[i]	= f;
-                            f++;
-                        }
-                        break;
-                        
-                    case 2: // LINE
-                        for (int i = index_s; i <= index_e; i++)
-                        {
-                            std::vector<int> temp_nodeList (MAX_FACE_PER_NODE, -1);
-                            int cl = -1;
-                            int cr = -1;
-                            
-                            getline(mesh_file_Fluent, line);
-                            sscanf_s(line.c_str(), "%x %x %x %x", &temp_nodeList[0], &temp_nodeList[1], &cl, &cr);
-                            
-                            face_ID[f]         = i;
-                            face_type[f]       = LINE;
-                            face_node[f][0]    = temp_nodeList[0];
-                            face_node[f][1]    = temp_nodeList[1];
-                            face_stencil[f][0] = cl;
-                            face_stencil[f][1] = cr;
-                            
-                            face_BC[f]         = bc_type;
-                            face_whereis[i]	   = f;
-                            f++;
-                        }
-                        break;
-                        
-                    case 3: // Triangle
-                        for (int i = index_s; i <= index_e; i++)
-                        {
-                            std::vector<int> temp_nodeList (MAX_FACE_PER_NODE, -1);
-                            int cl = -1;
-                            int cr = -1;
-                            
-                            getline(mesh_file_Fluent, line);
-                            sscanf_s(line.c_str(), "%x %x %x %x %x", &temp_nodeList[0], &temp_nodeList[1], &temp_nodeList[2], &cl, &cr);
-                            
-                            face_ID[f]         = i;
-                            face_type[f]       = TRI3;
-                            face_node[f][0]    = temp_nodeList[0];
-                            face_node[f][1]    = temp_nodeList[1];
-                            face_node[f][2]    = temp_nodeList[2];
-                            face_stencil[f][0] = cl;
-                            face_stencil[f][1] = cr;
-                            
-                            face_BC[f]         = bc_type;
-                            face_whereis[i]	   = f;
-                            f++;
-                        }
-                        break;
-                        
-                    case 4: // Quadrilateral
-                        for (int i = index_s; i <= index_e; i++)
-                        {
-                            std::vector<int> temp_nodeList (MAX_FACE_PER_NODE, -1);
-                            int cl = -1;
-                            int cr = -1;
-                            
-                            getline(mesh_file_Fluent, line);
-                            sscanf_s(line.c_str(), "%x %x %x %x %x %x", &temp_nodeList[0], &temp_nodeList[1], &temp_nodeList[2], &temp_nodeList[3], &cl, &cr);
-                            
-                            face_ID[f]         = i;
-                            face_type[f]       = QUAD4;
-                            face_node[f][0]    = temp_nodeList[0];
-                            face_node[f][1]    = temp_nodeList[1];
-                            face_node[f][2]    = temp_nodeList[2];
-                            face_node[f][3]    = temp_nodeList[3];
-                            face_stencil[f][0] = cl;
-                            face_stencil[f][1] = cr;
-                            
-                            face_BC[f]         = bc_type;
-                            face_whereis[i]	   = f;
-                            f++;
-                        }
-                        break;
-                        
-                    default:
-                        Common::ExceptionError(FromHere(), "It is not supported Face-type. PLEASE CHECK THE FACE TYPE IN A MESH FILE!", Common::ErrorCodes::NotSupportedType());
-                        break;
-                }
-            }
-        }
-    }
-    
-    if (f != nfm) Common::ExceptionError(FromHere(), "PROBLEM IN Face DATA. Number of read face does not match with header", Common::ErrorCodes::MismatchData());
-    
-    
-    // 5. Read Cell Data (5th READ)
-    std::vector<int>               cell_type(ncm, -1);
-    std::vector<int>               cell_ID(ncm, -1);
-    std::vector<int>               cell_BC(ncm, -1);
-    std::vector<int>               cell_whereis(ncm+1, -1);
-    std::vector<std::vector<int> > cell_NodeList(ncm, std::vector<int>(MAX_CELL_PER_NODE, -1));
-    std::vector<std::vector<int> > cell_FaceList(ncm, std::vector<int>(MAX_CELL_PER_FACE, -1));
-    
-    int c = 0;
-    int temp_type;
-    mesh_file_Fluent.clear();
-    mesh_file_Fluent.seekg(0, std::ios::beg);
-    
-    
-    while (! mesh_file_Fluent.eof())
-    {
-        index = -1;
-        getline(mesh_file_Fluent, line);
-        sscanf_s(line.c_str(), "(%d ", &index);
-        
-        if (index == 12)
-        {
-            temp_dummy	= -1;
-            zone 		= -1;
-            index_s		= -1;
-            index_e		= -1;
-            type 		= -1;
-            temp_type	= -1;
-            
-            sscanf_s(line.c_str(),"(%d (%x %x %x %d", &temp_dummy, &zone, &index_s, &index_e, &type); // GETTING INDEX AND ZONE
-            if (zone > 0)
-            {
-                sscanf_s(line.c_str(),"(%d (%x %x %x %d %d)", &temp_dummy, &zone, &index_e, &index_e, &type, &temp_type); // GETTING INDEX AND ZONE
-                
-                if (type == 1)
-                {
-                    if (temp_type != 0)
-                    {
-                        for (int i = index_s; i <= index_e; i++)
-                        {
-                            cell_ID[c]      = i;
-                            cell_BC[c]      = BC_INTERIOR;
-                            cell_type[c]    = cellTypeConverterFluent(temp_type);
-                            cell_whereis[i]	= c;
-                            c++;
-                        }
-                    }
-                    else
-                    {
-                        for (int i = index_s; i <= index_e; i++)
-                        {
-                            mesh_file_Fluent >> temp_type;
-                            
-                            cell_ID[c]      = i;
-                            cell_BC[c]      = BC_INTERIOR;
-                            cell_type[c]    = cellTypeConverterFluent(temp_type);
-                            cell_whereis[i]	= c;
-                            c++;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    if (c != ncm) Common::ExceptionError(FromHere(), "PROBLEM IN Cell DATA. Number of read cell does not match with header", Common::ErrorCodes::MismatchData());
-    
-    
-    
-    
-    
-    
-    /*
-     * Construct cells (Node and Face list)
-     */
-    int flag;
-    std::vector<int> filled_nodes(ncm, 0);
-    std::vector<int> filled_faces(ncm, 0);
-    
-    std::ostringstream error_message;
-    
-    for (int f = 0; f <= nfm-1; f++)
-    {
-        int cl	= face_stencil[f][0];
-        int cr	= face_stencil[f][1];
-        
-        // For Right Cell
-        if (cr != -1)
-        {
-            c = cell_whereis[cr];
-            
-            switch (cell_type[c])
-            {
-                case TRI3:
-                    if (face_type[f] != LINE)
-                    {
-                        error_message << "Cell ID:[" << cr << "] has problem during cell mesh construction. It has impossible face-type";
-                        Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::NotSupportedType());
-                    }
-                    
-                    
-                    if (filled_nodes[c] == 0)
-                    {
-                        cell_NodeList[c][0]	= face_node[f][1];
-                        cell_NodeList[c][1]	= face_node[f][0];
-                        filled_nodes[c]	= 2;
-                        
-                        cell_FaceList[c][0]	= face_ID[f];
-                        filled_faces[c] = 1;
-                    }
-                    else if (filled_nodes[c] == 2)
-                    {
-                        if (face_node[f][0] == cell_NodeList[c][0])
-                        {
-                            cell_NodeList[c][2]	= face_node[f][1];
-                            filled_nodes[c]	= 3;
-                            
-                            cell_FaceList[c][2]	= face_ID[f];
-                            filled_faces[c]++;
-                        }
-                        else if (face_node[f][1] == cell_NodeList[c][1])
-                        {
-                            cell_NodeList[c][2]	= face_node[f][0];
-                            filled_nodes[c]	= 3;
-                            
-                            cell_FaceList[c][1]	= face_ID[f];
-                            filled_faces[c]++;
-                        }
-                    }
-                    else
-                    {
-                        if (filled_faces[c] == 2)
-                        {
-                            if (face_node[f][0] == cell_NodeList[c][0] && face_node[f][1] == cell_NodeList[c][2])
-                            {
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if (face_node[f][0] == cell_NodeList[c][2] && face_node[f][1] == cell_NodeList[c][1])
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                    }
-                    break;
-                    
-                case QUAD4:
-                    if (face_type[f] != LINE)
-                    {
-                        error_message << "Cell ID:[" << cr << "] has problem during cell mesh construction. It has impossible face-type";
-                        Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::NotSupportedType());
-                    }
-                    
-                    
-                    if (filled_nodes[c] == 0)
-                    {
-                        cell_NodeList[c][0]	= face_node[f][1];
-                        cell_NodeList[c][1]	= face_node[f][0];
-                        filled_nodes[c]	= 2;
-                        
-                        cell_FaceList[c][0]	= face_ID[f];
-                        filled_faces[c] = 1;
-                    }
-                    else if (filled_nodes[c] == 2)
-                    {
-                        if (face_node[f][0] != cell_NodeList[c][0] &&
-                            face_node[f][0] != cell_NodeList[c][1] &&
-                            face_node[f][1] != cell_NodeList[c][0] &&
-                            face_node[f][1] != cell_NodeList[c][1])
-                        {
-                            cell_NodeList[c][2]	= face_node[f][1];
-                            cell_NodeList[c][3]	= face_node[f][0];
-                            filled_nodes[c]	= 4;
-                            
-                            cell_FaceList[c][2]	= face_ID[f];
-                            filled_faces[c]++;
-                        }
-                        
-                        if (cell_NodeList[c][0] == face_node[f][0] && cell_NodeList[c][1] != face_node[f][1])
-                        {
-                            if (cell_FaceList[c][3] == -1)
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                        
-                        if (cell_NodeList[c][0] != face_node[f][0] && cell_NodeList[c][1] == face_node[f][1])
-                        {
-                            if (cell_FaceList[c][1] == -1)
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                    }
-                    else if (filled_nodes[c] == 4)
-                    {
-                        if (face_node[f][0] == cell_NodeList[c][0] && face_node[f][1] == cell_NodeList[c][3])
-                        {
-                            if (cell_FaceList[c][3] == -1)
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                        else if (face_node[f][0] == cell_NodeList[c][2] && face_node[f][1] == cell_NodeList[c][1])
-                        {
-                            if (cell_FaceList[c][1] == -1)
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                    }
-                    
-                    break;
-                    
-                case TETRA4:
-                    if (face_type[f] != TRI3)
-                    {
-                        error_message << "Cell ID:[" << cr << "] has problem during cell mesh construction. It has impossible face-type";
-                        Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::NotSupportedType());
-                    }
-                    
-                    if (filled_nodes[c] == 0)
-                    {
-                        cell_NodeList[c][0]	= face_node[f][0];
-                        cell_NodeList[c][1]	= face_node[f][1];
-                        cell_NodeList[c][2]	= face_node[f][2];
-                        filled_nodes[c]	= 3;
-                        
-                        cell_FaceList[c][0]	= face_ID[f];
-                        filled_faces[c] = 1;
-                    }
-                    if (filled_nodes[c] == 3)
-                    {
-                        if (face_node[f][0] != cell_NodeList[c][0] &&
-                            face_node[f][0] != cell_NodeList[c][1] &&
-                            face_node[f][0] != cell_NodeList[c][2])
-                        {
-                            cell_NodeList[c][3] = face_node[f][0];
-                            filled_nodes[c]++;
-                            
-                            if(face_node[f][1] == cell_NodeList[c][0] &&
-                               face_node[f][2] == cell_NodeList[c][2])
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if(face_node[f][1] == cell_NodeList[c][1] &&
-                                    face_node[f][2] == cell_NodeList[c][0])
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if(face_node[f][1] == cell_NodeList[c][2] &&
-                                    face_node[f][2] == cell_NodeList[c][1])
-                            {
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                        else if (face_node[f][1] != cell_NodeList[c][0] &&
-                                 face_node[f][1] != cell_NodeList[c][1] &&
-                                 face_node[f][1] != cell_NodeList[c][2])
-                        {
-                            cell_NodeList[c][3] = face_node[f][1];
-                            filled_nodes[c]++;
-                            
-                            if(face_node[f][0] == cell_NodeList[c][0] &&
-                               face_node[f][2] == cell_NodeList[c][1])
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if(face_node[f][0] == cell_NodeList[c][1] &&
-                                    face_node[f][2] == cell_NodeList[c][2])
-                            {
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if(face_node[f][0] == cell_NodeList[c][2] &&
-                                    face_node[f][2] == cell_NodeList[c][0])
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                        else if (face_node[f][2] != cell_NodeList[c][0] &&
-                                 face_node[f][2] != cell_NodeList[c][1] &&
-                                 face_node[f][2] != cell_NodeList[c][2])
-                        {
-                            cell_NodeList[c][3] = face_node[f][2];
-                            filled_nodes[c]++;
-                            
-                            if(face_node[f][0] == cell_NodeList[c][1] &&
-                               face_node[f][1] == cell_NodeList[c][0])
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if(face_node[f][0] == cell_NodeList[c][2] &&
-                                    face_node[f][1] == cell_NodeList[c][1])
-                            {
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if(face_node[f][0] == cell_NodeList[c][0] &&
-                                    face_node[f][1] == cell_NodeList[c][2])
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                    }
-                    break;
-                    
-                case HEXA8:
-                    if (face_type[f] != QUAD4)
-                    {
-                        error_message << "Cell ID:[" << cr << "] has problem during cell mesh construction. It has impossible face-type";
-                        Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::NotSupportedType());
-                    }
-                    
-                    if (filled_nodes[c] == 0)
-                    {
-                        cell_NodeList[c][0]	= face_node[f][0];
-                        cell_NodeList[c][1]	= face_node[f][1];
-                        cell_NodeList[c][2]	= face_node[f][2];
-                        cell_NodeList[c][3]	= face_node[f][3];
-                        filled_nodes[c]	= 4;
-                        
-                        cell_FaceList[c][0]	= face_ID[f];
-                        filled_faces[c] = 1;
-                    }
-                    else if (filled_nodes[c] == 4 || filled_nodes[c] == 6)
-                    {
-                        if(cell_NodeList[c][0] == face_node[f][0]&&
-                           cell_NodeList[c][1] == face_node[f][3])
-                        {
-                            cell_NodeList[c][4]	= face_node[f][1];
-                            cell_NodeList[c][5]	= face_node[f][2];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][1]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][0] == face_node[f][1]&&
-                                cell_NodeList[c][1] == face_node[f][0])
-                        {
-                            cell_NodeList[c][4]	= face_node[f][2];
-                            cell_NodeList[c][5]	= face_node[f][3];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][1]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][0] == face_node[f][2]&&
-                                cell_NodeList[c][1] == face_node[f][1])
-                        {
-                            cell_NodeList[c][4]	= face_node[f][3];
-                            cell_NodeList[c][5]	= face_node[f][0];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][1]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][0] == face_node[f][3]&&
-                                cell_NodeList[c][1] == face_node[f][2])
-                        {
-                            cell_NodeList[c][4]	= face_node[f][0];
-                            cell_NodeList[c][5]	= face_node[f][1];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][1]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][2] == face_node[f][0]&&
-                                cell_NodeList[c][3] == face_node[f][3])
-                        {
-                            cell_NodeList[c][6]	= face_node[f][1];
-                            cell_NodeList[c][7]	= face_node[f][2];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][3]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][2] == face_node[f][1]&&
-                                cell_NodeList[c][3] == face_node[f][0])
-                        {
-                            cell_NodeList[c][6]	= face_node[f][2];
-                            cell_NodeList[c][7]	= face_node[f][3];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][3]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][2] == face_node[f][2]&&
-                                cell_NodeList[c][3] == face_node[f][1])
-                        {
-                            cell_NodeList[c][6]	= face_node[f][3];
-                            cell_NodeList[c][7]	= face_node[f][0];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][3]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][2] == face_node[f][3]&&
-                                cell_NodeList[c][3] == face_node[f][2])
-                        {
-                            cell_NodeList[c][6]	= face_node[f][0];
-                            cell_NodeList[c][7]	= face_node[f][1];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][3]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                    }
-                    else
-                    {
-                        std::vector<int> temp_face2(4);
-                        std::vector<int> temp_face4(4);
-                        std::vector<int> temp_face5(4);
-                        
-                        temp_face2[0]	= cell_NodeList[c][1];
-                        temp_face2[1]	= cell_NodeList[c][5];
-                        temp_face2[2]	= cell_NodeList[c][6];
-                        temp_face2[3]	= cell_NodeList[2][2];
-                        
-                        temp_face4[0]	= cell_NodeList[c][0];
-                        temp_face4[1]	= cell_NodeList[c][3];
-                        temp_face4[2]	= cell_NodeList[c][7];
-                        temp_face4[3]	= cell_NodeList[2][4];
-                        
-                        temp_face5[0]	= cell_NodeList[c][4];
-                        temp_face5[1]	= cell_NodeList[c][7];
-                        temp_face5[2]	= cell_NodeList[c][6];
-                        temp_face5[3]	= cell_NodeList[2][5];
-                        
-                        if (faceCompare(temp_face2, face_node[f], QUAD4) == 1)
-                        {
-                            cell_FaceList[c][2]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        
-                        if (faceCompare(temp_face4, face_node[f], QUAD4) == 1)
-                        {
-                            cell_FaceList[c][4]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        
-                        if (faceCompare(temp_face5, face_node[f], QUAD4) == 1)
-                        {
-                            cell_FaceList[c][5]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                    }
-                    break;
-                    
-                case PRISM6:
-                    if (face_type[f] == TRI3)
-                    {
-                        if (filled_nodes[c] == 0)
-                        {
-                            cell_NodeList[c][0]	= face_node[f][0];
-                            cell_NodeList[c][1]	= face_node[f][1];
-                            cell_NodeList[c][2]	= face_node[f][2];
-                            filled_nodes[c] = 3;
-                            
-                            cell_FaceList[c][0]	= face_ID[f];
-                            filled_faces[c] = 1;
-                        }
-                        else if (filled_nodes[c] == 5)
-                        {
-                            if (cell_NodeList[c][3] == face_node[f][0] &&
-                                cell_NodeList[c][4] == face_node[f][2])
-                            {
-                                cell_NodeList[c][5]	= face_node[f][1];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][5]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][3] == face_node[f][1] &&
-                                     cell_NodeList[c][4] == face_node[f][0])
-                            {
-                                cell_NodeList[c][5]	= face_node[f][2];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][5]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][3] == face_node[f][2] &&
-                                     cell_NodeList[c][4] == face_node[f][1])
-                            {
-                                cell_NodeList[c][5]	= face_node[f][0];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][5]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                        }
-                    }
-                    else if (face_type[f] == QUAD4)
-                    {
-                        if (filled_nodes[c] == 3)
-                        {
-                            if (cell_NodeList[c][0] == face_node[f][0] &&
-                                cell_NodeList[c][1] == face_node[f][3])
-                            {
-                                cell_NodeList[c][3]	= face_node[f][1];
-                                cell_NodeList[c][4]	= face_node[f][2];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][1] &&
-                                     cell_NodeList[c][1] == face_node[f][0])
-                            {
-                                cell_NodeList[c][3]	= face_node[f][2];
-                                cell_NodeList[c][4]	= face_node[f][3];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][2] &&
-                                     cell_NodeList[c][1] == face_node[f][1])
-                            {
-                                cell_NodeList[c][3]	= face_node[f][3];
-                                cell_NodeList[c][4]	= face_node[f][0];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][3] &&
-                                     cell_NodeList[c][1] == face_node[f][2])
-                            {
-                                cell_NodeList[c][3]	= face_node[f][0];
-                                cell_NodeList[c][4]	= face_node[f][1];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                        }
-                        else if (filled_nodes[c] == 6)
-                        {
-                            std::vector<int> temp_face2(4);
-                            std::vector<int> temp_face3(4);
-                            
-                            temp_face2[0]	= cell_NodeList[c][1];
-                            temp_face2[1]	= cell_NodeList[c][4];
-                            temp_face2[2]	= cell_NodeList[c][5];
-                            temp_face2[3]	= cell_NodeList[2][2];
-                            
-                            temp_face3[0]	= cell_NodeList[c][0];
-                            temp_face3[1]	= cell_NodeList[c][2];
-                            temp_face3[2]	= cell_NodeList[c][5];
-                            temp_face3[3]	= cell_NodeList[2][3];
-                            
-                            
-                            if (faceCompare(temp_face2, face_node[f], QUAD4) == 1)
-                            {
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            
-                            if (faceCompare(temp_face3, face_node[f], QUAD4) == 1)
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                        }
-                    }
-                    else
-                    {
-                        error_message << "Cell ID:[" << cr << "] has problem during cell mesh construction. It has impossible face-type";
-                        Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::NotSupportedType());
-                    }
-                    break;
-                    
-                case PYRAMID5:
-                    if (face_type[f] == QUAD4)
-                    {
-                        if (filled_nodes[c] == 0)
-                        {
-                            cell_NodeList[c][0]	= face_node[f][0];
-                            cell_NodeList[c][1]	= face_node[f][1];
-                            cell_NodeList[c][2]	= face_node[f][2];
-                            cell_NodeList[c][3]	= face_node[f][3];
-                            
-                            filled_nodes[c] = 4;
-                            
-                            cell_FaceList[c][0]	= face_ID[f];
-                            filled_faces[c] = 1;
-                        }
-                        else if (filled_nodes[c] == 3)
-                        {
-                            if (cell_NodeList[c][0] == face_node[f][0] &&
-                                cell_NodeList[c][1] == face_node[f][1])
-                            {
-                                cell_NodeList[c][2]	= face_node[f][2];
-                                cell_NodeList[c][3]	= face_node[f][3];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][0]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][1] &&
-                                     cell_NodeList[c][1] == face_node[f][2])
-                            {
-                                cell_NodeList[c][2]	= face_node[f][3];
-                                cell_NodeList[c][3]	= face_node[f][0];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][0]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][2] &&
-                                     cell_NodeList[c][1] == face_node[f][3])
-                            {
-                                cell_NodeList[c][2]	= face_node[f][0];
-                                cell_NodeList[c][3]	= face_node[f][1];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][0]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][3] &&
-                                     cell_NodeList[c][1] == face_node[f][0])
-                            {
-                                cell_NodeList[c][2]	= face_node[f][1];
-                                cell_NodeList[c][3]	= face_node[f][2];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][0]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                        }
-                    }
-                    else if (face_type[f] == TRI3)
-                    {
-                        if (filled_nodes[c] == 0)
-                        {
-                            cell_NodeList[c][0]	= face_node[f][0];
-                            cell_NodeList[c][1]	= face_node[f][2];
-                            cell_NodeList[c][4]	= face_node[f][1];
-                            filled_nodes[c] = 3;
-                            
-                            cell_FaceList[c][1]	= face_ID[f];
-                            filled_faces[c] = 1;
-                        }
-                        else if (filled_nodes[c] == 4)
-                        {
-                            if (cell_NodeList[c][0] == face_node[f][0] &&
-                                cell_NodeList[c][1] == face_node[f][2])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][1];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][1] &&
-                                     cell_NodeList[c][1] == face_node[f][0])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][2];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][2] &&
-                                     cell_NodeList[c][1] == face_node[f][1])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][0];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][1] == face_node[f][0] &&
-                                     cell_NodeList[c][2] == face_node[f][2])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][1];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][1] == face_node[f][1] &&
-                                     cell_NodeList[c][2] == face_node[f][0])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][2];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][1] == face_node[f][2] &&
-                                     cell_NodeList[c][2] == face_node[f][1])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][0];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][2] == face_node[f][0] &&
-                                     cell_NodeList[c][3] == face_node[f][2])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][1];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][2] == face_node[f][1] &&
-                                     cell_NodeList[c][3] == face_node[f][0])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][2];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][2] == face_node[f][2] &&
-                                     cell_NodeList[c][3] == face_node[f][1])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][0];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][3] == face_node[f][0] &&
-                                     cell_NodeList[c][0] == face_node[f][2])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][1];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][4]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][3] == face_node[f][1] &&
-                                     cell_NodeList[c][0] == face_node[f][0])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][2];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][4]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][3] == face_node[f][2] &&
-                                     cell_NodeList[c][0] == face_node[f][1])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][0];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][4]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                        }
-                        else if (filled_nodes[c] == 5)
-                        {
-                            std::vector<int> temp_face1(3);
-                            std::vector<int> temp_face2(3);
-                            std::vector<int> temp_face3(3);
-                            std::vector<int> temp_face4(3);
-                            
-                            temp_face1[0]	= cell_NodeList[c][0];
-                            temp_face1[1]	= cell_NodeList[c][4];
-                            temp_face1[2]	= cell_NodeList[c][1];
-                            
-                            temp_face2[0]	= cell_NodeList[c][1];
-                            temp_face2[1]	= cell_NodeList[c][4];
-                            temp_face2[2]	= cell_NodeList[c][2];
-                            
-                            temp_face3[0]	= cell_NodeList[c][3];
-                            temp_face3[1]	= cell_NodeList[c][2];
-                            temp_face3[2]	= cell_NodeList[c][4];
-                            
-                            temp_face4[0]	= cell_NodeList[c][0];
-                            temp_face4[1]	= cell_NodeList[c][3];
-                            temp_face4[2]	= cell_NodeList[c][4];
-                            
-                            
-                            if (faceCompare(temp_face1, face_node[f], TRI3) == 1)
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            
-                            if (faceCompare(temp_face2, face_node[f], TRI3) == 1)
-                            {
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            
-                            if (faceCompare(temp_face3, face_node[f], TRI3) == 1)
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            
-                            if (faceCompare(temp_face4, face_node[f], TRI3) == 1)
-                            {
-                                cell_FaceList[c][4]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                        }
-                    }
-                    break;
-            }
-        } // end right-cell
-        
-        
-        
-        // For Left Cell
-        if (cl != -1)
-        {
-            c = cell_whereis[cl];
-            
-            switch (cell_type[c])
-            {
-                case TRI3:
-                    if (face_type[f] != LINE)
-                    {
-                        error_message << "Cell ID:[" << cr << "] has problem during cell mesh construction. It has impossible face-type";
-                        Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::NotSupportedType());
-                    }
-                    
-                    
-                    if (filled_nodes[c] == 0)
-                    {
-                        cell_NodeList[c][0]	= face_node[f][0];
-                        cell_NodeList[c][1]	= face_node[f][1];
-                        filled_nodes[c]	= 2;
-                        
-                        cell_FaceList[c][0]	= face_ID[f];
-                        filled_faces[c] = 1;
-                    }
-                    else if (filled_nodes[c] == 2)
-                    {
-                        if (face_node[f][0] == cell_NodeList[c][1])
-                        {
-                            cell_NodeList[c][2]	= face_node[f][1];
-                            filled_nodes[c]	= 3;
-                            
-                            cell_FaceList[c][1]	= face_ID[f];
-                            filled_faces[c]++;
-                        }
-                        else if (face_node[f][1] == cell_NodeList[c][0])
-                        {
-                            cell_NodeList[c][2]	= face_node[f][0];
-                            filled_nodes[c]	= 3;
-                            
-                            cell_FaceList[c][2]	= face_ID[f];
-                            filled_faces[c]++;
-                        }
-                    }
-                    else
-                    {
-                        if (filled_faces[c] == 2)
-                        {
-                            if (face_node[f][0] == cell_NodeList[c][1] && face_node[f][1] == cell_NodeList[c][2])
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if (face_node[f][0] == cell_NodeList[c][2] && face_node[f][1] == cell_NodeList[c][0])
-                            {
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                    }
-                    break;
-                    
-                case QUAD4:
-                    if (face_type[f] != LINE)
-                    {
-                        error_message << "Cell ID:[" << cr << "] has problem during cell mesh construction. It has impossible face-type";
-                        Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::NotSupportedType());
-                    }
-                    
-                    
-                    if (filled_nodes[c] == 0)
-                    {
-                        cell_NodeList[c][0]	= face_node[f][0];
-                        cell_NodeList[c][1]	= face_node[f][1];
-                        filled_nodes[c]	= 2;
-                        
-                        cell_FaceList[c][0]	= face_ID[f];
-                        filled_faces[c] = 1;
-                    }
-                    else if (filled_nodes[c] == 2)
-                    {
-                        if (face_node[f][0] != cell_NodeList[c][0] &&
-                            face_node[f][0] != cell_NodeList[c][1] &&
-                            face_node[f][1] != cell_NodeList[c][0] &&
-                            face_node[f][1] != cell_NodeList[c][1])
-                        {
-                            cell_NodeList[c][2]	= face_node[f][0];
-                            cell_NodeList[c][3]	= face_node[f][1];
-                            filled_nodes[c]	= 4;
-                            
-                            cell_FaceList[c][2]	= face_ID[f];
-                            filled_faces[c]++;
-                        }
-                        
-                        if (cell_NodeList[c][0] == face_node[f][1] && cell_NodeList[c][1] != face_node[f][0])
-                        {
-                            if (cell_FaceList[c][3] == -1)
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                        
-                        if (cell_NodeList[c][0] != face_node[f][1] && cell_NodeList[c][1] == face_node[f][0])
-                        {
-                            if (cell_FaceList[c][1] == -1)
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                    }
-                    else if (filled_nodes[c] == 4)
-                    {
-                        if (face_node[f][0] == cell_NodeList[c][3] && face_node[f][1] == cell_NodeList[c][0])
-                        {
-                            if (cell_FaceList[c][3] == -1)
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                        else if (face_node[f][0] == cell_NodeList[c][1] && face_node[f][1] == cell_NodeList[c][2])
-                        {
-                            if (cell_FaceList[c][1] == -1)
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                    }
-                    break;
-                    
-                case TETRA4:
-                    if (face_type[f] != TRI3)
-                    {
-                        error_message << "Cell ID:[" << cr << "] has problem during cell mesh construction. It has impossible face-type";
-                        Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::NotSupportedType());
-                    }
-                    
-                    if (filled_nodes[c] == 0)
-                    {
-                        cell_NodeList[c][0]	= face_node[f][0];
-                        cell_NodeList[c][1]	= face_node[f][2];
-                        cell_NodeList[c][2]	= face_node[f][1];
-                        filled_nodes[c]	= 3;
-                        
-                        cell_FaceList[c][0]	= face_ID[f];
-                        filled_faces[c] = 1;
-                    }
-                    if (filled_nodes[c] == 3)
-                    {
-                        if (face_node[f][0] != cell_NodeList[c][0] &&
-                            face_node[f][0] != cell_NodeList[c][1] &&
-                            face_node[f][0] != cell_NodeList[c][2])
-                        {
-                            cell_NodeList[c][3] = face_node[f][0];
-                            filled_nodes[c]++;
-                            
-                            if(face_node[f][1] == cell_NodeList[c][0] &&
-                               face_node[f][2] == cell_NodeList[c][1])
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if(face_node[f][1] == cell_NodeList[c][1] &&
-                                    face_node[f][2] == cell_NodeList[c][2])
-                            {
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if(face_node[f][1] == cell_NodeList[c][2] &&
-                                    face_node[f][2] == cell_NodeList[c][0])
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                        else if (face_node[f][1] != cell_NodeList[c][0] &&
-                                 face_node[f][1] != cell_NodeList[c][1] &&
-                                 face_node[f][1] != cell_NodeList[c][2])
-                        {
-                            cell_NodeList[c][3] = face_node[f][1];
-                            filled_nodes[c]++;
-                            
-                            if(face_node[f][0] == cell_NodeList[c][1] &&
-                               face_node[f][2] == cell_NodeList[c][0])
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if(face_node[f][0] == cell_NodeList[c][2] &&
-                                    face_node[f][2] == cell_NodeList[c][1])
-                            {
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if(face_node[f][0] == cell_NodeList[c][0] &&
-                                    face_node[f][2] == cell_NodeList[c][2])
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                        else if (face_node[f][2] != cell_NodeList[c][0] &&
-                                 face_node[f][2] != cell_NodeList[c][1] &&
-                                 face_node[f][2] != cell_NodeList[c][2])
-                        {
-                            cell_NodeList[c][3] = face_node[f][2];
-                            filled_nodes[c]++;
-                            
-                            if(face_node[f][0] == cell_NodeList[c][0] &&
-                               face_node[f][1] == cell_NodeList[c][1])
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if(face_node[f][0] == cell_NodeList[c][1] &&
-                                    face_node[f][1] == cell_NodeList[c][2])
-                            {
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                            else if(face_node[f][0] == cell_NodeList[c][2] &&
-                                    face_node[f][1] == cell_NodeList[c][0])
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c]++;
-                            }
-                        }
-                    }
-                    break;
-                    
-                case HEXA8:
-                    if (face_type[f] != QUAD4)
-                    {
-                        error_message << "Cell ID:[" << cr << "] has problem during cell mesh construction. It has impossible face-type";
-                        Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::NotSupportedType());
-                    }
-                    
-                    if (filled_nodes[c] == 0)
-                    {
-                        cell_NodeList[c][0]	= face_node[f][0];
-                        cell_NodeList[c][1]	= face_node[f][3];
-                        cell_NodeList[c][2]	= face_node[f][2];
-                        cell_NodeList[c][3]	= face_node[f][1];
-                        filled_nodes[c]	= 4;
-                        
-                        cell_FaceList[c][0]	= face_ID[f];
-                        filled_faces[c] = 1;
-                    }
-                    else if (filled_nodes[c] == 4 || filled_nodes[c] == 6)
-                    {
-                        if(cell_NodeList[c][0] == face_node[f][0]&&
-                           cell_NodeList[c][1] == face_node[f][1])
-                        {
-                            cell_NodeList[c][4]	= face_node[f][3];
-                            cell_NodeList[c][5]	= face_node[f][2];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][1]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][0] == face_node[f][1]&&
-                                cell_NodeList[c][1] == face_node[f][2])
-                        {
-                            cell_NodeList[c][4]	= face_node[f][0];
-                            cell_NodeList[c][5]	= face_node[f][3];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][1]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][0] == face_node[f][2]&&
-                                cell_NodeList[c][1] == face_node[f][3])
-                        {
-                            cell_NodeList[c][4]	= face_node[f][1];
-                            cell_NodeList[c][5]	= face_node[f][0];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][1]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][0] == face_node[f][3]&&
-                                cell_NodeList[c][1] == face_node[f][0])
-                        {
-                            cell_NodeList[c][4]	= face_node[f][2];
-                            cell_NodeList[c][5]	= face_node[f][1];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][1]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][2] == face_node[f][0]&&
-                                cell_NodeList[c][3] == face_node[f][1])
-                        {
-                            cell_NodeList[c][6]	= face_node[f][3];
-                            cell_NodeList[c][7]	= face_node[f][2];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][3]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][2] == face_node[f][1]&&
-                                cell_NodeList[c][3] == face_node[f][2])
-                        {
-                            cell_NodeList[c][6]	= face_node[f][0];
-                            cell_NodeList[c][7]	= face_node[f][3];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][3]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][2] == face_node[f][2]&&
-                                cell_NodeList[c][3] == face_node[f][3])
-                        {
-                            cell_NodeList[c][6]	= face_node[f][1];
-                            cell_NodeList[c][7]	= face_node[f][0];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][3]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        else if(cell_NodeList[c][2] == face_node[f][3]&&
-                                cell_NodeList[c][3] == face_node[f][0])
-                        {
-                            cell_NodeList[c][6]	= face_node[f][2];
-                            cell_NodeList[c][7]	= face_node[f][1];
-                            filled_nodes[c] += 2;
-                            
-                            cell_FaceList[c][3]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                    }
-                    else
-                    {
-                        std::vector<int> temp_face2(4);
-                        std::vector<int> temp_face4(4);
-                        std::vector<int> temp_face5(4);
-                        
-                        temp_face2[0]	= cell_NodeList[c][1];
-                        temp_face2[1]	= cell_NodeList[c][2];
-                        temp_face2[2]	= cell_NodeList[c][6];
-                        temp_face2[3]	= cell_NodeList[2][5];
-                        
-                        temp_face4[0]	= cell_NodeList[c][0];
-                        temp_face4[1]	= cell_NodeList[c][4];
-                        temp_face4[2]	= cell_NodeList[c][7];
-                        temp_face4[3]	= cell_NodeList[2][3];
-                        
-                        temp_face5[0]	= cell_NodeList[c][4];
-                        temp_face5[1]	= cell_NodeList[c][5];
-                        temp_face5[2]	= cell_NodeList[c][6];
-                        temp_face5[3]	= cell_NodeList[2][7];
-                        
-                        if (faceCompare(temp_face2, face_node[f], QUAD4) == 1)
-                        {
-                            cell_FaceList[c][2]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        
-                        if (faceCompare(temp_face4, face_node[f], QUAD4) == 1)
-                        {
-                            cell_FaceList[c][4]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                        
-                        if (faceCompare(temp_face5, face_node[f], QUAD4) == 1)
-                        {
-                            cell_FaceList[c][5]	= face_ID[f];
-                            filled_faces[c] += 1;
-                        }
-                    }
-                    break;
-                    
-                case PRISM6:
-                    if (face_type[f] == TRI3)
-                    {
-                        if (filled_nodes[c] == 0)
-                        {
-                            cell_NodeList[c][0]	= face_node[f][0];
-                            cell_NodeList[c][1]	= face_node[f][2];
-                            cell_NodeList[c][2]	= face_node[f][1];
-                            filled_nodes[c] = 3;
-                            
-                            cell_FaceList[c][0]	= face_ID[f];
-                            filled_faces[c] = 1;
-                        }
-                        else if (filled_nodes[c] == 5)
-                        {
-                            if (cell_NodeList[c][3] == face_node[f][0] &&
-                                cell_NodeList[c][4] == face_node[f][1])
-                            {
-                                cell_NodeList[c][5]	= face_node[f][2];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][5]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][3] == face_node[f][1] &&
-                                     cell_NodeList[c][4] == face_node[f][2])
-                            {
-                                cell_NodeList[c][5]	= face_node[f][0];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][5]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][3] == face_node[f][2] &&
-                                     cell_NodeList[c][4] == face_node[f][0])
-                            {
-                                cell_NodeList[c][5]	= face_node[f][1];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][5]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                        }
-                    }
-                    else if (face_type[f] == QUAD4)
-                    {
-                        if (filled_nodes[c] == 3)
-                        {
-                            if (cell_NodeList[c][0] == face_node[f][0] &&
-                                cell_NodeList[c][1] == face_node[f][1])
-                            {
-                                cell_NodeList[c][3]	= face_node[f][3];
-                                cell_NodeList[c][4]	= face_node[f][2];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][1] &&
-                                     cell_NodeList[c][1] == face_node[f][2])
-                            {
-                                cell_NodeList[c][3]	= face_node[f][0];
-                                cell_NodeList[c][4]	= face_node[f][3];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][2] &&
-                                     cell_NodeList[c][1] == face_node[f][3])
-                            {
-                                cell_NodeList[c][3]	= face_node[f][1];
-                                cell_NodeList[c][4]	= face_node[f][0];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][3] &&
-                                     cell_NodeList[c][1] == face_node[f][0])
-                            {
-                                cell_NodeList[c][3]	= face_node[f][2];
-                                cell_NodeList[c][4]	= face_node[f][1];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                        }
-                        else if (filled_nodes[c] == 6)
-                        {
-                            std::vector<int> temp_face2(4);
-                            std::vector<int> temp_face3(4);
-                            
-                            temp_face2[0]	= cell_NodeList[c][1];
-                            temp_face2[1]	= cell_NodeList[c][2];
-                            temp_face2[2]	= cell_NodeList[c][5];
-                            temp_face2[3]	= cell_NodeList[2][4];
-                            
-                            temp_face3[0]	= cell_NodeList[c][0];
-                            temp_face3[1]	= cell_NodeList[c][3];
-                            temp_face3[2]	= cell_NodeList[c][5];
-                            temp_face3[3]	= cell_NodeList[2][2];
-                            
-                            
-                            if (faceCompare(temp_face2, face_node[f], QUAD4) == 1)
-                            {
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            
-                            if (faceCompare(temp_face3, face_node[f], QUAD4) == 1)
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                        }
-                    }
-                    else
-                    {
-                        error_message << "Cell ID:[" << cr << "] has problem during cell mesh construction. It has impossible face-type";
-                        Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::NotSupportedType());
-                    }
-                    break;
-                    
-                case PYRAMID5:
-                    if (face_type[f] == QUAD4)
-                    {
-                        if (filled_nodes[c] == 0)
-                        {
-                            cell_NodeList[c][0]	= face_node[f][0];
-                            cell_NodeList[c][1]	= face_node[f][3];
-                            cell_NodeList[c][2]	= face_node[f][2];
-                            cell_NodeList[c][3]	= face_node[f][1];
-                            filled_nodes[c] = 4;
-                            
-                            cell_FaceList[c][0]	= face_ID[f];
-                            filled_faces[c] = 1;
-                        }
-                        else if (filled_nodes[c] == 3)
-                        {
-                            if (cell_NodeList[c][0] == face_node[f][0] &&
-                                cell_NodeList[c][1] == face_node[f][3])
-                            {
-                                cell_NodeList[c][2]	= face_node[f][2];
-                                cell_NodeList[c][3]	= face_node[f][1];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][0]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][1] &&
-                                     cell_NodeList[c][1] == face_node[f][0])
-                            {
-                                cell_NodeList[c][2]	= face_node[f][3];
-                                cell_NodeList[c][3]	= face_node[f][2];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][0]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][2] &&
-                                     cell_NodeList[c][1] == face_node[f][1])
-                            {
-                                cell_NodeList[c][2]	= face_node[f][0];
-                                cell_NodeList[c][3]	= face_node[f][3];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][0]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][3] &&
-                                     cell_NodeList[c][1] == face_node[f][2])
-                            {
-                                cell_NodeList[c][2]	= face_node[f][1];
-                                cell_NodeList[c][3]	= face_node[f][0];
-                                filled_nodes[c] += 2;
-                                
-                                cell_FaceList[c][0]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                        }
-                    }
-                    else if (face_type[f] == TRI3)
-                    {
-                        if (filled_nodes[c] == 0)
-                        {
-                            cell_NodeList[c][0]	= face_node[f][0];
-                            cell_NodeList[c][1]	= face_node[f][1];
-                            cell_NodeList[c][4]	= face_node[f][2];
-                            filled_nodes[c] = 3;
-                            
-                            cell_FaceList[c][1]	= face_ID[f];
-                            filled_faces[c] = 1;
-                        }
-                        else if (filled_nodes[c] == 4)
-                        {
-                            if (cell_NodeList[c][0] == face_node[f][0] &&
-                                cell_NodeList[c][1] == face_node[f][1])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][2];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][1] &&
-                                     cell_NodeList[c][1] == face_node[f][2])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][0];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][0] == face_node[f][2] &&
-                                     cell_NodeList[c][1] == face_node[f][0])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][1];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][1] == face_node[f][0] &&
-                                     cell_NodeList[c][2] == face_node[f][1])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][2];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][1] == face_node[f][1] &&
-                                     cell_NodeList[c][2] == face_node[f][2])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][0];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][1] == face_node[f][2] &&
-                                     cell_NodeList[c][2] == face_node[f][0])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][1];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][2] == face_node[f][0] &&
-                                     cell_NodeList[c][3] == face_node[f][1])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][2];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][2] == face_node[f][1] &&
-                                     cell_NodeList[c][3] == face_node[f][2])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][0];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][2] == face_node[f][2] &&
-                                     cell_NodeList[c][3] == face_node[f][0])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][1];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][3] == face_node[f][0] &&
-                                     cell_NodeList[c][0] == face_node[f][1])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][2];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][4]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][3] == face_node[f][1] &&
-                                     cell_NodeList[c][0] == face_node[f][2])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][0];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][4]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            else if (cell_NodeList[c][3] == face_node[f][2] &&
-                                     cell_NodeList[c][0] == face_node[f][0])
-                            {
-                                cell_NodeList[c][4]	= face_node[f][1];
-                                filled_nodes[c] += 1;
-                                
-                                cell_FaceList[c][4]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                        }
-                        else if (filled_nodes[c] == 5)
-                        {
-                            std::vector<int> temp_face1(3);
-                            std::vector<int> temp_face2(3);
-                            std::vector<int> temp_face3(3);
-                            std::vector<int> temp_face4(3);
-                            
-                            temp_face1[0]	= cell_NodeList[c][0];
-                            temp_face1[1]	= cell_NodeList[c][1];
-                            temp_face1[2]	= cell_NodeList[c][4];
-                            
-                            temp_face2[0]	= cell_NodeList[c][1];
-                            temp_face2[1]	= cell_NodeList[c][2];
-                            temp_face2[2]	= cell_NodeList[c][4];
-                            
-                            temp_face3[0]	= cell_NodeList[c][2];
-                            temp_face3[1]	= cell_NodeList[c][3];
-                            temp_face3[2]	= cell_NodeList[c][4];
-                            
-                            temp_face4[0]	= cell_NodeList[c][3];
-                            temp_face4[1]	= cell_NodeList[c][0];
-                            temp_face4[2]	= cell_NodeList[c][4];
-                            
-                            
-                            if (faceCompare(temp_face1, face_node[f], TRI3) == 1)
-                            {
-                                cell_FaceList[c][1]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            
-                            if (faceCompare(temp_face2, face_node[f], TRI3) == 1)
-                            {
-                                cell_FaceList[c][2]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            
-                            if (faceCompare(temp_face3, face_node[f], TRI3) == 1)
-                            {
-                                cell_FaceList[c][3]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                            
-                            if (faceCompare(temp_face4, face_node[f], TRI3) == 1)
-                            {
-                                cell_FaceList[c][4]	= face_ID[f];
-                                filled_faces[c] += 1;
-                            }
-                        }
-                    }
-                    break;
-            }
-        } // end left-cell
-    }
-    
-    
-    
-    // Error check
-    for (int c = 0; c <= ncm-1; c++)
-    {
-        int nfaces;
-        int nnodes;
-        switch (cell_type[c])
-        {
-            case TRI3:
-                nfaces = 3;
-                nnodes = 3;
-                break;
-                
-            case QUAD4:
-                nfaces = 4;
-                nnodes = 4;
-                break;
-                
-            case TETRA4:
-                nfaces = 4;
-                nnodes = 4;
-                break;
-                
-            case HEXA8:
-                nfaces = 6;
-                nnodes = 8;
-                break;
-                
-            case PRISM6:
-                nfaces = 5;
-                nnodes = 6;
-                break;
-                
-            case PYRAMID5:
-                nfaces = 5;
-                nnodes = 5;
-                break;
-        }
-        
-        if (filled_nodes[c] != nnodes)
-        {
-            error_message << "Cell ID:[" << c << "] has problem during cell mesh construction. Some of nodes are not filled";
-            Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::MismatchData());
-        }
-        
-        if (filled_faces[c] != nfaces)
-        {
-            error_message << "Cell ID:[" << c << "] has problem during cell mesh construction. Some of faces are not filled";
-            Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::MismatchData());
-        }
-        
-        
-        
-        if (Common::VectorCompare::hasSameComponentINT(cell_NodeList[c], nnodes))
-        {
-            error_message << "Cell ID:[" << c << "] has repeated node on its node list.";
-            Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::ExceedLimit());
-        }
-        
-        if (Common::VectorCompare::hasSameComponentINT(cell_FaceList[c], nfaces))
-        {
-            error_message << "Cell ID:[" << c << "] has repeated face on its face list.";
-            Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::ExceedLimit());
-        }
-        
-        
-        if(Common::VectorCompare::hasSatisfyRangeINT(cell_NodeList[c], nnodes, 1, nnm))
-        {
-            error_message << "Cell ID:[" << c << "] has wrong node index in which is out of possible index range.";
-            Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::ExceedLimit());
-        }
-        
-        if(Common::VectorCompare::hasSatisfyRangeINT(cell_FaceList[c], nfaces, 1, nfm))
-        {
-            error_message << "Cell ID:[" << c << "] has wrong face index in which is out of possible index range.";
-            Common::ExceptionError(FromHere(), error_message.str(), Common::ErrorCodes::ExceedLimit());
-        }
-        
-    }
-    
-    mesh_file_Fluent.close();
-    
-    
-    
-    
-    
-    // WRITE OP2A GRID DATA
-    std::string fileName;
-    fileName = out_file_name + ".op2";
-    
-    std::ofstream mesh_file_OP2;
-    mesh_file_OP2.open(fileName.c_str());
-    
-    mesh_file_OP2 << "%*****************************************************" << std::endl;
-    mesh_file_OP2 << "%     OP2A Grid File using FORMAT version 1.0         " << std::endl;
-    mesh_file_OP2 << "%                                                     " << std::endl;
-    mesh_file_OP2 << "%                  Originally developed by Minkwan Kim" << std::endl;
-    mesh_file_OP2 << "%=====================================================" << std::endl;
-    mesh_file_OP2 << "% [FACE / CELL TYPE identifiers]                      " << std::endl;
-    mesh_file_OP2 << "%      Line                   :  3                    " << std::endl;
-    mesh_file_OP2 << "%      Triangle (3-nodes)     :  5                    " << std::endl;
-    mesh_file_OP2 << "%      Quadrilateral (4-nodes):  9                    " << std::endl;
-    mesh_file_OP2 << "%      Tetrahedral (4-nodes)  : 10                    " << std::endl;
-    mesh_file_OP2 << "%      Hexahedral (8-nodes)   : 12                    " << std::endl;
-    mesh_file_OP2 << "%      Prism (6-nodes)        : 13                    " << std::endl;
-    mesh_file_OP2 << "%      Pramid (5-nodes)       : 14                    " << std::endl;
-    mesh_file_OP2 << "%                                                     " << std::endl;
-    mesh_file_OP2 << "% [BC TYPE identifiers]                               " << std::endl;
-    mesh_file_OP2 << "%      Interior               :  0                    " << std::endl;
-    mesh_file_OP2 << "%      Wall                   : 10                    " << std::endl;
-    mesh_file_OP2 << "%      Inlet                  : 20                    " << std::endl;
-    mesh_file_OP2 << "%      Outlet                 : 30                    " << std::endl;
-    mesh_file_OP2 << "%      Freestream (Far-field) : 40                    " << std::endl;
-    mesh_file_OP2 << "%      Symmetric              : 50                    " << std::endl;
-    mesh_file_OP2 << "%      Axisymmetric           : 60                    " << std::endl;
-    mesh_file_OP2 << "%      Anode                  : 70                    " << std::endl;
-    mesh_file_OP2 << "%      Cathode                : 80                    " << std::endl;
-    mesh_file_OP2 << "%      Dielectric material    : 90                    " << std::endl;
-    mesh_file_OP2 << "%                                                     " << std::endl;
-    mesh_file_OP2 << "% [DATA Format]                                       " << std::endl;
-    mesh_file_OP2 << "%    -Node Data FORMAT                                " << std::endl;
-    mesh_file_OP2 << "%     (NODE ID#)  (POSITION DATA: X Y Z)           " << std::endl;
-    mesh_file_OP2 << "%    -Face Data FORMAT                                " << std::endl;
-    mesh_file_OP2 << "%     (FACE ID#)  (BOUNDARY CONDITION)  (FACE TYPE)  (LIST OF NODE IDs) (LEFT-CELL ID) (RIGHT-CELL ID)" << std::endl;
-    mesh_file_OP2 << "%    -Cell Data FORMAT" << std::endl;
-    mesh_file_OP2 << "%     (CELL ID#)  (BOUNDARY CONDITION)  (CELL TYPE)  (LIST OF NODE IDs) (LIST OF FACE IDs)" << std::endl;
-    mesh_file_OP2 << "%=====================================================" << std::endl;
-    mesh_file_OP2 << "%                   Last Format Updated on April/2016 " << std::endl;
-    mesh_file_OP2 << "%                                       by M Kim      " << std::endl;
-    mesh_file_OP2 << "%*****************************************************" << std::endl << std::endl;
-    
-    
-    mesh_file_OP2 << "% OVERALL GRID INFORMATION" << std::endl;
-    mesh_file_OP2 << "DIM= " << dim << std::endl;
-    mesh_file_OP2 << "NNM= " << nnm << std::endl;
-    mesh_file_OP2 << "NFM= " << nfm << std::endl;
-    mesh_file_OP2 << "NCM= " << ncm << std::endl;
-    mesh_file_OP2 << std::endl;
-    
-    mesh_file_OP2 << "%%%%%%%%%%%%" << std::endl;
-    mesh_file_OP2 << "NODEDATA= " << nnm <<std::endl;
-    if (dim == 2)
-    {
-        double z = 0.0;
-        for (int n_ID = 1; n_ID <= nnm; n_ID++)
-        {
-            n = node_whereis[n_ID];
-            
-            mesh_file_OP2 << std::setw(8) << node_ID[n]+1 <<
-            std::setw(25) << std::scientific << std::setprecision(16) << node_XY[n][0] <<
-            std::setw(25) << node_XY[n][1] <<
-            std::setw(25) << z << std::endl;
-        }
-        
-    }
-    else
-    {
-        for (int n_ID = 0; n_ID <= nnm-1; n_ID++)
-        {
-            n = node_whereis[n_ID];
-            
-            mesh_file_OP2 << std::setw(8) << n_ID <<
-            std::setw(25) << std::scientific << std::setprecision(16) << node_XY[n][0] <<
-            std::setw(25) << node_XY[n][1] <<
-            std::setw(25) << node_XY[n][2] << std::endl;
-        }
-    }
-    mesh_file_OP2 << std::endl;
-    
-    
-    mesh_file_OP2 << "%%%%%%%%%%%%" << std::endl;
-    mesh_file_OP2 << "FACEDATA= " << nfm << std::endl;
-    for (int f_ID = 1; f_ID <= nfm; f_ID++)
-    {
-        f = face_whereis[f_ID];
-        
-        int nnode;
-        switch (face_type[f])
-        {
-            case LINE:
-                nnode = 2;
-                break;
-                
-            case TRI3:
-                nnode = 3;
-                break;
-                
-            case QUAD4:
-                nnode = 4;
-                break;
-        }
-        
-        mesh_file_OP2 << std::setw(8) << f_ID;
-        mesh_file_OP2 << std::setw(8) << face_BC[f];
-        mesh_file_OP2 << std::setw(8) << face_type[f];
-        
-        for (int n = 0; n <= nnode-1; n++) mesh_file_OP2 << std::setw(8) << face_node[f][n];
-        mesh_file_OP2 << std::setw(8) << face_stencil[f][0];
-        mesh_file_OP2 << std::setw(8) << face_stencil[f][1];
-        mesh_file_OP2 << std::endl;
-    }
-    mesh_file_OP2 << std::endl;
-    
-    
-    mesh_file_OP2 << "%%%%%%%%%%%%" << std::endl;
-    mesh_file_OP2 << "CELLDATA= " << ncm << std::endl;
-    for (int c_ID = 1; c_ID <= ncm; c_ID++)
-    {
-        c = cell_whereis[c_ID];
-        
-        int cellBC = cell_BC[c];
-        
-        int nface;
-        int nnode;
-        
-        switch (cell_type[c])
-        {
-            case TRI3:
-                nface = 3;
-                nnode = 3;
-                break;
-                
-            case QUAD4:
-                nface = 4;
-                nnode = 4;
-                break;
-                
-            case TETRA4:
-                nface = 4;
-                nnode = 4;
-                break;
-                
-            case HEXA8:
-                nface = 6;
-                nnode = 8;
-                break;
-                
-            case PRISM6:
-                nface = 5;
-                nnode = 6;
-                break;
-        }
-        
-        mesh_file_OP2 << std::setw(8) << c_ID;
-        mesh_file_OP2 << std::setw(8) << cellBC;
-        mesh_file_OP2 << std::setw(8) << cell_type[c];
-        for (int n = 0; n <= nnode-1; n++) mesh_file_OP2 << std::setw(8) << cell_NodeList[c][n];
-        for (int f = 0; f <= nface-1; f++) mesh_file_OP2 << std::setw(8) << cell_FaceList[c][f];
-        mesh_file_OP2 << std::endl;
-    }
-    mesh_file_OP2 << std::endl;
-    
+    GridBasicInfo gridinfo;
+    GridGeo       gridgeo;
     
-    mesh_file_OP2.close();
+    readGridFromFluent(mesh_file_name_Fluent, gridinfo, gridgeo);
+    writeGridOP2(out_file_name + ".op2", gridinfo, gridgeo);
 }
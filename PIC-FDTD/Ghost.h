@@ -5,7 +5,7 @@
 
 #pragma once
 
-#include "GRID\cell.hpp"
+#include "GRID/cell.hpp"
 
 //! \class Ghost
 //! \brief Contains ghost cell properties, derived from CellBase
@@ -0,0 +1,173 @@
+//! \file
+//! \brief Implementation of GradientOperator class
+//! \author Rahul Kalampattel
+//! \date Last updated June 2018
+
+#include "GradientOperator.h"
+#include "Mesh.h"
+#include "Parameters.h"
+
+// Default constructor
+GradientOperator::GradientOperator()
+{
+}
+
+
+// Destructor
+GradientOperator::~GradientOperator()
+{
+}
+
+
+// Sort nodes into runs of internal nodes, whose neighbours are a fixed offset
+// away, and table entries. Each component of E at a table node is a central
+// difference, across the periodic image where there is one, or a one sided
+// difference at other boundaries.
+void GradientOperator::assemble(Parameters *parametersList, const Mesh *mesh)
+{
+	double h = mesh->h;
+	stride = mesh->structured ? mesh->numRows + 1 : 0;
+	runStart.clear();
+	runLength.clear();
+	tableNodes.clear();
+	terms.clear();
+	divisors.clear();
+
+	for (int i = 0; i < mesh->numNodes; i++)
+	{
+		const NodeGeometry &node = mesh->node(i);
+		int left = node.leftNodeID - 1, right = node.rightNodeID - 1;
+		int top = node.topNodeID - 1, bottom = node.bottomNodeID - 1;
+		int periodicX1 = node.periodicX1NodeID - 1, periodicX2 = node.periodicX2NodeID - 1;
+
+		if (node.boundaryType == boundaryInternal && stride > 0 &&
+			left == i - stride && right == i + stride && top == i - 1 && bottom == i + 1)
+		{
+			if (!runStart.empty() && runStart.back() + runLength.back() == i)
+			{
+				runLength.back()++;
+			}
+			else
+			{
+				runStart.push_back(i);
+				runLength.push_back(1);
+			}
+			continue;
+		}
+
+		tableNodes.push_back(i);
+
+		// Horizontal component
+		if (node.boundaryType == boundaryL || node.boundaryType == boundaryTL ||
+			node.boundaryType == boundaryBL)
+		{
+			if (parametersList->leftBCType == bcPeriodic)
+			{
+				terms.insert(terms.end(), { periodicX1, right });
+				divisors.push_back(2 * h);
+			}
+			else
+			{
+				terms.insert(terms.end(), { i, right });
+				divisors.push_back(h);
+			}
+		}
+		else if (node.boundaryType == boundaryR || node.boundaryType == boundaryTR ||
+			node.boundaryType == boundaryBR)
+		{
+			if (parametersList->rightBCType == bcPeriodic)
+			{
+				terms.insert(terms.end(), { left, periodicX1 });
+				divisors.push_back(2 * h);
+			}
+			else
+			{
+				terms.insert(terms.end(), { i, left });
+				divisors.push_back(h);
+			}
+		}
+		else
+		{
+			terms.insert(terms.end(), { left, right });
+			divisors.push_back(2 * h);
+		}
+
+		// Vertical component
+		if (node.boundaryType == boundaryT || node.boundaryType == boundaryTL ||
+			node.boundaryType == boundaryTR)
+		{
+			if (parametersList->topBCType == bcPeriodic)
+			{
+				terms.insert(terms.end(), { bottom, periodicX2 });
+				divisors.push_back(2 * h);
+			}
+			else
+			{
+				terms.insert(terms.end(), { i, bottom });
+				divisors.push_back(h);
+			}
+		}
+		else if (node.boundaryType == boundaryB || node.boundaryType == boundaryBL ||
+			node.boundaryType == boundaryBR)
+		{
+			if (parametersList->bottomBCType == bcPeriodic)
+			{
+				terms.insert(terms.end(), { periodicX2, top });
+				divisors.push_back(2 * h);
+			}
+			else
+			{
+				terms.insert(terms.end(), { i, top });
+				divisors.push_back(h);
+			}
+		}
+		else
+		{
+			terms.insert(terms.end(), { bottom, top });
+			divisors.push_back(2 * h);
+		}
+	}
+}
+
+
+// Calculate E from phi and set B, visiting each node once. Runs take a
+// vectorised central difference, table entries their precomputed difference.
+void GradientOperator::apply(Parameters *parametersList, Mesh *mesh) const
+{
+	double h = mesh->h;
+	std::vector<Nodes> &nodes = mesh->nodesVector.nodes;
+	const double *Bfield = parametersList->Bfield.data();
+	int numRuns = runStart.size(), numEntries = tableNodes.size();
+
+	# pragma omp parallel num_threads(parametersList->numThreads)
+	{
+		# pragma omp for schedule(static) nowait
+		for (int j = 0; j < numRuns; j++)
+		{
+			int first = runStart[j], last = runStart[j] + runLength[j];
+
+			# pragma omp simd
+			for (int i = first; i < last; i++)
+			{
+				double *EMfield = nodes[i].EMfield.data();
+				EMfield[0] = (nodes[i - stride].phi - nodes[i + stride].phi) / (2 * h);
+				EMfield[1] = (nodes[i + 1].phi - nodes[i - 1].phi) / (2 * h);
+				EMfield[3] = Bfield[0];
+				EMfield[4] = Bfield[1];
+				EMfield[5] = Bfield[2];
+			}
+		}
+
+		# pragma omp for schedule(static)
+		for (int j = 0; j < numEntries; j++)
+		{
+			const int *term = &terms[4 * j];
+			double *EMfield = nodes[tableNodes[j]].EMfield.data();
+			EMfield[0] = (nodes[term[0]].phi - nodes[term[1]].phi) / divisors[2 * j];
+			EMfield[1] = (nodes[term[2]].phi - nodes[term[3]].phi) / divisors[2 * j + 1];
+			EMfield[3] = Bfield[0];
+			EMfield[4] = Bfield[1];
+			EMfield[5] = Bfield[2];
+		}
+	}
+}
@@ -0,0 +1,39 @@
+//! \file
+//! \brief Definition of GradientOperator class
+//! \author Rahul Kalampattel
+//! \date Last updated June 2018
+
+#pragma once
+
+#include <vector>
+
+class Mesh;				// Forward declarations to resolve circular dependency
+class Parameters;
+
+//! \class GradientOperator
+//! \brief Electric field from the potential, with internal nodes of a
+//! structured mesh differenced in runs and every other node from a table of
+//! two point differences built from its boundary type
+class GradientOperator
+{
+public:
+	// Data members
+	std::vector<int> runStart;				//!< First node of each run of internal nodes
+	std::vector<int> runLength;				//!< Number of nodes in each run
+	int stride = 0;							//!< Index offset of left and right neighbours within a run
+	std::vector<int> tableNodes;			//!< Node of each table entry
+	std::vector<int> terms;					//!< Nodes differenced for x then y, E = (phi[a] - phi[b]) / divisor
+	std::vector<double> divisors;			//!< Divisor of x then y difference of each table entry
+
+
+	// Constructor/destructor
+	GradientOperator();						//!< Default constructor
+	~GradientOperator();					//!< Destructor
+
+
+	// Methods
+	void assemble(Parameters *parametersList,
+		const Mesh *mesh);					//!< Build runs and table from mesh connectivity and BCs
+	void apply(Parameters *parametersList,
+		Mesh *mesh) const;					//!< Calculate E from phi and apply external B, in one pass
+};
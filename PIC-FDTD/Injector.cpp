@@ -0,0 +1,206 @@
+//! \file
+//! \brief Implementation of Injector class
+//! \author Rahul Kalampattel
+//! \date Last updated June 2018
+
+#include <algorithm>
+#include <cmath>
+
+#include "Injector.h"
+
+// Default constructor
+Injector::Injector()
+{
+}
+
+
+// Constructor, which finds the faces of each open boundary and tabulates the
+// distribution of normal velocity of particles crossing them
+Injector::Injector(Parameters *parametersList, Mesh *mesh, VectorParticle *particlesVector)
+{
+	// Injected particles are of the same species as the initial particles
+	if (parametersList->simulationType == "electron")
+	{
+		prototype.basic.q = ELECTRON_CHARGE;
+		prototype.basic.m = ELECTRON_MASS_kg;
+		prototype.basic.type = -1;
+	}
+	else if (parametersList->propellant == "xenon")
+	{
+		prototype.basic.q = 0.0;
+		prototype.basic.m = XENON_MASS_kg;
+		prototype.basic.type = 0;
+	}
+	prototype.position = { 0.0, 0.0, 0.0 };
+	prototype.velocity = { 0.0, 0.0, 0.0 };
+	thermalVelocity = sqrt(K_B * parametersList->initialTemperature / prototype.basic.m);
+
+	// Reservoir density matches the initial loading, which is the total weight
+	// of the particles over the area of the cells they were seeded in
+	double totalWeight = 0.0, seededArea = 0.0;
+	for (int i = 0; i < particlesVector->numParticles; i++)
+	{
+		totalWeight += particlesVector->particleVector[i].weight;
+	}
+	for (int i = 0; i < parametersList->numCellsWithParticles; i++)
+	{
+		const CellGeometry &cell = mesh->cell(i);
+		seededArea += (cell.right - cell.left) * (cell.top - cell.bottom);
+	}
+	double density = (seededArea > 0.0) ? totalWeight / seededArea : 0.0;
+
+	BCType types[4] = { parametersList->leftBCType, parametersList->rightBCType,
+		parametersList->topBCType, parametersList->bottomBCType };
+	double normalDrifts[4] = { parametersList->initialVelocity[0], -parametersList->initialVelocity[0],
+		-parametersList->initialVelocity[1], parametersList->initialVelocity[1] };
+	double tangentialDrifts[4] = { parametersList->initialVelocity[1], parametersList->initialVelocity[1],
+		parametersList->initialVelocity[0], parametersList->initialVelocity[0] };
+
+	for (int side = 0; side < 4; side++)
+	{
+		// Bottom of an axisymmetric domain is the axis
+		if (types[side] != bcOpen || (side == 3 && parametersList->axisymmetric))
+		{
+			continue;
+		}
+
+		InjectionSegment segment;
+		segment.side = side;
+		segment.tangentialDrift = tangentialDrifts[side];
+		segment.rng.seed(parametersList->generateSeed());
+
+		// Flux weighted distribution v * exp(-(v - u)^2 / 2 vt^2) for v > 0,
+		// integrated with the trapezoidal rule and inverted at each quantile
+		const int numSamples = 4096, numQuantiles = 256;
+		double u = normalDrifts[side], vt = thermalVelocity;
+		double maxVelocity = std::max(u, 0.0) + 8.0 * vt;
+		std::vector<double> cumulative(numSamples + 1, 0.0);
+		double previous = 0.0;
+		for (int k = 1; k < numSamples + 1; k++)
+		{
+			double v = maxVelocity * k / numSamples;
+			double value = v * exp(-(v - u) * (v - u) / (2.0 * vt * vt));
+			cumulative[k] = cumulative[k - 1] + 0.5 * (previous + value) * maxVelocity / numSamples;
+			previous = value;
+		}
+		double flux = density * cumulative[numSamples] / (sqrt(2.0 * PI) * vt);
+
+		int k = 0;
+		for (int q = 0; q < numQuantiles; q++)
+		{
+			double target = cumulative[numSamples] * q / (numQuantiles - 1);
+			while (k < numSamples - 1 && cumulative[k + 1] < target)
+			{
+				k++;
+			}
+			double fraction = (cumulative[k + 1] > cumulative[k]) ?
+				(target - cumulative[k]) / (cumulative[k + 1] - cumulative[k]) : 0.0;
+			segment.normalVelocities.push_back(maxVelocity * (k + std::min(fraction, 1.0)) / numSamples);
+		}
+
+		// Faces on this side, with remainders started at random so that faces
+		// do not all inject on the same step
+		std::uniform_real_distribution<double> uniform(0.0, 1.0);
+		for (int i = 0; i < mesh->numCells; i++)
+		{
+			const CellGeometry &cell = mesh->cell(i);
+			int neighbour[4] = { cell.leftCellID, cell.rightCellID, cell.topCellID, cell.bottomCellID };
+			if (neighbour[side] <= 0)
+			{
+				double length = (side < 2) ? cell.top - cell.bottom : cell.right - cell.left;
+				segment.cellIDs.push_back(i + 1);
+				segment.particlesPerStep.push_back(flux * length * parametersList->timeStep);
+				segment.remainders.push_back(uniform(segment.rng));
+			}
+		}
+
+		segments.push_back(segment);
+	}
+}
+
+
+// Destructor
+Injector::~Injector()
+{
+}
+
+
+// Inject the particles crossing each open boundary over a time step. Segments
+// fill their own batches in parallel, which are then added to the simulation
+// together. Particles are placed a random fraction of their step inside the
+// boundary cell, so that they do not enter as a sheet.
+void Injector::inject(Parameters *parametersList, Mesh *mesh, VectorParticle *particlesVector)
+{
+	std::vector<std::vector<Particle>> batches(segments.size());
+	int numSegments = segments.size();
+
+	# pragma omp parallel for num_threads(parametersList->numThreads)
+	for (int s = 0; s < numSegments; s++)
+	{
+		InjectionSegment &segment = segments[s];
+		std::uniform_real_distribution<double> uniform(0.0, 1.0);
+		std::normal_distribution<double> normal(0.0, thermalVelocity);
+		int numQuantiles = segment.normalVelocities.size();
+
+		int numParticles = 0;
+		for (unsigned int f = 0; f < segment.cellIDs.size(); f++)
+		{
+			segment.remainders[f] += segment.particlesPerStep[f];
+			numParticles += static_cast<int>(segment.remainders[f]);
+		}
+		batches[s].reserve(numParticles);
+
+		for (unsigned int f = 0; f < segment.cellIDs.size(); f++)
+		{
+			const CellGeometry &cell = mesh->cell(segment.cellIDs[f] - 1);
+			for (; segment.remainders[f] >= 1.0; segment.remainders[f] -= 1.0)
+			{
+				double quantile = uniform(segment.rng) * (numQuantiles - 1);
+				int q = std::min(static_cast<int>(quantile), numQuantiles - 2);
+				double normalVelocity = segment.normalVelocities[q] + (quantile - q) *
+					(segment.normalVelocities[q + 1] - segment.normalVelocities[q]);
+				double tangentialVelocity = segment.tangentialDrift + normal(segment.rng);
+
+				double along = uniform(segment.rng);
+				double width = (segment.side < 2) ? cell.right - cell.left : cell.top - cell.bottom;
+				double depth = std::min(uniform(segment.rng) * normalVelocity * parametersList->timeStep,
+					0.999 * width);
+
+				batches[s].push_back(prototype);
+				Particle &particle = batches[s].back();
+				particle.cellID = segment.cellIDs[f];
+				if (segment.side == 0)
+				{
+					particle.position = { cell.left + depth, cell.bottom + along * (cell.top - cell.bottom), 0.0 };
+					particle.velocity = { normalVelocity, tangentialVelocity, normal(segment.rng) };
+				}
+				else if (segment.side == 1)
+				{
+					particle.position = { cell.right - depth, cell.bottom + along * (cell.top - cell.bottom), 0.0 };
+					particle.velocity = { -normalVelocity, tangentialVelocity, normal(segment.rng) };
+				}
+				else if (segment.side == 2)
+				{
+					particle.position = { cell.left + along * (cell.right - cell.left), cell.top - depth, 0.0 };
+					particle.velocity = { tangentialVelocity, -normalVelocity, normal(segment.rng) };
+				}
+				else
+				{
+					particle.position = { cell.left + along * (cell.right - cell.left), cell.bottom + depth, 0.0 };
+					particle.velocity = { tangentialVelocity, normalVelocity, normal(segment.rng) };
+				}
+				particle.oldPosition = particle.position;
+				particle.oldVelocity = particle.velocity;
+			}
+		}
+	}
+
+	numInjected = 0;
+	for (int s = 0; s < numSegments; s++)
+	{
+		numInjected += batches[s].size();
+		particlesVector->addParticlesToSim(mesh, batches[s]);
+	}
+
+	parametersList->logBrief("Particle injector exited", 1);
+}
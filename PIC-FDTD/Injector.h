@@ -0,0 +1,53 @@
+//! \file
+//! \brief Definition of Injector class
+//! \author Rahul Kalampattel
+//! \date Last updated June 2018
+
+#pragma once
+
+#include <random>
+#include <vector>
+
+#include "Mesh.h"
+#include "Parameters.h"
+#include "VectorParticle.h"
+
+//! \struct InjectionSegment
+//! \brief Faces of an open boundary, with the flux through each and a table of
+//! the velocity normal to the boundary, sampled from a drifting half-Maxwellian
+struct InjectionSegment
+{
+	int side = 0;								//!< Boundary side (0 left, 1 right, 2 top, 3 bottom)
+	std::vector<int> cellIDs;					//!< Boundary cell of each face
+	std::vector<double> particlesPerStep;		//!< Expected particles crossing each face per time step
+	std::vector<double> remainders;				//!< Fraction of a particle carried over by each face
+	std::vector<double> normalVelocities;		//!< Normal velocity at evenly spaced quantiles of the flux
+	double tangentialDrift = 0.0;				//!< Drift velocity along the boundary
+	std::mt19937 rng;							//!< Random number generator of this segment
+};
+
+//! \class Injector
+//! \brief Injects particles through open boundaries in batches, with the
+//! one-sided flux of a reservoir at the initial density and temperature, so
+//! that outflow is balanced
+class Injector
+{
+public:
+	// Data members
+	std::vector<InjectionSegment> segments;		//!< Open boundary segments
+	Particle prototype;							//!< Species of injected particles
+	double thermalVelocity = 0.0;				//!< Thermal velocity of injected species
+	int numInjected = 0;						//!< Particles injected at the last step
+
+
+	// Constructor/destructor
+	Injector();									//!< Default constructor
+	Injector(Parameters *parametersList, Mesh *mesh,
+		VectorParticle *particlesVector);		//!< Constructor
+	~Injector();								//!< Destructor
+
+
+	// Methods
+	void inject(Parameters *parametersList, Mesh *mesh,
+		VectorParticle *particlesVector);		//!< Inject particles for one time step
+};
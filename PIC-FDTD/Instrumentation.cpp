@@ -0,0 +1,283 @@
+//! \file
+//! \brief Implementation of Instrumentation class
+//! \author Rahul Kalampattel
+//! \date Last updated June 2018
+
+#include "Instrumentation.h"
+
+// Default constructor
+Instrumentation::Instrumentation()
+{
+}
+
+
+// Constructor
+Instrumentation::Instrumentation(Parameters *parametersList, int patchID)
+{
+	this->parametersList = parametersList;
+	this->patchID = patchID;
+
+	stageTime.assign(numStages, 0.0);
+	stageCalls.assign(numStages, 0);
+	iterationTime.assign(numStages, 0.0);
+
+	// Each patch has its own timeline file, which is written as the run
+	// progresses, so that a run which stops early still leaves a timeline
+	if (parametersList->timelineOutput != "none")
+	{
+		timelineFilename = parametersList->timelineFile + "_" + std::to_string(patchID) +
+			"." + parametersList->timelineOutput;
+		startTimeline();
+	}
+}
+
+
+// Destructor
+Instrumentation::~Instrumentation()
+{
+}
+
+
+// Name of a stage
+std::string Instrumentation::stageName(int stage)
+{
+	switch (stage)
+	{
+	case stageBalance:
+		return "Balance";
+	case stageProject:
+		return "Project";
+	case stageCurrent:
+		return "Current";
+	case stageSolve:
+		return "Solve";
+	case stageFDTD:
+		return "FDTD";
+	case stageInterpolate:
+		return "Interpolate";
+	case stagePush:
+		return "Push";
+	case stageMCC:
+		return "MCC";
+	case stageResample:
+		return "Resample";
+	case stageInject:
+		return "Inject";
+	case stageOutput:
+		return "Output";
+	default:
+		return "Unknown";
+	}
+}
+
+
+// Start timing a stage
+void Instrumentation::startStage()
+{
+	stageStart = std::chrono::steady_clock::now();
+}
+
+
+// Stop timing a stage and accumulate result
+void Instrumentation::stopStage(int stage)
+{
+	std::chrono::duration<double> duration = std::chrono::steady_clock::now() - stageStart;
+
+	stageTime[stage] += duration.count();
+	iterationTime[stage] += duration.count();
+	stageCalls[stage]++;
+}
+
+
+// Record number of particles pushed
+void Instrumentation::addParticlesPushed(int numParticles)
+{
+	particlesPushed += numParticles;
+}
+
+
+// Record number of field solver iterations
+void Instrumentation::addSolverIterations(int iterations)
+{
+	solverIterations += iterations;
+	iterationSolverIterations += iterations;
+}
+
+
+// Record bytes written by an output call of this patch
+void Instrumentation::addBytesWritten(long long bytes)
+{
+	bytesWritten += bytes;
+	iterationBytesWritten += bytes;
+}
+
+
+// Write current iteration to timeline
+void Instrumentation::endIteration(int iteration, double time, int numParticles)
+{
+	numIterations++;
+
+	if (!timelineFilename.empty())
+	{
+		writeRecord(iteration, time, numParticles);
+	}
+
+	iterationTime.assign(numStages, 0.0);
+	iterationSolverIterations = 0;
+	iterationBytesWritten = 0;
+}
+
+
+// Log summary table and complete timeline
+void Instrumentation::writeSummary()
+{
+	double totalTime = 0.0;
+	for (int i = 0; i < numStages; i++)
+	{
+		totalTime += stageTime[i];
+	}
+
+	std::stringstream line;
+
+	parametersList->logMessages("Timing summary for patch " + std::to_string(patchID),
+		__FILENAME__, __LINE__, 1);
+
+	line << std::left << std::setw(14) << "Stage" << std::right << std::setw(8) <<
+		"Calls" << std::setw(14) << "Time (s)" << std::setw(12) << "Per call" <<
+		std::setw(10) << "Share";
+	parametersList->logBrief(line.str(), 1);
+
+	for (int i = 0; i < numStages; i++)
+	{
+		line.str("");
+		line << std::left << std::setw(14) << stageName(i) << std::right <<
+			std::setw(8) << stageCalls[i] << std::scientific << std::setprecision(4) <<
+			std::setw(14) << stageTime[i] << std::setw(12) <<
+			(stageCalls[i] > 0 ? stageTime[i] / stageCalls[i] : 0.0) << std::fixed <<
+			std::setprecision(1) << std::setw(9) <<
+			(totalTime > 0.0 ? 100.0 * stageTime[i] / totalTime : 0.0) << "%";
+		parametersList->logBrief(line.str(), 1);
+	}
+
+	line.str("");
+	line << std::left << std::setw(22) << "Total" << std::right << std::scientific <<
+		std::setprecision(4) << std::setw(14) << totalTime;
+	parametersList->logBrief(line.str(), 1);
+
+	line.str("");
+	line << std::scientific << std::setprecision(4) << "Particles pushed per second: " <<
+		(stageTime[stagePush] > 0.0 ? static_cast<double>(particlesPushed) / stageTime[stagePush] : 0.0);
+	parametersList->logBrief(line.str(), 1);
+
+	line.str("");
+	line << "Solver iterations: " << solverIterations << " (" << std::fixed <<
+		std::setprecision(1) << (stageCalls[stageSolve] > 0 ?
+		static_cast<double>(solverIterations) / stageCalls[stageSolve] : 0.0) << " per call)";
+	parametersList->logBrief(line.str(), 1);
+
+	parametersList->logBrief("Bytes written: " + std::to_string(bytesWritten), 1);
+
+	if (!timelineFilename.empty())
+	{
+		finishTimeline();
+	}
+}
+
+
+// Size of a file in bytes (0 if it does not exist)
+long long Instrumentation::fileSize(std::string filename)
+{
+	std::ifstream file(filename, std::ios::binary | std::ios::ate);
+	if (!file.is_open())
+	{
+		return 0;
+	}
+	return static_cast<long long>(file.tellg());
+}
+
+
+// Create timeline file and write its header
+void Instrumentation::startTimeline()
+{
+	std::ofstream timelineFile(timelineFilename);
+	if (!timelineFile.is_open())
+	{
+		parametersList->logMessages("Unable to open timeline file " + timelineFilename,
+			__FILENAME__, __LINE__, 2);
+		timelineFilename.clear();
+		return;
+	}
+
+	if (parametersList->timelineOutput == "csv")
+	{
+		timelineFile << "patch,iteration,time,particles";
+		for (int i = 0; i < numStages; i++)
+		{
+			timelineFile << "," << stageName(i);
+		}
+		timelineFile << ",solverIterations,bytesWritten" << std::endl;
+	}
+	else
+	{
+		timelineFile << "{" << std::endl;
+		timelineFile << "  \"patch\": " << patchID << "," << std::endl;
+		timelineFile << "  \"timeline\": [" << std::endl;
+	}
+}
+
+
+// Append current iteration to timeline file. JSON records are separated
+// from the previous one at the start of each line, so that the file only
+// needs to be reopened for appending.
+void Instrumentation::writeRecord(int iteration, double time, int numParticles)
+{
+	std::ofstream timelineFile(timelineFilename, std::ios::app);
+	timelineFile << std::scientific << std::setprecision(8);
+
+	if (parametersList->timelineOutput == "csv")
+	{
+		timelineFile << patchID << "," << iteration << "," << time << "," << numParticles;
+		for (int i = 0; i < numStages; i++)
+		{
+			timelineFile << "," << iterationTime[i];
+		}
+		timelineFile << "," << iterationSolverIterations << "," << iterationBytesWritten << std::endl;
+	}
+	else
+	{
+		timelineFile << (firstRecord ? "" : ",\n") << "    {\"iteration\": " << iteration <<
+			", \"time\": " << time << ", \"particles\": " << numParticles;
+		for (int i = 0; i < numStages; i++)
+		{
+			timelineFile << ", \"" << stageName(i) << "\": " << iterationTime[i];
+		}
+		timelineFile << ", \"solverIterations\": " << iterationSolverIterations <<
+			", \"bytesWritten\": " << iterationBytesWritten << "}";
+	}
+	firstRecord = false;
+}
+
+
+// Write summary to timeline file. A CSV timeline is complete once its last
+// record is written, while a JSON timeline is closed with the summary.
+void Instrumentation::finishTimeline()
+{
+	if (parametersList->timelineOutput == "json")
+	{
+		std::ofstream timelineFile(timelineFilename, std::ios::app);
+		timelineFile << std::scientific << std::setprecision(8);
+		timelineFile << std::endl << "  ]," << std::endl;
+		timelineFile << "  \"summary\": {" << std::endl;
+		for (int i = 0; i < numStages; i++)
+		{
+			timelineFile << "    \"" << stageName(i) << "\": {\"calls\": " << stageCalls[i] <<
+				", \"time\": " << stageTime[i] << "}," << std::endl;
+		}
+		timelineFile << "    \"particlesPushed\": " << particlesPushed << "," << std::endl;
+		timelineFile << "    \"solverIterations\": " << solverIterations << "," << std::endl;
+		timelineFile << "    \"bytesWritten\": " << bytesWritten << std::endl;
+		timelineFile << "  }" << std::endl;
+		timelineFile << "}" << std::endl;
+	}
+	parametersList->logBrief("Timeline written to " + timelineFilename, 1);
+}
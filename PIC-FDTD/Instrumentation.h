@@ -0,0 +1,85 @@
+//! \file
+//! \brief Definition of Instrumentation class
+//! \author Rahul Kalampattel
+//! \date Last updated June 2018
+
+#pragma once
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Parameters.h"
+
+//! \enum StageType
+//! \brief Stages of the PIC loop which are timed separately
+enum StageType
+{
+	stageBalance,										//!< Tile load balancing
+	stageProject,										//!< Charge projection
+	stageCurrent,										//!< Esirkepov current deposition
+	stageSolve,											//!< Field solver
+	stageFDTD,											//!< FDTD solver
+	stageInterpolate,									//!< Field interpolation
+	stagePush,											//!< Particle pusher
+	stageMCC,											//!< Monte Carlo collisions
+	stageResample,										//!< Particle merging and splitting
+	stageInject,										//!< Open boundary injection
+	stageOutput,										//!< Tecplot output
+	numStages											//!< Number of timed stages
+};
+
+//! \class Instrumentation
+//! \brief Accumulates per-stage timings and throughput metrics for a patch
+class Instrumentation
+{
+private:
+	// Data members
+	Parameters *parametersList;							//!< Pointer to parameters list
+	int patchID;										//!< ID of patch being instrumented
+	std::string timelineFilename;						//!< Timeline file of this patch, empty if none
+	bool firstRecord = true;							//!< True until a record is written to the timeline
+	std::chrono::steady_clock::time_point stageStart;	//!< Start time of current stage
+	std::vector<double> iterationTime;					//!< Time spent in each stage during current iteration
+	int iterationSolverIterations = 0;					//!< Solver iterations during current iteration
+	long long iterationBytesWritten = 0;				//!< Bytes written during current iteration
+
+
+	// Methods
+	void startTimeline();								//!< Create timeline file and write its header
+	void writeRecord(int iteration, double time,
+		int numParticles);								//!< Append current iteration to timeline file
+	void finishTimeline();								//!< Write summary to timeline file
+
+public:
+	// Data members
+	std::vector<double> stageTime;						//!< Total time spent in each stage
+	std::vector<int> stageCalls;						//!< Number of calls to each stage
+	long long particlesPushed = 0;						//!< Total number of particles pushed
+	long long solverIterations = 0;						//!< Total number of field solver iterations
+	long long bytesWritten = 0;							//!< Total number of bytes written to output files
+	int numIterations = 0;								//!< Number of completed PIC iterations
+
+
+	// Constructor/destructor
+	Instrumentation();									//!< Default constructor
+	Instrumentation(Parameters *parametersList,
+		int patchID);									//!< Constructor
+	~Instrumentation();									//!< Destructor
+
+
+	// Methods
+	static std::string stageName(int stage);			//!< Name of a stage
+	static long long fileSize(std::string filename);	//!< Size of a file in bytes (0 if it does not exist)
+	void startStage();									//!< Start timing a stage
+	void stopStage(int stage);							//!< Stop timing a stage and accumulate result
+	void addParticlesPushed(int numParticles);			//!< Record number of particles pushed
+	void addSolverIterations(int iterations);			//!< Record number of field solver iterations
+	void addBytesWritten(long long bytes);				//!< Record bytes written by an output call
+	void endIteration(int iteration, double time,
+		int numParticles);								//!< Write current iteration to timeline
+	void writeSummary();								//!< Log summary table and complete timeline
+};
@@ -3,6 +3,7 @@
 //  OP2A
 //
 //  Created by Kim M.K. on 06/09/2016.
+//  Last edited by Rahul Kalampattel, June 2018
 //  Copyright © 2016 Kim M.K. All rights reserved.
 //
 #include <limits>
@@ -12,57 +13,36 @@
 #include "../COMM/error_check.hpp"
 
 
-double area_line(matrix& n1, matrix& n2)
+double area_line(const Vec3& n1, const Vec3& n2)
 {
-    // Check type of matrix
-    if (matrix_type(n1) == 1 && matrix_type(n2) == 1)
-    {
-        matrix n12;
-        n12 = n2 - n1;
-    
-        double res = norm(n12, 2);
-        return (res);
-    }
-    else
-    {
-        Common::OP2A_ERROR(FromHere(), 1, 1, __FUNCTION__);
-    }
+    Vec3 n12 = n2 - n1;
     
-    return (-1.0);
+    return (n12.norm());
 }
 
 
-double area_triangle(matrix& n1, matrix& n2, matrix& n3)
+double area_triangle(const Vec3& n1, const Vec3& n2, const Vec3& n3)
 {
-    if (matrix_type(n1) == 1 && matrix_type(n2) == 1 && matrix_type(n3) == 1)
-    {
-        double n12 = area_line(n1, n2);
-        double n23 = area_line(n2, n3);
-        double n31 = area_line(n3, n1);
+    double n12 = area_line(n1, n2);
+    double n23 = area_line(n2, n3);
+    double n31 = area_line(n3, n1);
     
-        double area, s;
+    double area, s;
     
-        s = 0.5 * (n12 + n23 + n31);
-        area	= s * (s-n12) * (s-n23) * (s-n31);
+    s = 0.5 * (n12 + n23 + n31);
+    area	= s * (s-n12) * (s-n23) * (s-n31);
     
-        if (area < 0.0)
-        {
-            Common::OP2A_ERROR2(FromHere(), 3, 20, __FUNCTION__, "area", area);
-            
-        }
-    
-        return (sqrt(area));
-    }
-    else
+    if (area < 0.0)
     {
-        Common::OP2A_ERROR(FromHere(), 1, 1, __FUNCTION__);
+        Common::OP2A_ERROR2(FromHere(), 3, 20, __FUNCTION__, "area", area);
+        
     }
     
-    return (-1.0);
+    return (sqrt(area));
 }
 
 
-double area_quadrilateral(matrix& n1, matrix& n2, matrix& n3, matrix& n4)
+double area_quadrilateral(const Vec3& n1, const Vec3& n2, const Vec3& n3, const Vec3& n4)
 {
     double s1, s2;
     
@@ -74,50 +54,38 @@ double area_quadrilateral(matrix& n1, matrix& n2, matrix& n3, matrix& n4)
 
 
 
-double area_tetrahedron(matrix& n1, matrix& n2, matrix& n3, matrix& n4)
+double area_tetrahedron(const Vec3& n1, const Vec3& n2, const Vec3& n3, const Vec3& n4)
 {
-    if (matrix_type(n1) == 1 &&
-        matrix_type(n2) == 1 &&
-        matrix_type(n3) == 1 &&
-        matrix_type(n4) == 1)
-    {
-        double vol;
+    double vol;
     
-        matrix n41 = n1 - n4;
-        matrix n42 = n2 - n4;
-        matrix n43 = n3 - n4;
+    Vec3 n41 = n1 - n4;
+    Vec3 n42 = n2 - n4;
+    Vec3 n43 = n3 - n4;
     
-        matrix temp = cross(n42, n43);
+    Vec3 temp = cross(n42, n43);
     
-        vol  = dot(n41, temp);
-        vol	= fabs(vol) / 6.0;
-        
-        if (vol < 0.0)
-            Common::OP2A_ERROR2(FromHere(), 3, 20, __FUNCTION__, "vol", vol);
-        
-        if (vol != vol)
-            Common::OP2A_ERROR2(FromHere(), 3, 21, __FUNCTION__, "vol", vol);
-        
-        if (vol == std::numeric_limits<double>::infinity())
-            Common::OP2A_ERROR2(FromHere(), 3, 22, __FUNCTION__, "vol", vol);
-        
-        return (vol);
-    }
-    else
-    {
-        Common::OP2A_ERROR(FromHere(), 1, 1, __FUNCTION__);
-    }
+    vol  = dot(n41, temp);
+    vol	= fabs(vol) / 6.0;
+    
+    if (vol < 0.0)
+        Common::OP2A_ERROR2(FromHere(), 3, 20, __FUNCTION__, "vol", vol);
+    
+    if (vol != vol)
+        Common::OP2A_ERROR2(FromHere(), 3, 21, __FUNCTION__, "vol", vol);
+    
+    if (vol == std::numeric_limits<double>::infinity())
+        Common::OP2A_ERROR2(FromHere(), 3, 22, __FUNCTION__, "vol", vol);
     
-    return (-1.0);
+    return (vol);
 }
 
 
-double area_pyramid(matrix& n1, matrix& n2,  matrix& n3, matrix& n4,  matrix& n5)
+double area_pyramid(const Vec3& n1, const Vec3& n2,  const Vec3& n3, const Vec3& n4,  const Vec3& n5)
 {
     int i;
     double volume;
     
-    matrix n6 (3,1);
+    Vec3 n6;
     
     for (i = 0; i <= 2; i++) n6(i) = 0.25 * (n1(i) + n2(i) + n3(i) + n4(i));
     
@@ -130,10 +98,10 @@ double area_pyramid(matrix& n1, matrix& n2,  matrix& n3, matrix& n4,  matrix& n5
 }
 
 
-double area_prism(matrix& n1, matrix& n2, matrix& n3, matrix& n4, matrix& n5, matrix& n6)
+double area_prism(const Vec3& n1, const Vec3& n2, const Vec3& n3, const Vec3& n4, const Vec3& n5, const Vec3& n6)
 {
     int i;
-    matrix n7(3, 1);
+    Vec3 n7;
     
     double volume;
     
@@ -149,10 +117,10 @@ double area_prism(matrix& n1, matrix& n2, matrix& n3, matrix& n4, matrix& n5, ma
 }
 
 
-double area_hexahedron(matrix& n1, matrix& n2, matrix& n3, matrix& n4, matrix& n5, matrix& n6, matrix& n7, matrix& n8)
+double area_hexahedron(const Vec3& n1, const Vec3& n2, const Vec3& n3, const Vec3& n4, const Vec3& n5, const Vec3& n6, const Vec3& n7, const Vec3& n8)
 {
     int i;
-    matrix n9(3, 1);
+    Vec3 n9;
     double volume;
     
     for (i = 0; i <= 2; i++)	n9(i) = 0.125 * (n1(i) + n2(i) + n3(i) + n4(i) + n5(i) + n6(i) + n7(i) + n8(i));
@@ -170,7 +138,7 @@ double area_hexahedron(matrix& n1, matrix& n2, matrix& n3, matrix& n4, matrix& n
 
 
 
-double calculateArea(std::vector<matrix>& n, int dim, int flag)
+double calculateArea(std::vector<Vec3>& n, int dim, int flag)
 {
     double res = -1.0;
     switch (flag)
@@ -3,6 +3,7 @@
 //  OP2A
 //
 //  Created by Kim M.K. on 06/09/2016.
+//  Last edited by Rahul Kalampattel, June 2018
 //  Copyright © 2016 Kim M.K. All rights reserved.
 //
 
@@ -11,21 +12,21 @@
 
 #include <stdio.h>
 #include <vector>
-#include "matrix.hpp"
+#include "vec.hpp"
 
 
 
 
 
-double area_line(matrix& n1, matrix& n2);
-double area_triangle(matrix& n1, matrix& n2, matrix& n3);
-double area_quadrilateral(matrix& n1, matrix& n2, matrix& n3, matrix& n4);
-double area_tetrahedron(matrix& n1, matrix& n2, matrix& n3, matrix& n4);
-double area_pyramid(matrix& n1, matrix& n2,  matrix& n3, matrix& n4,  matrix& n5);
-double area_prism(matrix& n1, matrix& n2, matrix& n3, matrix& n4, matrix& n5, matrix& n6);
-double area_hexahedron(matrix& n1, matrix& n2, matrix& n3, matrix& n4, matrix& n5, matrix& n6, matrix& n7, matrix& n8);
+double area_line(const Vec3& n1, const Vec3& n2);
+double area_triangle(const Vec3& n1, const Vec3& n2, const Vec3& n3);
+double area_quadrilateral(const Vec3& n1, const Vec3& n2, const Vec3& n3, const Vec3& n4);
+double area_tetrahedron(const Vec3& n1, const Vec3& n2, const Vec3& n3, const Vec3& n4);
+double area_pyramid(const Vec3& n1, const Vec3& n2,  const Vec3& n3, const Vec3& n4,  const Vec3& n5);
+double area_prism(const Vec3& n1, const Vec3& n2, const Vec3& n3, const Vec3& n4, const Vec3& n5, const Vec3& n6);
+double area_hexahedron(const Vec3& n1, const Vec3& n2, const Vec3& n3, const Vec3& n4, const Vec3& n5, const Vec3& n6, const Vec3& n7, const Vec3& n8);
 
 
-double calculateArea(std::vector<matrix>& n, int dim, int flag);
+double calculateArea(std::vector<Vec3>& n, int dim, int flag);
 
 #endif /* cal_area_hpp */
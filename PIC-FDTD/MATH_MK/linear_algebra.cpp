@@ -7,6 +7,7 @@
 //
 #include <iostream>
 #include "linear_algebra.hpp"
+#include "../COMM/error_check.hpp"
 
 
 
@@ -15,7 +15,7 @@ double MathBasic::length(std::vector<double>& a, std::vector<double>& b)
     double len = 0.0;
     int nd = a.size();
     
-    if (b.size() != nd)
+    if (static_cast<int>(b.size()) != nd)
     {
         Common::ExceptionError(FromHere(), "Dimensions of A and B do not match. BOth A and B should have same dimention", Common::ErrorCodes::Mismatch());
     }
@@ -3,17 +3,33 @@
 //  OP2A
 //
 //  Created by Kim M.K. on 25/08/2016.
-//  Last edited by Rahul Kalampattel, March 2018
+//  Last edited by Rahul Kalampattel, June 2018
 //  Copyright © 2016 Kim M.K. All rights reserved.
 //
 
 #define _USE_MATH_DEFINES
 #include <stdio.h>
+#include <algorithm>
+#include <functional>
 #include <omp.h>
 #include "matrix.hpp"
 #include "../COMM/error_check.hpp"
 #include "../COMM/MultiVector.hpp"
+
+// BLAS/LAPACK backend, either through MKL or a system library (USE_BLAS)
+#if defined(USE_MKL)
 #include "mkl.h"
+#define MATRIX_BLAS
+#elif defined(USE_BLAS)
+#include <cblas.h>
+#define MATRIX_BLAS
+
+extern "C"
+{
+    void dgetrf_(const int* m, const int* n, double* a, const int* lda, int* ipiv, int* info);
+    void dgetri_(const int* n, double* a, const int* lda, const int* ipiv, double* work, const int* lwork, int* info);
+}
+#endif
 
 
 // Constructor and Desctructor
@@ -24,23 +40,22 @@ matrix::matrix()
 }
 
 matrix::matrix(const unsigned int i)
-:m_I(i), m_J(1), m_data(i, std::vector<double>(1, 0.0))
+:m_I(i), m_J(1), m_data(i, 0.0)
 {
     
 }
 
 matrix::matrix(const unsigned int i, const unsigned int j)
-:m_I(i), m_J(j), m_data(i, std::vector<double>(j, 0.0))
+:m_I(i), m_J(j), m_data(i*j, 0.0)
 {
     
 }
 
 
 matrix::matrix(const vector2D& data)
+:m_I(0), m_J(0)
 {
-    m_I = data.size();
-    m_J = data[0].size();
-    m_data = data;
+    importData(data);
 }
 
 
@@ -70,8 +85,7 @@ double& matrix::operator() (const unsigned int i)
 }
 
 
-
-double& matrix::operator() (const unsigned int i, const unsigned int j)
+void matrix::exceedLimit(const unsigned int i, const unsigned int j) const
 {
     if (i >= m_I)
     {
@@ -82,43 +96,77 @@ double& matrix::operator() (const unsigned int i, const unsigned int j)
     {
         Common::ExceptionError(FromHere(), "Exceed the column size of a Matrix", Common::ErrorCodes::ExceedLimit());
     }
-        
-    return (m_data[i][j]);
 }
 
 matrix& matrix::operator= (const std::vector< std::vector<double> >& A)
 {
-    if (m_I !=  A.size() || m_J != A[0].size())	resize(A.size(), A[0].size());
-    
-    m_data	= A;
+    importData(A);
     return *this;
 }
 
-
-// Basic Functions
-void matrix::resize(unsigned int i, unsigned int j)
+matrix& matrix::operator+= (const matrix& b)
 {
-    m_I = i;
-    m_J = j;
+    if (m_I != b.m_I || m_J != b.m_J)
+        Common::ExceptionError(FromHere(), "Dimensions do not match", Common::ErrorCodes::MismatchDimension());
+    
+    double* x = m_data.data();
+    const double* y = b.m_data.data();
+    int size = m_data.size();
+    
+#pragma omp simd
+    for (int k = 0; k < size; k++) x[k] += y[k];
     
-    m_data.resize(i);
-    for (int ii = 0; ii <= m_I; ii++) m_data[ii].resize(j);
+    return *this;
 }
 
-unsigned int matrix::sizeRow() const
+matrix& matrix::operator-= (const matrix& b)
 {
-    return (m_I);
+    if (m_I != b.m_I || m_J != b.m_J)
+        Common::ExceptionError(FromHere(), "Dimensions do not match", Common::ErrorCodes::MismatchDimension());
+    
+    double* x = m_data.data();
+    const double* y = b.m_data.data();
+    int size = m_data.size();
+    
+#pragma omp simd
+    for (int k = 0; k < size; k++) x[k] -= y[k];
+    
+    return *this;
 }
 
-unsigned int matrix::sizeCol() const
+matrix& matrix::operator*= (const double b)
 {
-    return (m_J);
+    double* x = m_data.data();
+    int size = m_data.size();
+    
+#pragma omp simd
+    for (int k = 0; k < size; k++) x[k] *= b;
+    
+    return *this;
 }
 
 
-double matrix::element(const unsigned int i, const unsigned int j) const
+// Basic Functions
+void matrix::resize(unsigned int i, unsigned int j)
 {
-    return (m_data[i][j]);
+    if (j == m_J || m_I == 0)
+    {
+        m_data.resize(i*j, 0.0);
+    }
+    else
+    {
+        // Keep existing elements in place when the row length changes
+        std::vector <double, AlignedAllocator<double, MATRIX_ALIGNMENT> > data_temp(i*j, 0.0);
+        
+        for (unsigned int ii = 0; ii < std::min(i, m_I); ii++)
+            for (unsigned int jj = 0; jj < std::min(j, m_J); jj++)
+                data_temp[ii*j + jj] = m_data[ii*m_J + jj];
+        
+        m_data.swap(data_temp);
+    }
+    
+    m_I = i;
+    m_J = j;
 }
 
 
@@ -126,25 +174,9 @@ void matrix::removeRow(unsigned int I)
 {
     if (I >= m_I)	Common::ExceptionError(FromHere(), "Exceed the row size of a Matrix", Common::ErrorCodes::ExceedLimit());
     
-    int inew = 0;
-    std::vector <std::vector <double> >  data_temp(m_I-1, std::vector<double>(m_J)) ;
-    
-    for (int i = 0; i <= m_I-1; i++)
-    {
-        if (i != I)
-        {
-            if (i < I)	inew	 = i;
-            if (i > I)	inew	 = i - 1;
-            
-            for (int j = 0; j <= m_J-1; j++)
-            {
-                data_temp[inew][j] = m_data[i][j];
-            }
-        }
-    }
-    
-    resize(m_I-1, m_J);
-    m_data = data_temp;
+    // Rows are contiguous, so shift everything below row I up by one
+    m_data.erase(m_data.begin() + I*m_J, m_data.begin() + (I+1)*m_J);
+    m_I = m_I - 1;
 }
 
 
@@ -152,25 +184,21 @@ void matrix::removeColumn(unsigned int J)
 {
     if (J >= m_J) Common::ExceptionError(FromHere(), "Exceed the column size of a Matrix", Common::ErrorCodes::ExceedLimit());
     
-    int jnew = 0;
-    std::vector <std::vector <double> >  data_temp(m_I, std::vector<double>(m_J-1)) ;
-    
-    for (int i = 0; i <= m_I-1; i++)
+    int k = 0;
+    for (unsigned int i = 0; i < m_I; i++)
     {
-        for (int j = 0; j <= m_J-1; j++)
+        for (unsigned int j = 0; j < m_J; j++)
         {
             if (j != J)
             {
-                if (j < J)	jnew	 = j;
-                if (j > J)	jnew	 = j - 1;
-                
-                data_temp[i][jnew] = m_data[i][j];
+                m_data[k] = m_data[i*m_J + j];
+                k++;
             }
         }
     }
     
-    resize(m_I, m_J-1);
-    m_data = data_temp;
+    m_J = m_J - 1;
+    m_data.resize(m_I*m_J);
 }
 
 
@@ -178,34 +206,17 @@ void matrix::normalize()
 {
     double res = norm(*this, 2);
     
-    for (int i = 0; i < m_I; i++)
-        for (int j = 0; j < m_J; j++)
-            m_data[i][j] = m_data[i][j] / res;
+    for (unsigned int k = 0; k < m_data.size(); k++)
+        m_data[k] = m_data[k] / res;
 }
 
 
+// Matrices in OP2A are small, so reductions are done serially over the
+// contiguous storage rather than paying for a parallel region each call
 double matrix::sum()
 {
-    std::vector<double> o_sumMP(m_I, 0.0);
-    
-#pragma omp parallel for
-    for (int i = 0; i <= m_I-1; i++)
-    {
-        double sum_temp = 0.0;
-        for (int j = 0; j <= m_J-1; j++)
-        {
-            sum_temp += m_data[i][j];
-        }
-        
-        o_sumMP[i] = sum_temp;
-    }
-    
     double o_sum = 0.0;
-#pragma omp parallel for reduction(+: o_sum)
-    for (int i = 0; i <= m_I-1; i++)
-    {
-        o_sum += o_sumMP[i];
-    }
+    for (unsigned int k = 0; k < m_data.size(); k++) o_sum += m_data[k];
     
     return (o_sum);
 }
@@ -214,23 +225,10 @@ double matrix::sum()
 
 double matrix::max()
 {
-    std::vector<double> o_maxMP(m_I, 0.0);
-    
-#pragma omp parallel for shared (o_maxMP)
-    for (int ii = 0; ii < m_I; ii++)
-    {
-        o_maxMP[ii] = m_data[ii][0];
-        for (int jj = 1; jj < m_J; jj++)
-        {
-            if (m_data[ii][jj] > o_maxMP[ii]) o_maxMP[ii] = m_data[ii][jj];
-        }
-    }
-    
-#pragma omp barrier
-    double res = o_maxMP[0];
-    for (int ii = 1; ii < m_I; ii++)
+    double res = m_data[0];
+    for (unsigned int k = 1; k < m_data.size(); k++)
     {
-        if (o_maxMP[ii] > res)  res = o_maxMP[ii];
+        if (m_data[k] > res)  res = m_data[k];
     }
     
     return res;
@@ -239,22 +237,10 @@ double matrix::max()
 
 double matrix::min()
 {
-    std::vector<double> o_minMP(m_I, 0.0);
-    
-#pragma omp parallel for
-    for (int ii = 0; ii < m_I; ii++)
+    double res = m_data[0];
+    for (unsigned int k = 1; k < m_data.size(); k++)
     {
-        o_minMP[ii] = m_data[ii][0];
-        for (int jj = 1; jj < m_J; jj++)
-        {
-            if (m_data[ii][jj] < o_minMP[ii]) o_minMP[ii] = m_data[ii][jj];
-        }
-    }
-    
-    double res = o_minMP[0];
-    for (int ii = 1; ii < m_I; ii++)
-    {
-        if (o_minMP[ii] < res)  res = o_minMP[ii];
+        if (m_data[k] < res)  res = m_data[k];
     }
     
     return (res);
@@ -263,48 +249,40 @@ double matrix::min()
 
 std::vector < std::vector <double> > matrix::exportData()
 {
-    return(m_data);
+    std::vector < std::vector <double> > data(m_I, std::vector<double>(m_J));
+    
+    for (unsigned int i = 0; i < m_I; i++)
+        for (unsigned int j = 0; j < m_J; j++)
+            data[i][j] = m_data[i*m_J + j];
+    
+    return(data);
 }
 
-void matrix::importData(std::vector < std::vector <double> >& data)
+void matrix::importData(const std::vector < std::vector <double> >& data)
 {
-    m_data = data;
     m_I = data.size();
-    m_J = data[0].size();
+    m_J = (m_I > 0) ? data[0].size() : 0;
+    m_data.resize(m_I*m_J);
+    
+    for (unsigned int i = 0; i < m_I; i++)
+        for (unsigned int j = 0; j < m_J; j++)
+            m_data[i*m_J + j] = data[i][j];
 }
 
 
 double* matrix::extractToPtr() const
 {
-    //std::vector<double> res(m_I * m_J);
     double* res = new double [m_I*m_J];
-    
-    int k = 0;
-    for (int i = 0; i < m_I; i++)
-    {
-        for (int j = 0; j < m_J; j++)
-        {
-            res[k] = m_data[i][j];
-            k++;
-        }
-    }
+    std::copy(m_data.begin(), m_data.end(), res);
     
     return res;
 }
 
 void matrix::assignFromPtr(double* elements, const unsigned int m, const unsigned int n)
 {
-    resize(m, n);
-    
-    int k = 0;
-    for (int i = 0; i < m_I; i++)
-    {
-        for (int j = 0; j < m_J; j++)
-        {
-            m_data[i][j] = elements[k];
-            k++;
-        }
-    }
+    m_I = m;
+    m_J = n;
+    m_data.assign(elements, elements + m*n);
 }
 
 
@@ -313,13 +291,7 @@ void matrix::assignFromPtr(double* elements, const unsigned int m, const unsigne
 // Pre-defined matrix
 void matrix::ones()
 {
-    for (int i = 0; i <= m_I-1; i++)
-    {
-        for (int j = 0; j <= m_J-1; j++)
-        {
-            m_data[i][j] = 1.0;
-        }
-    }
+    std::fill(m_data.begin(), m_data.end(), 1.0);
 }
 
 void matrix::ones(unsigned int i, unsigned int j)
@@ -330,13 +302,7 @@ void matrix::ones(unsigned int i, unsigned int j)
 
 void matrix::zeros()
 {
-    for (int i = 0; i <= m_I-1; i++)
-    {
-        for (int j = 0; j <= m_J-1; j++)
-        {
-            m_data[i][j] = 0.0;
-        }
-    }
+    std::fill(m_data.begin(), m_data.end(), 0.0);
 }
 
 void matrix::zeros(unsigned int i, unsigned int j)
@@ -350,44 +316,21 @@ void matrix::diag()
     if (m_I != m_J)
         Common::ExceptionError(FromHere(), "You need a square matrix to create a diagonal matrix", Common::ErrorCodes::ExceedLimit());
     
-
-    for (int i = 0; i <= m_I-1; i++)
-    {
-        for (int j = 0; j <= m_J-1; j++)
-        {
-            m_data[i][j] = 0.0;
-        }
-        
-        m_data[i][i] = 1.0;
-    }
+    zeros();
+    for (unsigned int i = 0; i < m_I; i++) m_data[i*m_J + i] = 1.0;
 }
 
 void matrix::diag(unsigned int I)
 {
-    resize(I, I);
-    
-    for (int i = 0; i <= m_I-1; i++)
-    {
-        for (int j = 0; j <= m_J-1; j++)
-        {
-            m_data[i][j] = 0.0;
-        }
-        m_data[i][i] = 1.0;
-    }
+    diag(I, 1.0);
 }
 
 void matrix::diag(unsigned int I, double value)
 {
     resize(I, I);
-
-    for (int i = 0; i <= m_I-1; i++)
-    {
-        for (int j = 0; j <= m_J-1; j++)
-        {
-            m_data[i][j] = 0.0;
-        }
-        m_data[i][i] = value;
-    }
+    zeros();
+    
+    for (unsigned int i = 0; i < m_I; i++) m_data[i*m_J + i] = value;
 }
 
 
@@ -403,18 +346,18 @@ matrix& matrix::minorMatrix(const int r, const int c)
 
 void matrix::trans()
 {
-    std::vector< std::vector<double> > data_temp(m_J, std::vector<double>(m_I, 0.0));
+    std::vector <double, AlignedAllocator<double, MATRIX_ALIGNMENT> > data_temp(m_I*m_J);
     
-    for (int ii = 0; ii < m_I ; ii++)
+    for (unsigned int ii = 0; ii < m_I ; ii++)
     {
-        for (int jj = 0; jj < m_J; jj++)
+        for (unsigned int jj = 0; jj < m_J; jj++)
         {
-            data_temp[jj][ii] = m_data[ii][jj];
+            data_temp[jj*m_I + ii] = m_data[ii*m_J + jj];
         }
     }
     
     
-    m_data = data_temp;
+    m_data.swap(data_temp);
     
     int tempI = m_I;
     m_I = m_J;
@@ -430,11 +373,11 @@ void matrix::showData()
     std::cout << "Coloumn size: " << m_J << std::endl;
     std::cout << "Matrix data:"   << std::endl;
     
-    for (int i= 0; i < m_data.size(); i++)
+    for (unsigned int i = 0; i < m_I; i++)
     {
-        for (int j = 0; j < m_data[i].size(); j++)
+        for (unsigned int j = 0; j < m_J; j++)
         {
-            std::cout << m_data[i][j] << "  ";
+            std::cout << m_data[i*m_J + j] << "  ";
         }
         std::cout << std::endl;
     }
@@ -444,157 +387,62 @@ void matrix::showData()
 
 
 //Operators
-matrix operator +(const matrix& a, const matrix& b)
+matrix operator +(matrix a, const matrix& b)
 {
-    int i, j;
-    matrix res;
-    
-    if (a.sizeRow() == b.sizeRow() && a.sizeCol() == b.sizeCol())
-    {
-        res = a;
-        for (i = 0; i < a.sizeRow(); i++)
-        {
-            for (j = 0;  j < a.sizeCol(); j++)
-            {
-                res(i,j) = res(i,j) + b.element(i,j);
-            }
-        }
-    }
-    else
-    {
-        Common::ExceptionError(FromHere(), "Dimensions do not match", Common::ErrorCodes::MismatchDimension());
-    }
-    
-    return res;
+    a += b;
+    return a;
 }
 
-matrix operator +(const matrix& a, const double b)
+matrix operator +(matrix a, const double b)
 {
-    int i, j;
-    matrix res = a;
+    double* x = a.data();
+    int size = a.sizeRow() * a.sizeCol();
     
-    for (i = 0; i < a.sizeRow(); i++)
-    {
-        for (j = 0;  j < a.sizeCol(); j++)
-        {
-            res(i,j) = res(i,j) + b;
-        }
-    }
+    for (int k = 0; k < size; k++) x[k] = x[k] + b;
     
-    return res;
+    return a;
 }
 
-matrix operator+ (const double a, const matrix& b)
+matrix operator+ (const double a, matrix b)
 {
-    int i, j;
-    matrix res = b;
+    double* x = b.data();
+    int size = b.sizeRow() * b.sizeCol();
     
-    for (i = 0; i < b.sizeRow(); i++)
-    {
-        for (j = 0;  j < b.sizeCol(); j++)
-        {
-            res(i,j) = res(i,j) + a;
-        }
-    }
+    for (int k = 0; k < size; k++) x[k] = x[k] + a;
     
-    return res;
+    return b;
 }
 
 
-matrix operator -(const matrix& a, const matrix& b)
+matrix operator -(matrix a, const matrix& b)
 {
-    int i, j;
-    matrix res;
-    
-    if (a.sizeRow() == b.sizeRow() && a.sizeCol() == b.sizeCol())
-    {
-        res = a;
-        for (i = 0; i < a.sizeRow(); i++)
-        {
-            for (j = 0;  j < a.sizeCol(); j++)
-            {
-                res(i,j) = res(i,j) - b.element(i,j);
-            }
-        }
-    }
-    else
-    {
-        Common::ExceptionError(FromHere(), "Dimensions do not match", Common::ErrorCodes::MismatchDimension());
-    }
-    
-    return res;
+    a -= b;
+    return a;
 }
 
 
-matrix operator -(const matrix& a, const double b)
+matrix operator -(matrix a, const double b)
 {
-    int i, j;
-    matrix res = a;
+    double* x = a.data();
+    int size = a.sizeRow() * a.sizeCol();
     
-    for (i = 0; i < a.sizeRow(); i++)
-    {
-        for (j = 0;  j < a.sizeCol(); j++)
-        {
-            res(i,j) = res(i,j) - b;
-        }
-    }
+    for (int k = 0; k < size; k++) x[k] = x[k] - b;
     
-    return res;
+    return a;
 }
 
-matrix operator- (const double a, const matrix& b)
+matrix operator- (const double a, matrix b)
 {
-    int i, j;
-    matrix res = b;
+    double* x = b.data();
+    int size = b.sizeRow() * b.sizeCol();
     
-    for (i = 0; i < b.sizeRow(); i++)
-    {
-        for (j = 0;  j < b.sizeCol(); j++)
-        {
-            res(i,j) = a - res(i,j);
-        }
-    }
+    for (int k = 0; k < size; k++) x[k] = a - x[k];
     
-    return res;
+    return b;
 }
 
 
 
-#ifdef USE_MKL
-matrix operator* (const matrix& a, const matrix& b)
-{
-    int m, n, k;
-    double alpha, beta;
-    
-    alpha	= 1.0;
-    beta	= 0.0;
-    
-    double* res_elements;
-    double* a_elements;
-    double* b_elements;
-    
-    a_elements = a.extractToPtr();
-    b_elements = b.extractToPtr();
-    
-    if (a.sizeCol() == b.sizeRow())
-    {
-        m	= a.sizeRow();
-        k	= a.sizeCol();
-        n	= b.sizeCol();
-        
-        cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k, alpha, a_elements, k, b_elements, n, beta, res_elements, n);
-    }
-    else
-    {
-        Common::ExceptionError(FromHere(), "Dimensions do not match", Common::ErrorCodes::MismatchDimension());
-    }
-    
-    matrix res;
-    res.assignFromPtr(res_elements, m, n);
-    return res;
-}
-
-#else
 matrix operator* (const matrix& a, const matrix& b)
 {
     int m, n, k;
@@ -608,19 +456,28 @@ matrix operator* (const matrix& a, const matrix& b)
         
         res.resize(m, n);
         
-//#pragma omp parallel for
+#ifdef MATRIX_BLAS
+        // Storage is already contiguous and row-major, so it is passed to BLAS directly
+        if (m > 0 && n > 0 && k > 0)
+        {
+            cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k, 1.0, a.data(), k, b.data(), n, 0.0, res.data(), n);
+        }
+#else
+        const double* A = a.data();
+        const double* B = b.data();
+        double* C = res.data();
+        
+        // i-k-j ordering, so the inner loop runs along rows of B and C
         for (int i = 0; i < m; i++)
         {
-//#pragma ivdep
-        for (int j = 0; j < n; j++)
+            for (int ii = 0; ii < k; ii++)
             {
-                double temp1 = 0.0;
-                for (int ii = 0; ii < k;ii++) temp1 += a.element(i,ii)*b.element(ii, j);
-                
-                res(i,j) = temp1;
+                double aik = A[i*k + ii];
+#pragma omp simd
+                for (int j = 0; j < n; j++) C[i*n + j] += aik * B[ii*n + j];
             }
         }
-        
+#endif
     }
     else
     {
@@ -629,57 +486,23 @@ matrix operator* (const matrix& a, const matrix& b)
     
     return res;
 }
-#endif
 
 
-matrix operator* (const matrix& a, const double b)
+matrix operator* (matrix a, const double b)
 {
-    matrix res = a;
-    int m = res.sizeRow();
-    int n = res.sizeCol();
-    for (int i = 0; i < m; i++)
-    {
-        for (int  j= 0; j < n; j++)
-        {
-            res(i,j) = res.element(i,j) * b;
-        }
-    }
-    
-    return res;
+    a *= b;
+    return a;
 }
 
 
-matrix operator* (const double a, const matrix& b)
+matrix operator* (const double a, matrix b)
 {
-    matrix res = b;
-    int m = res.sizeRow();
-    int n = res.sizeCol();
+    double* x = b.data();
+    int size = b.sizeRow() * b.sizeCol();
     
-    for (int i = 0; i < m; i++)
-    {
-        for (int  j= 0; j < n; j++)
-        {
-            res(i,j) = a * res.element(i,j);
-        }
-    }
+    for (int k = 0; k < size; k++) x[k] = a * x[k];
     
-    return res;
-}
-
-
-matrix operator*= (matrix& a, double b)
-{
-	int m = a.sizeRow();
-	int n = a.sizeCol();
-	for (int i = 0; i < m; i++)
-	{
-		for (int j = 0; j < n; j++)
-		{
-			a(i, j) = a.element(i, j) * b;
-		}
-	}
-
-	return a;
+    return b;
 }
 
 
@@ -694,6 +517,43 @@ matrix  minorMatrix(const matrix&a, const int r, const int c)
 
 
 
+// LU decomposition with partial pivoting, in place on row-major storage.
+// Returns the sign of the row permutation, or 0 if the matrix is singular
+static int luDecompose(double* A, int m, int* ipiv)
+{
+    int sign = 1;
+    
+    for (int k = 0; k < m; k++)
+    {
+        int p = k;
+        for (int i = k+1; i < m; i++)
+        {
+            if (fabs(A[i*m + k]) > fabs(A[p*m + k])) p = i;
+        }
+        
+        ipiv[k] = p;
+        if (A[p*m + k] == 0.0) return 0;
+        
+        if (p != k)
+        {
+            std::swap_ranges(A + k*m, A + (k+1)*m, A + p*m);
+            sign = -sign;
+        }
+        
+        for (int i = k+1; i < m; i++)
+        {
+            double factor = A[i*m + k] / A[k*m + k];
+            A[i*m + k] = factor;
+            
+#pragma omp simd
+            for (int j = k+1; j < m; j++) A[i*m + j] -= factor * A[k*m + j];
+        }
+    }
+    
+    return sign;
+}
+
+
 double det(const matrix& a)
 {
     int m = a.sizeRow();
@@ -713,7 +573,7 @@ double det(const matrix& a)
     {
         res = a.element(0,0)*a.element(1,1) - a.element(0,1)*a.element(1,0);
     }
-    else if (m <= 5)
+    else if (m == 3)
     {
         for (int c = 0; c < n; c++)
         {
@@ -722,21 +582,17 @@ double det(const matrix& a)
             double temp1 = pow(-1.0, c);
             double temp2 = det(tempM);
             
-            res += temp1 * a.element(0, c) * temp2;  // faster than with pow()
+            res += temp1 * a.element(0, c) * temp2;
         }
     }
     else
     {
-#pragma omp parallel for reduction(+: res)
-        for (int i = 0; i < m-1; i++)
-        {
-            matrix tempMatrix = minorMatrix(a, 0, i);
-    
-            double temp1 = pow(-1.0, i);
-            double temp2 = det(tempMatrix);
-            
-            res += temp1*a.element(0, i) * temp2;
-        }
+        // Cofactor expansion grows factorially, so larger matrices go through LU
+        matrix LU = a;
+        std::vector<int> ipiv(m);
+        
+        res = luDecompose(LU.data(), m, ipiv.data());
+        for (int i = 0; i < m; i++) res *= LU.element(i, i);
     }
 
     Common::ErrorCheck::NumericValue(FromHere(), "Determinant of a matric:", res);
@@ -749,7 +605,7 @@ matrix confactor(const matrix& a)
 {
     int m = a.sizeRow();
     
-    if (m != a.sizeCol())
+    if (m != static_cast<int>(a.sizeCol()))
         Common::ExceptionError(FromHere(), "Matrix should be a square matrix to calculate confactor matrix", Common::ErrorCodes::ExceedLimit());
     
     if (m == 0)
@@ -757,18 +613,14 @@ matrix confactor(const matrix& a)
     
     matrix res(m, m);
     
-#pragma omp parallel
+    for (int i = 0; i < m; i++)
     {
-        for (int i = 0; i < m; i++)
+        for (int j = 0; j < m; j++)
         {
-#pragma ivdep
-            for (int j = 0; j < m; j++)
-            {
-                matrix a_minor = minorMatrix(a, i, j);
-                double d = det(a_minor);
-                
-                res(i,j) = pow(-1.0, i+j) * d;
-            }
+            matrix a_minor = minorMatrix(a, i, j);
+            double d = det(a_minor);
+            
+            res(i,j) = pow(-1.0, i+j) * d;
         }
     }
     
@@ -778,22 +630,8 @@ matrix confactor(const matrix& a)
 
 matrix adjoint(const matrix& a)
 {
-    int m = a.sizeRow();
-
-    matrix res(m , m);
-    matrix ap = confactor(a);
-    
-#pragma omp parallel
-    {
-        for (int i = 0; i < m; i++)
-        {
-#pragma ivdep
-            for (int j = 0; j < m; j++)
-            {
-                res(i, j) = ap(j, i);
-            }
-        }
-    }
+    matrix res = confactor(a);
+    res.trans();
     
     return res;
 }
@@ -803,50 +641,60 @@ matrix inv(const matrix &a)
 {
     int m = a.sizeRow();
     
-    matrix res(m, m);
-    double 	d = det(a);
+    if (m != static_cast<int>(a.sizeCol())) Common::ExceptionError(FromHere(), "Square matrix required for Inv", Common::ErrorCodes::MismatchDimension());
     
+    matrix res(m, m);
     
     if (m == 1)		// 1 X 1 MATRIX
     {
-        res(0,0) = 1/d;
+        res(0,0) = 1/det(a);
     }
     else if (m == 2)	// 2 X 2 MATRIX
     {
+        double 	d = det(a);
+        
         res(0,0) =  a.element(1,1) / d;
         res(0,1) = -a.element(0,1) / d;
         
         res(1,0) = -a.element(1,0) / d;
         res(1,1) =  a.element(0,0) / d;
     }
-    else if (m <= 5)
+    else if (m == 3)
     {
         // IT USES ADJOINT METHOD
-        matrix ai = adjoint(a);
-        
-        for (int i = 0; i <= m-1; i++)
-        {
-            for (int j = 0; j <= m-1; j++)
-            {
-                res(i,j)	= ai(i,j) / d;
-            }
-        }
+        double 	d = det(a);
+        res = adjoint(a);
+        res *= 1.0 / d;
     }
     else
     {
-        // IT USES ADJOINT METHOD
-        matrix ai = adjoint(a);
+        // LU decomposition, then solve for each column of the identity
+        matrix LU = a;
+        std::vector<int> ipiv(m);
+        
+        if (luDecompose(LU.data(), m, ipiv.data()) == 0)
+            Common::ExceptionError(FromHere(), "Matrix is singular", Common::ErrorCodes::Inf());
         
-#pragma omp parallel
+        const double* A = LU.data();
+        std::vector<double> x(m);
+        
+        for (int c = 0; c < m; c++)
         {
-            for (int i = 0; i <= m-1; i++)
+            std::fill(x.begin(), x.end(), 0.0);
+            x[c] = 1.0;
+            
+            for (int k = 0; k < m; k++) std::swap(x[k], x[ipiv[k]]);
+            
+            for (int i = 1; i < m; i++)
+                for (int j = 0; j < i; j++) x[i] -= A[i*m + j] * x[j];
+            
+            for (int i = m-1; i >= 0; i--)
             {
-#pragma ivdep
-                for (int j = 0; j <= m-1; j++)
-                {
-                    res(i,j)	= ai(i,j) / d;
-                }
+                for (int j = i+1; j < m; j++) x[i] -= A[i*m + j] * x[j];
+                x[i] /= A[i*m + i];
             }
+            
+            for (int i = 0; i < m; i++) res(i, c) = x[i];
         }
     }
     
@@ -856,28 +704,27 @@ matrix inv(const matrix &a)
 matrix inv2(const matrix& a)
 {
     int m = a.sizeRow();
-    if (m != a.sizeCol()) Common::ExceptionError(FromHere(), "Square matrix required for Inv", Common::ErrorCodes::MismatchDimension());
+    if (m != static_cast<int>(a.sizeCol())) Common::ExceptionError(FromHere(), "Square matrix required for Inv", Common::ErrorCodes::MismatchDimension());
 
-    matrix res(m,m);
-    
-    int i, j;
+#ifdef MATRIX_BLAS
+    matrix res = a;
     
     int info  = 0;
-    int *ipiv = new int [m+1];
     int lwork = m * m;
-    double *work	= new double [lwork];
-    double *element;
+    std::vector<int> ipiv(m+1);
+    std::vector<double> work(lwork);
     
-    element = a.extractToPtr();
-    dgetrf(&m, &m, element, &m, ipiv, &info);
-    dgetri(&m, element, &m, ipiv, work, &lwork, &info);
-    res.assignFromPtr(element, m, m);
+    // LAPACK is column-major, but the inverse of the transpose is the
+    // transpose of the inverse, so the row-major storage is used in place
+    dgetrf_(&m, &m, res.data(), &m, ipiv.data(), &info);
+    dgetri_(&m, res.data(), &m, ipiv.data(), work.data(), &lwork, &info);
     
-    delete[] ipiv;
-    delete[] work;
-    delete[] element;
+    if (info != 0) Common::ExceptionError(FromHere(), "Matrix is singular", Common::ErrorCodes::Inf());
     
     return (res);
+#else
+    return (inv(a));
+#endif
 }
 
 
@@ -889,9 +736,9 @@ void block_tri_diagonal_decomp(matrix *A, matrix *B, matrix *C, int NB)
         int m_b = B[i].sizeRow();
         int m_c = C[i].sizeRow();
     
-        if (m_a != A[i].sizeCol()) Common::ExceptionError(FromHere(), "The Block matrices[A] should be square", Common::ErrorCodes::MismatchDimension());
-        if (m_b != B[i].sizeCol()) Common::ExceptionError(FromHere(), "The Block matrices[B] should be square", Common::ErrorCodes::MismatchDimension());
-        if (m_c != C[i].sizeCol()) Common::ExceptionError(FromHere(), "The Block matrices[C] should be square", Common::ErrorCodes::MismatchDimension());
+        if (m_a != static_cast<int>(A[i].sizeCol())) Common::ExceptionError(FromHere(), "The Block matrices[A] should be square", Common::ErrorCodes::MismatchDimension());
+        if (m_b != static_cast<int>(B[i].sizeCol())) Common::ExceptionError(FromHere(), "The Block matrices[B] should be square", Common::ErrorCodes::MismatchDimension());
+        if (m_c != static_cast<int>(C[i].sizeCol())) Common::ExceptionError(FromHere(), "The Block matrices[C] should be square", Common::ErrorCodes::MismatchDimension());
     }
     
     // LU Decomposition for Block-tridiagonal matrix
@@ -904,18 +751,13 @@ void block_tri_diagonal_decomp(matrix *A, matrix *B, matrix *C, int NB)
     //   = |0  0   I  C3 0|
     
     // Step 2: Get C_1
-    matrix B1_inv = inv(B[1]);
-    C[1] = B1_inv * C[1];
+    C[1] = inv(B[1]) * C[1];
     
     // Step 3: for other boundaries
-#pragma ivdep
     for (int i = 2; i <= NB; i++)
     {
-        matrix AC = A[i]*C[i-1];
-        B[i] = B[i] - AC;
-        
-        matrix Binv = inv(B[i]);
-        C[i] = Binv * C[i];
+        B[i] -= A[i]*C[i-1];
+        C[i] = inv(B[i]) * C[i];
     }
 }
 
@@ -939,30 +781,20 @@ void block_tri_diagonal_solver(matrix *A, matrix *B, matrix *C, matrix *R, matri
     block_tri_diagonal_decomp(A, B, C, NB);
     
     // Step 3:: Forward substitution
-    matrix *Y;
-    Y	= new matrix [NB+1];
-    for (int i = 0; i <= NB; i++)	Y[i].zeros(m, 1);
+    std::vector<matrix> Y(NB+1, matrix(m, 1));
     
-    matrix Binv;
-    
-    Binv = inv(B[1]);
-    Y[1] = Binv * R[1];
+    Y[1] = inv(B[1]) * R[1];
     
     for (int i = 2;  i <= NB; i++)
     {
-        Binv = inv(B[i]);
-        matrix aux1 = A[i]*Y[i-1];
-        matrix aux2 = R[i] - aux1;
-        Y[i] = Binv * aux2;
+        Y[i] = inv(B[i]) * (R[i] - A[i]*Y[i-1]);
     }
     
     // Step 4:: Backward substitution
     X[NB]	= Y[NB];
     for (int i = NB-1; i >= 1; i--)
     {
-        matrix aux3;
-        aux3 = C[i] * X[i+1];
-        X[i]= Y[i] - aux3;
+        X[i] = Y[i] - C[i] * X[i+1];
     }
 }
 
@@ -1027,7 +859,7 @@ void rot2D(const double ang, matrix& res)
 
 void rotx(const double ang, bool is_degree, matrix& res)
 {
-    double rad;
+    double rad = ang;
     
     if(is_degree == true)   rad = ang * M_PI/180.0;
     rotx(rad, res);
@@ -1036,21 +868,21 @@ void rotx(const double ang, bool is_degree, matrix& res)
 
 void roty(const double ang, bool is_degree, matrix& res)
 {
-    double rad;
+    double rad = ang;
     if(is_degree == true)   rad = ang * M_PI/180.0;
     roty(rad, res);
 }
 
 void rotz(const double ang, bool is_degree, matrix& res)
 {
-    double rad;
+    double rad = ang;
     if(is_degree == true)   rad = ang * M_PI/180.0;
     rotz(rad, res);
 }
 
 void rot2D(const double ang, bool is_degree, matrix& res)
 {
-    double rad;
+    double rad = ang;
     if(is_degree == true)   rad = ang * M_PI/180.0;
     
     rot2D(rad, res);
@@ -1062,10 +894,10 @@ double dot(const matrix& a, const matrix& b)
     int m = a.sizeRow();
     int n = a.sizeCol();
     
-    if (m != b.sizeRow())
+    if (m != static_cast<int>(b.sizeRow()))
         Common::ExceptionError(FromHere(), "A and B must be same size", Common::ErrorCodes::MismatchDimension());
     
-    if (n != b.sizeCol())
+    if (n != static_cast<int>(b.sizeCol()))
         Common::ExceptionError(FromHere(), "A and B must be same size", Common::ErrorCodes::MismatchDimension());
 
     for (int ii = 0; ii < m; ii++)
@@ -1084,10 +916,10 @@ matrix cross(const matrix& a, const matrix& b)
     int m = a.sizeRow();
     int n = a.sizeCol();
     
-    if (m != b.sizeRow())
+    if (m != static_cast<int>(b.sizeRow()))
         Common::ExceptionError(FromHere(), "A and B must be same size", Common::ErrorCodes::MismatchDimension());
     
-    if (n != b.sizeCol())
+    if (n != static_cast<int>(b.sizeCol()))
         Common::ExceptionError(FromHere(), "A and B must be same size", Common::ErrorCodes::MismatchDimension());
 
     matrix res(m, n);
@@ -1131,16 +963,16 @@ matrix normalFromThreePoints(const matrix& a, const matrix&b, const matrix&c)
     int m = a.sizeRow();
     int n = a.sizeCol();
     
-    if (m != b.sizeRow())
+    if (m != static_cast<int>(b.sizeRow()))
         Common::ExceptionError(FromHere(), "A and B must be same size", Common::ErrorCodes::MismatchDimension());
     
-    if (n != b.sizeCol())
+    if (n != static_cast<int>(b.sizeCol()))
         Common::ExceptionError(FromHere(), "A and B must be same size", Common::ErrorCodes::MismatchDimension());
 
-    if (m != c.sizeRow())
+    if (m != static_cast<int>(c.sizeRow()))
         Common::ExceptionError(FromHere(), "A and C must be same size", Common::ErrorCodes::MismatchDimension());
     
-    if (n != c.sizeCol())
+    if (n != static_cast<int>(c.sizeCol()))
         Common::ExceptionError(FromHere(), "A and C must be same size", Common::ErrorCodes::MismatchDimension());
 
     
@@ -1169,9 +1001,6 @@ void svdMatrix(matrix& a, matrix& res)
 {
     int m = a.sizeRow();
     int n = a.sizeCol();
-    int lda = n;
-    int ldu = m;
-    int ldvt = n;
     int lds = min<int>(m,n);
     
     // Setup buffers to hold the matrices U, sigma and Vt:
@@ -1180,12 +1009,17 @@ void svdMatrix(matrix& a, matrix& res)
     std::vector<double>  u(m*m);
     std::vector<double> vt(n*n);
     
+#ifdef USE_MKL
+    int lda = n;
+    int ldu = m;
+    int ldvt = n;
     double*  A = a.extractToPtr();
     
     
     // Compute SVD
     int info;
     info = LAPACKE_dgesvd(LAPACK_ROW_MAJOR, 'A', 'A', m, n, A, lda, s.data(), u.data(), ldu, vt.data(), ldvt, superb.data());
+    delete [] A;
    
     
     // Check for convergence
@@ -1194,6 +1028,57 @@ void svdMatrix(matrix& a, matrix& res)
         printf( "The algorithm computing SVD failed to converge.\n" );
         exit( 1 );
     }
+#else
+    // Without LAPACK, the singular values are found as the square roots of the
+    // eigenvalues of A^T A (or A A^T), using cyclic Jacobi rotations
+    int p = min<int>(m,n);
+    std::vector<double> B(p*p, 0.0);
+    for (int i = 0; i < p; i++)
+    {
+        for (int j = 0; j < p; j++)
+        {
+            if (n <= m) for (int k = 0; k < m; k++) B[i*p+j] += a.element(k,i) * a.element(k,j);
+            else        for (int k = 0; k < n; k++) B[i*p+j] += a.element(i,k) * a.element(j,k);
+        }
+    }
+    
+    for (int sweep = 0; sweep < 100; sweep++)
+    {
+        double offDiagonal = 0.0;
+        for (int i = 0; i < p; i++)
+            for (int j = i+1; j < p; j++) offDiagonal += B[i*p+j] * B[i*p+j];
+        if (offDiagonal < 1.0e-30) break;
+        
+        for (int i = 0; i < p; i++)
+        {
+            for (int j = i+1; j < p; j++)
+            {
+                if (B[i*p+j] == 0.0) continue;
+                
+                double theta = 0.5 * (B[j*p+j] - B[i*p+i]) / B[i*p+j];
+                double t = (theta >= 0.0 ? 1.0 : -1.0) / (fabs(theta) + sqrt(theta*theta + 1.0));
+                double c = 1.0 / sqrt(t*t + 1.0);
+                double sn = t * c;
+                
+                for (int k = 0; k < p; k++)
+                {
+                    double bki = B[k*p+i], bkj = B[k*p+j];
+                    B[k*p+i] = c*bki - sn*bkj;
+                    B[k*p+j] = sn*bki + c*bkj;
+                }
+                for (int k = 0; k < p; k++)
+                {
+                    double bik = B[i*p+k], bjk = B[j*p+k];
+                    B[i*p+k] = c*bik - sn*bjk;
+                    B[j*p+k] = sn*bik + c*bjk;
+                }
+            }
+        }
+    }
+    
+    for (int i = 0; i < p; i++) s[i] = sqrt(std::max(B[i*p+i], 0.0));
+    std::sort(s.begin(), s.end(), std::greater<double>());
+#endif
     
     
     res.resize(1, lds);
@@ -1393,10 +1278,10 @@ matrix vectorStartEnd(const matrix& s, const matrix& e)
     int m = s.sizeRow();
     int n = s.sizeCol();
     
-    if (m != e.sizeRow())
+    if (m != static_cast<int>(e.sizeRow()))
         Common::ExceptionError(FromHere(), "A and B must be same size", Common::ErrorCodes::MismatchDimension());
     
-    if (n != e.sizeCol())
+    if (n != static_cast<int>(e.sizeCol()))
         Common::ExceptionError(FromHere(), "A and B must be same size", Common::ErrorCodes::MismatchDimension());
     
     matrix res(m, n);
@@ -3,7 +3,7 @@
 //  OP2A
 //
 //  Created by Kim M.K. on 25/08/2016.
-//  Last edited by Rahul Kalampattel, March 2018
+//  Last edited by Rahul Kalampattel, June 2018
 //  Copyright © 2016 Kim M.K. All rights reserved.
 //
 
@@ -11,8 +11,17 @@
 #define matrix_h
 
 
+#include <cstddef>
+#include <cstdlib>
+#include <new>
 #include <vector>
 #include <cmath>
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+
+#define MATRIX_ALIGNMENT 64     // Alignment of matrix storage in bytes (one cache line)
 
 
 template <class T>
@@ -31,6 +40,53 @@ T max (const T& a, const T& b)
 
 
 
+// Allocator returning storage aligned to an Alignment-byte boundary
+template <class T, std::size_t Alignment>
+class AlignedAllocator{
+public:
+    typedef T value_type;
+    
+    template <class U>
+    struct rebind { typedef AlignedAllocator<U, Alignment> other; };
+    
+    AlignedAllocator() {}
+    
+    template <class U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) {}
+    
+    T* allocate(std::size_t n)
+    {
+        if (n == 0) return NULL;
+        
+        void* p = NULL;
+#ifdef _WIN32
+        p = _aligned_malloc(n * sizeof(T), Alignment);
+#else
+        if (posix_memalign(&p, Alignment, n * sizeof(T)) != 0) p = NULL;
+#endif
+        if (p == NULL) throw std::bad_alloc();
+        return static_cast<T*>(p);
+    }
+    
+    void deallocate(T* p, std::size_t)
+    {
+#ifdef _WIN32
+        _aligned_free(p);
+#else
+        free(p);
+#endif
+    }
+};
+
+template <class T, class U, std::size_t Alignment>
+bool operator== (const AlignedAllocator<T, Alignment>&, const AlignedAllocator<U, Alignment>&) { return true; }
+
+template <class T, class U, std::size_t Alignment>
+bool operator!= (const AlignedAllocator<T, Alignment>&, const AlignedAllocator<U, Alignment>&) { return false; }
+
+
+
+// Dense matrix, stored row-major in a single aligned block
 class matrix{
     
     // Consructor and Destructor
@@ -45,17 +101,28 @@ public:
     // Basic operators
 public:
     double& operator() (const unsigned int i);
-    double& operator() (const unsigned int i, const unsigned int j);
+    
+    double& operator() (const unsigned int i, const unsigned int j)
+    {
+        if (i >= m_I || j >= m_J) exceedLimit(i, j);
+        return (m_data[i*m_J + j]);
+    }
+    
     matrix&	operator= (const std::vector< std::vector<double> >& A);
+    matrix& operator+= (const matrix& b);
+    matrix& operator-= (const matrix& b);
+    matrix& operator*= (const double b);
     
     
     
     // Basic functions
 public:
     void resize(unsigned int I, unsigned int J);
-    unsigned int sizeRow() const;
-    unsigned int sizeCol() const;
-    double element(const unsigned int i, const unsigned int j) const;
+    unsigned int sizeRow() const { return (m_I); }
+    unsigned int sizeCol() const { return (m_J); }
+    double element(const unsigned int i, const unsigned int j) const { return (m_data[i*m_J + j]); }
+    double* data()             { return (m_data.data()); }
+    const double* data() const { return (m_data.data()); }
     void removeRow(unsigned int I);
     void removeColumn(unsigned int J);
     void normalize();
@@ -65,7 +132,7 @@ public:
     
 
     std::vector <std::vector <double> > exportData();
-    void importData(std::vector < std::vector <double> >& data);
+    void importData(const std::vector < std::vector <double> >& data);
     
     double* extractToPtr() const;
     void assignFromPtr(double* elements, const unsigned int m, const unsigned int n);
@@ -93,30 +160,33 @@ public:
 public:
     void showData();
     
+private:
+    void exceedLimit(const unsigned int i, const unsigned int j) const;
+    
     
     
 // DATA set
 protected:
     unsigned int m_I;
     unsigned int m_J;
-    std::vector < std::vector<double> > m_data;
+    std::vector <double, AlignedAllocator<double, MATRIX_ALIGNMENT> > m_data;
 };
 
 
-// Operators
-matrix operator+ (const matrix& a, const matrix& b);
-matrix operator+ (const matrix& a, const double b);
-matrix operator+ (const double a, const matrix& b);
+// Operators (arguments taken by value are reused for the result, so chained
+// expressions move their temporaries instead of copying them)
+matrix operator+ (matrix a, const matrix& b);
+matrix operator+ (matrix a, const double b);
+matrix operator+ (const double a, matrix b);
 
-matrix operator- (const matrix& a, const matrix& b);
-matrix operator- (const matrix& a, const double b);
-matrix operator- (const double a, const matrix& b);
+matrix operator- (matrix a, const matrix& b);
+matrix operator- (matrix a, const double b);
+matrix operator- (const double a, matrix b);
 
 matrix operator* (const matrix& a, const matrix& b);
-matrix operator* (const matrix& a, const double b);
-matrix operator* (const double a, const matrix& b);
+matrix operator* (matrix a, const double b);
+matrix operator* (const double a, matrix b);
 
-matrix operator*= (matrix& a, double b);
 
 // Linear algebra functions
 matrix minorMatrix(const matrix&a, const int r, const int c);
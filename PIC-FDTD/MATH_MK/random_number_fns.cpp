@@ -10,16 +10,30 @@
 
 
 #include <stdio.h>
+#include <string.h>
 #include <iostream>
 #include <omp.h>
+#ifdef USE_MKL
 #include "mkl.h"
 #include "mkl_vsl_types.h"
+#else
+#include <random>
+#endif
 
 
 
 static unsigned int seed = 0x11111111;
+#ifdef USE_MKL
 static VSLStreamStatePtr stream;
 static bool m_rand_flag = false;
+#else
+// Without MKL, each thread draws from its own Mersenne Twister stream
+static std::mt19937_64& threadGenerator()
+{
+    static thread_local std::mt19937_64 generator(std::random_device{}() + omp_get_thread_num());
+    return generator;
+}
+#endif
 
 float* ranf_OMP(int N, int ncore)
 {
@@ -46,6 +60,7 @@ float* ranf_OMP(int N, int ncore)
     float *buff = new float[N];
     
     
+#ifdef USE_MKL
     // Creating and Initializeing Random streams
     vslNewStream(&stream, VSL_BRNG_MCG59, VSL_BRNG_RDRAND);
     
@@ -56,6 +71,14 @@ float* ranf_OMP(int N, int ncore)
         vslSkipAheadStream(stream, nskip*i);
         vsRngUniform(VSL_RNG_METHOD_UNIFORM_STD, stream, n_rand[i], (float*)&(buff[n_start[i]]), 0.0f, 1.0f);
     }
+#else
+#pragma omp parallel for num_threads(ncore)
+    for (int i = 0; i <= ncore-1; i++)
+    {
+        std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+        for (int j = 0; j < n_rand[i]; j++) buff[n_start[i] + j] = dist(threadGenerator());
+    }
+#endif
     
     return (buff);
 }
@@ -66,9 +89,9 @@ float* ranf_OMP(int N, int ncore)
 float ranf(void)
 {
     float rf;
-    unsigned int *irf = (unsigned int * ) &rf;
     seed *= 0x2C4856AD;
-    *irf = 0x3F800000 | (seed >> 9);
+    unsigned int irf = 0x3F800000 | (seed >> 9);
+    memcpy(&rf, &irf, sizeof(rf));
     return (rf-1.0);
 }
 
@@ -76,6 +99,7 @@ float ranf(void)
 double ranf_mkl(void)
 {
     double out;
+#ifdef USE_MKL
     if (m_rand_flag == false)
     {
         vslNewStream(&stream, VSL_BRNG_SFMT19937, VSL_BRNG_RDRAND);
@@ -83,12 +107,17 @@ double ranf_mkl(void)
     }
     
     vdRngGaussian(VSL_RNG_METHOD_GAUSSIAN_ICDF, stream, 1, &out, 0.5, 1.0);
+#else
+    std::normal_distribution<double> dist(0.5, 1.0);
+    out = dist(threadGenerator());
+#endif
     return (out);
 }
 
 double ranf_range(double a, double b)
 {
     double out;
+#ifdef USE_MKL
     if (m_rand_flag == false)
     {
         vslNewStream(&stream, VSL_BRNG_SFMT19937, VSL_BRNG_RDRAND);
@@ -96,6 +125,10 @@ double ranf_range(double a, double b)
     }
     
     vdRngUniform(VSL_RNG_METHOD_UNIFORM_STD, stream, 1, &out, a, b);
+#else
+    std::uniform_real_distribution<double> dist(a, b);
+    out = dist(threadGenerator());
+#endif
     return (out);
 }
 
@@ -106,9 +139,9 @@ matrix randi(const double imax, unsigned int m, unsigned int n)
     matrix res(m,n);
     
 #pragma omp parallel for
-    for (int ii = 0; ii < m; ii++)
+    for (unsigned int ii = 0; ii < m; ii++)
     {
-        for (int jj = 0; jj < n; jj++)
+        for (unsigned int jj = 0; jj < n; jj++)
         {
             res(ii, jj) = ranf_range(0.0, imax);
         }
@@ -0,0 +1,134 @@
+//
+//  vec.hpp
+//  OP2A
+//
+//  Created by Rahul Kalampattel, June 2018
+//
+//  Fixed-size vectors for grid geometry (positions, normal/tangent vectors).
+//  Unlike matrix, the components are stored inline, so a node costs no heap
+//  allocation and reading a component is a plain load.
+//
+
+#ifndef vec_hpp
+#define vec_hpp
+
+#include <cmath>
+
+
+
+template <unsigned int N>
+class Vec{
+
+    // Constructor
+public:
+    Vec()
+    {
+        for (unsigned int i = 0; i < N; i++) m_data[i] = 0.0;
+    }
+
+
+    // Basic operators
+public:
+    double& operator() (const unsigned int i)       { return m_data[i]; }
+    double  operator() (const unsigned int i) const { return m_data[i]; }
+
+    Vec& operator+= (const Vec& b)
+    {
+        for (unsigned int i = 0; i < N; i++) m_data[i] += b.m_data[i];
+        return *this;
+    }
+
+    Vec& operator-= (const Vec& b)
+    {
+        for (unsigned int i = 0; i < N; i++) m_data[i] -= b.m_data[i];
+        return *this;
+    }
+
+    Vec& operator*= (const double b)
+    {
+        for (unsigned int i = 0; i < N; i++) m_data[i] *= b;
+        return *this;
+    }
+
+    Vec& operator/= (const double b)
+    {
+        for (unsigned int i = 0; i < N; i++) m_data[i] /= b;
+        return *this;
+    }
+
+
+    // Basic functions
+public:
+    static constexpr unsigned int size() { return N; }
+
+    double norm() const
+    {
+        double res = 0.0;
+        for (unsigned int i = 0; i < N; i++) res += m_data[i] * m_data[i];
+        return (sqrt(res));
+    }
+
+    void normalize()
+    {
+        double res = norm();
+        for (unsigned int i = 0; i < N; i++) m_data[i] = m_data[i] / res;
+    }
+
+
+    // DATA set
+protected:
+    double m_data[N];
+};
+
+
+typedef Vec<3> Vec3;
+
+
+
+// Operators
+template <unsigned int N>
+Vec<N> operator+ (Vec<N> a, const Vec<N>& b)    { return (a += b); }
+
+template <unsigned int N>
+Vec<N> operator- (Vec<N> a, const Vec<N>& b)    { return (a -= b); }
+
+template <unsigned int N>
+Vec<N> operator* (Vec<N> a, const double b)     { return (a *= b); }
+
+template <unsigned int N>
+Vec<N> operator* (const double a, Vec<N> b)     { return (b *= a); }
+
+
+
+// Linear algebra functions
+template <unsigned int N>
+double dot(const Vec<N>& a, const Vec<N>& b)
+{
+    double res = 0.0;
+    for (unsigned int i = 0; i < N; i++) res += a(i) * b(i);
+    return (res);
+}
+
+inline Vec3 cross(const Vec3& a, const Vec3& b)
+{
+    Vec3 res;
+    res(0) = a(1)*b(2) - a(2)*b(1);
+    res(1) = a(2)*b(0) - a(0)*b(2);
+    res(2) = a(0)*b(1) - a(1)*b(0);
+    return (res);
+}
+
+inline Vec3 normalFromThreePoints(const Vec3& a, const Vec3& b, const Vec3& c)
+{
+    return (cross(b - a, c - a));
+}
+
+template <unsigned int N>
+Vec<N> vectorStartEnd(const Vec<N>& s, const Vec<N>& e)
+{
+    return (e - s);
+}
+
+
+
+#endif /* vec_hpp */
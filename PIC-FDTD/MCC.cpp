@@ -17,9 +17,17 @@ MCC::MCC(Parameters *parametersList, Mesh *mesh, VectorParticle *particlesVector
 	// TODO: Check that it is appropriate to use MCC (compare particle densities,
 	// collision frequencies, etc.)
 
+	// Number of real particles in each cell, in units of a macroparticle
+	std::vector<double> cellWeights(mesh->numCells, 0.0);
+	for (int i = 0; i < particlesVector->numParticles; i++)
+	{
+		cellWeights[particlesVector->particleVector[i].cellID - 1] += particlesVector->particleVector[i].weight;
+	}
+
 	for (int i = 0; i < particlesVector->numParticles; i++)
 	{	
-		double sigma, targetDensity;
+		// No collisions unless a cross section and target density are known
+		double sigma = 0.0, targetDensity = 0.0;
 		
 		// Collision cross section
 		if (parametersList->propellant == "xenon")
@@ -45,7 +53,7 @@ MCC::MCC(Parameters *parametersList, Mesh *mesh, VectorParticle *particlesVector
 				// only count particles of a specific kind, rather than all particles
 				// in the cell. Otherwise, use some sort of distribution to calculate
 				// the correct density.
-				targetDensity = static_cast<double>(mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].listOfParticles.size()) /
+				targetDensity = cellWeights[particlesVector->particleVector[i].cellID - 1] /
 					(mesh->h * mesh->h);
 			}
 			
@@ -58,7 +66,7 @@ MCC::MCC(Parameters *parametersList, Mesh *mesh, VectorParticle *particlesVector
 		else if (parametersList->simulationType == "electron")
 		{
 			// TODO: Collisions for electrons
-			targetDensity = static_cast<double>(mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].listOfParticles.size()) /
+			targetDensity = cellWeights[particlesVector->particleVector[i].cellID - 1] /
 				(mesh->h * mesh->h);
 		}
 
@@ -69,11 +77,10 @@ MCC::MCC(Parameters *parametersList, Mesh *mesh, VectorParticle *particlesVector
 
 		// Initialise random number generator, distribution in range [0, 1000000]
 		std::mt19937 rng;
-		rng.seed(std::random_device()());
+		rng.seed(parametersList->generateSeed());
 		std::uniform_int_distribution<std::mt19937::result_type> dist(0, 1000000);
 
 		double collisionRand = dist(rng) / (double)1000000;
-		double collisionRandType = dist(rng) / (double)1000000;
 
 		if (collisionProbability > collisionRand)
 		{
@@ -15,7 +15,31 @@ Mesh::Mesh()
 // Constructor
 Mesh::Mesh(Parameters *localParametersList, std::string type)
 {
-	if (type == "PIC")
+	// Geometry is generated here and then shared by copies of the mesh. Faces
+	// are only needed to find adjacent cells, so are released afterwards.
+	std::vector<NodeGeometry> nodes;
+	std::vector<CellGeometry> cells;
+	VectorFace facesVector;
+
+	if (type == "PIC" && localParametersList->userMesh)
+	{
+		localParametersList->logMessages("Starting additional mesh pre-processing", __FILENAME__, __LINE__, 1);
+		generateStructuredMesh(localParametersList, localParametersList->PICspacing);
+		if (localParametersList->tileSize > 0)
+		{
+			tilesVector.generateTiles(this, localParametersList->tileSize,
+				localParametersList->leftBCType == bcPeriodic,
+				localParametersList->topBCType == bcPeriodic);
+		}
+		return;
+	}
+	else if (type == "FDTD")
+	{
+		localParametersList->logBrief("Starting FDTD mesh pre-processing", 1);
+		generateStructuredMesh(localParametersList, localParametersList->FDTDspacing / 2.0);
+		return;
+	}
+	else if (type == "PIC")
 	{
 		localParametersList->logMessages("Starting additional mesh pre-processing", __FILENAME__, __LINE__, 1);
 
@@ -27,27 +51,11 @@ Mesh::Mesh(Parameters *localParametersList, std::string type)
 		dimension = localParametersList->gridinfoPIC.DIM;
 
 		// Extract (vector) data from gridgeo
-		cellsVector.allocate(localParametersList->gridgeoPIC.cells);
-		facesVector.allocate(localParametersList->gridgeoPIC.faces);
-		ghostVector.allocate(localParametersList->gridgeoPIC.ghost);
-		nodesVector.allocate(localParametersList->gridgeoPIC.nodes);
-	}
-	else if (type == "FDTD")
-	{
-		localParametersList->logBrief("Starting FDTD mesh pre-processing", 1);
-
-		// Extract data from gridinfo
-		numCells = localParametersList->gridinfoFDTD.NCM;
-		numFaces = localParametersList->gridinfoFDTD.NFM;
-		numGhost = localParametersList->gridinfoFDTD.NGM;
-		numNodes = localParametersList->gridinfoFDTD.NNM;
-		dimension = localParametersList->gridinfoFDTD.DIM;
-
-		// Extract (vector) data from gridgeo
-		cellsVector.allocate(localParametersList->gridgeoFDTD.cells);
-		facesVector.allocate(localParametersList->gridgeoFDTD.faces);
-		ghostVector.allocate(localParametersList->gridgeoFDTD.ghost);
-		nodesVector.allocate(localParametersList->gridgeoFDTD.nodes);
+		cells.assign(localParametersList->gridgeoPIC->cells.begin(),
+			localParametersList->gridgeoPIC->cells.end());
+		nodes.assign(localParametersList->gridgeoPIC->nodes.begin(),
+			localParametersList->gridgeoPIC->nodes.end());
+		facesVector.allocate(localParametersList->gridgeoPIC->faces);
 	}
 	else
 	{
@@ -60,7 +68,7 @@ Mesh::Mesh(Parameters *localParametersList, std::string type)
 	// # pragma omp parallel for num_threads(localParametersList->numThreads)
 	for (int i = 0; i < numNodes; i++)
 	{
-		nodesVector.nodes[i].geometry.X *= localParametersList->meshScalingParameter;
+		nodes[i].geometry.X *= localParametersList->meshScalingParameter;
 	}
 
 	// Find boundaries of each cell and identify adjacent/neighbouring cells,
@@ -74,396 +82,392 @@ Mesh::Mesh(Parameters *localParametersList, std::string type)
 		for (int j = 0; j < 3; j += 2)
 		{
 			// Node vector is indexed from 0, nodeIDs from 1, hence the index shift (-1) below
-			int nodeID = cellsVector.cells[i].connectivity.nodeIDs[j] - 1;
-			double x1 = nodesVector.nodes[nodeID].geometry.X.element(0, 0);
-			double x2 = nodesVector.nodes[nodeID].geometry.X.element(1, 0);
+			int nodeID = cells[i].connectivity.nodeIDs[j] - 1;
+			double x1 = nodes[nodeID].geometry.X(0);
+			double x2 = nodes[nodeID].geometry.X(1);
 
 			// Identify cell boundaries
 			if (j == 0)
 			{
-				cellsVector.cells[i].left = x1;
-				cellsVector.cells[i].right = x1;
-				cellsVector.cells[i].top = x2;
-				cellsVector.cells[i].bottom = x2;
+				cells[i].left = x1;
+				cells[i].right = x1;
+				cells[i].top = x2;
+				cells[i].bottom = x2;
 			}
 			else
 			{
-				if (x1 < cellsVector.cells[i].left)
+				if (x1 < cells[i].left)
 				{
-					cellsVector.cells[i].left = x1;
+					cells[i].left = x1;
 				}
-				else if (x1 > cellsVector.cells[i].right)
+				else if (x1 > cells[i].right)
 				{
-					cellsVector.cells[i].right = x1;
+					cells[i].right = x1;
 				}
-				if (x2 < cellsVector.cells[i].bottom)
+				if (x2 < cells[i].bottom)
 				{
-					cellsVector.cells[i].bottom = x2;
+					cells[i].bottom = x2;
 				}
-				else if (x2 > cellsVector.cells[i].top)
+				else if (x2 > cells[i].top)
 				{
-					cellsVector.cells[i].top = x2;
+					cells[i].top = x2;
 				}
 			}
 		}
 
-		hAverage += cellsVector.cells[i].right - cellsVector.cells[i].left + 
-			cellsVector.cells[i].top - cellsVector.cells[i].bottom;
+		hAverage += cells[i].right - cells[i].left + 
+			cells[i].top - cells[i].bottom;
 
 		// Get position of first node
-		int nodeID1 = cellsVector.cells[i].connectivity.nodeIDs[0] - 1;
-		int nodeID2 = cellsVector.cells[i].connectivity.nodeIDs[1] - 1;
-		int nodeID3 = cellsVector.cells[i].connectivity.nodeIDs[2] - 1;
-		int nodeID4 = cellsVector.cells[i].connectivity.nodeIDs[3] - 1;
-		double x1 = nodesVector.nodes[nodeID1].geometry.X.element(0, 0);
-		double x2 = nodesVector.nodes[nodeID1].geometry.X.element(1, 0);
+		int nodeID1 = cells[i].connectivity.nodeIDs[0] - 1;
+		int nodeID2 = cells[i].connectivity.nodeIDs[1] - 1;
+		int nodeID3 = cells[i].connectivity.nodeIDs[2] - 1;
+		int nodeID4 = cells[i].connectivity.nodeIDs[3] - 1;
+		double x1 = nodes[nodeID1].geometry.X(0);
+		double x2 = nodes[nodeID1].geometry.X(1);
 
 		// IDs of faces and their respective adjacent cells
-		int faceID_1 = cellsVector.cells[i].connectivity.faceIDs[0] - 1;
+		int faceID_1 = cells[i].connectivity.faceIDs[0] - 1;
 		int leftCell_1 = facesVector.faces[faceID_1].connectivity.cl[0] - 1;
 		int rightCell_1 = facesVector.faces[faceID_1].connectivity.cr[0] - 1;
 
-		int faceID_2 = cellsVector.cells[i].connectivity.faceIDs[1] - 1;
+		int faceID_2 = cells[i].connectivity.faceIDs[1] - 1;
 		int leftCell_2 = facesVector.faces[faceID_2].connectivity.cl[0] - 1;
 		int rightCell_2 = facesVector.faces[faceID_2].connectivity.cr[0] - 1;
 
-		int faceID_3 = cellsVector.cells[i].connectivity.faceIDs[2] - 1;
+		int faceID_3 = cells[i].connectivity.faceIDs[2] - 1;
 		int leftCell_3 = facesVector.faces[faceID_3].connectivity.cl[0] - 1;
 		int rightCell_3 = facesVector.faces[faceID_3].connectivity.cr[0] - 1;
 
-		int faceID_4 = cellsVector.cells[i].connectivity.faceIDs[3] - 1;
+		int faceID_4 = cells[i].connectivity.faceIDs[3] - 1;
 		int leftCell_4 = facesVector.faces[faceID_4].connectivity.cl[0] - 1;
 		int rightCell_4 = facesVector.faces[faceID_4].connectivity.cr[0] - 1;
 
 		// Identify position of adjacent cells based on location of first node,
 		// identify connected nodes, and positions of cells and nodes w.r.t.
 		// boundary of simulation domain
-		if (x1 == cellsVector.cells[i].left && x2 == cellsVector.cells[i].top)		// Top left node
+		if (x1 == cells[i].left && x2 == cells[i].top)		// Top left node
 		{
-			cellsVector.cells[i].firstNodePosition = "TL";
-			cellsVector.cells[i].leftCellID = leftCell_1 + rightCell_1 - i + 1;
-			cellsVector.cells[i].bottomCellID = leftCell_2 + rightCell_2 - i + 1;
-			cellsVector.cells[i].rightCellID = leftCell_3 + rightCell_3 - i + 1;
-			cellsVector.cells[i].topCellID = leftCell_4 + rightCell_4 - i + 1;
-
-			nodesVector.nodes[nodeID1].bottomNodeID = nodeID2 + 1;
-			nodesVector.nodes[nodeID1].rightNodeID = nodeID4 + 1;
-			nodesVector.nodes[nodeID2].rightNodeID = nodeID3 + 1;
-			nodesVector.nodes[nodeID2].topNodeID = nodeID1 + 1;
-			nodesVector.nodes[nodeID3].topNodeID = nodeID4 + 1;
-			nodesVector.nodes[nodeID3].leftNodeID = nodeID2 + 1;
-			nodesVector.nodes[nodeID4].leftNodeID = nodeID1 + 1;
-			nodesVector.nodes[nodeID4].bottomNodeID = nodeID3 + 1;
-
-			if (cellsVector.cells[i].leftCellID > 0 && cellsVector.cells[i].rightCellID > 0 &&
-				cellsVector.cells[i].topCellID > 0 && cellsVector.cells[i].bottomCellID > 0)
-			{
-				cellsVector.cells[i].boundaryType = "internal";
-				nodesVector.nodes[nodeID1].boundaryType = "internal";
-				nodesVector.nodes[nodeID2].boundaryType = "internal";
-				nodesVector.nodes[nodeID3].boundaryType = "internal";
-				nodesVector.nodes[nodeID4].boundaryType = "internal";
-			}
-			else if (cellsVector.cells[i].leftCellID < 1 && cellsVector.cells[i].bottomCellID < 1)
-			{
-				cellsVector.cells[i].boundaryType = "BL";
-				nodesVector.nodes[nodeID1].boundaryType = "L";
-				nodesVector.nodes[nodeID2].boundaryType = "BL";
-				nodesVector.nodes[nodeID3].boundaryType = "B";
+			cells[i].firstNodePosition = boundaryTL;
+			cells[i].leftCellID = leftCell_1 + rightCell_1 - i + 1;
+			cells[i].bottomCellID = leftCell_2 + rightCell_2 - i + 1;
+			cells[i].rightCellID = leftCell_3 + rightCell_3 - i + 1;
+			cells[i].topCellID = leftCell_4 + rightCell_4 - i + 1;
+
+			nodes[nodeID1].bottomNodeID = nodeID2 + 1;
+			nodes[nodeID1].rightNodeID = nodeID4 + 1;
+			nodes[nodeID2].rightNodeID = nodeID3 + 1;
+			nodes[nodeID2].topNodeID = nodeID1 + 1;
+			nodes[nodeID3].topNodeID = nodeID4 + 1;
+			nodes[nodeID3].leftNodeID = nodeID2 + 1;
+			nodes[nodeID4].leftNodeID = nodeID1 + 1;
+			nodes[nodeID4].bottomNodeID = nodeID3 + 1;
+
+			if (cells[i].leftCellID > 0 && cells[i].rightCellID > 0 &&
+				cells[i].topCellID > 0 && cells[i].bottomCellID > 0)
+			{
+				cells[i].boundaryType = boundaryInternal;
+				nodes[nodeID1].boundaryType = boundaryInternal;
+				nodes[nodeID2].boundaryType = boundaryInternal;
+				nodes[nodeID3].boundaryType = boundaryInternal;
+				nodes[nodeID4].boundaryType = boundaryInternal;
+			}
+			else if (cells[i].leftCellID < 1 && cells[i].bottomCellID < 1)
+			{
+				cells[i].boundaryType = boundaryBL;
+				nodes[nodeID1].boundaryType = boundaryL;
+				nodes[nodeID2].boundaryType = boundaryBL;
+				nodes[nodeID3].boundaryType = boundaryB;
 				numRows = i + 1;
 				numColumns = numCells / numRows;
 			}
-			else if (cellsVector.cells[i].leftCellID < 1 && cellsVector.cells[i].topCellID < 1)
+			else if (cells[i].leftCellID < 1 && cells[i].topCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "TL";
-				nodesVector.nodes[nodeID1].boundaryType = "TL";
-				nodesVector.nodes[nodeID2].boundaryType = "L";
-				nodesVector.nodes[nodeID4].boundaryType = "T";
+				cells[i].boundaryType = boundaryTL;
+				nodes[nodeID1].boundaryType = boundaryTL;
+				nodes[nodeID2].boundaryType = boundaryL;
+				nodes[nodeID4].boundaryType = boundaryT;
 			}
-			else if (cellsVector.cells[i].rightCellID < 1 && cellsVector.cells[i].topCellID < 1)
+			else if (cells[i].rightCellID < 1 && cells[i].topCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "TR";
-				nodesVector.nodes[nodeID1].boundaryType = "T";
-				nodesVector.nodes[nodeID3].boundaryType = "R";
-				nodesVector.nodes[nodeID4].boundaryType = "TR";
+				cells[i].boundaryType = boundaryTR;
+				nodes[nodeID1].boundaryType = boundaryT;
+				nodes[nodeID3].boundaryType = boundaryR;
+				nodes[nodeID4].boundaryType = boundaryTR;
 			}
-			else if (cellsVector.cells[i].rightCellID < 1 && cellsVector.cells[i].bottomCellID < 1)
+			else if (cells[i].rightCellID < 1 && cells[i].bottomCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "BR";
-				nodesVector.nodes[nodeID2].boundaryType = "B";
-				nodesVector.nodes[nodeID3].boundaryType = "BR";
-				nodesVector.nodes[nodeID4].boundaryType = "R";
+				cells[i].boundaryType = boundaryBR;
+				nodes[nodeID2].boundaryType = boundaryB;
+				nodes[nodeID3].boundaryType = boundaryBR;
+				nodes[nodeID4].boundaryType = boundaryR;
 			}
-			else if (cellsVector.cells[i].leftCellID < 1)
+			else if (cells[i].leftCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "L";
-				nodesVector.nodes[nodeID1].boundaryType = "L";
-				nodesVector.nodes[nodeID2].boundaryType = "L";
+				cells[i].boundaryType = boundaryL;
+				nodes[nodeID1].boundaryType = boundaryL;
+				nodes[nodeID2].boundaryType = boundaryL;
 			}
-			else if (cellsVector.cells[i].rightCellID < 1)
+			else if (cells[i].rightCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "R";
-				nodesVector.nodes[nodeID3].boundaryType = "R";
-				nodesVector.nodes[nodeID4].boundaryType = "R";
+				cells[i].boundaryType = boundaryR;
+				nodes[nodeID3].boundaryType = boundaryR;
+				nodes[nodeID4].boundaryType = boundaryR;
 			}
-			else if (cellsVector.cells[i].bottomCellID < 1)
+			else if (cells[i].bottomCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "B";
-				nodesVector.nodes[nodeID2].boundaryType = "B";
-				nodesVector.nodes[nodeID3].boundaryType = "B";
+				cells[i].boundaryType = boundaryB;
+				nodes[nodeID2].boundaryType = boundaryB;
+				nodes[nodeID3].boundaryType = boundaryB;
 			}
-			else if (cellsVector.cells[i].topCellID < 1)
+			else if (cells[i].topCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "T";
-				nodesVector.nodes[nodeID1].boundaryType = "T";
-				nodesVector.nodes[nodeID4].boundaryType = "T";
+				cells[i].boundaryType = boundaryT;
+				nodes[nodeID1].boundaryType = boundaryT;
+				nodes[nodeID4].boundaryType = boundaryT;
 			}
 		}
-		else if (x1 == cellsVector.cells[i].left && x2 == cellsVector.cells[i].bottom)			// Bottom left node
+		else if (x1 == cells[i].left && x2 == cells[i].bottom)			// Bottom left node
 		{
-			cellsVector.cells[i].firstNodePosition = "BL";
-			cellsVector.cells[i].bottomCellID = leftCell_1 + rightCell_1 - i + 1;
-			cellsVector.cells[i].rightCellID = leftCell_2 + rightCell_2 - i + 1;
-			cellsVector.cells[i].topCellID = leftCell_3 + rightCell_3 - i + 1;
-			cellsVector.cells[i].leftCellID = leftCell_4 + rightCell_4 - i + 1;
+			cells[i].firstNodePosition = boundaryBL;
+			cells[i].bottomCellID = leftCell_1 + rightCell_1 - i + 1;
+			cells[i].rightCellID = leftCell_2 + rightCell_2 - i + 1;
+			cells[i].topCellID = leftCell_3 + rightCell_3 - i + 1;
+			cells[i].leftCellID = leftCell_4 + rightCell_4 - i + 1;
 
-			nodesVector.nodes[nodeID1].rightNodeID = nodeID2 + 1;
-			nodesVector.nodes[nodeID1].topNodeID = nodeID4 + 1;
-			nodesVector.nodes[nodeID2].topNodeID = nodeID3 + 1;
-			nodesVector.nodes[nodeID2].leftNodeID = nodeID1 + 1;
-			nodesVector.nodes[nodeID3].leftNodeID = nodeID4 + 1;
-			nodesVector.nodes[nodeID3].bottomNodeID = nodeID2 + 1;
-			nodesVector.nodes[nodeID4].bottomNodeID = nodeID1 + 1;
-			nodesVector.nodes[nodeID4].rightNodeID = nodeID3 + 1;
+			nodes[nodeID1].rightNodeID = nodeID2 + 1;
+			nodes[nodeID1].topNodeID = nodeID4 + 1;
+			nodes[nodeID2].topNodeID = nodeID3 + 1;
+			nodes[nodeID2].leftNodeID = nodeID1 + 1;
+			nodes[nodeID3].leftNodeID = nodeID4 + 1;
+			nodes[nodeID3].bottomNodeID = nodeID2 + 1;
+			nodes[nodeID4].bottomNodeID = nodeID1 + 1;
+			nodes[nodeID4].rightNodeID = nodeID3 + 1;
 
-			if (cellsVector.cells[i].leftCellID > 0 && cellsVector.cells[i].rightCellID > 0 &&
-				cellsVector.cells[i].topCellID > 0 && cellsVector.cells[i].bottomCellID > 0)
+			if (cells[i].leftCellID > 0 && cells[i].rightCellID > 0 &&
+				cells[i].topCellID > 0 && cells[i].bottomCellID > 0)
 			{
-				cellsVector.cells[i].boundaryType = "internal";
-				nodesVector.nodes[nodeID1].boundaryType = "internal";
-				nodesVector.nodes[nodeID2].boundaryType = "internal";
-				nodesVector.nodes[nodeID3].boundaryType = "internal";
-				nodesVector.nodes[nodeID4].boundaryType = "internal";
+				cells[i].boundaryType = boundaryInternal;
+				nodes[nodeID1].boundaryType = boundaryInternal;
+				nodes[nodeID2].boundaryType = boundaryInternal;
+				nodes[nodeID3].boundaryType = boundaryInternal;
+				nodes[nodeID4].boundaryType = boundaryInternal;
 			}
-			else if (cellsVector.cells[i].leftCellID < 1 && cellsVector.cells[i].bottomCellID < 1)
+			else if (cells[i].leftCellID < 1 && cells[i].bottomCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "BL";
-				nodesVector.nodes[nodeID1].boundaryType = "BL";
-				nodesVector.nodes[nodeID2].boundaryType = "B";
-				nodesVector.nodes[nodeID4].boundaryType = "L";
+				cells[i].boundaryType = boundaryBL;
+				nodes[nodeID1].boundaryType = boundaryBL;
+				nodes[nodeID2].boundaryType = boundaryB;
+				nodes[nodeID4].boundaryType = boundaryL;
 			}
-			else if (cellsVector.cells[i].leftCellID < 1 && cellsVector.cells[i].topCellID < 1)
+			else if (cells[i].leftCellID < 1 && cells[i].topCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "TL";
-				nodesVector.nodes[nodeID1].boundaryType = "L";
-				nodesVector.nodes[nodeID3].boundaryType = "T";
-				nodesVector.nodes[nodeID4].boundaryType = "TL";
+				cells[i].boundaryType = boundaryTL;
+				nodes[nodeID1].boundaryType = boundaryL;
+				nodes[nodeID3].boundaryType = boundaryT;
+				nodes[nodeID4].boundaryType = boundaryTL;
 			}
-			else if (cellsVector.cells[i].rightCellID < 1 && cellsVector.cells[i].topCellID < 1)
+			else if (cells[i].rightCellID < 1 && cells[i].topCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "TR";
-				nodesVector.nodes[nodeID2].boundaryType = "R";
-				nodesVector.nodes[nodeID3].boundaryType = "TR";
-				nodesVector.nodes[nodeID4].boundaryType = "T";
+				cells[i].boundaryType = boundaryTR;
+				nodes[nodeID2].boundaryType = boundaryR;
+				nodes[nodeID3].boundaryType = boundaryTR;
+				nodes[nodeID4].boundaryType = boundaryT;
 			}
-			else if (cellsVector.cells[i].rightCellID < 1 && cellsVector.cells[i].bottomCellID < 1)
+			else if (cells[i].rightCellID < 1 && cells[i].bottomCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "BR";
-				nodesVector.nodes[nodeID1].boundaryType = "B";
-				nodesVector.nodes[nodeID2].boundaryType = "BR";
-				nodesVector.nodes[nodeID3].boundaryType = "R";
+				cells[i].boundaryType = boundaryBR;
+				nodes[nodeID1].boundaryType = boundaryB;
+				nodes[nodeID2].boundaryType = boundaryBR;
+				nodes[nodeID3].boundaryType = boundaryR;
 			}
-			else if (cellsVector.cells[i].leftCellID < 1)
+			else if (cells[i].leftCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "L";
-				nodesVector.nodes[nodeID1].boundaryType = "L";
-				nodesVector.nodes[nodeID4].boundaryType = "L";
+				cells[i].boundaryType = boundaryL;
+				nodes[nodeID1].boundaryType = boundaryL;
+				nodes[nodeID4].boundaryType = boundaryL;
 			}
-			else if (cellsVector.cells[i].rightCellID < 1)
+			else if (cells[i].rightCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "R";
-				nodesVector.nodes[nodeID2].boundaryType = "R";
-				nodesVector.nodes[nodeID3].boundaryType = "R";
+				cells[i].boundaryType = boundaryR;
+				nodes[nodeID2].boundaryType = boundaryR;
+				nodes[nodeID3].boundaryType = boundaryR;
 			}
-			else if (cellsVector.cells[i].bottomCellID < 1)
+			else if (cells[i].bottomCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "B";
-				nodesVector.nodes[nodeID1].boundaryType = "B";
-				nodesVector.nodes[nodeID2].boundaryType = "B";
+				cells[i].boundaryType = boundaryB;
+				nodes[nodeID1].boundaryType = boundaryB;
+				nodes[nodeID2].boundaryType = boundaryB;
 			}
-			else if (cellsVector.cells[i].topCellID < 1)
+			else if (cells[i].topCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "T";
-				nodesVector.nodes[nodeID3].boundaryType = "T";
-				nodesVector.nodes[nodeID4].boundaryType = "T";
+				cells[i].boundaryType = boundaryT;
+				nodes[nodeID3].boundaryType = boundaryT;
+				nodes[nodeID4].boundaryType = boundaryT;
 			}
 		}
-		else if (x1 == cellsVector.cells[i].right && x2 == cellsVector.cells[i].bottom)	// Bottom right node
+		else if (x1 == cells[i].right && x2 == cells[i].bottom)	// Bottom right node
 		{
-			cellsVector.cells[i].firstNodePosition = "BR";
-			cellsVector.cells[i].rightCellID = leftCell_1 + rightCell_1 - i + 1;
-			cellsVector.cells[i].topCellID = leftCell_2 + rightCell_2 - i + 1;
-			cellsVector.cells[i].leftCellID = leftCell_3 + rightCell_3 - i + 1;
-			cellsVector.cells[i].bottomCellID = leftCell_4 + rightCell_4 - i + 1;
+			cells[i].firstNodePosition = boundaryBR;
+			cells[i].rightCellID = leftCell_1 + rightCell_1 - i + 1;
+			cells[i].topCellID = leftCell_2 + rightCell_2 - i + 1;
+			cells[i].leftCellID = leftCell_3 + rightCell_3 - i + 1;
+			cells[i].bottomCellID = leftCell_4 + rightCell_4 - i + 1;
 
-			nodesVector.nodes[nodeID1].topNodeID = nodeID2 + 1;
-			nodesVector.nodes[nodeID1].leftNodeID = nodeID4 + 1;
-			nodesVector.nodes[nodeID2].leftNodeID = nodeID3 + 1;
-			nodesVector.nodes[nodeID2].bottomNodeID = nodeID1 + 1;
-			nodesVector.nodes[nodeID3].bottomNodeID = nodeID4 + 1;
-			nodesVector.nodes[nodeID3].rightNodeID = nodeID2 + 1;
-			nodesVector.nodes[nodeID4].rightNodeID = nodeID1 + 1;
-			nodesVector.nodes[nodeID4].topNodeID = nodeID3 + 1;
+			nodes[nodeID1].topNodeID = nodeID2 + 1;
+			nodes[nodeID1].leftNodeID = nodeID4 + 1;
+			nodes[nodeID2].leftNodeID = nodeID3 + 1;
+			nodes[nodeID2].bottomNodeID = nodeID1 + 1;
+			nodes[nodeID3].bottomNodeID = nodeID4 + 1;
+			nodes[nodeID3].rightNodeID = nodeID2 + 1;
+			nodes[nodeID4].rightNodeID = nodeID1 + 1;
+			nodes[nodeID4].topNodeID = nodeID3 + 1;
 
-			if (cellsVector.cells[i].leftCellID > 0 && cellsVector.cells[i].rightCellID > 0 &&
-				cellsVector.cells[i].topCellID > 0 && cellsVector.cells[i].bottomCellID > 0)
+			if (cells[i].leftCellID > 0 && cells[i].rightCellID > 0 &&
+				cells[i].topCellID > 0 && cells[i].bottomCellID > 0)
 			{
-				cellsVector.cells[i].boundaryType = "internal";
-				nodesVector.nodes[nodeID1].boundaryType = "internal";
-				nodesVector.nodes[nodeID2].boundaryType = "internal";
-				nodesVector.nodes[nodeID3].boundaryType = "internal";
-				nodesVector.nodes[nodeID4].boundaryType = "internal";
+				cells[i].boundaryType = boundaryInternal;
+				nodes[nodeID1].boundaryType = boundaryInternal;
+				nodes[nodeID2].boundaryType = boundaryInternal;
+				nodes[nodeID3].boundaryType = boundaryInternal;
+				nodes[nodeID4].boundaryType = boundaryInternal;
 			}
-			else if (cellsVector.cells[i].leftCellID < 1 && cellsVector.cells[i].bottomCellID < 1)
+			else if (cells[i].leftCellID < 1 && cells[i].bottomCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "BL";
-				nodesVector.nodes[nodeID1].boundaryType = "B";
-				nodesVector.nodes[nodeID3].boundaryType = "L";
-				nodesVector.nodes[nodeID4].boundaryType = "BL";
+				cells[i].boundaryType = boundaryBL;
+				nodes[nodeID1].boundaryType = boundaryB;
+				nodes[nodeID3].boundaryType = boundaryL;
+				nodes[nodeID4].boundaryType = boundaryBL;
 			}
-			else if (cellsVector.cells[i].leftCellID < 1 && cellsVector.cells[i].topCellID < 1)
+			else if (cells[i].leftCellID < 1 && cells[i].topCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "TL";
-				nodesVector.nodes[nodeID2].boundaryType = "T";
-				nodesVector.nodes[nodeID3].boundaryType = "TL";
-				nodesVector.nodes[nodeID4].boundaryType = "L";
+				cells[i].boundaryType = boundaryTL;
+				nodes[nodeID2].boundaryType = boundaryT;
+				nodes[nodeID3].boundaryType = boundaryTL;
+				nodes[nodeID4].boundaryType = boundaryL;
 			}
-			else if (cellsVector.cells[i].rightCellID < 1 && cellsVector.cells[i].topCellID < 1)
+			else if (cells[i].rightCellID < 1 && cells[i].topCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "TR";
-				nodesVector.nodes[nodeID1].boundaryType = "R";
-				nodesVector.nodes[nodeID2].boundaryType = "TR";
-				nodesVector.nodes[nodeID3].boundaryType = "T";
+				cells[i].boundaryType = boundaryTR;
+				nodes[nodeID1].boundaryType = boundaryR;
+				nodes[nodeID2].boundaryType = boundaryTR;
+				nodes[nodeID3].boundaryType = boundaryT;
 			}
-			else if (cellsVector.cells[i].rightCellID < 1 && cellsVector.cells[i].bottomCellID < 1)
+			else if (cells[i].rightCellID < 1 && cells[i].bottomCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "BR";
-				nodesVector.nodes[nodeID1].boundaryType = "BR";
-				nodesVector.nodes[nodeID2].boundaryType = "R";
-				nodesVector.nodes[nodeID4].boundaryType = "B";
+				cells[i].boundaryType = boundaryBR;
+				nodes[nodeID1].boundaryType = boundaryBR;
+				nodes[nodeID2].boundaryType = boundaryR;
+				nodes[nodeID4].boundaryType = boundaryB;
 			}
-			else if (cellsVector.cells[i].leftCellID < 1)
+			else if (cells[i].leftCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "L";
-				nodesVector.nodes[nodeID3].boundaryType = "L";
-				nodesVector.nodes[nodeID4].boundaryType = "L";
+				cells[i].boundaryType = boundaryL;
+				nodes[nodeID3].boundaryType = boundaryL;
+				nodes[nodeID4].boundaryType = boundaryL;
 			}
-			else if (cellsVector.cells[i].rightCellID < 1)
+			else if (cells[i].rightCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "R";
-				nodesVector.nodes[nodeID1].boundaryType = "R";
-				nodesVector.nodes[nodeID2].boundaryType = "R";
+				cells[i].boundaryType = boundaryR;
+				nodes[nodeID1].boundaryType = boundaryR;
+				nodes[nodeID2].boundaryType = boundaryR;
 			}
-			else if (cellsVector.cells[i].bottomCellID < 1)
+			else if (cells[i].bottomCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "B";
-				nodesVector.nodes[nodeID1].boundaryType = "B";
-				nodesVector.nodes[nodeID4].boundaryType = "B";
+				cells[i].boundaryType = boundaryB;
+				nodes[nodeID1].boundaryType = boundaryB;
+				nodes[nodeID4].boundaryType = boundaryB;
 			}
-			else if (cellsVector.cells[i].topCellID < 1)
+			else if (cells[i].topCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "T";
-				nodesVector.nodes[nodeID2].boundaryType = "T";
-				nodesVector.nodes[nodeID3].boundaryType = "T";
+				cells[i].boundaryType = boundaryT;
+				nodes[nodeID2].boundaryType = boundaryT;
+				nodes[nodeID3].boundaryType = boundaryT;
 			}
 		}
-		else if (x1 == cellsVector.cells[i].right && x2 == cellsVector.cells[i].top)		// Top right node
+		else if (x1 == cells[i].right && x2 == cells[i].top)		// Top right node
 		{
-			cellsVector.cells[i].firstNodePosition = "TR";
-			cellsVector.cells[i].topCellID = leftCell_1 + rightCell_1 - i + 1;
-			cellsVector.cells[i].leftCellID = leftCell_2 + rightCell_2 - i + 1;
-			cellsVector.cells[i].bottomCellID = leftCell_3 + rightCell_3 - i + 1;
-			cellsVector.cells[i].rightCellID = leftCell_4 + rightCell_4 - i + 1;
+			cells[i].firstNodePosition = boundaryTR;
+			cells[i].topCellID = leftCell_1 + rightCell_1 - i + 1;
+			cells[i].leftCellID = leftCell_2 + rightCell_2 - i + 1;
+			cells[i].bottomCellID = leftCell_3 + rightCell_3 - i + 1;
+			cells[i].rightCellID = leftCell_4 + rightCell_4 - i + 1;
 
-			nodesVector.nodes[nodeID1].leftNodeID = nodeID2 + 1;
-			nodesVector.nodes[nodeID1].bottomNodeID = nodeID4 + 1;
-			nodesVector.nodes[nodeID2].bottomNodeID = nodeID3 + 1;
-			nodesVector.nodes[nodeID2].rightNodeID = nodeID1 + 1;
-			nodesVector.nodes[nodeID3].rightNodeID = nodeID4 + 1;
-			nodesVector.nodes[nodeID3].topNodeID = nodeID2 + 1;
-			nodesVector.nodes[nodeID4].topNodeID = nodeID1 + 1;
-			nodesVector.nodes[nodeID4].leftNodeID = nodeID3 + 1;
+			nodes[nodeID1].leftNodeID = nodeID2 + 1;
+			nodes[nodeID1].bottomNodeID = nodeID4 + 1;
+			nodes[nodeID2].bottomNodeID = nodeID3 + 1;
+			nodes[nodeID2].rightNodeID = nodeID1 + 1;
+			nodes[nodeID3].rightNodeID = nodeID4 + 1;
+			nodes[nodeID3].topNodeID = nodeID2 + 1;
+			nodes[nodeID4].topNodeID = nodeID1 + 1;
+			nodes[nodeID4].leftNodeID = nodeID3 + 1;
 
-			if (cellsVector.cells[i].leftCellID > 0 && cellsVector.cells[i].rightCellID > 0 &&
-				cellsVector.cells[i].topCellID > 0 && cellsVector.cells[i].bottomCellID > 0)
+			if (cells[i].leftCellID > 0 && cells[i].rightCellID > 0 &&
+				cells[i].topCellID > 0 && cells[i].bottomCellID > 0)
 			{
-				cellsVector.cells[i].boundaryType = "internal";
-				nodesVector.nodes[nodeID1].boundaryType = "internal";
-				nodesVector.nodes[nodeID2].boundaryType = "internal";
-				nodesVector.nodes[nodeID3].boundaryType = "internal";
-				nodesVector.nodes[nodeID4].boundaryType = "internal";
+				cells[i].boundaryType = boundaryInternal;
+				nodes[nodeID1].boundaryType = boundaryInternal;
+				nodes[nodeID2].boundaryType = boundaryInternal;
+				nodes[nodeID3].boundaryType = boundaryInternal;
+				nodes[nodeID4].boundaryType = boundaryInternal;
 			}
-			else if (cellsVector.cells[i].leftCellID < 1 && cellsVector.cells[i].bottomCellID < 1)
+			else if (cells[i].leftCellID < 1 && cells[i].bottomCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "BL";
-				nodesVector.nodes[nodeID2].boundaryType = "L";
-				nodesVector.nodes[nodeID3].boundaryType = "BL";
-				nodesVector.nodes[nodeID4].boundaryType = "B";
+				cells[i].boundaryType = boundaryBL;
+				nodes[nodeID2].boundaryType = boundaryL;
+				nodes[nodeID3].boundaryType = boundaryBL;
+				nodes[nodeID4].boundaryType = boundaryB;
 			}
-			else if (cellsVector.cells[i].leftCellID < 1 && cellsVector.cells[i].topCellID < 1)
+			else if (cells[i].leftCellID < 1 && cells[i].topCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "TL";
-				nodesVector.nodes[nodeID1].boundaryType = "T";
-				nodesVector.nodes[nodeID2].boundaryType = "TL";
-				nodesVector.nodes[nodeID3].boundaryType = "L";
+				cells[i].boundaryType = boundaryTL;
+				nodes[nodeID1].boundaryType = boundaryT;
+				nodes[nodeID2].boundaryType = boundaryTL;
+				nodes[nodeID3].boundaryType = boundaryL;
 			}
-			else if (cellsVector.cells[i].rightCellID < 1 && cellsVector.cells[i].topCellID < 1)
+			else if (cells[i].rightCellID < 1 && cells[i].topCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "TR";
-				nodesVector.nodes[nodeID1].boundaryType = "TR";
-				nodesVector.nodes[nodeID2].boundaryType = "T";
-				nodesVector.nodes[nodeID4].boundaryType = "R";
+				cells[i].boundaryType = boundaryTR;
+				nodes[nodeID1].boundaryType = boundaryTR;
+				nodes[nodeID2].boundaryType = boundaryT;
+				nodes[nodeID4].boundaryType = boundaryR;
 			}
-			else if (cellsVector.cells[i].rightCellID < 1 && cellsVector.cells[i].bottomCellID < 1)
+			else if (cells[i].rightCellID < 1 && cells[i].bottomCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "BR";
-				nodesVector.nodes[nodeID1].boundaryType = "R";
-				nodesVector.nodes[nodeID3].boundaryType = "B";
-				nodesVector.nodes[nodeID4].boundaryType = "BR";
+				cells[i].boundaryType = boundaryBR;
+				nodes[nodeID1].boundaryType = boundaryR;
+				nodes[nodeID3].boundaryType = boundaryB;
+				nodes[nodeID4].boundaryType = boundaryBR;
 			}
-			else if (cellsVector.cells[i].leftCellID < 1)
+			else if (cells[i].leftCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "L";
-				nodesVector.nodes[nodeID2].boundaryType = "L";
-				nodesVector.nodes[nodeID3].boundaryType = "L";
+				cells[i].boundaryType = boundaryL;
+				nodes[nodeID2].boundaryType = boundaryL;
+				nodes[nodeID3].boundaryType = boundaryL;
 			}
-			else if (cellsVector.cells[i].rightCellID < 1)
+			else if (cells[i].rightCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "R";
-				nodesVector.nodes[nodeID1].boundaryType = "R";
-				nodesVector.nodes[nodeID4].boundaryType = "R";
+				cells[i].boundaryType = boundaryR;
+				nodes[nodeID1].boundaryType = boundaryR;
+				nodes[nodeID4].boundaryType = boundaryR;
 			}
-			else if (cellsVector.cells[i].bottomCellID < 1)
+			else if (cells[i].bottomCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "B";
-				nodesVector.nodes[nodeID3].boundaryType = "B";
-				nodesVector.nodes[nodeID4].boundaryType = "B";
+				cells[i].boundaryType = boundaryB;
+				nodes[nodeID3].boundaryType = boundaryB;
+				nodes[nodeID4].boundaryType = boundaryB;
 			}
-			else if (cellsVector.cells[i].topCellID < 1)
+			else if (cells[i].topCellID < 1)
 			{
-				cellsVector.cells[i].boundaryType = "T";
-				nodesVector.nodes[nodeID1].boundaryType = "T";
-				nodesVector.nodes[nodeID2].boundaryType = "T";
+				cells[i].boundaryType = boundaryT;
+				nodes[nodeID1].boundaryType = boundaryT;
+				nodes[nodeID2].boundaryType = boundaryT;
 			}
 		}
 	}
 
 	h = hAverage / static_cast<double>((2 * numCells));
-	if (type == "PIC" && (h - localParametersList->PICspacing) > 1e-10)
-	{
-		localParametersList->logBrief("Grid spacing not calculated correctly", 3);
-	}
-	else if (type == "FDTD" && (h - localParametersList->FDTDspacing) > 1e-10)
+	if ((h - localParametersList->PICspacing) > 1e-10)
 	{
 		localParametersList->logBrief("Grid spacing not calculated correctly", 3);
 	}
@@ -474,37 +478,37 @@ Mesh::Mesh(Parameters *localParametersList, std::string type)
 	for (int i = 0; i < numCells; i++)
 	{
 		// Periodic cells in Cartesian x/cylindrical z direction
-		if (cellsVector.cells[i].boundaryType == "TL" || 
-			cellsVector.cells[i].boundaryType == "L" || 
-			cellsVector.cells[i].boundaryType == "BL")
+		if (cells[i].boundaryType == boundaryTL || 
+			cells[i].boundaryType == boundaryL || 
+			cells[i].boundaryType == boundaryBL)
 		{
-			int j = cellsVector.cells[i].rightCellID - 1;
-			while (cellsVector.cells[j].boundaryType != "TR" && 
-				cellsVector.cells[j].boundaryType != "R" && 
-				cellsVector.cells[j].boundaryType != "BR")
+			int j = cells[i].rightCellID - 1;
+			while (cells[j].boundaryType != boundaryTR && 
+				cells[j].boundaryType != boundaryR && 
+				cells[j].boundaryType != boundaryBR)
 			{
-				j = cellsVector.cells[j].rightCellID - 1; 
+				j = cells[j].rightCellID - 1; 
 			}
-			cellsVector.cells[i].periodicX1CellID = j + 1;
-			cellsVector.cells[j].periodicX1CellID = i + 1;
+			cells[i].periodicX1CellID = j + 1;
+			cells[j].periodicX1CellID = i + 1;
 		}
 
 		// TODO: Does it make physical sense to have periodic BCs in the y/r 
 		// direction? Definitely not for cylindrical, not really for Cartesian...
 		// Periodic cells in Cartesian y/cylindrical r direction
-		if (cellsVector.cells[i].boundaryType == "TL" || 
-			cellsVector.cells[i].boundaryType == "T" || 
-			cellsVector.cells[i].boundaryType == "TR")
+		if (cells[i].boundaryType == boundaryTL || 
+			cells[i].boundaryType == boundaryT || 
+			cells[i].boundaryType == boundaryTR)
 		{
-			int j = cellsVector.cells[i].bottomCellID - 1;
-			while (cellsVector.cells[j].boundaryType != "BL" && 
-				cellsVector.cells[j].boundaryType != "B" && 
-				cellsVector.cells[j].boundaryType != "BR")
+			int j = cells[i].bottomCellID - 1;
+			while (cells[j].boundaryType != boundaryBL && 
+				cells[j].boundaryType != boundaryB && 
+				cells[j].boundaryType != boundaryBR)
 			{
-				j = cellsVector.cells[j].bottomCellID - 1;
+				j = cells[j].bottomCellID - 1;
 			}
-			cellsVector.cells[i].periodicX2CellID = j + 1;
-			cellsVector.cells[j].periodicX2CellID = i + 1;
+			cells[i].periodicX2CellID = j + 1;
+			cells[j].periodicX2CellID = i + 1;
 		}
 	}
 
@@ -514,58 +518,227 @@ Mesh::Mesh(Parameters *localParametersList, std::string type)
 	for (int i = 0; i < numNodes; i++)
 	{
 		// Periodic nodes in x direction
-		if (nodesVector.nodes[i].boundaryType == "TL" ||
-			nodesVector.nodes[i].boundaryType == "L" ||
-			nodesVector.nodes[i].boundaryType == "BL")
+		if (nodes[i].boundaryType == boundaryTL ||
+			nodes[i].boundaryType == boundaryL ||
+			nodes[i].boundaryType == boundaryBL)
 		{
-			int j = nodesVector.nodes[i].rightNodeID - 1;
-			while (nodesVector.nodes[j].boundaryType != "TR" &&
-				nodesVector.nodes[j].boundaryType != "R" &&
-				nodesVector.nodes[j].boundaryType != "BR")
+			int j = nodes[i].rightNodeID - 1;
+			while (nodes[j].boundaryType != boundaryTR &&
+				nodes[j].boundaryType != boundaryR &&
+				nodes[j].boundaryType != boundaryBR)
 			{
-				j = nodesVector.nodes[j].rightNodeID - 1;
+				j = nodes[j].rightNodeID - 1;
 			}
-			nodesVector.nodes[i].periodicX1NodeID = j + 1;
-			nodesVector.nodes[j].periodicX1NodeID = i + 1;
+			nodes[i].periodicX1NodeID = j + 1;
+			nodes[j].periodicX1NodeID = i + 1;
 		}
 
 		// Periodic nodes in y direction
-		if (nodesVector.nodes[i].boundaryType == "TL" ||
-			nodesVector.nodes[i].boundaryType == "T" ||
-			nodesVector.nodes[i].boundaryType == "TR")
+		if (nodes[i].boundaryType == boundaryTL ||
+			nodes[i].boundaryType == boundaryT ||
+			nodes[i].boundaryType == boundaryTR)
+		{
+			int j = nodes[i].bottomNodeID - 1;
+			while (nodes[j].boundaryType != boundaryBL &&
+				nodes[j].boundaryType != boundaryB &&
+				nodes[j].boundaryType != boundaryBR)
+			{
+				j = nodes[j].bottomNodeID - 1;
+			}
+			nodes[i].periodicX2NodeID = j + 1;
+			nodes[j].periodicX2NodeID = i + 1;
+		}
+	}
+	shareGeometry(nodes, cells);
+	localParametersList->logBrief("Additional mesh pre-processing complete", 1);
+}
+
+
+// Generate nodes and cells of a uniform rectangular grid. Columns run left to
+// right and rows top to bottom, so that neighbours, boundary positions and 
+// periodic partners follow directly from the column and row of each element, 
+// and no faces, ghost cells or intermediate grid data are created.
+void Mesh::generateStructuredMesh(Parameters *localParametersList, double spacing)
+{
+	structured = true;
+	numColumns = static_cast<int>(round(localParametersList->domainLength / spacing));
+	numRows = static_cast<int>(round(localParametersList->domainHeight / spacing));
+	numCells = numColumns * numRows;
+	numNodes = (numColumns + 1) * (numRows + 1);
+	numFaces = 0;
+	numGhost = 0;
+	dimension = 2;
+
+	double scale = localParametersList->meshScalingParameter;
+
+	// Nodes, with boundary position as the union of the edges they lie on
+	std::vector<NodeGeometry> nodes(numNodes);
+	for (int column = 0; column < numColumns + 1; column++)
+	{
+		for (int row = 0; row < numRows + 1; row++)
+		{
+			NodeGeometry &node = nodes[nodeIndex(column, row)];
+			node.geometry.X(0) = spacing * column;
+			node.geometry.X(1) = localParametersList->domainHeight - spacing * row;
+			node.geometry.X *= scale;
+
+			int boundary = boundaryInternal;
+			if (column == 0)
+			{
+				boundary |= boundaryL;
+			}
+			else
+			{
+				node.leftNodeID = nodeIndex(column - 1, row) + 1;
+			}
+			if (column == numColumns)
+			{
+				boundary |= boundaryR;
+			}
+			else
+			{
+				node.rightNodeID = nodeIndex(column + 1, row) + 1;
+			}
+			if (row == 0)
+			{
+				boundary |= boundaryT;
+			}
+			else
+			{
+				node.topNodeID = nodeIndex(column, row - 1) + 1;
+			}
+			if (row == numRows)
+			{
+				boundary |= boundaryB;
+			}
+			else
+			{
+				node.bottomNodeID = nodeIndex(column, row + 1) + 1;
+			}
+			node.boundaryType = static_cast<BoundaryType>(boundary);
+
+			// Periodic nodes in x and y directions
+			if (column == 0 || column == numColumns)
+			{
+				node.periodicX1NodeID = nodeIndex(numColumns - column, row) + 1;
+			}
+			if (row == 0 || row == numRows)
+			{
+				node.periodicX2NodeID = nodeIndex(column, numRows - row) + 1;
+			}
+		}
+	}
+
+	// Cells, with nodes ordered anticlockwise from the top left, and adjacent 
+	// cell IDs of 0 on the domain boundary
+	double hAverage = 0;
+	std::vector<CellGeometry> cells(numCells);
+	for (int column = 0; column < numColumns; column++)
+	{
+		for (int row = 0; row < numRows; row++)
 		{
-			int j = nodesVector.nodes[i].bottomNodeID - 1;
-			while (nodesVector.nodes[j].boundaryType != "BL" &&
-				nodesVector.nodes[j].boundaryType != "B" &&
-				nodesVector.nodes[j].boundaryType != "BR")
+			CellGeometry &cell = cells[cellIndex(column, row)];
+			int nodeTL = nodeIndex(column, row);
+			int nodeBR = nodeIndex(column + 1, row + 1);
+			cell.connectivity.nodeIDs = { nodeTL + 1, nodeIndex(column, row + 1) + 1,
+				nodeBR + 1, nodeIndex(column + 1, row) + 1 };
+			cell.firstNodePosition = boundaryTL;
+
+			cell.left = nodes[nodeTL].geometry.X(0);
+			cell.right = nodes[nodeBR].geometry.X(0);
+			cell.top = nodes[nodeTL].geometry.X(1);
+			cell.bottom = nodes[nodeBR].geometry.X(1);
+			hAverage += cell.right - cell.left + cell.top - cell.bottom;
+
+			cell.leftCellID = column > 0 ? cellIndex(column - 1, row) + 1 : 0;
+			cell.rightCellID = column < numColumns - 1 ? cellIndex(column + 1, row) + 1 : 0;
+			cell.topCellID = row > 0 ? cellIndex(column, row - 1) + 1 : 0;
+			cell.bottomCellID = row < numRows - 1 ? cellIndex(column, row + 1) + 1 : 0;
+
+			int boundary = boundaryInternal;
+			if (column == 0)
+			{
+				boundary |= boundaryL;
+			}
+			if (column == numColumns - 1)
+			{
+				boundary |= boundaryR;
+			}
+			if (row == 0)
+			{
+				boundary |= boundaryT;
+			}
+			if (row == numRows - 1)
+			{
+				boundary |= boundaryB;
+			}
+			cell.boundaryType = static_cast<BoundaryType>(boundary);
+
+			// Periodic cells in x and y directions
+			if (column == 0 || column == numColumns - 1)
+			{
+				cell.periodicX1CellID = cellIndex(numColumns - 1 - column, row) + 1;
+			}
+			if (row == 0 || row == numRows - 1)
 			{
-				j = nodesVector.nodes[j].bottomNodeID - 1;
+				cell.periodicX2CellID = cellIndex(column, numRows - 1 - row) + 1;
 			}
-			nodesVector.nodes[i].periodicX2NodeID = j + 1;
-			nodesVector.nodes[j].periodicX2NodeID = i + 1;
 		}
 	}
+
+	h = hAverage / static_cast<double>((2 * numCells));
+	shareGeometry(nodes, cells);
 	localParametersList->logBrief("Additional mesh pre-processing complete", 1);
 }
 
 
+// Move generated geometry into storage shared by copies of the mesh, and
+// allocate the node and cell properties which each copy updates
+void Mesh::shareGeometry(std::vector<NodeGeometry> &nodes, std::vector<CellGeometry> &cells)
+{
+	nodeGeometry = std::make_shared<const std::vector<NodeGeometry>>(std::move(nodes));
+	cellGeometry = std::make_shared<const std::vector<CellGeometry>>(std::move(cells));
+	nodesVector.allocate(numNodes);
+	cellsVector.allocate(numCells);
+}
+
+
+// Assemble the field operators for the boundary conditions and solver of a
+// parameters list. These only depend on the mesh geometry, so are assembled
+// once and shared by copies of the mesh (e.g. the patches of a simulation).
+void Mesh::assembleOperators(Parameters *localParametersList)
+{
+	if (localParametersList->solverType == "PCG" || localParametersList->solverType == "BiCGStab")
+	{
+		std::shared_ptr<PoissonMatrix> matrix = std::make_shared<PoissonMatrix>();
+		matrix->assemble(localParametersList, this);
+		poissonMatrix = matrix;
+	}
+	std::shared_ptr<GradientOperator> gradient = std::make_shared<GradientOperator>();
+	gradient->assemble(localParametersList, this);
+	gradientOperator = gradient;
+}
+
+
 // Destructor
 Mesh::~Mesh()
 {
 }
 
 
-// Assign particle IDs to a cell
+// Assign particle IDs to a cell, particles must then be sorted into tiles again
 void Mesh::addParticlesToCell(int cellID, int particleID)
 {
 	cellsVector.cells[cellID - 1].listOfParticles.push_back(particleID);
+	tilesVector.binsValid = false;
 }
 
 
-// Remove particle IDs from a cell
+// Remove particle IDs from a cell, particles must then be sorted into tiles again
 void Mesh::removeParticlesFromCell(int cellID, int particleID)
 {
-	for (int i = 0; i < cellsVector.cells[cellID - 1].listOfParticles.size(); i++)
+	tilesVector.binsValid = false;
+	for (unsigned int i = 0; i < cellsVector.cells[cellID - 1].listOfParticles.size(); i++)
 	{
 		if (cellsVector.cells[cellID - 1].listOfParticles[i] == particleID)
 		{
@@ -573,3 +746,49 @@ void Mesh::removeParticlesFromCell(int cellID, int particleID)
 		}
 	}
 }
+
+
+// Give each pair of periodic boundary nodes the mean of a property, in x
+// and/or y, visiting the left and top nodes in index order. On a structured
+// mesh these are the first column and the first row.
+void Mesh::averagePeriodic(double Nodes::*property, bool periodicX1, bool periodicX2)
+{
+	std::vector<Nodes> &nodes = nodesVector.nodes;
+	auto average = [&](int i, int periodicNodeID)
+	{
+		nodes[i].*property = 0.5 * (nodes[i].*property + nodes[periodicNodeID - 1].*property);
+		nodes[periodicNodeID - 1].*property = nodes[i].*property;
+	};
+
+	if (structured)
+	{
+		for (int row = 0; row < numRows + 1 && periodicX1; row++)
+		{
+			int i = nodeIndex(0, row);
+			average(i, node(i).periodicX1NodeID);
+			if (row == 0 && periodicX2)
+			{
+				average(i, node(i).periodicX2NodeID);
+			}
+		}
+		for (int column = periodicX1 ? 1 : 0; column < numColumns + 1 && periodicX2; column++)
+		{
+			int i = nodeIndex(column, 0);
+			average(i, node(i).periodicX2NodeID);
+		}
+		return;
+	}
+
+	for (int i = 0; i < numNodes; i++)
+	{
+		BoundaryType type = node(i).boundaryType;
+		if (periodicX1 && (type == boundaryTL || type == boundaryL || type == boundaryBL))
+		{
+			average(i, node(i).periodicX1NodeID);
+		}
+		if (periodicX2 && (type == boundaryTL || type == boundaryT || type == boundaryTR))
+		{
+			average(i, node(i).periodicX2NodeID);
+		}
+	}
+}
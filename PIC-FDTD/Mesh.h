@@ -5,10 +5,16 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "GradientOperator.h"
+#include "PoissonMatrix.h"
 #include "VectorCell.h"
 #include "VectorFace.h"
-#include "VectorGhost.h"
 #include "VectorNode.h"
+#include "VectorTile.h"
 
 class Parameters;	// Forward declaration to resolve circular dependency 
 
@@ -30,22 +36,49 @@ public:
 	int numRows;							//!< Number of rows of cells
 	int numColumns;							//!< Number of columns of cells
 	double h;								//!< Cell width/length (assume uniform)
-	VectorCell cellsVector;					//!< Vector of cells
-	VectorFace facesVector;					//!< Vector of faces
-	VectorGhost ghostVector;				//!< Vector of ghost cells
-	VectorNode nodesVector;					//!< Vector of nodes
+	bool structured = false;				//!< Uniform rectangular grid, indexed by column and row
+	VectorCell cellsVector;					//!< Vector of cells, holding the particles in each cell
+	VectorNode nodesVector;					//!< Vector of nodes, holding the fields at each node
+	VectorTile tilesVector;					//!< Vector of tiles, empty unless tiling is enabled
+	std::shared_ptr<const std::vector<CellGeometry>>
+		cellGeometry;						//!< Bounds and connectivity of cells, shared by copies of the mesh
+	std::shared_ptr<const std::vector<NodeGeometry>>
+		nodeGeometry;						//!< Position and connectivity of nodes, shared by copies of the mesh
+	std::shared_ptr<const PoissonMatrix>
+		poissonMatrix;						//!< Assembled Poisson operator, null unless a Krylov solver is used
+	std::shared_ptr<const GradientOperator>
+		gradientOperator;					//!< Electric field stencils, null until operators are assembled
 
 
 	// Constructor/destructor
 	Mesh();									//!< Default constructor
 	Mesh(Parameters *localParametersList, 
 		std::string type);					//!< Constructor
+	Mesh(const Mesh &mesh) = default;		//!< Copy constructor
+	Mesh(Mesh &&mesh) = default;			//!< Move constructor
 	~Mesh();								//!< Destructor
+	Mesh &operator=(const Mesh &mesh) = default;	//!< Copy assignment
+	Mesh &operator=(Mesh &&mesh) = default;		//!< Move assignment
 
 
 	// Methods
+	void generateStructuredMesh(Parameters *localParametersList, 
+		double spacing);					//!< Generate nodes and cells of a uniform rectangular grid
+	void shareGeometry(std::vector<NodeGeometry> &nodes,
+		std::vector<CellGeometry> &cells);	//!< Move generated geometry into shared storage and allocate node and cell properties
+	void assembleOperators(Parameters *localParametersList);	//!< Assemble field operators, shared by copies of the mesh
+	const CellGeometry &cell(int cellID) const
+	{ return (*cellGeometry)[cellID]; }		//!< Geometry of cell, indexed from 0
+	const NodeGeometry &node(int nodeID) const
+	{ return (*nodeGeometry)[nodeID]; }		//!< Geometry of node, indexed from 0
+	int cellIndex(int column, int row) const
+	{ return column * numRows + row; }		//!< Index of cell in a structured mesh, rows counted from top
+	int nodeIndex(int column, int row) const
+	{ return column * (numRows + 1) + row; }	//!< Index of node in a structured mesh, rows counted from top
 	void addParticlesToCell(int cellID, 
 		int particleID);					//!< Assign particle IDs to a cell
 	void removeParticlesFromCell(int cellID,
 		int particleID);					//!< Remove particle IDs from a cell
+	void averagePeriodic(double Nodes::*property,
+		bool periodicX1, bool periodicX2);	//!< Average a node property over pairs of periodic boundary nodes
 };
\ No newline at end of file
@@ -1,5 +1,5 @@
 //! \file
-//! \brief Implementation of Nodes class 
+//! \brief Implementation of Nodes and NodeGeometry classes 
 //! \author Rahul Kalampattel
 //! \date Last updated February 2018
 
@@ -11,8 +11,20 @@ Nodes::Nodes()
 }
 
 
+// Destructor
+Nodes::~Nodes()
+{
+}
+
+
+// Default constructor
+NodeGeometry::NodeGeometry()
+{
+}
+
+
 // Constructor
-Nodes::Nodes(NodeBase baseNode)
+NodeGeometry::NodeGeometry(NodeBase baseNode)
 {
 	this->connectivity = baseNode.connectivity;
 	this->geometry = baseNode.geometry;
@@ -20,6 +32,6 @@ Nodes::Nodes(NodeBase baseNode)
 
 
 // Destructor
-Nodes::~Nodes()
+NodeGeometry::~NodeGeometry()
 {
 }
\ No newline at end of file
@@ -1,19 +1,35 @@
 //! \file
-//! \brief Definition of Nodes class 
+//! \brief Definition of Nodes and NodeGeometry classes 
 //! \author Rahul Kalampattel
 //! \date Last updated April 2018
 
 #pragma once
 
-#include "GRID\node.hpp"
+#include <string>
+#include <vector>
 
-// TODO: Either make Nodes a base class and derive separate classes for the PIC
-// and FDTD meshes, or just make a derived class for FDTD mesh nodes, keeping 
-// parameters like PICcellID and YeeType
+#include "GRID/node.hpp"
 
-//! \class Nodes
-//! \brief Contains node properties, derived from NodeBase
-class Nodes : public NodeBase
+//! \enum BoundaryType
+//! \brief Position of a node or cell on the domain boundary, as a bitmask so
+//! that each corner is the union of the two edges meeting there
+enum BoundaryType : unsigned char
+{
+	boundaryInternal = 0,					//!< Not on the boundary
+	boundaryL = 1,							//!< Left edge
+	boundaryR = 2,							//!< Right edge
+	boundaryT = 4,							//!< Top edge
+	boundaryB = 8,							//!< Bottom edge
+	boundaryTL = boundaryT | boundaryL,		//!< Top left corner
+	boundaryTR = boundaryT | boundaryR,		//!< Top right corner
+	boundaryBL = boundaryB | boundaryL,		//!< Bottom left corner
+	boundaryBR = boundaryB | boundaryR		//!< Bottom right corner
+};
+
+//! \class NodeGeometry
+//! \brief Position and connectivity of a node, derived from NodeBase. These do
+//! not change once the mesh is generated, so are shared by copies of the mesh.
+class NodeGeometry : public NodeBase
 {
 public:
 	// Data members
@@ -23,12 +39,27 @@ public:
 	int bottomNodeID = -1;					//!< ID of node to bottom
 	int periodicX1NodeID = -1;				//!< ID of periodic node, x/z direction (not valid for internal nodes)
 	int	periodicX2NodeID = -1;				//!< ID of periodic node, y/r direction (not valid for internal nodes or axisymmetric cases)
-	int PICcellID = -1;						//!< ID of PIC mesh cell which the FDTD mesh node occupies
-	std::string boundaryType;				//!< Position on boundary
+	BoundaryType boundaryType =
+		boundaryInternal;					//!< Position on boundary
+
+
+	// Constructor/destructor
+	NodeGeometry();							//!< Default constructor
+	NodeGeometry(NodeBase baseNode);		//!< Constructor
+	~NodeGeometry();						//!< Destructor
+};
 
+//! \class Nodes
+//! \brief Contains the field and particle properties of a node, which are
+//! updated by each patch
+class Nodes
+{
+public:
+	// Data members
 	double charge = -1;						//!< Charge at the grid node
 	double rho = -1;						//!< Charge density at the grid node
 	double phi = -1;						//!< Potential at the grid node
+	double oldPhi = 0;						//!< Potential at the grid node from the previous solve
 	std::vector<double> current
 	{ -1.0, -1.0 };							//!< Current
 	std::vector<double> EMfield
@@ -37,7 +68,6 @@ public:
 
 	// Constructor/destructor
 	Nodes();								//!< Default constructor
-	Nodes(NodeBase baseNode);				//!< Constructor
 	~Nodes();								//!< Destructor
 
 
@@ -38,9 +38,15 @@ Parameters::Parameters(std::string filename)
 			else
 			{
 				inputFile >> name >> value;
+				name = firstCharacter + name;
+				if (name.back() == ':')
+				{
+					name.pop_back();
+				}
 				if (value.front() != '%' && value.back() != ':')
 				{
 					valuesVector.push_back(value);
+					namesVector.push_back(name);
 					inputFile.ignore(256, '\n');
 				}
 				// Check for empty arguments
@@ -49,18 +55,22 @@ Parameters::Parameters(std::string filename)
 					while (true)
 					{
 						valuesVector.push_back("DEFAULT");
+						namesVector.push_back(name);
 						if (value.back() == ':')
 						{
+							name = value.substr(0, value.size() - 1);
 							inputFile >> value;
 							if (value.front() == '%')
 							{
 								valuesVector.push_back("DEFAULT");
+								namesVector.push_back(name);
 								inputFile.ignore(256, '\n');
 								break;
 							}
 							else if (value.back() != ':')
 							{
 								valuesVector.push_back(value);
+								namesVector.push_back(name);
 								inputFile.ignore(256, '\n');
 								break;
 							}
@@ -509,7 +519,8 @@ void Parameters::assignInputs()
 				outputs.push_back(value);
 			}
 
-			for (int i = 0; i < outputs.size(); i++)
+			initialPosition.clear();
+			for (unsigned int i = 0; i < outputs.size(); i++)
 			{
 				initialPosition.push_back(stod(outputs[i]));
 				if (initialPosition[i] < 0.0 || initialPosition[i] > 1.0)
@@ -560,7 +571,8 @@ void Parameters::assignInputs()
 				outputs.push_back(value);
 			}
 
-			for (int i = 0; i < outputs.size(); i++)
+			initialVelocity.clear();
+			for (unsigned int i = 0; i < outputs.size(); i++)
 			{
 				initialVelocity.push_back(stod(outputs[i]));
 			}
@@ -677,7 +689,8 @@ void Parameters::assignInputs()
 				outputs.push_back(value);
 			}
 
-			for (int i = 0; i < outputs.size(); i++)
+			Efield.clear();
+			for (unsigned int i = 0; i < outputs.size(); i++)
 			{
 				Efield.push_back(stod(outputs[i]));
 			}
@@ -719,7 +732,8 @@ void Parameters::assignInputs()
 				outputs.push_back(value);
 			}
 
-			for (int i = 0; i < outputs.size(); i++)
+			Bfield.clear();
+			for (unsigned int i = 0; i < outputs.size(); i++)
 			{
 				Bfield.push_back(stod(outputs[i]));
 			}
@@ -1076,7 +1090,8 @@ void Parameters::assignInputs()
 				throw 0.0;
 			}
 			solverType = valuesVector[index];
-			if (solverType == "GS" || solverType == "FFT")
+			if (solverType == "GS" || solverType == "FFT" || solverType == "PCG" ||
+				solverType == "BiCGStab")
 			{
 			}
 			else
@@ -1096,7 +1111,7 @@ void Parameters::assignInputs()
 		}
 		catch (int error)
 		{
-			logBrief("Solver type should be GS or FFT, default value will be used", 2);
+			logBrief("Solver type should be GS, FFT, PCG or BiCGStab, default value will be used", 2);
 			useDefaultArgument = true;
 		}
 		if (useDefaultArgument == true)
@@ -1226,14 +1241,7 @@ void Parameters::assignInputs()
 			{
 				throw 0.0;
 			}
-			leftBCType = valuesVector[index];
-			if (leftBCType == "periodic" || leftBCType == "open" || leftBCType == "dirichlet" || leftBCType == "neumann")
-			{
-			}
-			else
-			{
-				throw 1;
-			}
+			leftBCType = stringToBCType(valuesVector[index]);
 		}
 		catch (double error)
 		{
@@ -1253,7 +1261,7 @@ void Parameters::assignInputs()
 		if (useDefaultArgument == true)
 		{
 			valuesVector[index] = "dirichlet";
-			leftBCType = valuesVector[index];
+			leftBCType = stringToBCType(valuesVector[index]);
 			useDefaultArgument = false;
 		}
 		logBrief("Left boundary condition type: " + valuesVector[index], 1);
@@ -1294,14 +1302,7 @@ void Parameters::assignInputs()
 			{
 				throw 0.0;
 			}
-			rightBCType = valuesVector[index];
-			if (rightBCType == "periodic" || rightBCType == "open" || rightBCType == "dirichlet" || rightBCType == "neumann")
-			{
-			}
-			else
-			{
-				throw 1;
-			}
+			rightBCType = stringToBCType(valuesVector[index]);
 		}
 		catch (double error)
 		{
@@ -1321,10 +1322,10 @@ void Parameters::assignInputs()
 		if (useDefaultArgument == true)
 		{
 			valuesVector[index] = "dirichlet";
-			rightBCType = valuesVector[index];
+			rightBCType = stringToBCType(valuesVector[index]);
 			useDefaultArgument = false;
 		}
-		if ((rightBCType == "periodic" && leftBCType != "periodic") || (rightBCType != "periodic" && leftBCType == "periodic"))
+		if ((rightBCType == bcPeriodic && leftBCType != bcPeriodic) || (rightBCType != bcPeriodic && leftBCType == bcPeriodic))
 		{
 			logBrief("Periodic boundary conditions must be used on left and right boundaries", 3);
 		}
@@ -1366,14 +1367,7 @@ void Parameters::assignInputs()
 			{
 				throw 0.0;
 			}
-			topBCType = valuesVector[index];
-			if (topBCType == "periodic" || topBCType == "open" || topBCType == "dirichlet" || topBCType == "neumann")
-			{
-			}
-			else
-			{
-				throw 1;
-			}
+			topBCType = stringToBCType(valuesVector[index]);
 		}
 		catch (double error)
 		{
@@ -1393,7 +1387,7 @@ void Parameters::assignInputs()
 		if (useDefaultArgument == true)
 		{
 			valuesVector[index] = "dirichlet";
-			topBCType = valuesVector[index];
+			topBCType = stringToBCType(valuesVector[index]);
 			useDefaultArgument = false;
 		}
 		logBrief("Top boundary condition type: " + valuesVector[index], 1);
@@ -1434,14 +1428,7 @@ void Parameters::assignInputs()
 			{
 				throw 0.0;
 			}
-			bottomBCType = valuesVector[index];
-			if (bottomBCType == "periodic" || bottomBCType == "open" || bottomBCType == "dirichlet" || bottomBCType == "neumann")
-			{
-			}
-			else
-			{
-				throw 1;
-			}
+			bottomBCType = stringToBCType(valuesVector[index]);
 		}
 		catch (double error)
 		{
@@ -1461,21 +1448,26 @@ void Parameters::assignInputs()
 		if (useDefaultArgument == true)
 		{
 			valuesVector[index] = "dirichlet";
-			bottomBCType = valuesVector[index];
+			bottomBCType = stringToBCType(valuesVector[index]);
 			useDefaultArgument = false;
 		}
-		if ((bottomBCType == "periodic" && topBCType != "periodic") || (bottomBCType != "periodic" && topBCType == "periodic"))
+		if ((bottomBCType == bcPeriodic && topBCType != bcPeriodic) || (bottomBCType != bcPeriodic && topBCType == bcPeriodic))
 		{
 			logBrief("Periodic boundary conditions must be used on top and bottom boundaries", 3);
 		}
-		if (bottomBCType == "periodic" && axisymmetric == true)
+		if (bottomBCType == bcPeriodic && axisymmetric == true)
 		{
 			logBrief("Cannot have periodic top/bottom BCs in axisymmetric simulations", 3);
 		}
-		if (bottomBCType == "periodic" && rightBCType == "periodic")
+		if (bottomBCType == bcPeriodic && rightBCType == bcPeriodic)
 		{
 			logBrief("Cannot have periodic BCs in all four directions", 3);
 		}
+		if (solverType == "FFT" && !userMesh)
+		{
+			logBrief("FFT solver requires a rectangular user-defined mesh, GS will be used", 2);
+			solverType = "GS";
+		}
 		logBrief("Bottom boundary condition type: " + valuesVector[index], 1);
 		index++;
 
@@ -1694,400 +1686,884 @@ void Parameters::assignInputs()
 		}
 		logBrief("Global solution file name: " + valuesVector[index], 1);
 		index++;
-	}
-}
-
-
-// Process mesh file
-void Parameters::generateMesh(std::string type)
-{
-	double h;
-	std::string meshFile;
-	if (type == "PIC")
-	{
-		h = PICspacing;
-		meshFile = meshFilePIC;
-	}
-	else if (type == "FDTD")
-	{
-		// Since the effective grid spacing of a Yee mesh is half that of a regular
-		// mesh, we divide the input spacing by two
-		h = FDTDspacing / 2.0;
-		meshFile = meshFileFDTD;
-	}
-
-	if (abs((domainLength / h) - round(domainLength / h)) <= 1e-10 &&
-		abs((domainHeight / h) - round(domainHeight / h)) <= 1e-10)
-	{
-		// Number of cells in each direction (length and height)
-		int NL = round(domainLength / h);
-		int NH = round(domainHeight / h);
-
-		// Number of cells, nodes and faces
-		int NCM = NL * NH;
-		int NNM = (NL + 1) * (NH + 1);
-		int NFM = (NL + 1) * NH + (NH + 1) * NL;
 
-		std::vector<std::vector<double>> nodesVector;
-		std::vector<std::vector<int>> cellsVector;
-		std::vector<std::vector<int>> facesVector;
 
-		// Create nodes
-		int nodeID = 0;
-		for (int i = 0; i < NL + 1; i++)
+		// Older input files may not contain the timing output parameters
+		if (static_cast<int>(valuesVector.size()) < index + 2)
 		{
-			for (int j = 0; j < NH + 1; j++)
-			{
-				std::vector<double> node = { h * i,domainHeight - h * j };
-				nodesVector.push_back(node);
-
-				// Check for boundary nodes
-				if (abs(nodesVector[nodeID][0] - 0.0) <= 1e-10 ||
-					abs(nodesVector[nodeID][0] - domainLength) <= 1e-10 ||
-					abs(nodesVector[nodeID][1] - 0.0) <= 1e-10 ||
-					abs(nodesVector[nodeID][1] - domainHeight) <= 1e-10)
-				{
-					nodesVector[nodeID].push_back(1.0);
-				}
-				else
-				{
-					nodesVector[nodeID].push_back(0.0);
-				}
-
-				nodeID++;
-			}
+			valuesVector.resize(index + 2, "DEFAULT");
 		}
 
-		// Create cells and link to nodes
-		for (int cellID = 1; cellID < NCM + 1; cellID++)
+		try
 		{
-			int column = floor(cellID / NH);
-			int row = cellID % NH;
-			if (row == 0)
+			if (valuesVector[index] == "DEFAULT")
 			{
-				column--;
-				row = NH;
+				throw 0.0;
+			}
+			timelineOutput = valuesVector[index];
+			if (timelineOutput != "none" && timelineOutput != "csv" && timelineOutput != "json")
+			{
+				throw 1;
 			}
-
-			int node1 = (NH + 1)*column + row;
-			int node2 = (NH + 1)*column + row + 1;
-			int node3 = (NH + 1)*(column + 1) + row + 1;
-			int node4 = (NH + 1)*(column + 1) + row;
-
-			std::vector<int> cell = { node1,node2,node3,node4,0,0,0,0 };
-			cellsVector.push_back(cell);
 		}
-
-		// Create faces and link to nodes and cells
-		int faceID = 0;
-		for (int cellID = 1; cellID < NCM + 1; cellID++)
+		catch (double error)
 		{
-			int node1 = cellsVector[cellID - 1][0];
-			int node2 = cellsVector[cellID - 1][1];
-			int node3 = cellsVector[cellID - 1][2];
-			int node4 = cellsVector[cellID - 1][3];
-
-			// Left face
-			if (nodesVector[node1 - 1][2] == 1.0 &&
-				nodesVector[node2 - 1][2] == 1.0)
-			{
-				faceID++;
-				std::vector<int> face = { -1,node1,node2,cellID,0 };
-				facesVector.push_back(face);
-				cellsVector[cellID - 1][4] = faceID;
-			}
-			else if (node1 < node2)
-			{
-				faceID++;
-				std::vector<int> face = { 0,node2,node1,cellID - NH,cellID };
-				facesVector.push_back(face);
-				cellsVector[cellID - 1][4] = faceID;
-				cellsVector[cellID - NH - 1][6] = faceID;
-			}
-
-			// Bottom face
-			if (nodesVector[node2 - 1][2] == 1.0 &&
-				nodesVector[node3 - 1][2] == 1.0)
-			{
-				faceID++;
-				std::vector<int> face = { -1,node2,node3,cellID,0 };
-				facesVector.push_back(face);
-				cellsVector[cellID - 1][5] = faceID;
-			}
-			else if (node2 < node3)
-			{
-				faceID++;
-				std::vector<int> face = { 0,node2,node3,cellID,cellID + 1 };
-				facesVector.push_back(face);
-				cellsVector[cellID - 1][5] = faceID;
-				cellsVector[cellID][7] = faceID;
-			}
-
-			// Right face
-			if (nodesVector[node3 - 1][2] == 1.0 &&
-				nodesVector[node4 - 1][2] == 1.0)
-			{
-				faceID++;
-				std::vector<int> face = { -1,node3,node4,cellID,0 };
-				facesVector.push_back(face);
-				cellsVector[cellID - 1][6] = faceID;
-			}
-
-			// Top face
-			if (nodesVector[node4 - 1][2] == 1.0 &&
-				nodesVector[node1 - 1][2] == 1.0)
-			{
-				faceID++;
-				std::vector<int> face = { -1,node4,node1,cellID,0 };
-				facesVector.push_back(face);
-				cellsVector[cellID - 1][7] = faceID;
-			}
-		}
-
-		std::ofstream mesh_file_OP2(meshFile + ".op2", std::ios::trunc);
-
-		// Write mesh file in OP2A format
-		if (mesh_file_OP2.is_open())
-		{
-			mesh_file_OP2 << "%*****************************************************" << std::endl;
-			mesh_file_OP2 << "%     OP2A Grid File using FORMAT version 1.0         " << std::endl;
-			mesh_file_OP2 << "%                                                     " << std::endl;
-			mesh_file_OP2 << "%                  Originally developed by Minkwan Kim" << std::endl;
-			mesh_file_OP2 << "%=====================================================" << std::endl;
-			mesh_file_OP2 << "% [FACE / CELL TYPE identifiers]                      " << std::endl;
-			mesh_file_OP2 << "%      Line                   :  3                    " << std::endl;
-			mesh_file_OP2 << "%      Triangle (3-nodes)     :  5                    " << std::endl;
-			mesh_file_OP2 << "%      Quadrilateral (4-nodes):  9                    " << std::endl;
-			mesh_file_OP2 << "%      Tetrahedral (4-nodes)  : 10                    " << std::endl;
-			mesh_file_OP2 << "%      Hexahedral (8-nodes)   : 12                    " << std::endl;
-			mesh_file_OP2 << "%      Prism (6-nodes)        : 13                    " << std::endl;
-			mesh_file_OP2 << "%      Pyramid (5-nodes)      : 14                    " << std::endl;
-			mesh_file_OP2 << "%                                                     " << std::endl;
-			mesh_file_OP2 << "% [BC TYPE identifiers]                               " << std::endl;
-			mesh_file_OP2 << "%      Interior               :  0                    " << std::endl;
-			mesh_file_OP2 << "%      Wall                   : 10                    " << std::endl;
-			mesh_file_OP2 << "%      Inlet                  : 20                    " << std::endl;
-			mesh_file_OP2 << "%      Outlet                 : 30                    " << std::endl;
-			mesh_file_OP2 << "%      Freestream (Far-field) : 40                    " << std::endl;
-			mesh_file_OP2 << "%      Symmetric              : 50                    " << std::endl;
-			mesh_file_OP2 << "%      Axisymmetric           : 60                    " << std::endl;
-			mesh_file_OP2 << "%      Anode                  : 70                    " << std::endl;
-			mesh_file_OP2 << "%      Cathode                : 80                    " << std::endl;
-			mesh_file_OP2 << "%      Dielectric material    : 90                    " << std::endl;
-			mesh_file_OP2 << "%                                                     " << std::endl;
-			mesh_file_OP2 << "% [DATA Format]                                       " << std::endl;
-			mesh_file_OP2 << "%    -Node Data FORMAT                                " << std::endl;
-			mesh_file_OP2 << "%     (NODE ID#)  (POSITION DATA: X Y Z)           " << std::endl;
-			mesh_file_OP2 << "%    -Face Data FORMAT                                " << std::endl;
-			mesh_file_OP2 << "%     (FACE ID#)  (BOUNDARY CONDITION)  (FACE TYPE)  (LIST OF NODE IDs) (LEFT-CELL ID) (RIGHT-CELL ID)" << std::endl;
-			mesh_file_OP2 << "%    -Cell Data FORMAT" << std::endl;
-			mesh_file_OP2 << "%     (CELL ID#)  (BOUNDARY CONDITION)  (CELL TYPE)  (LIST OF NODE IDs) (LIST OF FACE IDs)" << std::endl;
-			mesh_file_OP2 << "%=====================================================" << std::endl;
-			mesh_file_OP2 << "%                   Last Format Updated on April/2016 " << std::endl;
-			mesh_file_OP2 << "%                                       by M Kim      " << std::endl;
-			mesh_file_OP2 << "%*****************************************************" << std::endl << std::endl;
-
-			mesh_file_OP2 << "% OVERALL GRID INFORMATION" << std::endl;
-			mesh_file_OP2 << "DIM= " << 2 << std::endl;
-			mesh_file_OP2 << "NNM= " << NNM << std::endl;
-			mesh_file_OP2 << "NFM= " << NFM << std::endl;
-			mesh_file_OP2 << "NCM= " << NCM << std::endl;
-			mesh_file_OP2 << std::endl;
-
-			mesh_file_OP2 << "%%%%%%%%%%%" << std::endl;
-			mesh_file_OP2 << "NODEDATA= " << NNM << std::endl;
-			for (int n = 0; n < NNM; n++)
-			{
-				mesh_file_OP2 << std::setw(8) << n + 1 << std::setw(25) <<
-					std::scientific << std::setprecision(16) <<
-					nodesVector[n][0] << std::setw(25) << nodesVector[n][1] <<
-					std::setw(25) << 0.0 << std::endl;
-			}
-			mesh_file_OP2 << std::endl;
-
-			mesh_file_OP2 << "%%%%%%%%%%%%" << std::endl;
-			mesh_file_OP2 << "FACEDATA= " << NFM << std::endl;
-			for (int f = 0; f < NFM; f++)
-			{
-				mesh_file_OP2 << std::setw(8) << f + 1 << std::setw(8) <<
-					facesVector[f][0] << std::setw(8) << 3;
-				for (int i = 1; i <= 4; i++)
-					mesh_file_OP2 << std::setw(8) << facesVector[f][i];
-				mesh_file_OP2 << std::endl;
-			}
-			mesh_file_OP2 << std::endl;
-
-			mesh_file_OP2 << "%%%%%%%%%%%" << std::endl;
-			mesh_file_OP2 << "CELLDATA= " << NCM << std::endl;
-			for (int c = 0; c < NCM; c++)
-			{
-				mesh_file_OP2 << std::setw(8) << c + 1 << std::setw(8) << 0 <<
-					std::setw(8) << 9;
-				for (int i = 0; i < 8; i++)
-					mesh_file_OP2 << std::setw(8) << cellsVector[c][i];
-				mesh_file_OP2 << std::endl;
-			}
-			mesh_file_OP2 << std::endl;
-			mesh_file_OP2.close();
+			logBrief("No argument detected for timeline output format, default value will be used", 2);
+			useDefaultArgument = true;
 		}
-	}
-	else
-	{
-		logBrief("Grid spacing not uniform, please adjust", 3);
-	}
-}
+		catch (int error)
+		{
+			logBrief("Timeline output format should be none, csv or json, default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		if (useDefaultArgument == true)
+		{
+			valuesVector[index] = "none";
+			timelineOutput = valuesVector[index];
+			useDefaultArgument = false;
+		}
+		logBrief("Timeline output format: " + valuesVector[index], 1);
+		index++;
 
 
-// Process mesh file
-void Parameters::processMesh(std::string type)
-{
-	if (type == "PIC")
-	{
-		if (userMesh)
+		try
 		{
-			logMessages("Generating user mesh", __FILENAME__, __LINE__, 1);
-			generateMesh("PIC");
+			if (valuesVector[index] == "DEFAULT")
+			{
+				throw 0.0;
+			}
+			timelineFile = valuesVector[index];
 		}
-		else
+		catch (double error)
 		{
-			precessingGridSU2(meshFilePath, meshFilePIC);
+			logBrief("No argument detected for timeline file name, default value will be used", 2);
+			useDefaultArgument = true;
 		}
-		logMessages("Extracting mesh data", __FILENAME__, __LINE__, 1);
-		readGridFromFile(meshFilePIC + ".op2", gridinfoPIC, gridgeoPIC);
-		processingGrid(gridinfoPIC, gridgeoPIC);
-	}
-	else if (type == "FDTD")
-	{
-		logBrief("Generating FDTD mesh and extracting data", 1);
-		generateMesh("FDTD");
-		readGridFromFile(meshFileFDTD + ".op2", gridinfoFDTD, gridgeoFDTD);
-		processingGrid(gridinfoFDTD, gridgeoFDTD);
-	}
-}
-
+		if (useDefaultArgument == true)
+		{
+			valuesVector[index] = "cTimeline";
+			timelineFile = valuesVector[index];
+			useDefaultArgument = false;
+		}
+		logBrief("Timeline file name: " + valuesVector[index], 1);
+		index++;
 
-// Log messages, warnings and errors
-void Parameters::logMessages(std::string message, std::string filename, int line, int messageType)
-{
-	std::chrono::system_clock::time_point currentTime = std::chrono::system_clock::now();
-	std::chrono::duration<double> duration;
-	duration = currentTime - initialTime;
 
-	if (!firstLog)
-	{
-		std::ofstream logFile("logFile.txt", std::ios::app);	// Open log file, 'append' write mode
+		// Numerical scheme and ensemble parameters, which older input files may not contain
+		if (static_cast<int>(valuesVector.size()) < index + 13)
+		{
+			valuesVector.resize(index + 13, "DEFAULT");
+		}
 
-		if (!logFile.is_open())
+		try
 		{
-			while (!logFile.is_open())
+			if (valuesVector[index] == "DEFAULT")
 			{
-				std::cout << "Unable to open log file!!!" << std::endl;
-				logFile.close();
-				std::ofstream logFile("logFile.txt", std::ios::app);
-				if (logFile.is_open())
-				{
-					break;
-				}
+				throw 0.0;
+			}
+			shapeOrder = stoi(valuesVector[index]);
+			if (shapeOrder < shapeNGP || shapeOrder > shapeCubic)
+			{
+				throw 1;
+			}
+			else if (shapeOrder != shapeCIC && !userMesh)
+			{
+				throw 2;
 			}
 		}
-
-		if (messageType == 1)
+		catch (double error)
 		{
-			logFile << std::left << std::setfill('.') << std::setw(45) << "(" +
-				filename + ", line " + std::to_string(line) + ")" << message <<
-				std::right << std::setw(100 - message.length()) << "Elapsed time: " +
-				std::to_string(duration.count()) + " seconds" << std::endl;
+			logBrief("No argument detected for particle shape order, default value will be used", 2);
+			useDefaultArgument = true;
 		}
-		else if (messageType == 2)
+		catch (std::invalid_argument&)
 		{
-			logFile << std::left << std::setfill('.') << std::setw(45) << "(" +
-				filename + ", line " + std::to_string(line) + ")" << "## WARNING: " +
-				message << std::right << std::setw(100 - message.length()) << 
-				"Elapsed time: " + std::to_string(duration.count()) + " seconds" <<
-				std::endl;
+			logBrief("Invalid argument detected for particle shape order, default value will be used", 2);
+			useDefaultArgument = true;
 		}
-		else if (messageType == 3)
+		catch (int error)
 		{
-			logFile << std::left << std::setfill('.') << std::setw(45) << "(" +
-				filename + ", line " + std::to_string(line) + ")" << "#### ERROR: " + 
-				message << std::right << std::setw(100 - message.length()) << 
-				"Elapsed time: " + std::to_string(duration.count()) + " seconds" <<
-				std::endl;
-			numErrors += 1;
+			if (error == 1)
+			{
+				logBrief("Particle shape order should be between 0 and 3, default value will be used", 2);
+			}
+			else
+			{
+				logBrief("Higher order particle shapes require a user-defined mesh, default value will be used", 2);
+			}
+			useDefaultArgument = true;
 		}
-		logFile.close();
+		if (useDefaultArgument == true)
+		{
+			valuesVector[index] = "1";
+			shapeOrder = stoi(valuesVector[index]);
+			useDefaultArgument = false;
+		}
+		logBrief("Particle shape order: " + valuesVector[index], 1);
+		index++;
 
-		std::cout << message << std::endl;
-	}
-	else
-	{
-		std::ofstream logFile("logFile.txt", std::ios::trunc);	// Open log file, 'truncate' write mode
 
-		if (!logFile.is_open())
+		try
 		{
-			while (!logFile.is_open())
+			if (valuesVector[index] == "DEFAULT")
 			{
-				std::cout << "Unable to open log file!!!" << std::endl;
-				logFile.close();
-				std::ofstream logFile("logFile.txt", std::ios::trunc);
-				if (logFile.is_open())
-				{
-					break;
-				}
+				throw 0.0;
+			}
+			currentDeposition = valuesVector[index];
+			if (currentDeposition != "direct" && currentDeposition != "esirkepov")
+			{
+				throw 1;
+			}
+			else if (currentDeposition == "esirkepov" && (!userMesh || axisymmetric))
+			{
+				throw 2;
 			}
 		}
+		catch (double error)
+		{
+			logBrief("No argument detected for current deposition scheme, default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		catch (int error)
+		{
+			if (error == 1)
+			{
+				logBrief("Current deposition scheme should be direct or esirkepov, default value will be used", 2);
+			}
+			else
+			{
+				logBrief("Esirkepov current deposition requires a Cartesian user-defined mesh, default value will be used", 2);
+			}
+			useDefaultArgument = true;
+		}
+		if (useDefaultArgument == true)
+		{
+			valuesVector[index] = "direct";
+			currentDeposition = valuesVector[index];
+			useDefaultArgument = false;
+		}
+		logBrief("Current deposition scheme: " + valuesVector[index], 1);
+		index++;
 
-		char time[26];
-		std::time_t clockTime = std::chrono::system_clock::to_time_t(currentTime);
-		ctime_s(time, sizeof time, &clockTime);
-		logFile << "Simulation start time: " << time << std::endl;
-			
-		logFile << std::left << std::setfill('.') << std::setw(45) << "(" + 
-			filename + ", line " + std::to_string(line) + ")" << message << 
-			std::right << std::setw(100 - message.length()) << "Elapsed time: " + 
-			std::to_string(duration.count()) + " seconds" << std::endl;
-		logFile.close();
-
-		std::cout << message << std::endl;
-		firstLog = false;
-	}
-
-}
-
+		// Esirkepov currents only drive the fields through the FDTD solver,
+		// which must then advance them at every time step
+		if (currentDeposition == "esirkepov" && FDTDfrequency != 1)
+		{
+			logBrief("Esirkepov current deposition requires an FDTD frequency of 1, which will be used", 2);
+			FDTDfrequency = 1;
+		}
 
-// Log brief messages
-void Parameters::logBrief(std::string message, int messageType)
-{
-	std::ofstream logFile("logFile.txt", std::ios::app);	// Open log file, 'append' write mode
 
-	if (!logFile.is_open())
-	{ 
-		while (!logFile.is_open())
+		try
 		{
-			std::cout << "Unable to open log file!!!" << std::endl;
-			logFile.close();
-			std::ofstream logFile("logFile.txt", std::ios::app);
-			if (logFile.is_open())
+			if (valuesVector[index] == "DEFAULT")
+			{
+				throw 0.0;
+			}
+			int value = stoi(valuesVector[index]);
+			if (value == 1)
+			{
+				fusedKernel = true;
+			}
+			else if (value == 0)
 			{
-				break;
+				fusedKernel = false;
+			}
+			else
+			{
+				throw 1;
 			}
 		}
-	}
+		catch (double error)
+		{
+			logBrief("No argument detected for fused kernel flag, default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		catch (std::invalid_argument&)
+		{
+			logBrief("Invalid argument detected for fused kernel flag, default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		catch (int error)
+		{
+			logBrief("Fused kernel flag should be true (1) or false (0), default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		if (useDefaultArgument == true)
+		{
+			valuesVector[index] = "0";
+			fusedKernel = false;
+			useDefaultArgument = false;
+		}
+		logBrief("Fused kernel flag: " + valuesVector[index], 1);
+		index++;
 
-	if (messageType == 1)
-	{
-		logFile << std::left << std::setw(45) << " " << message << std::endl;
-	}
-	else if (messageType == 2)
-	{
-		logFile << std::left << std::setw(45) << " " << "## WARNING: " + message << std::endl;
-	}
-	else if (messageType == 3)
-	{
-		logFile << std::left << std::setw(45) << " " << "#### ERROR: " + message << std::endl;
-		numErrors += 1;
-	}
-	logFile.close();
 
-	std::cout << message << std::endl;
-}
\ No newline at end of file
+		try
+		{
+			if (valuesVector[index] == "DEFAULT")
+			{
+				throw 0.0;
+			}
+			tileSize = stoi(valuesVector[index]);
+			if (tileSize < 0)
+			{
+				throw 1;
+			}
+			else if (tileSize > 0 && !userMesh)
+			{
+				throw 2;
+			}
+		}
+		catch (double error)
+		{
+			logBrief("No argument detected for tile size, default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		catch (std::invalid_argument&)
+		{
+			logBrief("Invalid argument detected for tile size, default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		catch (int error)
+		{
+			if (error == 1)
+			{
+				logBrief("Tile size should be 0 (no tiling) or a positive number of cells, default value will be used", 2);
+			}
+			else
+			{
+				logBrief("Tiling requires a user-defined mesh, default value will be used", 2);
+			}
+			useDefaultArgument = true;
+		}
+		if (useDefaultArgument == true)
+		{
+			valuesVector[index] = "0";
+			tileSize = stoi(valuesVector[index]);
+			useDefaultArgument = false;
+		}
+		logBrief("Tile size: " + valuesVector[index], 1);
+		index++;
+
+
+		try
+		{
+			if (valuesVector[index] == "DEFAULT")
+			{
+				throw 0.0;
+			}
+			loadBalanceFrequency = stoi(valuesVector[index]);
+			if (loadBalanceFrequency < 0)
+			{
+				throw 1;
+			}
+			else if (loadBalanceFrequency > 0 && tileSize == 0)
+			{
+				throw 2;
+			}
+		}
+		catch (double error)
+		{
+			logBrief("No argument detected for load balance frequency, default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		catch (std::invalid_argument&)
+		{
+			logBrief("Invalid argument detected for load balance frequency, default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		catch (int error)
+		{
+			if (error == 1)
+			{
+				logBrief("Load balance frequency should be 0 (no balancing) or positive, default value will be used", 2);
+			}
+			else
+			{
+				logBrief("Load balancing requires tiling (tileSize > 0), default value will be used", 2);
+			}
+			useDefaultArgument = true;
+		}
+		if (useDefaultArgument == true)
+		{
+			valuesVector[index] = "0";
+			loadBalanceFrequency = stoi(valuesVector[index]);
+			useDefaultArgument = false;
+		}
+		logBrief("Load balance frequency: " + valuesVector[index], 1);
+		index++;
+
+
+		try
+		{
+			if (valuesVector[index] == "DEFAULT")
+			{
+				throw 0.0;
+			}
+			solverWarmStart = valuesVector[index];
+			if (solverWarmStart != "none" && solverWarmStart != "previous" &&
+				solverWarmStart != "extrapolate")
+			{
+				throw 1;
+			}
+			else if (solverWarmStart != "none" && solverType == "FFT")
+			{
+				throw 2;
+			}
+		}
+		catch (double error)
+		{
+			logBrief("No argument detected for solver warm start, default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		catch (int error)
+		{
+			if (error == 1)
+			{
+				logBrief("Solver warm start should be none, previous or extrapolate, default value will be used", 2);
+			}
+			else
+			{
+				logBrief("Solver warm start has no effect on the FFT solver, default value will be used", 2);
+			}
+			useDefaultArgument = true;
+		}
+		if (useDefaultArgument == true)
+		{
+			valuesVector[index] = "none";
+			solverWarmStart = valuesVector[index];
+			useDefaultArgument = false;
+		}
+		logBrief("Solver warm start: " + valuesVector[index], 1);
+		index++;
+
+
+		try
+		{
+			if (valuesVector[index] == "DEFAULT")
+			{
+				throw 0.0;
+			}
+			residualCheckInterval = stoi(valuesVector[index]);
+			if (residualCheckInterval < 1)
+			{
+				throw 1;
+			}
+		}
+		catch (double error)
+		{
+			logBrief("No argument detected for residual check interval, default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		catch (std::invalid_argument&)
+		{
+			logBrief("Invalid argument detected for residual check interval, default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		catch (int error)
+		{
+			logBrief("Residual check interval should be a positive number of iterations, default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		if (useDefaultArgument == true)
+		{
+			valuesVector[index] = "9";
+			residualCheckInterval = stoi(valuesVector[index]);
+			useDefaultArgument = false;
+		}
+		logBrief("Residual check interval: " + valuesVector[index], 1);
+		index++;
+
+
+		try
+		{
+			if (valuesVector[index] == "DEFAULT")
+			{
+				throw 0.0;
+			}
+			preconditioner = valuesVector[index];
+			if (preconditioner != "jacobi" && preconditioner != "ilu0")
+			{
+				throw 1;
+			}
+		}
+		catch (double error)
+		{
+			logBrief("No argument detected for preconditioner, default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		catch (int error)
+		{
+			logBrief("Preconditioner should be jacobi or ilu0, default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		if (useDefaultArgument == true)
+		{
+			valuesVector[index] = "jacobi";
+			preconditioner = valuesVector[index];
+			useDefaultArgument = false;
+		}
+		logBrief("Preconditioner: " + valuesVector[index], 1);
+		index++;
+
+
+		try
+		{
+			if (valuesVector[index] == "DEFAULT")
+			{
+				throw 0.0;
+			}
+			resampleFrequency = stoi(valuesVector[index]);
+			if (resampleFrequency < 0)
+			{
+				throw 1;
+			}
+		}
+		catch (double error)
+		{
+			logBrief("No argument detected for resample frequency, default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		catch (std::invalid_argument&)
+		{
+			logBrief("Invalid argument detected for resample frequency, default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		catch (int error)
+		{
+			logBrief("Resample frequency should be 0 (no resampling) or positive, default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		if (useDefaultArgument == true)
+		{
+			valuesVector[index] = "0";
+			resampleFrequency = stoi(valuesVector[index]);
+			useDefaultArgument = false;
+		}
+		logBrief("Resample frequency: " + valuesVector[index], 1);
+		index++;
+
+
+		try
+		{
+			if (valuesVector[index] == "DEFAULT")
+			{
+				throw 0.0;
+			}
+			targetParticlesPerCell = stoi(valuesVector[index]);
+			if (targetParticlesPerCell < 2)
+			{
+				throw 1;
+			}
+		}
+		catch (double error)
+		{
+			logBrief("No argument detected for target particles per cell, default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		catch (std::invalid_argument&)
+		{
+			logBrief("Invalid argument detected for target particles per cell, default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		catch (int error)
+		{
+			logBrief("Target particles per cell should be at least 2, default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		if (useDefaultArgument == true)
+		{
+			valuesVector[index] = std::to_string(std::max(particlesPerCell, 2));
+			targetParticlesPerCell = stoi(valuesVector[index]);
+			useDefaultArgument = false;
+		}
+		logBrief("Target particles per cell: " + valuesVector[index], 1);
+		index++;
+
+
+		try
+		{
+			if (valuesVector[index] == "DEFAULT")
+			{
+				throw 0.0;
+			}
+			subcycleInterval = stoi(valuesVector[index]);
+			if (subcycleInterval < 1)
+			{
+				throw 1;
+			}
+		}
+		catch (double error)
+		{
+			logBrief("No argument detected for sub-cycle interval, default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		catch (std::invalid_argument&)
+		{
+			logBrief("Invalid argument detected for sub-cycle interval, default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		catch (int error)
+		{
+			logBrief("Sub-cycle interval should be a positive number of time steps, default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		if (useDefaultArgument == true)
+		{
+			valuesVector[index] = "1";
+			subcycleInterval = stoi(valuesVector[index]);
+			useDefaultArgument = false;
+		}
+		logBrief("Sub-cycle interval: " + valuesVector[index], 1);
+		index++;
+
+
+		try
+		{
+			if (valuesVector[index] == "DEFAULT")
+			{
+				throw 0.0;
+			}
+			int value = stoi(valuesVector[index]);
+			if (value == 1)
+			{
+				openBoundaryInjection = true;
+			}
+			else if (value == 0)
+			{
+				openBoundaryInjection = false;
+			}
+			else
+			{
+				throw 1;
+			}
+		}
+		catch (double error)
+		{
+			logBrief("No argument detected for open boundary injection flag, default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		catch (std::invalid_argument&)
+		{
+			logBrief("Invalid argument detected for open boundary injection flag, default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		catch (int error)
+		{
+			logBrief("Open boundary injection flag should be true (1) or false (0), default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		if (useDefaultArgument == true)
+		{
+			valuesVector[index] = "0";
+			openBoundaryInjection = false;
+			useDefaultArgument = false;
+		}
+		logBrief("Open boundary injection flag: " + valuesVector[index], 1);
+		index++;
+
+
+		// Ensemble parameters
+		try
+		{
+			if (valuesVector[index] == "DEFAULT")
+			{
+				throw 0.0;
+			}
+			ensembleFile = valuesVector[index];
+			if (ensembleFile != "none" && !std::ifstream(ensembleFile).is_open())
+			{
+				throw 1;
+			}
+		}
+		catch (double error)
+		{
+			logBrief("No argument detected for ensemble file, default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		catch (int error)
+		{
+			logBrief("Ensemble file could not be opened, default value will be used", 2);
+			useDefaultArgument = true;
+		}
+		if (useDefaultArgument == true)
+		{
+			valuesVector[index] = "none";
+			ensembleFile = valuesVector[index];
+			useDefaultArgument = false;
+		}
+		logBrief("Ensemble file: " + valuesVector[index], 1);
+		index++;
+	}
+}
+
+
+// Size a user-defined (uniform rectangular) mesh, which is then generated
+// directly by Mesh using implicit column/row indexing
+void Parameters::generateMesh(std::string type)
+{
+	double h = PICspacing;
+	GridBasicInfo *gridinfo = &gridinfoPIC;
+	if (type == "FDTD")
+	{
+		// Since the effective grid spacing of a Yee mesh is half that of a regular
+		// mesh, we divide the input spacing by two
+		h = FDTDspacing / 2.0;
+		gridinfo = &gridinfoFDTD;
+	}
+
+	if (std::abs((domainLength / h) - round(domainLength / h)) <= 1e-10 &&
+		std::abs((domainHeight / h) - round(domainHeight / h)) <= 1e-10)
+	{
+		// Number of cells in each direction (length and height)
+		int NL = round(domainLength / h);
+		int NH = round(domainHeight / h);
+
+		// Number of cells and nodes, faces and ghost cells are not stored
+		gridinfo->DIM = 2;
+		gridinfo->NCM = NL * NH;
+		gridinfo->NNM = (NL + 1) * (NH + 1);
+		gridinfo->NFM = 0;
+		gridinfo->NGM = 0;
+	}
+	else
+	{
+		logBrief("Grid spacing not uniform, please adjust", 3);
+	}
+}
+
+
+// Process mesh file
+void Parameters::processMesh(std::string type)
+{
+	if (type == "PIC")
+	{
+		if (userMesh)
+		{
+			logMessages("Generating user mesh", __FILENAME__, __LINE__, 1);
+			generateMesh("PIC");
+		}
+		else
+		{
+			logMessages("Extracting mesh data", __FILENAME__, __LINE__, 1);
+
+			// Parsed geometry is only read once meshes are built, so copies of the
+			// parameters list (one per patch) share it rather than duplicating it
+			gridgeoPIC = std::make_shared<GridGeo>();
+			if (meshFilePath.size() > 4 && meshFilePath.substr(meshFilePath.size() - 4) == ".msh")
+			{
+				readGridFromFluent(meshFilePath, gridinfoPIC, *gridgeoPIC);
+			}
+			else
+			{
+				readGridFromSU2(meshFilePath, gridinfoPIC, *gridgeoPIC);
+			}
+			processingGrid(gridinfoPIC, *gridgeoPIC);
+		}
+	}
+	else if (type == "FDTD")
+	{
+		logBrief("Generating FDTD mesh", 1);
+		generateMesh("FDTD");
+	}
+}
+
+
+// Replace the raw value of a named input, which takes effect when inputs are
+// next assigned
+bool Parameters::overrideInput(std::string name, std::string value)
+{
+	for (unsigned int i = 0; i < namesVector.size(); i++)
+	{
+		if (namesVector[i] == name)
+		{
+			valuesVector[i] = value;
+			return true;
+		}
+	}
+	return false;
+}
+
+
+// Start a reproducible stream of seeds, distinct for each stream number
+void Parameters::setRandomSeed(unsigned int seed, unsigned int stream)
+{
+	randomSeed = seed;
+	std::seed_seq sequence{ seed, stream };
+	seedStream.seed(sequence);
+}
+
+
+// Seed for a random number generator, taken from the seed stream if one has
+// been started, otherwise from the system
+std::mt19937::result_type Parameters::generateSeed()
+{
+	if (randomSeed == 0)
+	{
+		return std::random_device()();
+	}
+	return seedStream();
+}
+
+
+// Log messages, warnings and errors
+void Parameters::logMessages(std::string message, std::string filename, int line, int messageType)
+{
+	// Patches may run concurrently, so only one message is written at a time
+	# pragma omp critical(logFile)
+	{
+		std::chrono::system_clock::time_point currentTime = std::chrono::system_clock::now();
+		std::chrono::duration<double> duration;
+		duration = currentTime - initialTime;
+
+		if (!firstLog)
+		{
+			std::ofstream logFile("logFile.txt", std::ios::app);	// Open log file, 'append' write mode
+
+			if (!logFile.is_open())
+			{
+				while (!logFile.is_open())
+				{
+					std::cout << "Unable to open log file!!!" << std::endl;
+					logFile.close();
+					std::ofstream logFile("logFile.txt", std::ios::app);
+					if (logFile.is_open())
+					{
+						break;
+					}
+				}
+			}
+
+			if (messageType == 1)
+			{
+				logFile << std::left << std::setfill('.') << std::setw(45) << "(" +
+					filename + ", line " + std::to_string(line) + ")" << message <<
+					std::right << std::setw(100 - message.length()) << "Elapsed time: " +
+					std::to_string(duration.count()) + " seconds" << std::endl;
+			}
+			else if (messageType == 2)
+			{
+				logFile << std::left << std::setfill('.') << std::setw(45) << "(" +
+					filename + ", line " + std::to_string(line) + ")" << "## WARNING: " +
+					message << std::right << std::setw(100 - message.length()) << 
+					"Elapsed time: " + std::to_string(duration.count()) + " seconds" <<
+					std::endl;
+			}
+			else if (messageType == 3)
+			{
+				logFile << std::left << std::setfill('.') << std::setw(45) << "(" +
+					filename + ", line " + std::to_string(line) + ")" << "#### ERROR: " + 
+					message << std::right << std::setw(100 - message.length()) << 
+					"Elapsed time: " + std::to_string(duration.count()) + " seconds" <<
+					std::endl;
+				numErrors += 1;
+			}
+			logFile.close();
+
+			std::cout << message << std::endl;
+		}
+		else
+		{
+			std::ofstream logFile("logFile.txt", std::ios::trunc);	// Open log file, 'truncate' write mode
+
+			if (!logFile.is_open())
+			{
+				while (!logFile.is_open())
+				{
+					std::cout << "Unable to open log file!!!" << std::endl;
+					logFile.close();
+					std::ofstream logFile("logFile.txt", std::ios::trunc);
+					if (logFile.is_open())
+					{
+						break;
+					}
+				}
+			}
+
+			char time[26];
+			std::time_t clockTime = std::chrono::system_clock::to_time_t(currentTime);
+#ifdef _WIN32
+			ctime_s(time, sizeof time, &clockTime);
+#else
+			ctime_r(&clockTime, time);
+#endif
+			logFile << "Simulation start time: " << time << std::endl;
+			
+			logFile << std::left << std::setfill('.') << std::setw(45) << "(" + 
+				filename + ", line " + std::to_string(line) + ")" << message << 
+				std::right << std::setw(100 - message.length()) << "Elapsed time: " + 
+				std::to_string(duration.count()) + " seconds" << std::endl;
+			logFile.close();
+
+			std::cout << message << std::endl;
+			firstLog = false;
+		}
+	}
+
+}
+
+
+// Log brief messages
+void Parameters::logBrief(std::string message, int messageType)
+{
+	// Patches may run concurrently, so only one message is written at a time
+	# pragma omp critical(logFile)
+	{
+		std::ofstream logFile("logFile.txt", std::ios::app);	// Open log file, 'append' write mode
+
+		if (!logFile.is_open())
+		{ 
+			while (!logFile.is_open())
+			{
+				std::cout << "Unable to open log file!!!" << std::endl;
+				logFile.close();
+				std::ofstream logFile("logFile.txt", std::ios::app);
+				if (logFile.is_open())
+				{
+					break;
+				}
+			}
+		}
+
+		if (messageType == 1)
+		{
+			logFile << std::left << std::setw(45) << " " << message << std::endl;
+		}
+		else if (messageType == 2)
+		{
+			logFile << std::left << std::setw(45) << " " << "## WARNING: " + message << std::endl;
+		}
+		else if (messageType == 3)
+		{
+			logFile << std::left << std::setw(45) << " " << "#### ERROR: " + message << std::endl;
+			numErrors += 1;
+		}
+		logFile.close();
+
+		std::cout << message << std::endl;
+	}
+}
+
+// Convert boundary condition name to BCType (throws 1 if not recognised, to
+// be caught alongside the other argument errors in assignInputs)
+BCType Parameters::stringToBCType(std::string type)
+{
+	if (type == "periodic")
+	{
+		return bcPeriodic;
+	}
+	else if (type == "open")
+	{
+		return bcOpen;
+	}
+	else if (type == "dirichlet")
+	{
+		return bcDirichlet;
+	}
+	else if (type == "neumann")
+	{
+		return bcNeumann;
+	}
+	throw 1;
+}
@@ -5,11 +5,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <ctime>
 #include <exception>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <random>
 #include <string>
 #include <sstream>
@@ -19,7 +22,31 @@
 
 #include "omp.h"
 
+#ifdef _WIN32
 #define __FILENAME__ strrchr("\\" __FILE__, '\\') + 1
+#else
+#define __FILENAME__ strrchr("/" __FILE__, '/') + 1
+#endif
+
+//! \enum BCType
+//! \brief Boundary condition types, resolved from the input file once
+enum BCType : unsigned char
+{
+	bcPeriodic,								//!< Periodic boundary
+	bcOpen,									//!< Open boundary
+	bcDirichlet,							//!< Fixed potential
+	bcNeumann								//!< Fixed potential gradient
+};
+
+//! \enum ShapeOrder
+//! \brief Order of the particle shape function (B-spline of the same order)
+enum ShapeOrder
+{
+	shapeNGP = 0,							//!< Nearest grid point
+	shapeCIC = 1,							//!< Cloud in cell (linear)
+	shapeTSC = 2,							//!< Triangular shaped cloud (quadratic)
+	shapeCubic = 3							//!< Cubic B-spline
+};
 
 //! \class Parameters 
 //! \brief Handles pre-processing of input parameters
@@ -28,21 +55,22 @@ class Parameters
 private:
 	// Data members
 	std::vector<std::string> valuesVector;	//!< Raw strings from input file	
-	std::string meshFilePIC = "PICMesh";	//!< Name of PIC mesh file
-	std::string meshFileFDTD = "FDTDMesh";	//!< Name of FDTD mesh file
+	std::vector<std::string> namesVector;	//!< Names of the values in valuesVector
 
 	bool useDefaultArgument = false;		//!< Flag to use default argument
 	bool fileNotOpened = false;				//!< Check if input file was opened 
 	bool firstLog = true;					//!< Check if this is the first log entry
 	std::chrono::system_clock::time_point initialTime;	//!< Global simulation time
+	std::mt19937 seedStream;				//!< Generator of seeds, used if randomSeed is set
 
 public:
 	// Data members
 	int numErrors = 0;						//!< Number of errors detected during simulation
 	GridBasicInfo gridinfoPIC;				//!< Basic grid properties, PIC mesh
-	GridGeo gridgeoPIC;						//!< Detailed grid info, PIC mesh
+	std::shared_ptr<GridGeo> gridgeoPIC;	//!< Detailed grid info, PIC mesh, shared by copies of the parameters list
 	GridBasicInfo gridinfoFDTD;				//!< Basic grid properties, FDTD mesh
-	GridGeo gridgeoFDTD;					//!< Detailed grid info, FDTD mesh
+	std::shared_ptr<GridGeo> gridgeoFDTD;	//!< Detailed grid info, FDTD mesh, shared by copies of the parameters list
+	unsigned int randomSeed = 0;			//!< Seed of random number stream, 0 to seed from the system
 
 
 	// Global simulation parameters
@@ -79,17 +107,17 @@ public:
 	double meshScalingParameter;			//!< Mesh scaling parameter
 
 	// Solver and boundary condition parameters
-	std::string solverType;					//!< Solver type (GS, FFT)
+	std::string solverType;					//!< Solver type (GS, FFT, PCG, BiCGStab)
 	int maxSolverIterations;				//!< Maximum number of iterations for solver
 	double residualTolerance;				//!< Tolerance for solver residuals
 	double SORparameter;					//!< Successive over-relaxation parameter
-	std::string leftBCType;					//!< Boundary condition on left edge (periodic, open, dirichlet, neumann)
+	BCType leftBCType;						//!< Boundary condition on left edge (periodic, open, dirichlet, neumann)
 	double leftBCValue;						//!< Value of left edge boundary condition
-	std::string rightBCType;				//!< Boundary condition on right edge (periodic, open, dirichlet, neumann)
+	BCType rightBCType;						//!< Boundary condition on right edge (periodic, open, dirichlet, neumann)
 	double rightBCValue;					//!< Value of right edge boundary condition
-	std::string topBCType;					//!< Boundary condition on top edge (periodic, open, dirichlet, neumann)
+	BCType topBCType;						//!< Boundary condition on top edge (periodic, open, dirichlet, neumann)
 	double topBCValue;						//!< Value of top edge boundary condition
-	std::string bottomBCType;				//!< Boundary condition on bottom edge (periodic, open, dirichlet, neumann)
+	BCType bottomBCType;					//!< Boundary condition on bottom edge (periodic, open, dirichlet, neumann)
 	double bottomBCValue;					//!< Value of bottom edge boundary condition
 
 	// Parallelisation parameters
@@ -101,6 +129,25 @@ public:
 	std::string tecplotParticleSolution;	//!< Tecplot particle solution file
 	std::string tecplotNodeSolution;		//!< Tecplot node solution file
 	std::string tecplotGlobalSolution;		//!< Tecplot global solution file
+	std::string timelineOutput;				//!< Format of per-iteration timing output (none, csv, json)
+	std::string timelineFile;				//!< Timing output file
+
+	// Numerical scheme parameters
+	int shapeOrder;							//!< Particle shape function order (0 NGP, 1 CIC, 2 TSC, 3 cubic)
+	std::string currentDeposition;			//!< Current deposition scheme (direct, esirkepov)
+	bool fusedKernel;						//!< If true, gather, push and deposit in a single pass
+	int tileSize;							//!< Width of square tiles of cells, 0 for no tiling
+	int loadBalanceFrequency;				//!< Iterations between repartitioning of tiles, 0 for none
+	std::string solverWarmStart;			//!< Initial guess for the potential solver (none, previous, extrapolate)
+	int residualCheckInterval;				//!< Solver iterations between convergence checks
+	std::string preconditioner;				//!< Preconditioner for PCG and BiCGStab solvers (jacobi, ilu0)
+	int resampleFrequency;					//!< Iterations between merging and splitting of particles, 0 for none
+	int targetParticlesPerCell;				//!< Particles of each species per cell kept by resampling
+	int subcycleInterval;					//!< Time steps between pushes of ions and neutrals
+	bool openBoundaryInjection;				//!< True if particles are injected through open boundaries
+
+	// Ensemble parameters
+	std::string ensembleFile;				//!< File listing cases to run concurrently, none for a single run
 
 
 	// Constructor/destructor
@@ -111,10 +158,16 @@ public:
 
 	// Methods
 	void assignInputs();					//!< Assign values to data members
-	void generateMesh(std::string type);	//!< Generate a user-defined mesh
+	void generateMesh(std::string type);	//!< Size a user-defined mesh
 	void processMesh(std::string type);		//!< Post process mesh 
+	bool overrideInput(std::string name,
+		std::string value);					//!< Replace the raw value of a named input
+	void setRandomSeed(unsigned int seed,
+		unsigned int stream);				//!< Start a reproducible random number stream
+	std::mt19937::result_type generateSeed();	//!< Seed for a random number generator
 	void logMessages(std::string message, std::string filename, 
 		int line, int messageType);			//!< Log messages, warnings and errors
 	void logBrief(std::string message, 
 		int messageType);					//!< Log brief messages
+	BCType stringToBCType(std::string type);	//!< Convert boundary condition name to BCType
 };
\ No newline at end of file
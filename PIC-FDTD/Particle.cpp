@@ -33,16 +33,16 @@ Particle::Particle(Parameters *parametersList, Mesh *mesh, int patchID, int cell
 
 	// Initialise random number generator, distribution in range [0, 1000000]
 	std::mt19937 rng;
-	rng.seed(std::random_device()());
+	rng.seed(parametersList->generateSeed());
 	std::uniform_int_distribution<std::mt19937::result_type> dist(0, 1000000);
 
 	if (parametersList->particleDistribution == "precise")
 	{
 		// Place particle in cell at location (xInitial, yInitial)
-		position.push_back(mesh->cellsVector.cells[cellID - 1].left * (1 - parametersList->initialPosition[0]) +
-			mesh->cellsVector.cells[cellID - 1].right * parametersList->initialPosition[0]);		// Cartesian x/cylindrical z
-		position.push_back(mesh->cellsVector.cells[cellID - 1].top * parametersList->initialPosition[1] +
-			mesh->cellsVector.cells[cellID - 1].bottom * (1 - parametersList->initialPosition[1]));	// Cartesian y/cylindrical r
+		position.push_back(mesh->cell(cellID - 1).left * (1 - parametersList->initialPosition[0]) +
+			mesh->cell(cellID - 1).right * parametersList->initialPosition[0]);		// Cartesian x/cylindrical z
+		position.push_back(mesh->cell(cellID - 1).top * parametersList->initialPosition[1] +
+			mesh->cell(cellID - 1).bottom * (1 - parametersList->initialPosition[1]));	// Cartesian y/cylindrical r
 		position.push_back(0.0);																	// Cartesian z/cylindrical theta
 	}
 	else if (parametersList->particleDistribution == "random")
@@ -50,10 +50,10 @@ Particle::Particle(Parameters *parametersList, Mesh *mesh, int patchID, int cell
 		// Place particle at a random location in the cell
 		double random1 = dist(rng) / (double)1000000;
 		double random2 = dist(rng) / (double)1000000;
-		position.push_back(mesh->cellsVector.cells[cellID - 1].left * (1 - random1) +
-			mesh->cellsVector.cells[cellID - 1].right * random1);			// Cartesian x/cylindrical z
-		position.push_back(mesh->cellsVector.cells[cellID - 1].top * random2 +
-			mesh->cellsVector.cells[cellID - 1].bottom * (1 - random2));	// Cartesian y/cylindrical r
+		position.push_back(mesh->cell(cellID - 1).left * (1 - random1) +
+			mesh->cell(cellID - 1).right * random1);			// Cartesian x/cylindrical z
+		position.push_back(mesh->cell(cellID - 1).top * random2 +
+			mesh->cell(cellID - 1).bottom * (1 - random2));	// Cartesian y/cylindrical r
 		position.push_back(0.0);											// Cartesian z/cylindrical theta
 	}
 	else if (parametersList->particleDistribution == "uniform")
@@ -65,12 +65,14 @@ Particle::Particle(Parameters *parametersList, Mesh *mesh, int patchID, int cell
 		double yratio = (0.5 + static_cast<double>(floor(index /
 			sqrt(parametersList->particlesPerCell)))) / sqrt(parametersList->particlesPerCell);
 
-		position.push_back(mesh->cellsVector.cells[cellID - 1].left * (1 - xratio) +
-			mesh->cellsVector.cells[cellID - 1].right * xratio);			// Cartesian x/cylindrical z
-		position.push_back(mesh->cellsVector.cells[cellID - 1].top * yratio +
-			mesh->cellsVector.cells[cellID - 1].bottom * (1 - yratio));		// Cartesian y/cylindrical r
+		position.push_back(mesh->cell(cellID - 1).left * (1 - xratio) +
+			mesh->cell(cellID - 1).right * xratio);			// Cartesian x/cylindrical z
+		position.push_back(mesh->cell(cellID - 1).top * yratio +
+			mesh->cell(cellID - 1).bottom * (1 - yratio));		// Cartesian y/cylindrical r
 		position.push_back(0.0);											// Cartesian z/cylindrical theta
 	}
+	oldPosition = position;
+
 	// TODO: Method for distributing particles when simulation is axisymmetric,
 	// need to ensure same number of particles per unit cell volume, i.e.
 	// cells closer to the axis will have different numbers of particles
@@ -129,17 +131,18 @@ Particle::Particle(Parameters *parametersList, Mesh *mesh, int patchID, int cell
 
 	// Initialise random number generator, distribution in range [0, 1000000]
 	std::mt19937 rng;
-	rng.seed(std::random_device()());
+	rng.seed(parametersList->generateSeed());
 	std::uniform_int_distribution<std::mt19937::result_type> dist(0, 1000000);
 
 	// Place particle at a random location in the cell
 	double random1 = dist(rng) / (double)1000000;
 	double random2 = dist(rng) / (double)1000000;
-	position.push_back(mesh->cellsVector.cells[cellID - 1].left * (1 - random1) +
-		mesh->cellsVector.cells[cellID - 1].right * random1);			// Cartesian x/cylindrical z
-	position.push_back(mesh->cellsVector.cells[cellID - 1].top * random2 +
-		mesh->cellsVector.cells[cellID - 1].bottom * (1 - random2));	// Cartesian y/cylindrical r
+	position.push_back(mesh->cell(cellID - 1).left * (1 - random1) +
+		mesh->cell(cellID - 1).right * random1);			// Cartesian x/cylindrical z
+	position.push_back(mesh->cell(cellID - 1).top * random2 +
+		mesh->cell(cellID - 1).bottom * (1 - random2));	// Cartesian y/cylindrical r
 	position.push_back(0.0);											// Cartesian z/cylindrical theta
+	oldPosition = position;
 
 	// TODO: Select velocities from a Maxwellian distribution
 	// Initial particle velocity
@@ -7,7 +7,7 @@
 
 #include "Parameters.h"
 #include "Mesh.h"
-#include "CHEM\species.hpp"
+#include "CHEM/species.hpp"
 
 // TODO: Does the Particle class need to be derived from the species class, or 
 // should it just contain an attribute speciesType? Doing so means each instance 
@@ -23,11 +23,16 @@ public:
 	int particleID;							//!< Particle ID
 	int cellID;								//!< Current cell ID
 	std::vector<double> position;			//!< Particle position vector
+	std::vector<double> oldPosition;		//!< Position vector from previous time step
 	std::vector<double> velocity;			//!< Particle velocity vector
 	std::vector<double> oldVelocity
 	{ -1.0, -1.0, -1.0 };					//!< Velocity vector from previous time step
 	std::vector<double> EMfield
 	{ -1.0, -1.0, -1.0, -1.0, -1.0, -1.0 };	//!< Electromagnetic field
+	double weight = 1.0;					//!< Statistical weight, in units of a species macroparticle
+	std::vector<double> fieldSum
+	{ 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };		//!< Sum of fields gathered since last push, if sub-cycled
+	int numFieldSamples = 0;				//!< Number of fields in fieldSum
 
 
 	// Constructor/destructor
@@ -36,7 +41,11 @@ public:
 		int particleID, int index);			//!< Initial constructor
 	Particle(Parameters *parametersList, Mesh *mesh, int patchID, int cellID,
 		int particleID, std::string type);	// Single particle constructor
+	Particle(const Particle &particle) = default;	//!< Copy constructor
+	Particle(Particle &&particle) = default;		//!< Move constructor
 	~Particle();							//!< Destructor
+	Particle &operator=(const Particle &particle) = default;	//!< Copy assignment
+	Particle &operator=(Particle &&particle) = default;		//!< Move assignment
 
 
 	// Methods
@@ -22,6 +22,7 @@ ParticlePusher::ParticlePusher(Parameters *parametersList, Mesh *mesh, VectorPar
 	{
 		for (int i = 0; i < particlesVector->numParticles; i++)
 		{
+			double timeStep = parametersList->timeStep * subcycleInterval(parametersList, particlesVector->particleVector[i]);
 			particlesVector->particleVector[i].oldVelocity = particlesVector->particleVector[i].velocity;
 
 			particlesVector->particleVector[i].velocity[0] -=
@@ -31,7 +32,7 @@ ParticlePusher::ParticlePusher(Parameters *parametersList, Mesh *mesh, VectorPar
 					particlesVector->particleVector[i].velocity[1] - 
 					particlesVector->particleVector[i].EMfield[4] *
 					particlesVector->particleVector[i].velocity[2]) * 0.5 *
-				parametersList->timeStep / particlesVector->particleVector[i].basic.m;
+				timeStep / particlesVector->particleVector[i].basic.m;
 		
 			particlesVector->particleVector[i].velocity[1] -=
 				particlesVector->particleVector[i].basic.q *
@@ -40,7 +41,7 @@ ParticlePusher::ParticlePusher(Parameters *parametersList, Mesh *mesh, VectorPar
 					particlesVector->particleVector[i].velocity[2] -
 					particlesVector->particleVector[i].EMfield[5] * 
 					particlesVector->particleVector[i].oldVelocity[0]) * 0.5 *
-				parametersList->timeStep / particlesVector->particleVector[i].basic.m;
+				timeStep / particlesVector->particleVector[i].basic.m;
 
 			particlesVector->particleVector[i].velocity[2] -=
 				particlesVector->particleVector[i].basic.q *
@@ -49,11 +50,11 @@ ParticlePusher::ParticlePusher(Parameters *parametersList, Mesh *mesh, VectorPar
 					particlesVector->particleVector[i].oldVelocity[0] -
 					particlesVector->particleVector[i].EMfield[3] * 
 					particlesVector->particleVector[i].oldVelocity[1]) * 0.5 *
-				parametersList->timeStep / particlesVector->particleVector[i].basic.m;
+				timeStep / particlesVector->particleVector[i].basic.m;
 		}
 	}
 
-	// TODO: Inject new particles to maintain charge balance with open BCs
+	// Particles leaving through open BCs are replaced by Injector
 
 	// TODO: At the moment both Dirichlet and Neumann BCs cause reflection, however
 	// in waves, Dirichlet causes a sign change while Neumann does not (perfect 
@@ -61,391 +62,457 @@ ParticlePusher::ParticlePusher(Parameters *parametersList, Mesh *mesh, VectorPar
 	
 	// Currently available BCs: periodic, open, Dirichlet and Neumann
 	for (int i = 0; i < particlesVector->numParticles; i++)
-	{		
-		particlesVector->particleVector[i].oldVelocity = particlesVector->particleVector[i].velocity;
+	{
+		double timeStep = subcycleStep(parametersList, particlesVector->particleVector[i]);
+		if (timeStep == 0.0)
+		{
+			continue;
+		}
 
-		// Update velocity using Boris method:
-		double vMinus[3];
-		double tVector[3], sVector[3];
-		for (int j = 0; j < 3; j++)
+		PushResult result = pushParticle(parametersList, mesh, particlesVector, i, timeStep);
+		if (result == pushStopped)
 		{
-			// 1. Half acceleration
-			vMinus[j] = particlesVector->particleVector[i].velocity[j] + 0.5 *
-				particlesVector->particleVector[i].basic.q * parametersList->timeStep *
-				particlesVector->particleVector[i].EMfield[j] / particlesVector->particleVector[i].basic.m;
+			break;
+		}
+		else if (result == pushRemoved)
+		{
+			// Particle was removed from the simulation, the next one now has index i
+			i -= 1;
+		}
+	}
 
-			// 2. Rotation
-			double theta = 2.0 * abs(atan(0.5 * particlesVector->particleVector[i].EMfield[j+3] *
-				parametersList->timeStep * particlesVector->particleVector[i].basic.q /
-				particlesVector->particleVector[i].basic.m)) * 180.0 / std::_Pi;
+	// TODO: Shift v forwards half a time step to sync v and x for plotting
 
-			if (theta > 45.0)
-			{
-				parametersList->logBrief("Rotation angle has exceeded 45 degrees by " + std::to_string(theta - 45), 3);
-				break;
-			}
+	parametersList->logBrief("Particle pusher exited", 1);
+}
 
-			tVector[j] = particlesVector->particleVector[i].basic.q * 0.5 *
-				parametersList->timeStep * particlesVector->particleVector[i].EMfield[j+3] /
-				particlesVector->particleVector[i].basic.m;
-			sVector[j] = 2 * tVector[j] / (1 + tVector[j] * tVector[j]);
-		}
 
-		double v1Dashed = vMinus[0] + vMinus[1] * tVector[2] - vMinus[2] * tVector[1];
-		double v2Dashed = vMinus[1] - vMinus[0] * tVector[2] + vMinus[2] * tVector[0];
-		double v3Dashed = vMinus[2] + vMinus[0] * tVector[1] - vMinus[1] * tVector[0];
+// Destructor
+ParticlePusher::~ParticlePusher()
+{
+}
+
 
-		double v1Plus = vMinus[0] + v2Dashed * sVector[2] - v3Dashed * sVector[1];
-		double v2Plus = vMinus[1] - v1Dashed * sVector[2] + v3Dashed * sVector[0];
-		double v3Plus = vMinus[2] + v1Dashed * sVector[1] - v2Dashed * sVector[0];
+// Number of time steps between pushes of a particle, which is more than one
+// for sub-cycled heavy species (ions and neutrals)
+int ParticlePusher::subcycleInterval(Parameters *parametersList, const Particle &particle)
+{
+	if (particle.basic.m > ELECTRON_MASS_kg)
+	{
+		return parametersList->subcycleInterval;
+	}
+	return 1;
+}
+
+
+// Time step to push a particle over, or zero if it is held this step. Fields
+// gathered by sub-cycled particles are summed until they are next pushed, with
+// the average field, over all of the steps since their last push. Held
+// particles do not move, so deposit the same charge and no current.
+double ParticlePusher::subcycleStep(Parameters *parametersList, Particle &particle)
+{
+	int interval = subcycleInterval(parametersList, particle);
+	if (interval == 1)
+	{
+		return parametersList->timeStep;
+	}
 
-		// 3. Half acceleration
-		particlesVector->particleVector[i].velocity[0] = v1Plus + 0.5 *
-			particlesVector->particleVector[i].basic.q * parametersList->timeStep *
-			particlesVector->particleVector[i].EMfield[0] / particlesVector->particleVector[i].basic.m;
+	for (int j = 0; j < 6; j++)
+	{
+		particle.fieldSum[j] += particle.EMfield[j];
+	}
+	particle.numFieldSamples++;
 
-		particlesVector->particleVector[i].velocity[1] = v2Plus + 0.5 *
-			particlesVector->particleVector[i].basic.q * parametersList->timeStep *
-			particlesVector->particleVector[i].EMfield[1] / particlesVector->particleVector[i].basic.m;
+	if (particle.numFieldSamples < interval)
+	{
+		particle.oldPosition = particle.position;
+		return 0.0;
+	}
 
-		particlesVector->particleVector[i].velocity[2] = v3Plus + 0.5 *
-			particlesVector->particleVector[i].basic.q * parametersList->timeStep *
-			particlesVector->particleVector[i].EMfield[2] / particlesVector->particleVector[i].basic.m;
+	for (int j = 0; j < 6; j++)
+	{
+		particle.EMfield[j] = particle.fieldSum[j] / particle.numFieldSamples;
+		particle.fieldSum[j] = 0.0;
+	}
+	particle.numFieldSamples = 0;
+	return parametersList->timeStep * interval;
+}
 
-		// TODO: Does third velocity component need to be included in Courant 
-		// number calculation since only 2 spatial dimensions are being modelled?
-		double courantNumber = (particlesVector->particleVector[i].velocity[0] +
-			particlesVector->particleVector[i].velocity[1] + 
-			particlesVector->particleVector[i].velocity[2]) * parametersList->timeStep /
-			mesh->h;
 
-		if (courantNumber > 1.0)
+// Push a single particle over a time step and update its cell, applying
+// boundary conditions. Cell lists and plotVector are updated once the particle
+// has stopped moving. If updates are deferred, they are left to the caller
+// along with the removal of particles which leave the domain, so that the
+// mesh and particle vector are not changed while other particles are pushed.
+PushResult ParticlePusher::pushParticle(Parameters *parametersList, Mesh *mesh,
+	VectorParticle *particlesVector, int i, double timeStep, bool deferUpdates)
+{
+	int oldCellID = particlesVector->particleVector[i].cellID;
+	bool crossed = false;
+	auto exitDomain = [&]()
+	{
+		if (!deferUpdates)
 		{
-			parametersList->logBrief("Consider adjusting time step, CFL condition is " + std::to_string(courantNumber), 2);
-			if (courantNumber > 1.5)
-			{
-				parametersList->logBrief("Stopping pusher, CFL condition exceeded by " + std::to_string(courantNumber - 1.0), 3);
-				break;
-			}
+			mesh->removeParticlesFromCell(oldCellID, particlesVector->particleVector[i].particleID);
+			particlesVector->removeParticleFromSim(particlesVector->particleVector[i].particleID);
 		}
+		return pushRemoved;
+	};
 
-		// Update Cartesian x/cylindrical z position
-		particlesVector->particleVector[i].position[0] += parametersList->timeStep * 
-			particlesVector->particleVector[i].velocity[0]; 
+	particlesVector->particleVector[i].oldVelocity = particlesVector->particleVector[i].velocity;
+	particlesVector->particleVector[i].oldPosition = particlesVector->particleVector[i].position;
 
-		double displacementL = particlesVector->particleVector[i].position[0] - 
-			mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].left;
-		double displacementR = particlesVector->particleVector[i].position[0] -
-			mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].right;
+	// Update velocity using Boris method:
+	double vMinus[3];
+	double tVector[3], sVector[3];
+	for (int j = 0; j < 3; j++)
+	{
+		// 1. Half acceleration
+		vMinus[j] = particlesVector->particleVector[i].velocity[j] + 0.5 *
+			particlesVector->particleVector[i].basic.q * timeStep *
+			particlesVector->particleVector[i].EMfield[j] / particlesVector->particleVector[i].basic.m;
+
+		// 2. Rotation
+		double theta = 2.0 * std::abs(atan(0.5 * particlesVector->particleVector[i].EMfield[j+3] *
+			timeStep * particlesVector->particleVector[i].basic.q /
+			particlesVector->particleVector[i].basic.m)) * 180.0 / PI;
 
-		if ((displacementL < 0.0 && abs(displacementL) >= mesh->h) || (displacementR > 0.0 && abs(displacementR) >= mesh->h))
+		if (theta > 45.0)
 		{
-			parametersList->logBrief("Particle " + std::to_string(i + 1) + " has moved more than one cell length", 3);
+			parametersList->logBrief("Rotation angle has exceeded 45 degrees by " + std::to_string(theta - 45), 3);
 			break;
 		}
 
-		// Update cell ID in Cartesian x/cylindrical z direction, exiting left
-		if (displacementL < 0.0)
+		tVector[j] = particlesVector->particleVector[i].basic.q * 0.5 *
+			timeStep * particlesVector->particleVector[i].EMfield[j+3] /
+			particlesVector->particleVector[i].basic.m;
+		sVector[j] = 2 * tVector[j] / (1 + tVector[j] * tVector[j]);
+	}
+
+	double v1Dashed = vMinus[0] + vMinus[1] * tVector[2] - vMinus[2] * tVector[1];
+	double v2Dashed = vMinus[1] - vMinus[0] * tVector[2] + vMinus[2] * tVector[0];
+	double v3Dashed = vMinus[2] + vMinus[0] * tVector[1] - vMinus[1] * tVector[0];
+
+	double v1Plus = vMinus[0] + v2Dashed * sVector[2] - v3Dashed * sVector[1];
+	double v2Plus = vMinus[1] - v1Dashed * sVector[2] + v3Dashed * sVector[0];
+	double v3Plus = vMinus[2] + v1Dashed * sVector[1] - v2Dashed * sVector[0];
+
+	// 3. Half acceleration
+	particlesVector->particleVector[i].velocity[0] = v1Plus + 0.5 *
+		particlesVector->particleVector[i].basic.q * timeStep *
+		particlesVector->particleVector[i].EMfield[0] / particlesVector->particleVector[i].basic.m;
+
+	particlesVector->particleVector[i].velocity[1] = v2Plus + 0.5 *
+		particlesVector->particleVector[i].basic.q * timeStep *
+		particlesVector->particleVector[i].EMfield[1] / particlesVector->particleVector[i].basic.m;
+
+	particlesVector->particleVector[i].velocity[2] = v3Plus + 0.5 *
+		particlesVector->particleVector[i].basic.q * timeStep *
+		particlesVector->particleVector[i].EMfield[2] / particlesVector->particleVector[i].basic.m;
+
+	// TODO: Does third velocity component need to be included in Courant 
+	// number calculation since only 2 spatial dimensions are being modelled?
+	double courantNumber = (particlesVector->particleVector[i].velocity[0] +
+		particlesVector->particleVector[i].velocity[1] + 
+		particlesVector->particleVector[i].velocity[2]) * timeStep /
+		mesh->h;
+
+	if (courantNumber > 1.0)
+	{
+		parametersList->logBrief("Consider adjusting time step, CFL condition is " + std::to_string(courantNumber), 2);
+		if (courantNumber > 1.5)
 		{
-			mesh->removeParticlesFromCell(particlesVector->particleVector[i].cellID,
-				particlesVector->particleVector[i].particleID);
+			parametersList->logBrief("Stopping pusher, CFL condition exceeded by " + std::to_string(courantNumber - 1.0), 3);
+			return pushStopped;
+		}
+	}
 
-			// Particle remains inside domain
-			if (mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].leftCellID > 0)
-			{	
+	// Update Cartesian x/cylindrical z position
+	particlesVector->particleVector[i].position[0] += timeStep * 
+		particlesVector->particleVector[i].velocity[0]; 
+
+	double displacementL = particlesVector->particleVector[i].position[0] - 
+		mesh->cell(particlesVector->particleVector[i].cellID - 1).left;
+	double displacementR = particlesVector->particleVector[i].position[0] -
+		mesh->cell(particlesVector->particleVector[i].cellID - 1).right;
+
+	if ((displacementL < 0.0 && std::abs(displacementL) >= mesh->h) || (displacementR > 0.0 && std::abs(displacementR) >= mesh->h))
+	{
+		parametersList->logBrief("Particle " + std::to_string(i + 1) + " has moved more than one cell length", 3);
+		return pushStopped;
+	}
+
+	// Update cell ID in Cartesian x/cylindrical z direction, exiting left
+	if (displacementL < 0.0)
+	{
+		crossed = true;
+
+		// Particle remains inside domain
+		if (mesh->cell(particlesVector->particleVector[i].cellID - 1).leftCellID > 0)
+		{	
+			particlesVector->particleVector[i].cellID =
+				mesh->cell(particlesVector->particleVector[i].cellID - 1).leftCellID;
+		}
+		// Particle crosses left boundary of domain
+		else
+		{
+			if (parametersList->leftBCType == bcPeriodic)
+			{
 				particlesVector->particleVector[i].cellID =
-					mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].leftCellID;
+					mesh->cell(particlesVector->particleVector[i].cellID - 1).periodicX1CellID;
+
+				// Shift Cartesian x/ cylindrical z position
+				particlesVector->particleVector[i].position[0] = displacementL +
+					mesh->cell(particlesVector->particleVector[i].cellID - 1).right;
 			}
-			// Particle crosses left boundary of domain
-			else
+			else if (parametersList->leftBCType == bcOpen)
 			{
-				if (parametersList->leftBCType == "periodic")
-				{
-					particlesVector->particleVector[i].cellID =
-						mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].periodicX1CellID;
-
-					// Shift Cartesian x/ cylindrical z position
-					particlesVector->particleVector[i].position[0] = displacementL +
-						mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].right;
-				}
-				else if (parametersList->leftBCType == "open")
-				{
-					particlesVector->removeParticleFromSim(particlesVector->particleVector[i].particleID);
-					i -= 1;
-					continue;
-				}
-				else if (parametersList->leftBCType == "dirichlet" ||
-						 parametersList->leftBCType == "neumann")
-				{
-					// Reflect particle from boundary
-					particlesVector->particleVector[i].position[0] = -displacementL +
-						mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].left;
-
-					// Reverse x velocity
-					particlesVector->particleVector[i].velocity[0] *= -1.0;
-				}
+				return exitDomain();
+			}
+			else if (parametersList->leftBCType == bcDirichlet ||
+					 parametersList->leftBCType == bcNeumann)
+			{
+				// Reflect particle from boundary
+				particlesVector->particleVector[i].position[0] = -displacementL +
+					mesh->cell(particlesVector->particleVector[i].cellID - 1).left;
 
+				// Reverse x velocity
+				particlesVector->particleVector[i].velocity[0] *= -1.0;
 			}
 
-			mesh->addParticlesToCell(particlesVector->particleVector[i].cellID,
-				particlesVector->particleVector[i].particleID);
 		}
+	}
 
-		// Update cell ID in Cartesian x/ cylindrical z direction, exiting right
-		else if (displacementR > 0.0)
-		{
-			mesh->removeParticlesFromCell(particlesVector->particleVector[i].cellID,
-				particlesVector->particleVector[i].particleID);
+	// Update cell ID in Cartesian x/ cylindrical z direction, exiting right
+	else if (displacementR > 0.0)
+	{
+		crossed = true;
 
-			// Particle remains inside domain
-			if (mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].rightCellID > 0)
+		// Particle remains inside domain
+		if (mesh->cell(particlesVector->particleVector[i].cellID - 1).rightCellID > 0)
+		{
+			particlesVector->particleVector[i].cellID =
+				mesh->cell(particlesVector->particleVector[i].cellID - 1).rightCellID;
+		}
+		// Particle crosses right boundary
+		else
+		{
+			if (parametersList->rightBCType == bcPeriodic)
 			{
 				particlesVector->particleVector[i].cellID =
-					mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].rightCellID;
+					mesh->cell(particlesVector->particleVector[i].cellID - 1).periodicX1CellID;
+
+				// Shift Cartesian x/ cylindrical z position
+				particlesVector->particleVector[i].position[0] = displacementR +
+					mesh->cell(particlesVector->particleVector[i].cellID - 1).left;
 			}
-			// Particle crosses right boundary
-			else
+			else if (parametersList->rightBCType == bcOpen)
 			{
-				if (parametersList->rightBCType == "periodic")
-				{
-					particlesVector->particleVector[i].cellID =
-						mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].periodicX1CellID;
-
-					// Shift Cartesian x/ cylindrical z position
-					particlesVector->particleVector[i].position[0] = displacementR +
-						mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].left;
-				}
-				else if (parametersList->rightBCType == "open")
-				{
-					particlesVector->removeParticleFromSim(particlesVector->particleVector[i].particleID);
-					i -= 1;
-					continue;
-				}
-				else if (parametersList->rightBCType == "dirichlet" ||
-						 parametersList->rightBCType == "neumann")
-				{
-					// Reflect particle from boundary
-					particlesVector->particleVector[i].position[0] = -displacementR +
-						mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].right;
-
-					// Reverse Cartesian x/ cylindrical z velocity
-					particlesVector->particleVector[i].velocity[0] *= -1.0;
-				}
+				return exitDomain();
 			}
+			else if (parametersList->rightBCType == bcDirichlet ||
+					 parametersList->rightBCType == bcNeumann)
+			{
+				// Reflect particle from boundary
+				particlesVector->particleVector[i].position[0] = -displacementR +
+					mesh->cell(particlesVector->particleVector[i].cellID - 1).right;
 
-			mesh->addParticlesToCell(particlesVector->particleVector[i].cellID,
-				particlesVector->particleVector[i].particleID);
+				// Reverse Cartesian x/ cylindrical z velocity
+				particlesVector->particleVector[i].velocity[0] *= -1.0;
+			}
 		}
+	}
 
-		// Update Cartesian y/ cylindrical r position
-		particlesVector->particleVector[i].position[1] += parametersList->timeStep * 
-			particlesVector->particleVector[i].velocity[1];
+	// Update Cartesian y/ cylindrical r position
+	particlesVector->particleVector[i].position[1] += timeStep * 
+		particlesVector->particleVector[i].velocity[1];
 
-		double displacementB = particlesVector->particleVector[i].position[1] -
-			mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].bottom;
-		double displacementT = particlesVector->particleVector[i].position[1] -
-			mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].top;
+	double displacementB = particlesVector->particleVector[i].position[1] -
+		mesh->cell(particlesVector->particleVector[i].cellID - 1).bottom;
+	double displacementT = particlesVector->particleVector[i].position[1] -
+		mesh->cell(particlesVector->particleVector[i].cellID - 1).top;
 
-		if ((displacementB < 0.0 && abs(displacementB) >= mesh->h) || (displacementT > 0.0 && abs(displacementT) >= mesh->h))
+	if ((displacementB < 0.0 && std::abs(displacementB) >= mesh->h) || (displacementT > 0.0 && std::abs(displacementT) >= mesh->h))
+	{
+		parametersList->logBrief("Particle " + std::to_string(i + 1) + " has moved more than one cell length", 3);
+		return pushStopped;
+	}
+
+	// Update cell ID in Cartesian y/ cylindrical r direction, exiting bottom
+	if (displacementB < 0.0)
+	{
+		crossed = true;
+		
+		// Particle remains inside domain
+		if (mesh->cell(particlesVector->particleVector[i].cellID - 1).bottomCellID > 0)
 		{
-			parametersList->logBrief("Particle " + std::to_string(i + 1) + " has moved more than one cell length", 3);
-			break;
+			particlesVector->particleVector[i].cellID =
+				mesh->cell(particlesVector->particleVector[i].cellID - 1).bottomCellID;
 		}
-
-		// Update cell ID in Cartesian y/ cylindrical r direction, exiting bottom
-		if (displacementB < 0.0)
+		// Particle crosses bottom boundary
+		else
 		{
-			mesh->removeParticlesFromCell(particlesVector->particleVector[i].cellID,
-				particlesVector->particleVector[i].particleID);
-			
-			// Particle remains inside domain
-			if (mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].bottomCellID > 0)
+			// Periodic case not valid for axisymmetric simulations
+			if (parametersList->bottomBCType == bcPeriodic)
 			{
 				particlesVector->particleVector[i].cellID =
-					mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].bottomCellID;
+					mesh->cell(particlesVector->particleVector[i].cellID - 1).periodicX2CellID;
+
+				// Shift Cartesian y/ cylindrical r position
+				particlesVector->particleVector[i].position[1] = displacementB +
+					mesh->cell(particlesVector->particleVector[i].cellID - 1).top;
 			}
-			// Particle crosses bottom boundary
-			else
+			else if (parametersList->bottomBCType == bcOpen)
 			{
-				// Periodic case not valid for axisymmetric simulations
-				if (parametersList->bottomBCType == "periodic")
-				{
-					particlesVector->particleVector[i].cellID =
-						mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].periodicX2CellID;
+				return exitDomain();
+			}
+			else if (parametersList->bottomBCType == bcDirichlet ||
+					 parametersList->bottomBCType == bcNeumann)
+			{
+				// Reflect particle from boundary
+				particlesVector->particleVector[i].position[1] = -displacementB +
+					mesh->cell(particlesVector->particleVector[i].cellID - 1).bottom;
 
-					// Shift Cartesian y/ cylindrical r position
-					particlesVector->particleVector[i].position[1] = displacementB +
-						mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].top;
-				}
-				else if (parametersList->bottomBCType == "open")
-				{
-					particlesVector->removeParticleFromSim(particlesVector->particleVector[i].particleID);
-					i -= 1;
-					continue;
-				}
-				else if (parametersList->bottomBCType == "dirichlet" ||
-						 parametersList->bottomBCType == "neumann")
-				{
-					// Reflect particle from boundary
-					particlesVector->particleVector[i].position[1] = -displacementB +
-						mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].bottom;
+				// Reverse Cartesian y/ cylindrical r velocity
+				particlesVector->particleVector[i].velocity[1] *= -1.0;
+			}
+		}
+	}
 
-					// Reverse Cartesian y/ cylindrical r velocity
-					particlesVector->particleVector[i].velocity[1] *= -1.0;
-				}
+	// Update cell ID in Cartesian y/ cylindrical r direction, exiting top
+	else if (displacementT > 0.0)
+	{
+		crossed = true;
+		
+		// Particle remains inside domain
+		if (mesh->cell(particlesVector->particleVector[i].cellID - 1).topCellID > 0)
+		{
+			particlesVector->particleVector[i].cellID =
+				mesh->cell(particlesVector->particleVector[i].cellID - 1).topCellID;
+		}
+		// Particle crosses top boundary
+		else
+		{
+			// Periodic case not valid for axisymmetric simulations
+			if (parametersList->topBCType == bcPeriodic)
+			{
+				particlesVector->particleVector[i].cellID =
+					mesh->cell(particlesVector->particleVector[i].cellID - 1).periodicX2CellID;
+
+				// Shift Cartesian y/ cylindrical r position
+				particlesVector->particleVector[i].position[1] = displacementT +
+					mesh->cell(particlesVector->particleVector[i].cellID - 1).bottom;
+			}
+			else if (parametersList->topBCType == bcOpen)
+			{
+				return exitDomain();
 			}
+			else if (parametersList->topBCType == bcDirichlet ||
+					 parametersList->topBCType == bcNeumann)
+			{
+				// Reflect particle from boundary
+				particlesVector->particleVector[i].position[1] = -displacementT +
+					mesh->cell(particlesVector->particleVector[i].cellID - 1).top;
 
-			mesh->addParticlesToCell(particlesVector->particleVector[i].cellID,
-				particlesVector->particleVector[i].particleID);
+				// Reverse Cartesian y/ cylindrical r velocity
+				particlesVector->particleVector[i].velocity[1] *= -1.0;
+			}
 		}
+	}
+
+	// Update cylindrical theta position (no need to update Cartesian z)
+	if (parametersList->axisymmetric)
+	{
+		particlesVector->particleVector[i].position[2] += timeStep *
+			particlesVector->particleVector[i].velocity[2];
+
+		double newX2 = sqrt(particlesVector->particleVector[i].position[1] *
+			+particlesVector->particleVector[i].position[1] +
+			+particlesVector->particleVector[i].position[2] *
+			+particlesVector->particleVector[i].position[2]);
+
+		if (newX2 > (static_cast<double>(mesh->numRows) * mesh->h))
+		{
+			parametersList->logBrief("Out of plane motion has exceeded domain height", 2);
+		}
+
+		double rotation = atan(std::abs(particlesVector->particleVector[i].position[2]) /
+			particlesVector->particleVector[i].position[1]);
+
+		if ((rotation * 180.0 / PI) > 15.0)
+		{
+			parametersList->logBrief("Out of plane rotation has exceeded 15 degrees", 2);
+		}
+
+		displacementT += newX2 - particlesVector->particleVector[i].position[1];
+		if (displacementT > 0.0 && std::abs(displacementT) >= mesh->h)
+		{
+			parametersList->logBrief("Particle " + std::to_string(i + 1) + " has moved more than one cell length", 3);
+			return pushStopped;
+		}
+
+		// Update r and theta positions
+		particlesVector->particleVector[i].position[1] = newX2;
+		particlesVector->particleVector[i].position[2] = 0.0;
+
+		// Rotate velocities back to z-r plane
+		double velocity2 = particlesVector->particleVector[i].velocity[1];
+		particlesVector->particleVector[i].velocity[1] = cos(rotation) *
+			particlesVector->particleVector[i].velocity[1] - sin(rotation) *
+			particlesVector->particleVector[i].velocity[2];
+		particlesVector->particleVector[i].velocity[2] = sin(rotation) *
+			velocity2 + cos(rotation) *	particlesVector->particleVector[i].velocity[2];
 
 		// Update cell ID in Cartesian y/ cylindrical r direction, exiting top
-		else if (displacementT > 0.0)
+		if (displacementT > 0.0)
 		{
-			mesh->removeParticlesFromCell(particlesVector->particleVector[i].cellID,
-				particlesVector->particleVector[i].particleID);
-			
+			crossed = true;
+
 			// Particle remains inside domain
-			if (mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].topCellID > 0)
+			if (mesh->cell(particlesVector->particleVector[i].cellID - 1).topCellID > 0)
 			{
 				particlesVector->particleVector[i].cellID =
-					mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].topCellID;
+					mesh->cell(particlesVector->particleVector[i].cellID - 1).topCellID;
 			}
 			// Particle crosses top boundary
 			else
 			{
-				// Periodic case not valid for axisymmetric simulations
-				if (parametersList->topBCType == "periodic")
+				// TODO: Doesn't make sense to have periodic top BC for cylindrical case
+				if (parametersList->topBCType == bcPeriodic)
 				{
 					particlesVector->particleVector[i].cellID =
-						mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].periodicX2CellID;
+						mesh->cell(particlesVector->particleVector[i].cellID - 1).periodicX2CellID;
 
 					// Shift Cartesian y/ cylindrical r position
 					particlesVector->particleVector[i].position[1] = displacementT +
-						mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].bottom;
+						mesh->cell(particlesVector->particleVector[i].cellID - 1).bottom;
 				}
-				else if (parametersList->topBCType == "open")
+				else if (parametersList->topBCType == bcOpen)
 				{
-					particlesVector->removeParticleFromSim(particlesVector->particleVector[i].particleID);
-					i -= 1;
-					continue;
+					return exitDomain();
 				}
-				else if (parametersList->topBCType == "dirichlet" ||
-						 parametersList->topBCType == "neumann")
+				else if (parametersList->topBCType == bcDirichlet ||
+					parametersList->topBCType == bcNeumann)
 				{
 					// Reflect particle from boundary
 					particlesVector->particleVector[i].position[1] = -displacementT +
-						mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].top;
+						mesh->cell(particlesVector->particleVector[i].cellID - 1).top;
 
 					// Reverse Cartesian y/ cylindrical r velocity
 					particlesVector->particleVector[i].velocity[1] *= -1.0;
 				}
 			}
-
-			mesh->addParticlesToCell(particlesVector->particleVector[i].cellID,
-				particlesVector->particleVector[i].particleID);
 		}
-
-		// Update cylindrical theta position (no need to update Cartesian z)
-		if (parametersList->axisymmetric)
+	}
+	if (!deferUpdates)
+	{
+		if (crossed)
 		{
-			particlesVector->particleVector[i].position[2] += parametersList->timeStep *
-				particlesVector->particleVector[i].velocity[2];
-
-			double newX2 = sqrt(particlesVector->particleVector[i].position[1] *
-				+particlesVector->particleVector[i].position[1] +
-				+particlesVector->particleVector[i].position[2] *
-				+particlesVector->particleVector[i].position[2]);
-
-			if (newX2 > (static_cast<double>(mesh->numRows) * mesh->h));
-			{
-				parametersList->logBrief("Out of plane motion has exceeded domain height", 2);
-			}
-
-			double rotation = atan(abs(particlesVector->particleVector[i].position[2]) /
-				particlesVector->particleVector[i].position[1]);
-
-			if ((rotation * 180.0 / std::_Pi) > 15.0)
-			{
-				parametersList->logBrief("Out of plane rotation has exceeded 15 degrees", 2);
-			}
-
-			displacementT += newX2 - particlesVector->particleVector[i].position[1];
-			if (displacementT > 0.0 && abs(displacementT) >= mesh->h)
-			{
-				parametersList->logBrief("Particle " + std::to_string(i + 1) + " has moved more than one cell length", 3);
-				break;
-			}
-
-			// Update r and theta positions
-			particlesVector->particleVector[i].position[1] = newX2;
-			particlesVector->particleVector[i].position[2] = 0.0;
-
-			// Rotate velocities back to z-r plane
-			double velocity2 = particlesVector->particleVector[i].velocity[1];
-			particlesVector->particleVector[i].velocity[1] = cos(rotation) *
-				particlesVector->particleVector[i].velocity[1] - sin(rotation) *
-				particlesVector->particleVector[i].velocity[2];
-			particlesVector->particleVector[i].velocity[2] = sin(rotation) *
-				velocity2 + cos(rotation) *	particlesVector->particleVector[i].velocity[2];
-
-			// Update cell ID in Cartesian y/ cylindrical r direction, exiting top
-			if (displacementT > 0.0)
-			{
-				mesh->removeParticlesFromCell(particlesVector->particleVector[i].cellID,
-					particlesVector->particleVector[i].particleID);
-
-				// Particle remains inside domain
-				if (mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].topCellID > 0)
-				{
-					particlesVector->particleVector[i].cellID =
-						mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].topCellID;
-				}
-				// Particle crosses top boundary
-				else
-				{
-					// TODO: Doesn't make sense to have periodic top BC for cylindrical case
-					if (parametersList->topBCType == "periodic")
-					{
-						particlesVector->particleVector[i].cellID =
-							mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].periodicX2CellID;
-
-						// Shift Cartesian y/ cylindrical r position
-						particlesVector->particleVector[i].position[1] = displacementT +
-							mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].bottom;
-					}
-					else if (parametersList->topBCType == "open")
-					{
-						particlesVector->removeParticleFromSim(particlesVector->particleVector[i].particleID);
-						i -= 1;
-						continue;
-					}
-					else if (parametersList->topBCType == "dirichlet" ||
-						parametersList->topBCType == "neumann")
-					{
-						// Reflect particle from boundary
-						particlesVector->particleVector[i].position[1] = -displacementT +
-							mesh->cellsVector.cells[particlesVector->particleVector[i].cellID - 1].top;
-
-						// Reverse Cartesian y/ cylindrical r velocity
-						particlesVector->particleVector[i].velocity[1] *= -1.0;
-					}
-				}
-
-				mesh->addParticlesToCell(particlesVector->particleVector[i].cellID,
-					particlesVector->particleVector[i].particleID);
-			}
+			mesh->removeParticlesFromCell(oldCellID, particlesVector->particleVector[i].particleID);
+			mesh->addParticlesToCell(particlesVector->particleVector[i].cellID,
+				particlesVector->particleVector[i].particleID);
 		}
 		particlesVector->updatePlotVector(&particlesVector->particleVector[i]);
 	}
-
-	// TODO: Shift v forwards half a time step to sync v and x for plotting
-
-	parametersList->logBrief("Particle pusher exited", 1);
+	return crossed ? pushCrossed : pushMoved;
 }
-
-
-// Destructor
-ParticlePusher::~ParticlePusher()
-{
-}
\ No newline at end of file
@@ -9,6 +9,16 @@
 #include "Parameters.h"
 #include "VectorParticle.h"
 
+//! \enum PushResult
+//! \brief Outcome of pushing a single particle
+enum PushResult
+{
+	pushMoved,											//!< Particle moved within its cell
+	pushCrossed,										//!< Particle crossed a cell face (or was reflected at one)
+	pushRemoved,										//!< Particle left through an open boundary
+	pushStopped											//!< Error detected, stop pushing
+};
+
 //! \class ParticlePusher
 //! \brief Update particle position and velocity at each time step
 class ParticlePusher
@@ -25,5 +35,11 @@ public:
 
 
 	// Methods
-
+	static int subcycleInterval(Parameters *parametersList,
+		const Particle &particle);						//!< Time steps between pushes of a particle
+	static double subcycleStep(Parameters *parametersList,
+		Particle &particle);							//!< Time step to push a particle over, 0 if held
+	PushResult pushParticle(Parameters *parametersList, Mesh *mesh,
+		VectorParticle *particlesVector, int i,
+		double timeStep, bool deferUpdates = false);	//!< Push a single particle over a time step
 };
\ No newline at end of file
@@ -11,8 +11,9 @@ Patch::Patch()
 }
 
 
-// Constructor
-Patch::Patch(Parameters *parametersList, int patchID)
+// Constructor, which starts from a copy of a mesh generated once for all
+// patches, sharing its faces and ghost cells
+Patch::Patch(Parameters *parametersList, const Mesh &baseMesh, int patchID)
 {
 	parametersList->logMessages("Initialising patch " + std::to_string(patchID), __FILENAME__, __LINE__, 1);
 
@@ -20,7 +21,13 @@ Patch::Patch(Parameters *parametersList, int patchID)
 	this->patchID = patchID;
 	this->parametersList = *parametersList;
 
-	mesh = Mesh(&this->parametersList, "PIC");
+	// Patches of a seeded run draw from separate random number streams
+	if (this->parametersList.randomSeed != 0)
+	{
+		this->parametersList.setRandomSeed(this->parametersList.randomSeed, patchID);
+	}
+
+	mesh = baseMesh;
 	particlesVector = VectorParticle(&this->parametersList, &mesh, patchID);
 
 	parametersList->logBrief("Initialising Tecplot output files", 1);
@@ -38,23 +45,43 @@ Patch::~Patch()
 }
 
 
-// Generate Tecplot output
+// Generate Tecplot output. Output files may be shared with other patches, so
+// the bytes written by this patch are found from the growth of each file
+// while it holds the output lock (files are truncated at time zero).
 void Patch::generateParticleOutput(vector2D data, int numParticles, double time)
 {
 	// Plot style can be T (plot all particles at each time step), TA (animated),
 	// NT (plot each particle over all time steps) and NTA (animated)  
-	writeSolutionXY_NTA_Tecplot(parametersList.tecplotParticleSolution, data, numParticles, time);
+	std::string filename = parametersList.tecplotParticleSolution + ".plt";
+	# pragma omp critical(output)
+	{
+		long long initialSize = (time == 0.0) ? 0 : Instrumentation::fileSize(filename);
+		writeSolutionXY_NTA_Tecplot(parametersList.tecplotParticleSolution, data, numParticles, time);
+		instrumentation.addBytesWritten(Instrumentation::fileSize(filename) - initialSize);
+	}
 }
 
-void Patch::generateNodeOutput(Mesh mesh, double time)
+void Patch::generateNodeOutput(Mesh &mesh, double time)
 {
-	writeSolutionNodeTecplot(parametersList.tecplotNodeSolution, mesh, time);
+	std::string filename = parametersList.tecplotNodeSolution + ".plt";
+	# pragma omp critical(output)
+	{
+		long long initialSize = (time == 0.0) ? 0 : Instrumentation::fileSize(filename);
+		writeSolutionNodeTecplot(parametersList.tecplotNodeSolution, mesh, time);
+		instrumentation.addBytesWritten(Instrumentation::fileSize(filename) - initialSize);
+	}
 }
 
 void Patch::generateGlobalOutput(double EK, double EP, double time)
 {
-	writeSolution_T_Tecplot(parametersList.tecplotGlobalSolution, EK, EP, 
-		parametersList.maximumNumberOfIterations / parametersList.plotFrequency, time);
+	std::string filename = parametersList.tecplotGlobalSolution + ".plt";
+	# pragma omp critical(output)
+	{
+		long long initialSize = (time == 0.0) ? 0 : Instrumentation::fileSize(filename);
+		writeSolution_T_Tecplot(parametersList.tecplotGlobalSolution, EK, EP,
+			parametersList.maximumNumberOfIterations / parametersList.plotFrequency, time);
+		instrumentation.addBytesWritten(Instrumentation::fileSize(filename) - initialSize);
+	}
 }
 
 // Start the PIC loop within a Patch object
@@ -65,32 +92,125 @@ void Patch::startPIC()
 	{
 		parametersList.logMessages("Starting PIC loop in patch " + std::to_string(patchID), __FILENAME__, __LINE__, 1);
 
+		// Instrumentation is created here rather than in the constructor, since
+		// it holds a pointer to this patch's copy of the parameters list
+		instrumentation = Instrumentation(&parametersList, patchID);
+
+		if (parametersList.openBoundaryInjection == true)
+		{
+			injector = Injector(&parametersList, &mesh, &particlesVector);
+		}
+
+		fdtd = FDTD(&parametersList, &mesh);
+
+		// Esirkepov current is deposited on the FDTD mesh, which then advances
+		// the whole field, so the Poisson solve is only needed for the initial
+		// field and charge is only projected for output
+		bool esirkepov = parametersList.currentDeposition == "esirkepov";
+
+		// Set once the fused kernel has deposited charge at the new particle
+		// positions, so that the projector does not deposit it again
+		bool chargeDeposited = false;
+
 		for (int i = 0; i < parametersList.maximumNumberOfIterations; i++)
 		{
 			parametersList.logMessages("Starting iteration " + std::to_string(i + 1),
 				__FILENAME__, __LINE__, 1);
 
+			bool plotStep = (static_cast<int>((time + parametersList.timeStep) / parametersList.timeStep) + 1) %
+				parametersList.plotFrequency == 0;
+
 			// TODO: Do the classes below really need to be defined as such, or can they
 			// be replaced with functions of the Patch class? Probably more efficient
 			// to call functions rather than producing class instances at each 
 			// time step...
 
-			ChargeProjector projector(&parametersList, &mesh, &particlesVector);
+			// Repartition tiles between threads to follow the particles
+			if (parametersList.loadBalanceFrequency > 0 && i % parametersList.loadBalanceFrequency == 0)
+			{
+				instrumentation.startStage();
+				mesh.tilesVector.balance(&parametersList, &mesh, &particlesVector, parametersList.numThreads);
+				instrumentation.stopStage(stageBalance);
+			}
+
+			if (!esirkepov || i == 0 || plotStep)
+			{
+				instrumentation.startStage();
+				ChargeProjector projector(&parametersList, &mesh, &particlesVector, !chargeDeposited);
+				instrumentation.stopStage(stageProject);
+			}
 
-			FieldSolver solver(&parametersList, &mesh);
+			if (!esirkepov || i == 0)
+			{
+				instrumentation.startStage();
+				FieldSolver solver(&parametersList, &mesh);
+				instrumentation.stopStage(stageSolve);
+				instrumentation.addSolverIterations(solver.iterations);
+			}
 
 			if ((static_cast<int>(time / parametersList.timeStep) + 1) % parametersList.FDTDfrequency == 0)
 			{
-				FDTD fdtd(&parametersList, &mesh);
+				instrumentation.startStage();
+				fdtd.solveFields(&parametersList, &mesh);
+				instrumentation.stopStage(stageFDTD);
 			}
 
-			FieldInterpolator interpolator(&parametersList, &mesh, &particlesVector);
+			// The first push only moves velocities back half a step, so always
+			// uses the separate stages
+			if (parametersList.fusedKernel == true && time > 0.0)
+			{
+				instrumentation.addParticlesPushed(particlesVector.numParticles);
+				instrumentation.startStage();
+				FusedKernel fused(&parametersList, &mesh, &fdtd.FDTDmesh, &particlesVector);
+				instrumentation.stopStage(stagePush);
+				chargeDeposited = true;
+			}
+			else
+			{
+				instrumentation.startStage();
+				FieldInterpolator interpolator(&parametersList, &mesh, &particlesVector);
+				instrumentation.stopStage(stageInterpolate);
+
+				instrumentation.addParticlesPushed(particlesVector.numParticles);
+				instrumentation.startStage();
+				ParticlePusher pusher(&parametersList, &mesh, &particlesVector, time);
+				instrumentation.stopStage(stagePush);
+
+				if (esirkepov)
+				{
+					instrumentation.startStage();
+					CurrentProjector currentProjector(&parametersList, &fdtd.FDTDmesh, &particlesVector);
+					instrumentation.stopStage(stageCurrent);
+				}
+				chargeDeposited = false;
+			}
 
-			ParticlePusher pusher(&parametersList, &mesh, &particlesVector, time);
+			// Replace particles which have left through open boundaries
+			if (parametersList.openBoundaryInjection == true)
+			{
+				instrumentation.startStage();
+				injector.inject(&parametersList, &mesh, &particlesVector);
+				instrumentation.stopStage(stageInject);
+				chargeDeposited = false;
+			}
 
 			if ((static_cast<int>(time / parametersList.timeStep) + 1) % parametersList.MCCfrequency == 0)
 			{
+				instrumentation.startStage();
 				MCC collisions(&parametersList, &mesh, &particlesVector);
+				instrumentation.stopStage(stageMCC);
+
+				// Collisions may add or remove particles
+				chargeDeposited = false;
+			}
+
+			// Merge and split particles to keep the number per cell near its target
+			if (parametersList.resampleFrequency > 0 && (i + 1) % parametersList.resampleFrequency == 0)
+			{
+				instrumentation.startStage();
+				Resampler resampler(&parametersList, &mesh, &particlesVector);
+				instrumentation.stopStage(stageResample);
+				chargeDeposited = false;
 			}
 
 			// TODO: At certain intervals, calculate the Debye length, plasma frequency, 
@@ -107,16 +227,22 @@ void Patch::startPIC()
 			time += parametersList.timeStep;
 
 			// Generate plots at specified intervals
-			if ((static_cast<int>(time / parametersList.timeStep) + 1) % parametersList.plotFrequency == 0)
+			if (plotStep)
 			{
+				instrumentation.startStage();
 				double EK = particlesVector.calculateEK();
 				double EP = mesh.nodesVector.calculateEP();
 
 				generateParticleOutput(particlesVector.plotVector, particlesVector.numParticles, time);
 				generateNodeOutput(mesh, time);
 				generateGlobalOutput(EK, EP, time);
+				instrumentation.stopStage(stageOutput);
 				parametersList.logBrief("Tecplot output generated", 1);
 			}
+
+			instrumentation.endIteration(i + 1, time, particlesVector.numParticles);
 		}
+
+		instrumentation.writeSummary();
 	}
 }
\ No newline at end of file
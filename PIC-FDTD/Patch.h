@@ -8,13 +8,18 @@
 #include <iostream>
 
 #include "ChargeProjector.h"
+#include "CurrentProjector.h"
 #include "FDTD.h"
 #include "FieldInterpolator.h"
 #include "FieldSolver.h"
+#include "FusedKernel.h"
+#include "Injector.h"
+#include "Instrumentation.h"
 #include "MCC.h"
 #include "Mesh.h"
 #include "Parameters.h"
 #include "ParticlePusher.h"
+#include "Resampler.h"
 #include "VectorParticle.h"
 
 //! \class Patch
@@ -27,12 +32,15 @@ private:
 	Parameters parametersList;							//!< Copy of parameters list
 	Mesh mesh;											//!< Details of mesh
 	VectorParticle particlesVector;						//!< Vector of resident particles
+	Instrumentation instrumentation;					//!< Stage timings and throughput metrics
+	Injector injector;									//!< Particle injection through open boundaries
+	FDTD fdtd;											//!< FDTD solver, whose mesh is kept between steps
 
 
 	// Methods
 	void generateParticleOutput(vector2D data, 
 		int numParticles, double time);					//!< Generate Tecplot output for particles
-	void generateNodeOutput(Mesh mesh, double time);	//!< Generate Tecplot output for nodes
+	void generateNodeOutput(Mesh &mesh, double time);	//!< Generate Tecplot output for nodes
 	void generateGlobalOutput(double EK, double EP, 
 		double time);									//!< Generate Tecplot output for global parameters
 
@@ -44,8 +52,13 @@ public:
 
 	// Constructor/destructor
 	Patch();											//!< Default constructor
-	Patch(Parameters *parametersList, int patchID);		//!< Constructor
+	Patch(Parameters *parametersList, const Mesh &baseMesh,
+		int patchID);									//!< Constructor
+	Patch(const Patch &patch) = delete;					//!< Patches are not copied
+	Patch(Patch &&patch) = default;						//!< Move constructor
 	~Patch();											//!< Destructor
+	Patch &operator=(const Patch &patch) = delete;		//!< Patches are not copied
+	Patch &operator=(Patch &&patch) = default;			//!< Move assignment
 
 
 	// Methods
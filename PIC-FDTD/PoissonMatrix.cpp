@@ -0,0 +1,620 @@
+//! \file
+//! \brief Implementation of PoissonMatrix class
+//! \author Rahul Kalampattel
+//! \date Last updated June 2018
+
+#include <cmath>
+#include <map>
+#include <utility>
+
+#include "CHEM/chemConstants.hpp"
+#include "Mesh.h"
+#include "Parameters.h"
+#include "PoissonMatrix.h"
+
+// Default constructor
+PoissonMatrix::PoissonMatrix()
+{
+}
+
+
+// Destructor
+PoissonMatrix::~PoissonMatrix()
+{
+}
+
+
+//! \struct NodeEquation
+//! \brief Equation for the potential at a single node, either a fixed value,
+//! or diagonal * phi - sum(coefficient * neighbour phi) = rhoCoefficient * rho
+//! + constant
+struct NodeEquation
+{
+	bool fixed = false;								//!< Potential set directly
+	bool held = false;								//!< Potential left unchanged
+	double value = 0.0;								//!< Value of fixed potential
+	double diagonal = 0.0;							//!< Coefficient of node potential
+	std::vector<std::pair<int, double>> neighbours;	//!< Neighbour node and coefficient pairs
+	double rhoCoefficient = 0.0;					//!< Coefficient of charge density
+	double constant = 0.0;							//!< Constant from boundary conditions
+};
+
+
+// Equation for the potential at a node, following the stencils of the SOR
+// solver in FieldSolver so that both converge to the same potential
+static NodeEquation nodeEquation(Parameters *parametersList, const Mesh *mesh, int j)
+{
+	const NodeGeometry &node = mesh->node(j);
+	double h = mesh->h;
+	int left = node.leftNodeID - 1, right = node.rightNodeID - 1;
+	int top = node.topNodeID - 1, bottom = node.bottomNodeID - 1;
+	int periodicX1 = node.periodicX1NodeID - 1, periodicX2 = node.periodicX2NodeID - 1;
+
+	NodeEquation equation;
+	equation.rhoCoefficient = h * h / EPSILON_0;
+
+	auto fixed = [&](double value)
+	{
+		equation.fixed = true;
+		equation.value = value;
+	};
+
+	if (parametersList->axisymmetric)
+	{
+		double above = 1.0 + h / (2 * node.geometry.X(1));
+		double below = 1.0 - h / (2 * node.geometry.X(1));
+
+		if (node.boundaryType == boundaryInternal)
+		{
+			equation.diagonal = 4.0;
+			equation.neighbours = { { left, 1.0 }, { right, 1.0 }, { top, above }, { bottom, below } };
+		}
+		else if (node.boundaryType == boundaryL && parametersList->leftBCType == bcPeriodic)
+		{
+			equation.diagonal = 4.0;
+			equation.neighbours = { { periodicX1, 1.0 }, { right, 1.0 }, { top, above }, { bottom, below } };
+		}
+		else if (node.boundaryType == boundaryL && parametersList->leftBCType == bcDirichlet)
+		{
+			fixed(parametersList->leftBCValue);
+		}
+		else if (node.boundaryType == boundaryL && parametersList->leftBCType == bcNeumann)
+		{
+			equation.diagonal = 3.0;
+			equation.neighbours = { { right, 1.0 }, { top, above }, { bottom, below } };
+			equation.constant = -h * parametersList->leftBCValue;
+		}
+		else if (node.boundaryType == boundaryR && parametersList->rightBCType == bcPeriodic)
+		{
+			equation.diagonal = 4.0;
+			equation.neighbours = { { left, 1.0 }, { periodicX1, 1.0 }, { top, above }, { bottom, below } };
+		}
+		else if (node.boundaryType == boundaryR && parametersList->rightBCType == bcDirichlet)
+		{
+			fixed(parametersList->rightBCValue);
+		}
+		else if (node.boundaryType == boundaryR && parametersList->rightBCType == bcNeumann)
+		{
+			equation.diagonal = 3.0;
+			equation.neighbours = { { left, 1.0 }, { top, above }, { bottom, below } };
+			equation.constant = h * parametersList->rightBCValue;
+		}
+		else if (node.boundaryType == boundaryT && parametersList->topBCType == bcDirichlet)
+		{
+			fixed(parametersList->topBCValue);
+		}
+		else if (node.boundaryType == boundaryT && parametersList->topBCType == bcNeumann)
+		{
+			equation.diagonal = 3.0;
+			equation.neighbours = { { left, 1.0 }, { right, 1.0 }, { bottom, 1.0 } };
+			equation.constant = h * h * parametersList->topBCValue / node.geometry.X(1) +
+				h * parametersList->topBCValue;
+		}
+		else if (node.boundaryType == boundaryB)
+		{
+			// Bottom nodes must always obey the symmetry BC
+			equation.diagonal = 4.0;
+			equation.neighbours = { { left, 1.0 }, { right, 1.0 }, { top, 2.0 } };
+		}
+		else
+		{
+			// Corner nodes and open boundaries are not updated by SOR either
+			equation.held = true;
+		}
+		return equation;
+	}
+
+	if (node.boundaryType == boundaryInternal)
+	{
+		equation.diagonal = 4.0;
+		equation.neighbours = { { left, 1.0 }, { right, 1.0 }, { top, 1.0 }, { bottom, 1.0 } };
+	}
+	else if (node.boundaryType == boundaryL)
+	{
+		if (parametersList->leftBCType == bcPeriodic)
+		{
+			equation.diagonal = 4.0;
+			equation.neighbours = { { periodicX1, 1.0 }, { right, 1.0 }, { top, 1.0 }, { bottom, 1.0 } };
+		}
+		else if (parametersList->leftBCType == bcDirichlet)
+		{
+			fixed(parametersList->leftBCValue);
+		}
+		else if (parametersList->leftBCType == bcNeumann)
+		{
+			equation.diagonal = 3.0;
+			equation.neighbours = { { right, 1.0 }, { top, 1.0 }, { bottom, 1.0 } };
+			equation.constant = -parametersList->leftBCValue * h;
+		}
+		else
+		{
+			equation.held = true;
+		}
+	}
+	else if (node.boundaryType == boundaryR)
+	{
+		if (parametersList->rightBCType == bcPeriodic)
+		{
+			equation.diagonal = 4.0;
+			equation.neighbours = { { left, 1.0 }, { periodicX1, 1.0 }, { top, 1.0 }, { bottom, 1.0 } };
+		}
+		else if (parametersList->rightBCType == bcDirichlet)
+		{
+			fixed(parametersList->rightBCValue);
+		}
+		else if (parametersList->rightBCType == bcNeumann)
+		{
+			equation.diagonal = 3.0;
+			equation.neighbours = { { left, 1.0 }, { top, 1.0 }, { bottom, 1.0 } };
+			equation.constant = parametersList->rightBCValue * h;
+		}
+		else
+		{
+			equation.held = true;
+		}
+	}
+	else if (node.boundaryType == boundaryT)
+	{
+		if (parametersList->topBCType == bcPeriodic)
+		{
+			equation.diagonal = 4.0;
+			equation.neighbours = { { left, 1.0 }, { right, 1.0 }, { periodicX2, 1.0 }, { bottom, 1.0 } };
+		}
+		else if (parametersList->topBCType == bcDirichlet)
+		{
+			fixed(parametersList->topBCValue);
+		}
+		else if (parametersList->topBCType == bcNeumann)
+		{
+			equation.diagonal = 3.0;
+			equation.neighbours = { { left, 1.0 }, { right, 1.0 }, { bottom, 1.0 } };
+			equation.constant = parametersList->topBCValue * h;
+		}
+		else
+		{
+			equation.held = true;
+		}
+	}
+	else if (node.boundaryType == boundaryB)
+	{
+		if (parametersList->bottomBCType == bcPeriodic)
+		{
+			equation.diagonal = 4.0;
+			equation.neighbours = { { left, 1.0 }, { right, 1.0 }, { top, 1.0 }, { periodicX2, 1.0 } };
+		}
+		else if (parametersList->bottomBCType == bcDirichlet)
+		{
+			fixed(parametersList->bottomBCValue);
+		}
+		else if (parametersList->bottomBCType == bcNeumann)
+		{
+			equation.diagonal = 3.0;
+			equation.neighbours = { { left, 1.0 }, { right, 1.0 }, { top, 1.0 } };
+			equation.constant = -parametersList->bottomBCValue * h;
+		}
+		else
+		{
+			equation.held = true;
+		}
+	}
+	else if (parametersList->leftBCType == bcNeumann && parametersList->rightBCType == bcNeumann &&
+		parametersList->topBCType == bcNeumann && parametersList->bottomBCType == bcNeumann)
+	{
+		equation.diagonal = 2.0;
+		if (node.boundaryType == boundaryTL)
+		{
+			equation.neighbours = { { right, 1.0 }, { bottom, 1.0 } };
+			equation.constant = h * (parametersList->topBCValue - parametersList->leftBCValue);
+		}
+		else if (node.boundaryType == boundaryBL)
+		{
+			equation.neighbours = { { right, 1.0 }, { top, 1.0 } };
+			equation.constant = -h * (parametersList->bottomBCValue + parametersList->leftBCValue);
+		}
+		else if (node.boundaryType == boundaryTR)
+		{
+			equation.neighbours = { { left, 1.0 }, { bottom, 1.0 } };
+			equation.constant = h * (parametersList->topBCValue + parametersList->rightBCValue);
+		}
+		else
+		{
+			equation.neighbours = { { left, 1.0 }, { top, 1.0 } };
+			equation.constant = h * (parametersList->rightBCValue - parametersList->bottomBCValue);
+		}
+	}
+	else if (parametersList->leftBCType == bcDirichlet && parametersList->topBCType == bcDirichlet)
+	{
+		fixed(0.5 * (parametersList->leftBCValue + parametersList->topBCValue));
+	}
+	else if (parametersList->leftBCType == bcDirichlet && parametersList->bottomBCType == bcDirichlet)
+	{
+		fixed(0.5 * (parametersList->leftBCValue + parametersList->bottomBCValue));
+	}
+	else if (parametersList->rightBCType == bcDirichlet && parametersList->topBCType == bcDirichlet)
+	{
+		fixed(0.5 * (parametersList->rightBCValue + parametersList->topBCValue));
+	}
+	else if (parametersList->rightBCType == bcDirichlet && parametersList->bottomBCType == bcDirichlet)
+	{
+		fixed(0.5 * (parametersList->rightBCValue + parametersList->bottomBCValue));
+	}
+	else if (parametersList->leftBCType == bcDirichlet)
+	{
+		fixed(parametersList->leftBCValue);
+	}
+	else if (parametersList->rightBCType == bcDirichlet)
+	{
+		fixed(parametersList->rightBCValue);
+	}
+	else if (parametersList->topBCType == bcDirichlet)
+	{
+		fixed(parametersList->topBCValue);
+	}
+	else if (parametersList->bottomBCType == bcDirichlet)
+	{
+		fixed(parametersList->bottomBCValue);
+	}
+	else
+	{
+		parametersList->logBrief("Unable to resolve corner BCs", 2);
+		fixed(0.0);
+	}
+	return equation;
+}
+
+
+// Assemble operator and preconditioner from the mesh. Fixed nodes are moved to
+// the right hand side, and periodic image nodes share an unknown whose
+// equation is the sum of both nodes' equations (the fixed point of SOR with
+// averaging across the boundary), which keeps the Cartesian operator
+// symmetric.
+void PoissonMatrix::assemble(Parameters *parametersList, const Mesh *mesh)
+{
+	int numNodes = mesh->numNodes;
+	std::vector<NodeEquation> equations(numNodes);
+	for (int j = 0; j < numNodes; j++)
+	{
+		equations[j] = nodeEquation(parametersList, mesh, j);
+	}
+
+	// Number unknowns, with right and bottom periodic nodes sharing the
+	// unknown of their image on the left or top
+	unknownIDs.assign(numNodes, -1);
+	fixedValues.assign(numNodes, 0.0);
+	heldNodes.assign(numNodes, false);
+	numUnknowns = 0;
+	for (int j = 0; j < numNodes; j++)
+	{
+		const NodeGeometry &node = mesh->node(j);
+		if (equations[j].fixed || equations[j].held)
+		{
+			fixedValues[j] = equations[j].value;
+			heldNodes[j] = equations[j].held;
+			continue;
+		}
+
+		int image = -1;
+		if (parametersList->leftBCType == bcPeriodic && (node.boundaryType & boundaryR))
+		{
+			image = node.periodicX1NodeID - 1;
+		}
+		else if (!parametersList->axisymmetric && parametersList->topBCType == bcPeriodic &&
+			(node.boundaryType & boundaryB))
+		{
+			image = node.periodicX2NodeID - 1;
+		}
+
+		if (image < 0 || equations[image].fixed || equations[image].held)
+		{
+			unknownIDs[j] = numUnknowns;
+			numUnknowns++;
+		}
+	}
+	for (int j = 0; j < numNodes; j++)
+	{
+		const NodeGeometry &node = mesh->node(j);
+		if (unknownIDs[j] < 0 && !equations[j].fixed && !equations[j].held)
+		{
+			unknownIDs[j] = unknownIDs[(node.boundaryType & boundaryR) &&
+				parametersList->leftBCType == bcPeriodic ?
+				node.periodicX1NodeID - 1 : node.periodicX2NodeID - 1];
+		}
+	}
+
+	// Sum node equations into rows of unknowns
+	std::vector<std::map<int, double>> rows(numUnknowns);
+	constants.assign(numUnknowns, 0.0);
+	rhoCoefficients.assign(numNodes, 0.0);
+	couplingUnknowns.clear();
+	couplingNodes.clear();
+	couplingValues.clear();
+	for (int j = 0; j < numNodes; j++)
+	{
+		int row = unknownIDs[j];
+		if (row < 0)
+		{
+			continue;
+		}
+
+		rows[row][row] += equations[j].diagonal;
+		constants[row] += equations[j].constant;
+		rhoCoefficients[j] = equations[j].rhoCoefficient;
+		for (const auto &neighbour : equations[j].neighbours)
+		{
+			int column = unknownIDs[neighbour.first];
+			if (column < 0)
+			{
+				couplingUnknowns.push_back(row);
+				couplingNodes.push_back(neighbour.first);
+				couplingValues.push_back(neighbour.second);
+			}
+			else
+			{
+				rows[row][column] -= neighbour.second;
+			}
+		}
+	}
+	matrix.assemble(rows);
+
+	inverseDiagonal.resize(numUnknowns);
+	for (int i = 0; i < numUnknowns; i++)
+	{
+		inverseDiagonal[i] = 1.0 / matrix.values[matrix.diagonalEntry[i]];
+	}
+	if (parametersList->preconditioner == "ilu0")
+	{
+		matrix.factoriseILU();
+	}
+
+	method = parametersList->solverType;
+	if (method == "PCG" && !matrix.isSymmetric(1e-12))
+	{
+		parametersList->logBrief("Poisson operator is not symmetric, BiCGStab will be used instead of PCG", 2);
+		method = "BiCGStab";
+	}
+
+	parametersList->logBrief("Poisson operator assembled with " + std::to_string(numUnknowns) +
+		" unknowns and " + std::to_string(matrix.values.size()) + " entries", 1);
+}
+
+
+// Solve for phi at each node, starting from its current value, and return the
+// number of iterations performed
+int PoissonMatrix::solve(Parameters *parametersList, Mesh *mesh) const
+{
+	std::vector<double> b(constants), x(numUnknowns, 0.0);
+
+	for (int j = 0; j < mesh->numNodes; j++)
+	{
+		Nodes &node = mesh->nodesVector.nodes[j];
+		if (unknownIDs[j] >= 0)
+		{
+			b[unknownIDs[j]] += rhoCoefficients[j] * node.rho;
+			x[unknownIDs[j]] = node.phi;
+		}
+		else if (!heldNodes[j])
+		{
+			node.phi = fixedValues[j];
+		}
+	}
+	for (unsigned int k = 0; k < couplingUnknowns.size(); k++)
+	{
+		b[couplingUnknowns[k]] += couplingValues[k] * mesh->nodesVector.nodes[couplingNodes[k]].phi;
+	}
+
+	// Same measure as the SOR residual, an RMS over all nodes
+	double tolerance = parametersList->residualTolerance * sqrt(static_cast<double>(mesh->numNodes));
+
+	int iterations = (method == "PCG") ? solvePCG(parametersList, b, x, tolerance) :
+		solveBiCGStab(parametersList, b, x, tolerance);
+
+	for (int j = 0; j < mesh->numNodes; j++)
+	{
+		if (unknownIDs[j] >= 0)
+		{
+			mesh->nodesVector.nodes[j].phi = x[unknownIDs[j]];
+		}
+	}
+	return iterations;
+}
+
+
+// Apply preconditioner, z = M^-1 r
+void PoissonMatrix::precondition(const std::vector<double> &r, std::vector<double> &z) const
+{
+	if (matrix.factors.empty())
+	{
+		for (int i = 0; i < numUnknowns; i++)
+		{
+			z[i] = inverseDiagonal[i] * r[i];
+		}
+	}
+	else
+	{
+		matrix.solveILU(r, z);
+	}
+}
+
+
+// Dot product of two vectors
+static double dot(const std::vector<double> &a, const std::vector<double> &b, int numThreads)
+{
+	double sum = 0.0;
+
+	# pragma omp parallel for reduction(+:sum) num_threads(numThreads)
+	for (unsigned int i = 0; i < a.size(); i++)
+	{
+		sum += a[i] * b[i];
+	}
+	return sum;
+}
+
+
+// Preconditioned conjugate gradient method, for symmetric operators
+int PoissonMatrix::solvePCG(Parameters *parametersList, const std::vector<double> &b,
+	std::vector<double> &x, double tolerance) const
+{
+	int numThreads = parametersList->numThreads;
+	std::vector<double> r(numUnknowns), z(numUnknowns), p(numUnknowns), Ap(numUnknowns);
+
+	matrix.multiply(x, Ap, numThreads);
+	for (int i = 0; i < numUnknowns; i++)
+	{
+		r[i] = b[i] - Ap[i];
+	}
+	if (sqrt(dot(r, r, numThreads)) < tolerance)
+	{
+		return 0;
+	}
+	precondition(r, z);
+	p = z;
+	double rz = dot(r, z, numThreads);
+
+	int iteration = 0;
+	while (iteration < parametersList->maxSolverIterations)
+	{
+		iteration++;
+
+		matrix.multiply(p, Ap, numThreads);
+		double pAp = dot(p, Ap, numThreads);
+		if (pAp == 0.0)
+		{
+			break;
+		}
+		double alpha = rz / pAp;
+
+		# pragma omp parallel for num_threads(numThreads)
+		for (int i = 0; i < numUnknowns; i++)
+		{
+			x[i] += alpha * p[i];
+			r[i] -= alpha * Ap[i];
+		}
+		if (sqrt(dot(r, r, numThreads)) < tolerance)
+		{
+			parametersList->logBrief("Solver convergence criteria met", 1);
+			break;
+		}
+
+		precondition(r, z);
+		double rzNew = dot(r, z, numThreads);
+		double beta = rzNew / rz;
+		rz = rzNew;
+
+		# pragma omp parallel for num_threads(numThreads)
+		for (int i = 0; i < numUnknowns; i++)
+		{
+			p[i] = z[i] + beta * p[i];
+		}
+	}
+	return iteration;
+}
+
+
+// Preconditioned (from the right) biconjugate gradient stabilised method, for
+// non-symmetric operators
+int PoissonMatrix::solveBiCGStab(Parameters *parametersList, const std::vector<double> &b,
+	std::vector<double> &x, double tolerance) const
+{
+	int numThreads = parametersList->numThreads;
+	std::vector<double> r(numUnknowns), rHat(numUnknowns), p(numUnknowns, 0.0),
+		v(numUnknowns, 0.0), pHat(numUnknowns), s(numUnknowns), sHat(numUnknowns),
+		t(numUnknowns);
+
+	matrix.multiply(x, v, numThreads);
+	for (int i = 0; i < numUnknowns; i++)
+	{
+		r[i] = b[i] - v[i];
+		v[i] = 0.0;
+	}
+	if (sqrt(dot(r, r, numThreads)) < tolerance)
+	{
+		return 0;
+	}
+	rHat = r;
+	double rho = 1.0, alpha = 1.0, omega = 1.0;
+
+	int iteration = 0;
+	while (iteration < parametersList->maxSolverIterations)
+	{
+		iteration++;
+
+		double rhoNew = dot(rHat, r, numThreads);
+		if (rhoNew == 0.0)
+		{
+			break;
+		}
+		double beta = (rhoNew / rho) * (alpha / omega);
+		rho = rhoNew;
+
+		# pragma omp parallel for num_threads(numThreads)
+		for (int i = 0; i < numUnknowns; i++)
+		{
+			p[i] = r[i] + beta * (p[i] - omega * v[i]);
+		}
+		precondition(p, pHat);
+		matrix.multiply(pHat, v, numThreads);
+		double rHatV = dot(rHat, v, numThreads);
+		if (rHatV == 0.0)
+		{
+			break;
+		}
+		alpha = rho / rHatV;
+
+		# pragma omp parallel for num_threads(numThreads)
+		for (int i = 0; i < numUnknowns; i++)
+		{
+			s[i] = r[i] - alpha * v[i];
+		}
+		if (sqrt(dot(s, s, numThreads)) < tolerance)
+		{
+			for (int i = 0; i < numUnknowns; i++)
+			{
+				x[i] += alpha * pHat[i];
+			}
+			parametersList->logBrief("Solver convergence criteria met", 1);
+			break;
+		}
+
+		precondition(s, sHat);
+		matrix.multiply(sHat, t, numThreads);
+		double tt = dot(t, t, numThreads);
+		omega = (tt == 0.0) ? 0.0 : dot(t, s, numThreads) / tt;
+
+		# pragma omp parallel for num_threads(numThreads)
+		for (int i = 0; i < numUnknowns; i++)
+		{
+			x[i] += alpha * pHat[i] + omega * sHat[i];
+			r[i] = s[i] - omega * t[i];
+		}
+		if (sqrt(dot(r, r, numThreads)) < tolerance)
+		{
+			parametersList->logBrief("Solver convergence criteria met", 1);
+			break;
+		}
+		if (omega == 0.0)
+		{
+			break;
+		}
+	}
+	return iteration;
+}
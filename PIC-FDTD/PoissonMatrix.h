@@ -0,0 +1,54 @@
+//! \file
+//! \brief Definition of PoissonMatrix class
+//! \author Rahul Kalampattel
+//! \date Last updated June 2018
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "SparseMatrix.h"
+
+class Mesh;				// Forward declarations to resolve circular dependency
+class Parameters;
+
+//! \class PoissonMatrix
+//! \brief Discrete Poisson operator of the field solver, with its boundary
+//! condition rows, assembled from mesh connectivity and solved with a
+//! preconditioned Krylov method
+class PoissonMatrix
+{
+public:
+	// Data members
+	SparseMatrix matrix;					//!< Operator on unknown potentials
+	std::vector<int> unknownIDs;			//!< Unknown of each node, -1 for fixed nodes
+	std::vector<double> fixedValues;		//!< Potential of each fixed node
+	std::vector<bool> heldNodes;			//!< Nodes whose potential is left unchanged by the solver
+	std::vector<double> rhoCoefficients;	//!< Coefficient of charge density of each node in its unknown's equation
+	std::vector<double> constants;			//!< Constant part of the right hand side of each unknown
+	std::vector<int> couplingUnknowns;		//!< Unknown coupled to a fixed node, for each coupling
+	std::vector<int> couplingNodes;			//!< Fixed node of each coupling
+	std::vector<double> couplingValues;		//!< Coefficient of fixed node potential on right hand side of each coupling
+	std::vector<double> inverseDiagonal;	//!< Jacobi preconditioner
+	std::string method;						//!< Krylov method (PCG, BiCGStab)
+	int numUnknowns = 0;					//!< Number of unknowns, 0 until assembled
+
+
+	// Constructor/destructor
+	PoissonMatrix();						//!< Default constructor
+	~PoissonMatrix();						//!< Destructor
+
+
+	// Methods
+	void assemble(Parameters *parametersList,
+		const Mesh *mesh);					//!< Assemble operator and preconditioner from the mesh
+	int solve(Parameters *parametersList,
+		Mesh *mesh) const;					//!< Solve for phi at each node, returning iterations performed
+	void precondition(const std::vector<double> &r,
+		std::vector<double> &z) const;		//!< Apply preconditioner, z = M^-1 r
+	int solvePCG(Parameters *parametersList, const std::vector<double> &b,
+		std::vector<double> &x, double tolerance) const;		//!< Preconditioned conjugate gradient method
+	int solveBiCGStab(Parameters *parametersList, const std::vector<double> &b,
+		std::vector<double> &x, double tolerance) const;		//!< Preconditioned biconjugate gradient stabilised method
+};
@@ -0,0 +1,231 @@
+//! \file
+//! \brief Implementation of Resampler class
+//! \author Rahul Kalampattel
+//! \date Last updated June 2018
+
+#include <algorithm>
+#include <map>
+#include <utility>
+
+#include "Resampler.h"
+
+// Default constructor
+Resampler::Resampler()
+{
+}
+
+
+// Merge a group of particles into two of half the total weight each, at the
+// weighted mean position. Velocities are the weighted mean plus or minus the
+// spread of the group, along the largest deviation from the mean, which keeps
+// both momentum and kinetic energy. Velocities from the previous step are
+// merged in the same way, so energy diagnostics are unchanged.
+static void mergeGroup(const std::vector<const Particle*> &group, std::vector<Particle> &added)
+{
+	double totalWeight = 0.0;
+	std::vector<double> position(3, 0.0), oldPosition(3, 0.0);
+	for (unsigned int i = 0; i < group.size(); i++)
+	{
+		totalWeight += group[i]->weight;
+		for (int j = 0; j < 3; j++)
+		{
+			position[j] += group[i]->weight * group[i]->position[j];
+			oldPosition[j] += group[i]->weight * group[i]->oldPosition[j];
+		}
+	}
+	for (int j = 0; j < 3; j++)
+	{
+		position[j] /= totalWeight;
+		oldPosition[j] /= totalWeight;
+	}
+
+	Particle first = *group[0], second = *group[0];
+	first.weight = 0.5 * totalWeight;
+	second.weight = 0.5 * totalWeight;
+	first.position = position;
+	second.position = position;
+	first.oldPosition = oldPosition;
+	second.oldPosition = oldPosition;
+
+	for (std::vector<double> Particle::*velocity : { &Particle::velocity, &Particle::oldVelocity })
+	{
+		std::vector<double> mean(3, 0.0);
+		for (unsigned int i = 0; i < group.size(); i++)
+		{
+			for (int j = 0; j < 3; j++)
+			{
+				mean[j] += group[i]->weight * (group[i]->*velocity)[j] / totalWeight;
+			}
+		}
+
+		double variance = 0.0, largestDeviation = 0.0;
+		std::vector<double> direction(3, 0.0);
+		for (unsigned int i = 0; i < group.size(); i++)
+		{
+			double deviation = 0.0;
+			for (int j = 0; j < 3; j++)
+			{
+				deviation += pow((group[i]->*velocity)[j] - mean[j], 2);
+			}
+			variance += group[i]->weight * deviation / totalWeight;
+			if (deviation > largestDeviation)
+			{
+				largestDeviation = deviation;
+				for (int j = 0; j < 3; j++)
+				{
+					direction[j] = ((group[i]->*velocity)[j] - mean[j]) / sqrt(deviation);
+				}
+			}
+		}
+
+		for (int j = 0; j < 3; j++)
+		{
+			(first.*velocity)[j] = mean[j] + sqrt(variance) * direction[j];
+			(second.*velocity)[j] = mean[j] - sqrt(variance) * direction[j];
+		}
+	}
+
+	added.push_back(first);
+	added.push_back(second);
+}
+
+
+// Split a particle into two of half its weight and the same velocity, moved
+// apart symmetrically within its cell, which keeps charge, its centre,
+// momentum and kinetic energy
+static void splitParticle(Particle &particle, Particle &other, const Mesh *mesh, std::mt19937 &rng)
+{
+	const CellGeometry &cell = mesh->cell(particle.cellID - 1);
+	double distance = std::min(std::min(particle.position[0] - cell.left, cell.right - particle.position[0]),
+		std::min(particle.position[1] - cell.bottom, cell.top - particle.position[1]));
+	double angle = std::uniform_real_distribution<double>(0.0, 2.0 * PI)(rng);
+	double offset[2] = { 0.5 * distance * cos(angle), 0.5 * distance * sin(angle) };
+
+	particle.weight *= 0.5;
+	other = particle;
+	for (int j = 0; j < 2; j++)
+	{
+		particle.position[j] += offset[j];
+		particle.oldPosition[j] += offset[j];
+		other.position[j] -= offset[j];
+		other.oldPosition[j] -= offset[j];
+	}
+}
+
+
+// Constructor
+Resampler::Resampler(Parameters *parametersList, Mesh *mesh, VectorParticle *particlesVector)
+{
+	int target = parametersList->targetParticlesPerCell;
+
+	// Initialise random number generator
+	std::mt19937 rng;
+	rng.seed(parametersList->generateSeed());
+
+	// Particles of each species in each cell
+	std::map<std::pair<int, int>, std::vector<int>> groups;
+	for (int i = 0; i < particlesVector->numParticles; i++)
+	{
+		const Particle &particle = particlesVector->particleVector[i];
+		groups[{ particle.cellID, particle.basic.type }].push_back(i);
+	}
+
+	std::vector<bool> removed(particlesVector->numParticles, false);
+	std::vector<Particle> added;
+
+	for (auto &group : groups)
+	{
+		std::vector<int> &members = group.second;
+		int numMembers = members.size();
+
+		if (numMembers > target)
+		{
+			// Each merge of a group of three or more particles leaves two, so
+			// the lightest particles are merged in as many groups as needed to
+			// reach the target, with neighbouring speeds grouped together
+			int excess = numMembers - target;
+			int numGroups = std::min(excess, target / 2);
+			int numMerging = excess + 2 * numGroups;
+
+			std::sort(members.begin(), members.end(), [&](int a, int b)
+			{
+				return particlesVector->particleVector[a].weight < particlesVector->particleVector[b].weight;
+			});
+			std::vector<std::pair<double, int>> speeds;
+			for (int i = 0; i < numMerging; i++)
+			{
+				const std::vector<double> &velocity = particlesVector->particleVector[members[i]].velocity;
+				speeds.push_back({ velocity[0] * velocity[0] + velocity[1] * velocity[1] +
+					velocity[2] * velocity[2], members[i] });
+			}
+			std::sort(speeds.begin(), speeds.end());
+
+			int first = 0;
+			for (int k = 0; k < numGroups; k++)
+			{
+				int size = numMerging / numGroups + (k < numMerging % numGroups ? 1 : 0);
+				std::vector<const Particle*> mergeList;
+				for (int i = first; i < first + size; i++)
+				{
+					mergeList.push_back(&particlesVector->particleVector[speeds[i].second]);
+					removed[speeds[i].second] = true;
+				}
+				mergeGroup(mergeList, added);
+				first += size;
+			}
+			numMerged += excess;
+		}
+		else if (numMembers < target)
+		{
+			// The heaviest particle is split until the target is reached
+			std::vector<Particle> pieces;
+			for (int i = 0; i < numMembers; i++)
+			{
+				pieces.push_back(particlesVector->particleVector[members[i]]);
+			}
+			std::vector<bool> changed(numMembers, false);
+
+			for (int k = 0; k < target - numMembers; k++)
+			{
+				int heaviest = 0;
+				for (unsigned int i = 1; i < pieces.size(); i++)
+				{
+					if (pieces[i].weight > pieces[heaviest].weight)
+					{
+						heaviest = i;
+					}
+				}
+				Particle other;
+				splitParticle(pieces[heaviest], other, mesh, rng);
+				pieces.push_back(other);
+				changed[heaviest] = true;
+				changed.push_back(true);
+			}
+
+			for (int i = 0; i < static_cast<int>(pieces.size()); i++)
+			{
+				if (changed[i])
+				{
+					if (i < numMembers)
+					{
+						removed[members[i]] = true;
+					}
+					added.push_back(pieces[i]);
+				}
+			}
+			numSplit += target - numMembers;
+		}
+	}
+
+	particlesVector->replaceParticles(mesh, removed, added);
+
+	parametersList->logMessages("Resampled particles, " + std::to_string(numMerged) + " merged and " +
+		std::to_string(numSplit) + " split", __FILENAME__, __LINE__, 1);
+	parametersList->logBrief("Resampler exited", 1);
+}
+
+
+// Destructor
+Resampler::~Resampler()
+{
+}
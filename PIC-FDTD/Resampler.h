@@ -0,0 +1,29 @@
+//! \file
+//! \brief Definition of Resampler class
+//! \author Rahul Kalampattel
+//! \date Last updated June 2018
+
+#pragma once
+
+#include "Mesh.h"
+#include "Parameters.h"
+#include "VectorParticle.h"
+
+//! \class Resampler
+//! \brief Merges and splits weighted particles so that each species keeps a
+//! target number of particles per cell, conserving charge, momentum and
+//! kinetic energy
+class Resampler
+{
+public:
+	// Data members
+	int numMerged = 0;						//!< Particles removed by merging
+	int numSplit = 0;						//!< Particles added by splitting
+
+
+	// Constructor/destructor
+	Resampler();							//!< Default constructor
+	Resampler(Parameters *parametersList, Mesh *mesh,
+		VectorParticle *particlesVector);	//!< Constructor
+	~Resampler();							//!< Destructor
+};
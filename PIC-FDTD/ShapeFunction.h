@@ -0,0 +1,216 @@
+//! \file
+//! \brief Definition of B-spline particle shape functions and their stencils
+//! \author Rahul Kalampattel
+//! \date Last updated June 2018
+
+#pragma once
+
+#include <cmath>
+
+#include "Mesh.h"
+#include "Parameters.h"
+
+//! \struct ShapeFunction
+//! \brief One dimensional B-spline weights of a given order. The position u is
+//! measured in units of grid spacing from the first node, weights are returned
+//! for nodes first, first + 1, ..., first + Order.
+template <int Order>
+struct ShapeFunction;
+
+template <>
+struct ShapeFunction<shapeNGP>
+{
+	static const int support = 1;
+	static void weights(double u, int &first, double *w)
+	{
+		first = static_cast<int>(std::floor(u + 0.5));
+		w[0] = 1.0;
+	}
+};
+
+template <>
+struct ShapeFunction<shapeCIC>
+{
+	static const int support = 2;
+	static void weights(double u, int &first, double *w)
+	{
+		first = static_cast<int>(std::floor(u));
+		double d = u - first;
+		w[0] = 1.0 - d;
+		w[1] = d;
+	}
+};
+
+template <>
+struct ShapeFunction<shapeTSC>
+{
+	static const int support = 3;
+	static void weights(double u, int &first, double *w)
+	{
+		int nearest = static_cast<int>(std::floor(u + 0.5));
+		double d = u - nearest;
+		first = nearest - 1;
+		w[0] = 0.5 * (0.5 - d) * (0.5 - d);
+		w[1] = 0.75 - d * d;
+		w[2] = 0.5 * (0.5 + d) * (0.5 + d);
+	}
+};
+
+template <>
+struct ShapeFunction<shapeCubic>
+{
+	static const int support = 4;
+	static void weights(double u, int &first, double *w)
+	{
+		int lower = static_cast<int>(std::floor(u));
+		double d = u - lower;
+		double dSquared = d * d, dCubed = dSquared * d;
+		first = lower - 1;
+		w[0] = (1.0 - d) * (1.0 - d) * (1.0 - d) / 6.0;
+		w[1] = (4.0 - 6.0 * dSquared + 3.0 * dCubed) / 6.0;
+		w[2] = (1.0 + 3.0 * d + 3.0 * dSquared - 3.0 * dCubed) / 6.0;
+		w[3] = dCubed / 6.0;
+	}
+};
+
+
+// Map a node index which lies outside the domain back onto the mesh, either
+// by wrapping around for periodic boundaries, or by folding the weight onto
+// the boundary node otherwise (so that total charge is conserved)
+inline int stencilIndex(int index, int numIntervals, bool periodic)
+{
+	if (index < 0)
+	{
+		return periodic ? index + numIntervals : 0;
+	}
+	else if (index > numIntervals)
+	{
+		return periodic ? index - numIntervals : numIntervals;
+	}
+	return index;
+}
+
+
+//! \brief Apply a visitor to every node in the stencil of a particle on a
+//! structured mesh, as visit(nodeIndex, weight). Deposition and gather are
+//! both built on this, so that they always use the same shape.
+template <int Order, typename Visitor>
+void applyStencil(const Mesh *mesh, double x1, double x2, bool periodicX1,
+	bool periodicX2, Visitor visit)
+{
+	const int support = ShapeFunction<Order>::support;
+
+	// Columns are numbered from the left and rows from the top of the domain
+	double u = (x1 - mesh->node(0).geometry.X(0)) / mesh->h;
+	double v = (mesh->node(0).geometry.X(1) - x2) / mesh->h;
+
+	// A position which is no longer finite, e.g. after an unstable solve, has
+	// no stencil on the mesh
+	if (!std::isfinite(u) || !std::isfinite(v))
+	{
+		return;
+	}
+
+	int firstColumn, firstRow;
+	double wColumn[support], wRow[support];
+	ShapeFunction<Order>::weights(u, firstColumn, wColumn);
+	ShapeFunction<Order>::weights(v, firstRow, wRow);
+
+	for (int a = 0; a < support; a++)
+	{
+		int column = stencilIndex(firstColumn + a, mesh->numColumns, periodicX1);
+		for (int b = 0; b < support; b++)
+		{
+			int row = stencilIndex(firstRow + b, mesh->numRows, periodicX2);
+			visit(mesh->nodeIndex(column, row), wColumn[a] * wRow[b]);
+		}
+	}
+}
+
+
+//! \brief Apply a visitor to every node in the stencil of a particle within a
+//! tile, as visit(localIndex, weight). Wrapping and folding at the domain
+//! boundaries are already part of the tile's node map.
+template <int Order, typename Visitor>
+void applyTileStencil(const Mesh *mesh, const Tiles &tile, double x1, double x2,
+	Visitor visit)
+{
+	const int support = ShapeFunction<Order>::support;
+
+	double u = (x1 - mesh->node(0).geometry.X(0)) / mesh->h;
+	double v = (mesh->node(0).geometry.X(1) - x2) / mesh->h;
+
+	int firstColumn, firstRow;
+	double wColumn[support], wRow[support];
+	ShapeFunction<Order>::weights(u, firstColumn, wColumn);
+	ShapeFunction<Order>::weights(v, firstRow, wRow);
+
+	for (int a = 0; a < support; a++)
+	{
+		for (int b = 0; b < support; b++)
+		{
+			visit(tile.localIndex(firstColumn + a, firstRow + b), wColumn[a] * wRow[b]);
+		}
+	}
+}
+
+//! \struct ParticleStencil
+//! \brief Apply a visitor to the nodes which share a particle's weight. On
+//! meshes read from file, CIC weights are taken from the particle's cell, so
+//! work on any quadrilateral mesh. Other orders, and CIC on structured
+//! meshes, use the column and row stencil of a structured mesh.
+template <int Order>
+struct ParticleStencil
+{
+	template <typename Visitor>
+	static void apply(const Mesh *mesh, int cellID, double x1, double x2,
+		bool periodicX1, bool periodicX2, Visitor visit)
+	{
+		applyStencil<Order>(mesh, x1, x2, periodicX1, periodicX2, visit);
+	}
+};
+
+template <>
+struct ParticleStencil<shapeCIC>
+{
+	template <typename Visitor>
+	static void apply(const Mesh *mesh, int cellID, double x1, double x2,
+		bool periodicX1, bool periodicX2, Visitor visit)
+	{
+		if (mesh->structured)
+		{
+			applyStencil<shapeCIC>(mesh, x1, x2, periodicX1, periodicX2, visit);
+			return;
+		}
+
+		const CellGeometry &cell = mesh->cell(cellID - 1);
+		double hSquared = mesh->h * mesh->h;
+
+		// Corner weights, in the order TL, BL, BR, TR in which cell nodes are
+		// numbered (starting from firstNodePosition)
+		double corner[4] = {
+			(cell.right - x1) * (x2 - cell.bottom) / hSquared,
+			(cell.right - x1) * (cell.top - x2) / hSquared,
+			(x1 - cell.left) * (cell.top - x2) / hSquared,
+			(x1 - cell.left) * (x2 - cell.bottom) / hSquared };
+
+		int first = 0;
+		if (cell.firstNodePosition == boundaryBL)
+		{
+			first = 1;
+		}
+		else if (cell.firstNodePosition == boundaryBR)
+		{
+			first = 2;
+		}
+		else if (cell.firstNodePosition == boundaryTR)
+		{
+			first = 3;
+		}
+
+		for (int j = 0; j < 4; j++)
+		{
+			visit(cell.connectivity.nodeIDs[j] - 1, corner[(first + j) % 4]);
+		}
+	}
+};
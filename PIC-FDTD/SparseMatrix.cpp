@@ -0,0 +1,164 @@
+//! \file
+//! \brief Implementation of SparseMatrix class
+//! \author Rahul Kalampattel
+//! \date Last updated June 2018
+
+#include <algorithm>
+#include <cmath>
+
+#include "SparseMatrix.h"
+
+// Default constructor
+SparseMatrix::SparseMatrix()
+{
+}
+
+
+// Destructor
+SparseMatrix::~SparseMatrix()
+{
+}
+
+
+// Compress rows of column/value pairs, which every row must include its
+// diagonal in
+void SparseMatrix::assemble(const std::vector<std::map<int, double>> &rows)
+{
+	numRows = rows.size();
+	rowStart.assign(1, 0);
+	columns.clear();
+	values.clear();
+	diagonalEntry.assign(numRows, -1);
+	factors.clear();
+
+	for (int i = 0; i < numRows; i++)
+	{
+		for (const auto &entry : rows[i])
+		{
+			if (entry.first == i)
+			{
+				diagonalEntry[i] = columns.size();
+			}
+			columns.push_back(entry.first);
+			values.push_back(entry.second);
+		}
+		rowStart.push_back(columns.size());
+	}
+}
+
+
+// Matrix-vector product y = Ax
+void SparseMatrix::multiply(const std::vector<double> &x, std::vector<double> &y,
+	int numThreads) const
+{
+	# pragma omp parallel for num_threads(numThreads)
+	for (int i = 0; i < numRows; i++)
+	{
+		double sum = 0.0;
+		for (int j = rowStart[i]; j < rowStart[i + 1]; j++)
+		{
+			sum += values[j] * x[columns[j]];
+		}
+		y[i] = sum;
+	}
+}
+
+
+// Check if matrix equals its transpose, to within a tolerance relative to the
+// largest entry
+bool SparseMatrix::isSymmetric(double tolerance) const
+{
+	double largest = 0.0;
+	for (unsigned int j = 0; j < values.size(); j++)
+	{
+		largest = std::max(largest, std::abs(values[j]));
+	}
+
+	for (int i = 0; i < numRows; i++)
+	{
+		for (int j = rowStart[i]; j < rowStart[i + 1]; j++)
+		{
+			// Find the transposed entry by bisection of the sorted row
+			int k = columns[j], first = rowStart[k], last = rowStart[k + 1];
+			while (first < last)
+			{
+				int middle = (first + last) / 2;
+				if (columns[middle] < i)
+				{
+					first = middle + 1;
+				}
+				else
+				{
+					last = middle;
+				}
+			}
+			double transpose = (first < rowStart[k + 1] && columns[first] == i) ? values[first] : 0.0;
+			if (std::abs(values[j] - transpose) > tolerance * largest)
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+
+// Incomplete LU factorisation with no fill-in, ILU(0). The unit lower factor L
+// and upper factor U are stored together on the pattern of the matrix.
+void SparseMatrix::factoriseILU()
+{
+	factors = values;
+	std::vector<int> position(numRows, -1);
+
+	for (int i = 0; i < numRows; i++)
+	{
+		for (int j = rowStart[i]; j < rowStart[i + 1]; j++)
+		{
+			position[columns[j]] = j;
+		}
+
+		for (int j = rowStart[i]; j < rowStart[i + 1] && columns[j] < i; j++)
+		{
+			int k = columns[j];
+			factors[j] /= factors[diagonalEntry[k]];
+			for (int l = diagonalEntry[k] + 1; l < rowStart[k + 1]; l++)
+			{
+				if (position[columns[l]] >= 0)
+				{
+					factors[position[columns[l]]] -= factors[j] * factors[l];
+				}
+			}
+		}
+
+		for (int j = rowStart[i]; j < rowStart[i + 1]; j++)
+		{
+			position[columns[j]] = -1;
+		}
+	}
+}
+
+
+// Solve LUz = r with the incomplete factors, by forward then backward
+// substitution
+void SparseMatrix::solveILU(const std::vector<double> &r, std::vector<double> &z) const
+{
+	for (int i = 0; i < numRows; i++)
+	{
+		double sum = r[i];
+		for (int j = rowStart[i]; j < diagonalEntry[i]; j++)
+		{
+			sum -= factors[j] * z[columns[j]];
+		}
+		z[i] = sum;
+	}
+
+	for (int i = numRows - 1; i >= 0; i--)
+	{
+		double sum = z[i];
+		for (int j = diagonalEntry[i] + 1; j < rowStart[i + 1]; j++)
+		{
+			sum -= factors[j] * z[columns[j]];
+		}
+		z[i] = sum / factors[diagonalEntry[i]];
+	}
+}
@@ -0,0 +1,39 @@
+//! \file
+//! \brief Definition of SparseMatrix class
+//! \author Rahul Kalampattel
+//! \date Last updated June 2018
+
+#pragma once
+
+#include <map>
+#include <vector>
+
+//! \class SparseMatrix
+//! \brief Square matrix in compressed sparse row (CSR) format, with columns
+//! sorted within each row
+class SparseMatrix
+{
+public:
+	// Data members
+	int numRows = 0;						//!< Number of rows (and columns)
+	std::vector<int> rowStart;				//!< Index of first entry of each row, and end
+	std::vector<int> columns;				//!< Column of each entry
+	std::vector<double> values;				//!< Value of each entry
+	std::vector<int> diagonalEntry;			//!< Index of diagonal entry of each row
+	std::vector<double> factors;			//!< Incomplete LU factors, on the same pattern (empty until factorised)
+
+
+	// Constructor/destructor
+	SparseMatrix();							//!< Default constructor
+	~SparseMatrix();						//!< Destructor
+
+
+	// Methods
+	void assemble(const std::vector<std::map<int, double>> &rows);	//!< Compress rows of column/value pairs
+	void multiply(const std::vector<double> &x, std::vector<double> &y,
+		int numThreads) const;				//!< Matrix-vector product y = Ax
+	bool isSymmetric(double tolerance) const;	//!< Check if matrix equals its transpose
+	void factoriseILU();					//!< Incomplete LU factorisation with no fill-in, ILU(0)
+	void solveILU(const std::vector<double> &r,
+		std::vector<double> &z) const;		//!< Solve LUz = r with the incomplete factors
+};
@@ -0,0 +1,106 @@
+//! \file
+//! \brief Implementation of TaskGraph class 
+//! \author Rahul Kalampattel
+//! \date Last updated June 2018
+
+#include "TaskGraph.h"
+
+// Default constructor
+TaskGraph::TaskGraph()
+{
+}
+
+
+// Destructor
+TaskGraph::~TaskGraph()
+{
+}
+
+
+// Add a task, returning its ID. Dependencies must already be in the graph,
+// which keeps it acyclic.
+int TaskGraph::addTask(std::function<void()> task, const std::vector<int> &dependencies)
+{
+	int taskID = static_cast<int>(tasks.size());
+	tasks.push_back(task);
+	successors.push_back(std::vector<int>());
+	numDependencies.push_back(static_cast<int>(dependencies.size()));
+
+	for (unsigned int i = 0; i < dependencies.size(); i++)
+	{
+		successors[dependencies[i]].push_back(taskID);
+	}
+	return taskID;
+}
+
+
+// Number of tasks in graph
+int TaskGraph::numTasks() const
+{
+	return static_cast<int>(tasks.size());
+}
+
+
+// Execute all tasks, respecting dependencies. If called from within a parallel
+// region (e.g. from a task of another graph), tasks are added to the existing
+// team rather than starting a nested one, so that graphs compose.
+void TaskGraph::run(int numThreads)
+{
+	remaining = numDependencies;
+
+	if (omp_in_parallel())
+	{
+		# pragma omp taskgroup
+		{
+			for (unsigned int i = 0; i < tasks.size(); i++)
+			{
+				if (numDependencies[i] == 0)
+				{
+					launch(i);
+				}
+			}
+		}
+	}
+	else
+	{
+		# pragma omp parallel num_threads(numThreads)
+		{
+			# pragma omp single
+			{
+				# pragma omp taskgroup
+				{
+					for (unsigned int i = 0; i < tasks.size(); i++)
+					{
+						if (numDependencies[i] == 0)
+						{
+							launch(i);
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+
+// Start a task, then any successors for which it was the last dependency
+void TaskGraph::launch(int taskID)
+{
+	# pragma omp task firstprivate(taskID)
+	{
+		tasks[taskID]();
+
+		for (unsigned int i = 0; i < successors[taskID].size(); i++)
+		{
+			int successorID = successors[taskID][i];
+			int left;
+			# pragma omp atomic capture
+			left = --remaining[successorID];
+
+			if (left == 0)
+			{
+				launch(successorID);
+			}
+		}
+	}
+}
@@ -0,0 +1,41 @@
+//! \file
+//! \brief Definition of TaskGraph class 
+//! \author Rahul Kalampattel
+//! \date Last updated June 2018
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "omp.h"
+
+//! \class TaskGraph
+//! \brief Directed acyclic graph of tasks, each of which is started as an 
+//! OpenMP task as soon as all of the tasks it depends on have completed. Idle
+//! threads take up waiting tasks, so uneven tasks are balanced at run time.
+class TaskGraph
+{
+private:
+	// Data members
+	std::vector<std::function<void()>> tasks;		//!< Work done by each task
+	std::vector<std::vector<int>> successors;		//!< Tasks which depend on each task
+	std::vector<int> numDependencies;				//!< Number of tasks each task depends on
+	std::vector<int> remaining;						//!< Dependencies yet to complete during run
+
+
+	// Methods
+	void launch(int taskID);						//!< Start a task, then any successors it releases
+
+public:
+	// Constructor/destructor
+	TaskGraph();									//!< Default constructor
+	~TaskGraph();									//!< Destructor
+
+
+	// Methods
+	int addTask(std::function<void()> task,
+		const std::vector<int> &dependencies = {});	//!< Add a task, returning its ID
+	int numTasks() const;							//!< Number of tasks in graph
+	void run(int numThreads);						//!< Execute all tasks, respecting dependencies
+};
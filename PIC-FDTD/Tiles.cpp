@@ -0,0 +1,52 @@
+//! \file
+//! \brief Implementation of Tiles class 
+//! \author Rahul Kalampattel
+//! \date Last updated June 2018
+
+#include <algorithm>
+
+#include "Tiles.h"
+
+// Default constructor
+Tiles::Tiles()
+{
+}
+
+
+// Destructor
+Tiles::~Tiles()
+{
+}
+
+
+// Copy node fields into local cache
+void Tiles::loadFields(const VectorNode &nodesVector)
+{
+	const std::vector<int> &localNodeIDs = *nodeIDs;
+	for (unsigned int i = 0; i < localNodeIDs.size(); i++)
+	{
+		for (int j = 0; j < 6; j++)
+		{
+			EMfield[6 * i + j] = nodesVector.nodes[localNodeIDs[i]].EMfield[j];
+		}
+	}
+}
+
+
+// Set local charge to 0
+void Tiles::clearCharge()
+{
+	std::fill(charge.begin(), charge.end(), 0.0);
+}
+
+
+// Add local charge to nodes, halo nodes are shared with neighbouring tiles
+// so this must not run concurrently for adjacent tiles
+void Tiles::mergeCharge(VectorNode &nodesVector) const
+{
+	const std::vector<int> &localNodeIDs = *nodeIDs;
+	for (unsigned int i = 0; i < localNodeIDs.size(); i++)
+	{
+		nodesVector.nodes[localNodeIDs[i]].charge += charge[i];
+	}
+}
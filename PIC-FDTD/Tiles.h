@@ -0,0 +1,49 @@
+//! \file
+//! \brief Definition of Tiles class 
+//! \author Rahul Kalampattel
+//! \date Last updated June 2018
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "VectorNode.h"
+
+//! \class Tiles
+//! \brief Square block of cells on a structured mesh, with the particles binned
+//! in it and local copies of the surrounding nodes for gather and deposition
+class Tiles
+{
+public:
+	// Data members
+	int firstColumn = 0;				//!< First cell column in tile
+	int firstRow = 0;					//!< First cell row in tile
+	int numColumns = 0;					//!< Number of cell columns in tile
+	int numRows = 0;					//!< Number of cell rows in tile
+	int firstNodeColumn = 0;			//!< First local node column, including halo (may be outside mesh)
+	int firstNodeRow = 0;				//!< First local node row, including halo (may be outside mesh)
+	int numNodeColumns = 0;				//!< Number of local node columns, including halo
+	int numNodeRows = 0;				//!< Number of local node rows, including halo
+	std::shared_ptr<const std::vector<int>>
+		nodeIDs;						//!< Mesh node index of each local node, wrapped or folded, shared by copies of the tile
+	std::vector<int> listOfParticles;	//!< Indices in particleVector of particles in the tile
+	std::vector<double> EMfield;		//!< Local copy of node fields, six per local node
+	std::vector<double> charge;			//!< Local charge accumulator
+	double workTime = 0.0;				//!< Time spent on tile since last balance
+	double workParticles = 0.0;			//!< Particles processed by tile since last balance
+	int workCalls = 0;					//!< Number of times tile was processed since last balance
+
+
+	// Constructor/destructor
+	Tiles();							//!< Default constructor
+	~Tiles();							//!< Destructor
+
+
+	// Methods
+	int localIndex(int column, int row) const
+	{ return (column - firstNodeColumn) * numNodeRows + row - firstNodeRow; }	//!< Index of local node from mesh column and row
+	void loadFields(const VectorNode &nodesVector);		//!< Copy node fields into local cache
+	void clearCharge();									//!< Set local charge to 0
+	void mergeCharge(VectorNode &nodesVector) const;	//!< Add local charge to nodes
+};
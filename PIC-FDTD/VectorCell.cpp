@@ -17,12 +17,9 @@ VectorCell::~VectorCell()
 }
 
 
-// Allocate CellBase elements to cells data member
-void VectorCell::allocate(std::vector<CellBase> cells)
+// Allocate particle properties of each cell, with geometry held separately by
+// the mesh
+void VectorCell::allocate(int numCells)
 {
-	for (int i = 0; i < cells.size(); i++)
-	{
-		Cells tempCell(cells[i]);
-		this->cells.push_back(tempCell);
-	}
+	cells.assign(numCells, Cells());
 }
\ No newline at end of file
@@ -22,5 +22,5 @@ public:
 
 
 	// Methods
-	void allocate(std::vector<CellBase> cells);	//!< Allocate CellBase elements to cells data member
+	void allocate(int numCells);				//!< Allocate particle properties of each cell
 };
\ No newline at end of file
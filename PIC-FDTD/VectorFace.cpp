@@ -20,7 +20,7 @@ VectorFace::~VectorFace()
 // Allocate FaceBase elements to faces data member
 void VectorFace::allocate(std::vector<FaceBase> faces)
 {
-	for (int i = 0; i < faces.size(); i++)
+	for (unsigned int i = 0; i < faces.size(); i++)
 	{
 		Faces tempFace(faces[i]);
 		this->faces.push_back(tempFace);
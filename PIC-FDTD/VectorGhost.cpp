@@ -20,7 +20,7 @@ VectorGhost::~VectorGhost()
 // Allocate CellBase elements to ghosts data member
 void VectorGhost::allocate(std::vector<CellBase> cells)
 {
-	for (int i = 0; i < cells.size(); i++)
+	for (unsigned int i = 0; i < cells.size(); i++)
 	{
 		Ghost tempGhost(cells[i]);
 		this->ghosts.push_back(tempGhost);
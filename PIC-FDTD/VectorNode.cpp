@@ -17,21 +17,18 @@ VectorNode::~VectorNode()
 }
 
 
-// Allocate NodeBase elements to nodes data member
-void VectorNode::allocate(std::vector<NodeBase> nodes)
+// Allocate field and particle properties of each node, with geometry held
+// separately by the mesh
+void VectorNode::allocate(int numNodes)
 {
-	for (int i = 0; i < nodes.size(); i++)
-	{
-		Nodes tempNode(nodes[i]);
-		this->nodes.push_back(tempNode);
-	}
+	nodes.assign(numNodes, Nodes());
 }
 
 
 // Set charge to 0 for all elements
 void VectorNode::clearChargeAndCurrent()
 {
-	for (int i = 0; i < nodes.size(); i++)
+	for (unsigned int i = 0; i < nodes.size(); i++)
 	{
 		nodes[i].charge = 0;
 		nodes[i].current = { 0.0,0.0 };
@@ -39,20 +36,62 @@ void VectorNode::clearChargeAndCurrent()
 }
 
 
+// Set charge to 0 for all elements, keeping current
+void VectorNode::clearCharge()
+{
+	for (unsigned int i = 0; i < nodes.size(); i++)
+	{
+		nodes[i].charge = 0;
+	}
+}
+
+
+// Set current to 0 for all elements, keeping charge
+void VectorNode::clearCurrent()
+{
+	for (unsigned int i = 0; i < nodes.size(); i++)
+	{
+		nodes[i].current = { 0.0,0.0 };
+	}
+}
+
+
 // Set phi to 0 for all elements
 void VectorNode::clearPhi()
 {
-	for (int i = 0; i < nodes.size(); i++)
+	for (unsigned int i = 0; i < nodes.size(); i++)
 	{
 		nodes[i].phi = 0;
 	}
 }
 
 
+// Set the initial guess for phi to the last solution, or extrapolate linearly
+// from the last two solutions, keeping the last solution in oldPhi. Before the
+// first solve, phi is set to 0.
+void VectorNode::predictPhi(bool extrapolate)
+{
+	for (unsigned int i = 0; i < nodes.size(); i++)
+	{
+		double lastPhi = (numPhiGuesses > 0) ? nodes[i].phi : 0.0;
+		if (extrapolate && numPhiGuesses > 1)
+		{
+			nodes[i].phi = 2.0 * lastPhi - nodes[i].oldPhi;
+		}
+		else
+		{
+			nodes[i].phi = lastPhi;
+		}
+		nodes[i].oldPhi = lastPhi;
+	}
+	numPhiGuesses++;
+}
+
+
 // Clear fields members of nodes
 void VectorNode::clearFields()
 {
-	for (int i = 0; i < nodes.size(); i++)
+	for (unsigned int i = 0; i < nodes.size(); i++)
 	{
 		nodes[i].EMfield = { 0.0,0.0,0.0,0.0,0.0,0.0 };
 	}
@@ -63,7 +102,7 @@ void VectorNode::clearFields()
 double VectorNode::calculateEP()
 {
 	double EP = 0.0;
-	for (int i = 0; i < nodes.size(); i++)
+	for (unsigned int i = 0; i < nodes.size(); i++)
 	{
 		// TODO: Should this use charge or rho? Does it need an 'abs'?
 		EP += 0.5 * nodes[i].charge * nodes[i].phi;
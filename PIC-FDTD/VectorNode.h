@@ -14,6 +14,7 @@ class VectorNode
 public:
 	// Data members
 	std::vector<Nodes> nodes;					//!< Vector of Nodes objects
+	int numPhiGuesses = 0;						//!< Number of initial guesses for phi made from previous solutions
 
 
 	// Constructor/destructor
@@ -22,9 +23,12 @@ public:
 
 
 	// Methods
-	void allocate(std::vector<NodeBase> nodes);	//!< Allocate NodeBase elements to nodes data member
+	void allocate(int numNodes);				//!< Allocate field and particle properties of each node
 	void clearChargeAndCurrent();				//!< Set charge to 0 for all elements
+	void clearCharge();							//!< Set charge to 0 for all elements, keeping current
+	void clearCurrent();						//!< Set current to 0 for all elements, keeping charge
 	void clearPhi();							//!< Set phi to 0 for all elements
+	void predictPhi(bool extrapolate);			//!< Set initial guess for phi from previous solutions
 	void clearFields();							//!< Clear fields members of nodes
 	double calculateEP();						//!< Calculate potential energy
 };
\ No newline at end of file
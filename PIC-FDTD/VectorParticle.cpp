@@ -3,6 +3,8 @@
 //! \author Rahul Kalampattel
 //! \date Last updated April 2018
 
+#include <utility>
+
 #include "VectorParticle.h"
 
 // Default constructor
@@ -84,7 +86,7 @@ void VectorParticle::updatePlotVector(Particle *particle)
 	// TODO: Resizing vectors is not a particularly efficient operation, consider 
 	// some other means of storing data for plotting in future
 
-	for (int i = 0; i < plotVector.size(); i++)
+	for (unsigned int i = 0; i < plotVector.size(); i++)
 	{
 		if (plotVector[i][5] == static_cast<double>(particle->particleID))
 		{
@@ -104,7 +106,7 @@ void VectorParticle::updatePlotVector(Particle *particle)
 // Remove particle from plotVector
 void VectorParticle::removeFromPlotVector(int particleID)
 {
-	for (int i = 0; i < plotVector.size(); i++)
+	for (unsigned int i = 0; i < plotVector.size(); i++)
 	{
 		if (plotVector[i][5] == static_cast<double>(particleID))
 		{
@@ -139,6 +141,25 @@ void VectorParticle::addParticleToSim(Parameters *parametersList, Mesh *mesh, in
 }
 
 
+
+// Add a batch of particles to simulation, which are given new IDs. Storage
+// for the whole batch is reserved up front.
+void VectorParticle::addParticlesToSim(Mesh *mesh, std::vector<Particle> &added)
+{
+	particleVector.reserve(particleVector.size() + added.size());
+	plotVector.reserve(plotVector.size() + added.size());
+	for (unsigned int i = 0; i < added.size(); i++)
+	{
+		maxParticleID++;
+		added[i].particleID = maxParticleID;
+		particleVector.push_back(std::move(added[i]));
+		addToPlotVector(&particleVector.back());
+		mesh->addParticlesToCell(particleVector.back().cellID, particleVector.back().particleID);
+	}
+	numParticles = particleVector.size();
+}
+
+
 // Remove particle from simulation
 void VectorParticle::removeParticleFromSim(int particleID)
 {
@@ -155,6 +176,47 @@ void VectorParticle::removeParticleFromSim(int particleID)
 }
 
 
+// Remove flagged particles and add new ones, which are given new IDs, in a
+// single pass. Cell lists are updated, and plotVector is rebuilt in the
+// order of particleVector.
+void VectorParticle::replaceParticles(Mesh *mesh, const std::vector<bool> &removed,
+	std::vector<Particle> &added)
+{
+	int numKept = 0;
+	for (int i = 0; i < numParticles; i++)
+	{
+		if (removed[i])
+		{
+			mesh->removeParticlesFromCell(particleVector[i].cellID, particleVector[i].particleID);
+		}
+		else
+		{
+			if (numKept != i)
+			{
+				particleVector[numKept] = std::move(particleVector[i]);
+			}
+			numKept++;
+		}
+	}
+	particleVector.resize(numKept);
+
+	for (unsigned int i = 0; i < added.size(); i++)
+	{
+		maxParticleID++;
+		added[i].particleID = maxParticleID;
+		particleVector.push_back(added[i]);
+		mesh->addParticlesToCell(added[i].cellID, added[i].particleID);
+	}
+	numParticles = particleVector.size();
+
+	plotVector.clear();
+	for (int i = 0; i < numParticles; i++)
+	{
+		addToPlotVector(&particleVector[i]);
+	}
+}
+
+
 //!< Calculate kinetic energy
 double VectorParticle::calculateEK()
 {
@@ -165,9 +227,9 @@ double VectorParticle::calculateEK()
 		// and t-1.5*dt (velocity and oldVelocity), in order to get a result time 
 		// centred at t-1*dt (still behind). Need abs to remove noise.
 		// TODO: Does this need to include all three velocity components?
-		EK += 0.5 * particleVector[i].basic.m *	(abs(particleVector[i].velocity[0] *
-			particleVector[i].oldVelocity[0]) + abs(particleVector[i].velocity[1] *
-			particleVector[i].oldVelocity[1]) + abs(particleVector[i].velocity[2] *
+		EK += 0.5 * particleVector[i].basic.m * particleVector[i].weight * (std::abs(particleVector[i].velocity[0] *
+			particleVector[i].oldVelocity[0]) + std::abs(particleVector[i].velocity[1] *
+			particleVector[i].oldVelocity[1]) + std::abs(particleVector[i].velocity[2] *
 			particleVector[i].oldVelocity[2]));
 	}
 	return EK;
@@ -32,7 +32,11 @@ public:
 	VectorParticle();								//!< Default constructor
 	VectorParticle(Parameters *parametersList,
 		Mesh *mesh, int patchID);					//!< Constructor
+	VectorParticle(const VectorParticle &particlesVector) = default;	//!< Copy constructor
+	VectorParticle(VectorParticle &&particlesVector) = default;		//!< Move constructor
 	~VectorParticle();								//!< Destructor
+	VectorParticle &operator=(const VectorParticle &particlesVector) = default;	//!< Copy assignment
+	VectorParticle &operator=(VectorParticle &&particlesVector) = default;		//!< Move assignment
 
 
 	// Methods
@@ -41,5 +45,9 @@ public:
 	void addParticleToSim(Parameters * parametersList, 
 		Mesh * mesh, int cellID, std::string type); //!< Add particle to simulation
 	void removeParticleFromSim(int particleID);		//!< Remove particle from simulation
+	void replaceParticles(Mesh *mesh, const std::vector<bool> &removed,
+		std::vector<Particle> &added);				//!< Remove flagged particles and add new ones in a single pass
+	void addParticlesToSim(Mesh *mesh,
+		std::vector<Particle> &added);				//!< Add a batch of particles to simulation
 	double calculateEK();							//!< Calculate kinetic energy
 };
\ No newline at end of file
@@ -15,12 +15,20 @@ VectorPatch::VectorPatch()
 VectorPatch::VectorPatch(Parameters *parametersList)
 {
 	parametersList->logMessages("Creating patches vector", __FILENAME__, __LINE__, 1);
-	
-	for (int i = 0; i < parametersList->numberOfPatches; i++)
-	{
-		Patch patch(parametersList, i);
-		patchesVector.push_back(patch);
-	}
+
+	// The mesh is generated once, and each patch takes its own copy of the
+	// node and cell properties, sharing the geometry and field operators
+	Mesh baseMesh(parametersList, "PIC");
+	createPatches(parametersList, baseMesh);
+}
+
+
+// Constructor, using a mesh which has already been generated (e.g. shared by
+// the cases of an ensemble)
+VectorPatch::VectorPatch(Parameters *parametersList, const Mesh &baseMesh)
+{
+	parametersList->logMessages("Creating patches vector", __FILENAME__, __LINE__, 1);
+	createPatches(parametersList, baseMesh);
 }
 
 
@@ -30,12 +38,53 @@ VectorPatch::~VectorPatch()
 }
 
 
+// Construct patches from a copy of a mesh. Patches are constructed in place,
+// since they cannot be copied. Field operators depend on the boundary
+// conditions of this parameters list, which may differ between the cases
+// sharing a mesh, so are assembled here once for all patches.
+void VectorPatch::createPatches(Parameters *parametersList, const Mesh &baseMesh)
+{
+	Mesh mesh(baseMesh);
+	mesh.assembleOperators(parametersList);
+
+	numThreads = parametersList->numThreads;
+	patchesVector.reserve(parametersList->numberOfPatches);
+	for (int i = 0; i < parametersList->numberOfPatches; i++)
+	{
+		patchesVector.emplace_back(parametersList, mesh, i);
+	}
+}
+
+
 // Start the PIC loop within a VectorPatch object
 void VectorPatch::startPIC()
 {
+	// Patches are independent, so each one is a task. Tile tasks within a 
+	// patch join the same team, so threads freed by a lightly loaded patch
+	// help with the tiles of a heavily loaded one.
+	if (patchesVector.size() > 1)
+	{
+		TaskGraph graph;
+		for (unsigned int i = 0; i < patchesVector.size(); i++)
+		{
+			Patch *patch = &patchesVector[i];
+			graph.addTask([=]()
+			{
+				patch->startPIC();
+			});
+		}
+		graph.run(numThreads);
+	}
+	else
+	{
+		for (unsigned int i = 0; i < patchesVector.size(); i++)
+		{
+			patchesVector[i].startPIC();
+		}
+	}
+
 	for (unsigned int i = 0; i < patchesVector.size(); i++)
 	{
-		patchesVector[i].startPIC();
 		numErrors += patchesVector[i].numErrors;
 	}
 }
\ No newline at end of file
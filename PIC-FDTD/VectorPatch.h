@@ -6,20 +6,29 @@
 #pragma once
 
 #include "Patch.h"
+#include "TaskGraph.h"
 
 //! \class VectorPatch
 //! \brief Create and manage a vector of Patch objects
 class VectorPatch
 {
+private:
+	// Methods
+	void createPatches(Parameters *parametersList,
+		const Mesh &baseMesh);					//!< Construct patches from a copy of a mesh
+
 public:
 	// Data members
 	int numErrors = 0;							//!< Sum of errors in Patch objects
+	int numThreads = 1;							//!< Number of threads shared by all patches
 	std::vector<Patch> patchesVector;			//!< Vector of Patch objects
 
 
 	// Constructor/destructor
 	VectorPatch();								//!< Default constructor
 	VectorPatch(Parameters *parametersList);	//!< Constructor
+	VectorPatch(Parameters *parametersList,
+		const Mesh &baseMesh);					//!< Constructor, using an existing mesh
 	~VectorPatch();								//!< Destructor
 	
 
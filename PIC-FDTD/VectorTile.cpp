@@ -0,0 +1,297 @@
+//! \file
+//! \brief Implementation of VectorTile class 
+//! \author Rahul Kalampattel
+//! \date Last updated June 2018
+
+#include <algorithm>
+
+#include "Parameters.h"
+#include "ShapeFunction.h"
+#include "VectorParticle.h"
+#include "VectorTile.h"
+
+// Default constructor
+VectorTile::VectorTile()
+{
+}
+
+
+// Destructor
+VectorTile::~VectorTile()
+{
+}
+
+
+// Split mesh into tiles with local node maps. Each tile keeps a halo of nodes
+// wide enough for the cubic shape of a particle anywhere in its cells.
+void VectorTile::generateTiles(const Mesh *mesh, int tileSize, bool periodicX1, bool periodicX2)
+{
+	const int halo = 2;
+
+	this->tileSize = tileSize;
+	numTileColumns = (mesh->numColumns + tileSize - 1) / tileSize;
+	numTileRows = (mesh->numRows + tileSize - 1) / tileSize;
+	tiles.assign(numTileColumns * numTileRows, Tiles());
+	order.resize(tiles.size());
+	binsValid = false;
+
+	for (int tileColumn = 0; tileColumn < numTileColumns; tileColumn++)
+	{
+		for (int tileRow = 0; tileRow < numTileRows; tileRow++)
+		{
+			Tiles &tile = tiles[tileColumn * numTileRows + tileRow];
+			tile.firstColumn = tileColumn * tileSize;
+			tile.firstRow = tileRow * tileSize;
+			tile.numColumns = std::min(tileSize, mesh->numColumns - tile.firstColumn);
+			tile.numRows = std::min(tileSize, mesh->numRows - tile.firstRow);
+
+			tile.firstNodeColumn = tile.firstColumn - halo;
+			tile.firstNodeRow = tile.firstRow - halo;
+			tile.numNodeColumns = tile.numColumns + 1 + 2 * halo;
+			tile.numNodeRows = tile.numRows + 1 + 2 * halo;
+
+			std::vector<int> nodeIDs(tile.numNodeColumns * tile.numNodeRows);
+			for (int a = 0; a < tile.numNodeColumns; a++)
+			{
+				int column = stencilIndex(tile.firstNodeColumn + a, mesh->numColumns, periodicX1);
+				for (int b = 0; b < tile.numNodeRows; b++)
+				{
+					int row = stencilIndex(tile.firstNodeRow + b, mesh->numRows, periodicX2);
+					nodeIDs[a * tile.numNodeRows + b] = mesh->nodeIndex(column, row);
+				}
+			}
+			tile.EMfield.assign(6 * nodeIDs.size(), 0.0);
+			tile.charge.assign(nodeIDs.size(), 0.0);
+			tile.nodeIDs = std::make_shared<const std::vector<int>>(std::move(nodeIDs));
+		}
+	}
+
+	// Order tiles along a Hilbert curve, so that contiguous runs of tiles form
+	// compact regions of the mesh
+	int n = 1;
+	while (n < numTileColumns || n < numTileRows)
+	{
+		n *= 2;
+	}
+	std::vector<int> distance(tiles.size());
+	curveOrder.resize(tiles.size());
+	for (unsigned int i = 0; i < tiles.size(); i++)
+	{
+		distance[i] = hilbertIndex(n, i / numTileRows, i % numTileRows);
+		curveOrder[i] = i;
+	}
+	std::sort(curveOrder.begin(), curveOrder.end(), [&](int first, int second)
+	{
+		return distance[first] < distance[second];
+	});
+}
+
+
+// Sort particles into tiles by cell, and order tiles by decreasing number of
+// particles so that the largest are started first
+void VectorTile::binParticles(const Mesh *mesh, const VectorParticle *particlesVector)
+{
+	for (unsigned int i = 0; i < tiles.size(); i++)
+	{
+		tiles[i].listOfParticles.clear();
+		order[i] = i;
+	}
+
+	for (int i = 0; i < particlesVector->numParticles; i++)
+	{
+		int cellID = particlesVector->particleVector[i].cellID - 1;
+		int column = cellID / mesh->numRows;
+		int row = cellID % mesh->numRows;
+		tiles[(column / tileSize) * numTileRows + row / tileSize].listOfParticles.push_back(i);
+	}
+
+	std::stable_sort(order.begin(), order.end(), [&](int first, int second)
+	{
+		return tiles[first].listOfParticles.size() > tiles[second].listOfParticles.size();
+	});
+	binsValid = true;
+}
+
+
+// Sort particles into tiles only if any have been added, removed or moved to
+// another cell since they were last sorted, so that the bins are shared by
+// deposition and gather within a time step
+void VectorTile::updateBins(const Mesh *mesh, const VectorParticle *particlesVector)
+{
+	if (!binsValid)
+	{
+		binParticles(mesh, particlesVector);
+	}
+}
+
+
+// Add tasks applying work to every tile, returning task IDs. Once balanced,
+// there is one task per work group, which processes its run of tiles along
+// the Hilbert curve, otherwise there is one task per tile (largest first).
+// The time spent on each tile and group is recorded for the next balance.
+std::vector<int> VectorTile::addTasks(TaskGraph &graph, std::function<void(Tiles &tile)> work)
+{
+	std::vector<int> taskIDs;
+	auto timedWork = [work](Tiles &tile)
+	{
+		double start = omp_get_wtime();
+		work(tile);
+		tile.workTime += omp_get_wtime() - start;
+		tile.workParticles += tile.listOfParticles.size();
+		tile.workCalls++;
+	};
+
+	if (groupStart.size() > 1)
+	{
+		for (unsigned int group = 0; group < groupStart.size() - 1; group++)
+		{
+			taskIDs.push_back(graph.addTask([this, group, timedWork]()
+			{
+				double start = omp_get_wtime();
+				for (int k = groupStart[group]; k < groupStart[group + 1]; k++)
+				{
+					timedWork(tiles[curveOrder[k]]);
+				}
+				groupTime[group] += omp_get_wtime() - start;
+			}));
+		}
+	}
+	else
+	{
+		for (unsigned int k = 0; k < tiles.size(); k++)
+		{
+			Tiles *tile = &tiles[order[k]];
+			taskIDs.push_back(graph.addTask([tile, timedWork]()
+			{
+				timedWork(*tile);
+			}));
+		}
+	}
+	return taskIDs;
+}
+
+
+// Partition tiles along the Hilbert curve into groups of equal cost, and sort
+// particles into the same order so that each group works on a contiguous block
+// of memory. The cost of a tile is modelled as a * particles + b * cells, with
+// a and b fitted (least squares) to the time measured on each tile since the
+// last balance, or a = b = 1 before anything has been measured.
+void VectorTile::balance(Parameters *parametersList, const Mesh *mesh,
+	VectorParticle *particlesVector, int numGroups)
+{
+	// Report how evenly the previous partition was loaded
+	if (groupStart.size() > 1)
+	{
+		double maxTime = 0.0, sumTime = 0.0;
+		for (unsigned int group = 0; group < groupTime.size(); group++)
+		{
+			maxTime = std::max(maxTime, groupTime[group]);
+			sumTime += groupTime[group];
+		}
+		if (sumTime > 0.0)
+		{
+			parametersList->logBrief("Tile group load imbalance (max/mean - 1): " + 
+				std::to_string(100.0 * (maxTime * groupTime.size() / sumTime - 1.0)) + "%", 1);
+		}
+	}
+
+	// Fit cost per particle and per cell
+	double spp = 0.0, spc = 0.0, scc = 0.0, stp = 0.0, stc = 0.0;
+	for (unsigned int i = 0; i < tiles.size(); i++)
+	{
+		double particles = tiles[i].workParticles;
+		double cells = static_cast<double>(tiles[i].numColumns * tiles[i].numRows) * tiles[i].workCalls;
+		spp += particles * particles;
+		spc += particles * cells;
+		scc += cells * cells;
+		stp += tiles[i].workTime * particles;
+		stc += tiles[i].workTime * cells;
+	}
+	double determinant = spp * scc - spc * spc;
+	double particleCost = 1.0, cellCost = 1.0;
+	if (determinant > 0.0)
+	{
+		particleCost = std::max(0.0, (stp * scc - stc * spc) / determinant);
+		cellCost = std::max(0.0, (stc * spp - stp * spc) / determinant);
+		if (particleCost == 0.0 && cellCost == 0.0)
+		{
+			particleCost = cellCost = 1.0;
+		}
+	}
+
+	binParticles(mesh, particlesVector);
+	std::vector<double> cost(tiles.size());
+	double totalCost = 0.0;
+	for (unsigned int i = 0; i < tiles.size(); i++)
+	{
+		cost[i] = particleCost * tiles[i].listOfParticles.size() +
+			cellCost * tiles[i].numColumns * tiles[i].numRows;
+		totalCost += cost[i];
+
+		tiles[i].workTime = 0.0;
+		tiles[i].workParticles = 0.0;
+		tiles[i].workCalls = 0;
+	}
+
+	// Split the curve where the running cost passes each multiple of the
+	// mean group cost
+	numGroups = std::max(1, std::min(numGroups, static_cast<int>(tiles.size())));
+	groupStart.assign(1, 0);
+	double runningCost = 0.0;
+	for (unsigned int k = 0; k < curveOrder.size() && static_cast<int>(groupStart.size()) < numGroups; k++)
+	{
+		runningCost += cost[curveOrder[k]];
+		if (runningCost >= totalCost * groupStart.size() / numGroups)
+		{
+			groupStart.push_back(k + 1);
+		}
+	}
+	while (static_cast<int>(groupStart.size()) < numGroups + 1)
+	{
+		groupStart.push_back(static_cast<int>(curveOrder.size()));
+	}
+	groupTime.assign(numGroups, 0.0);
+
+	// Migrate particles so that each tile, and so each group, is contiguous
+	std::vector<int> rank(tiles.size());
+	for (unsigned int k = 0; k < curveOrder.size(); k++)
+	{
+		rank[curveOrder[k]] = k;
+	}
+	auto tileRank = [&](const Particle &particle)
+	{
+		int column = (particle.cellID - 1) / mesh->numRows;
+		int row = (particle.cellID - 1) % mesh->numRows;
+		return rank[(column / tileSize) * numTileRows + row / tileSize];
+	};
+	std::stable_sort(particlesVector->particleVector.begin(), particlesVector->particleVector.end(),
+		[&](const Particle &first, const Particle &second)
+	{
+		return tileRank(first) < tileRank(second);
+	});
+}
+
+
+// Distance along Hilbert curve of order n (a power of two) to point (x, y)
+int VectorTile::hilbertIndex(int n, int x, int y)
+{
+	int distance = 0;
+	for (int s = n / 2; s > 0; s /= 2)
+	{
+		int rx = (x & s) > 0;
+		int ry = (y & s) > 0;
+		distance += s * s * ((3 * rx) ^ ry);
+
+		// Rotate quadrant
+		if (ry == 0)
+		{
+			if (rx == 1)
+			{
+				x = n - 1 - x;
+				y = n - 1 - y;
+			}
+			std::swap(x, y);
+		}
+	}
+	return distance;
+}
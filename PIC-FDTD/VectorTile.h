@@ -0,0 +1,52 @@
+//! \file
+//! \brief Definition of VectorTile class 
+//! \author Rahul Kalampattel
+//! \date Last updated June 2018
+
+#pragma once
+
+#include <functional>
+
+#include "TaskGraph.h"
+#include "Tiles.h"
+
+class Mesh;				// Forward declarations to resolve circular dependency
+class Parameters;
+class VectorParticle;
+
+//! \class VectorTile
+//! \brief Create and manage a vector of Tiles objects covering a structured mesh
+class VectorTile
+{
+public:
+	// Data members
+	std::vector<Tiles> tiles;					//!< Vector of Tiles objects
+	std::vector<int> order;						//!< Tile indices, most heavily loaded first
+	std::vector<int> curveOrder;				//!< Tile indices along a Hilbert curve
+	std::vector<int> groupStart;				//!< First entry in curveOrder of each work group, and end (empty until balanced)
+	std::vector<double> groupTime;				//!< Time spent in each work group since last balance
+	int tileSize = 0;							//!< Width of tiles in cells, 0 if not tiled
+	bool binsValid = false;						//!< True while listOfParticles of each tile matches particleVector
+	int numTileColumns = 0;						//!< Number of columns of tiles
+	int numTileRows = 0;						//!< Number of rows of tiles
+
+
+	// Constructor/destructor
+	VectorTile();								//!< Default constructor
+	~VectorTile();								//!< Destructor
+
+
+	// Methods
+	void generateTiles(const Mesh *mesh, int tileSize,
+		bool periodicX1, bool periodicX2);		//!< Split mesh into tiles with local node maps
+	void binParticles(const Mesh *mesh, 
+		const VectorParticle *particlesVector);	//!< Sort particles into tiles by cell
+	void updateBins(const Mesh *mesh,
+		const VectorParticle *particlesVector);	//!< Sort particles into tiles if they have changed cell since last sorted
+	std::vector<int> addTasks(TaskGraph &graph,
+		std::function<void(Tiles &tile)> work);	//!< Add tasks applying work to every tile, returning task IDs
+	void balance(Parameters *parametersList, const Mesh *mesh,
+		VectorParticle *particlesVector, 
+		int numGroups);							//!< Partition tiles along Hilbert curve into groups of equal cost
+	static int hilbertIndex(int n, int x, int y);	//!< Distance along Hilbert curve of order n to point (x, y)
+};
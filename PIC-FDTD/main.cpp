@@ -3,6 +3,7 @@
 //! \author Rahul Kalampattel
 //! \date Last updated April 2018
 
+#include "Ensemble.h"
 #include "Simulation.h"
 
 int main()
@@ -15,8 +16,15 @@ int main()
 	{
 		parametersList.processMesh("PIC");
 
-		// Commence simulation
-		Simulation simulation(&parametersList);
+		// Commence simulation, or an ensemble of variations of it
+		if (parametersList.ensembleFile != "none")
+		{
+			Ensemble ensemble(&parametersList);
+		}
+		else
+		{
+			Simulation simulation(&parametersList);
+		}
 	}
 
 